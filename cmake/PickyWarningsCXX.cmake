@@ -33,7 +33,16 @@ if(CMAKE_COMPILER_IS_GNUCC OR CMAKE_COMPILER_IS_GNUCXX OR CMAKE_CXX_COMPILER_ID
   # WPICKY_ENABLE = Options we want to enable as-is.
   # WPICKY_DETECT = Options we want to test first and enable if available.
 
-  set(WPICKY_ENABLE "-Wall")
+  # Prefer the -Wextra alias with clang.
+  if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+    set(WPICKY_ENABLE "-Wextra")
+  else()
+    set(WPICKY_ENABLE "-W")
+  endif()
+
+  list(APPEND WPICKY_ENABLE
+    -Wall
+  )
 
   # ----------------------------------
   # Add new options here, if in doubt:
@@ -0,0 +1,2726 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2024 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <queue>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <getopt.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#endif // defined(__x86_64__) || defined(__i386__)
+
+#include <nghttp3/nghttp3.h>
+
+#include "template.h"
+
+namespace nghttp3 {
+
+namespace {
+// SimStreamType is the type of a stream which the network simulator
+// can apply its own link parameters to.
+enum class SimStreamType {
+  REQUEST,
+  CONTROL,
+  QPACK_ENCODER,
+  QPACK_DECODER,
+};
+} // namespace
+
+namespace {
+constexpr std::pair<SimStreamType, std::string_view> sim_stream_type_names[]{
+    {SimStreamType::REQUEST, "request"},
+    {SimStreamType::CONTROL, "control"},
+    {SimStreamType::QPACK_ENCODER, "qpack-encoder"},
+    {SimStreamType::QPACK_DECODER, "qpack-decoder"},
+};
+} // namespace
+
+namespace {
+// SimLinkParams is the parameters of a simulated link.
+struct SimLinkParams {
+  // delay is the one-way delay in microseconds.
+  uint64_t delay;
+  // jitter is the maximum additional delay in microseconds of each
+  // packet, which reorders packets across streams.
+  uint64_t jitter;
+  // loss is the packet loss rate in percent.
+  double loss;
+};
+} // namespace
+
+namespace {
+struct Config {
+  // nstreams is the number of concurrent request streams.
+  size_t nstreams;
+  // ncalls is the number of nghttp3_conn_writev_stream calls, or the
+  // number of batches to measure.
+  size_t ncalls;
+  // ntotal_streams is the number of streams which are opened and
+  // closed over a connection lifetime.
+  size_t ntotal_streams;
+  // file_size is the size of a file which the server serves.
+  uint64_t file_size;
+  // nrequests is the number of requests in each end-to-end scenario.
+  size_t nrequests;
+  // sim_seed is the seed of pseudo random numbers which the network
+  // simulator uses.
+  uint64_t sim_seed;
+  // sim_link is the parameters of the simulated network which apply
+  // to the streams that sim_stream_links does not cover.
+  SimLinkParams sim_link;
+  // sim_stream_links is the parameters of the simulated network for
+  // each stream type.
+  std::unordered_map<SimStreamType, SimLinkParams> sim_stream_links;
+} config{
+    10000,
+    1000000,
+    100000,
+    1_g,
+    100000,
+    1,
+    {
+        20000,
+        10000,
+        2.,
+    },
+    {},
+};
+} // namespace
+
+namespace {
+std::array<uint8_t, 1_k> body;
+} // namespace
+
+namespace {
+nghttp3_ssize read_data(nghttp3_conn *, int64_t, nghttp3_vec *vec, size_t,
+                        uint32_t *, void *, void *) {
+  vec[0].base = body.data();
+  vec[0].len = body.size();
+
+  return 1;
+}
+} // namespace
+
+namespace {
+// flush writes all data that |src| produces into |dest| as if they
+// were connected by a lossless transport.
+int flush(nghttp3_conn *src, nghttp3_conn *dest) {
+  std::array<nghttp3_vec, 16> vec;
+  std::vector<uint8_t> buf;
+
+  for (;;) {
+    int64_t stream_id;
+    int fin;
+
+    auto sveccnt = nghttp3_conn_writev_stream(src, &stream_id, &fin,
+                                              vec.data(), vec.size());
+    if (sveccnt < 0) {
+      std::cerr << "nghttp3_conn_writev_stream: " << nghttp3_strerror(sveccnt)
+                << std::endl;
+      return -1;
+    }
+
+    if (stream_id == -1) {
+      return 0;
+    }
+
+    buf.clear();
+
+    for (nghttp3_ssize i = 0; i < sveccnt; ++i) {
+      buf.insert(std::end(buf), vec[i].base, vec[i].base + vec[i].len);
+    }
+
+    auto nread = nghttp3_conn_read_stream(dest, stream_id, buf.data(),
+                                          buf.size(), fin);
+    if (nread < 0) {
+      std::cerr << "nghttp3_conn_read_stream: " << nghttp3_strerror(nread)
+                << std::endl;
+      return -1;
+    }
+
+    auto rv = nghttp3_conn_add_write_offset(src, stream_id, buf.size());
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_add_write_offset: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+  }
+}
+} // namespace
+
+namespace {
+struct SchedResult {
+  // nstreams is the number of distinct streams which wrote data.
+  size_t nstreams;
+  std::chrono::steady_clock::duration elapsed;
+};
+} // namespace
+
+namespace {
+// setup_server makes a client and a server connected with each other,
+// and lets the server respond to config.nstreams requests with
+// bodies which never end.  The caller must delete |*pclient| and
+// |*pserver| even if this function fails after creating them.
+int setup_server(nghttp3_conn **pclient, nghttp3_conn **pserver, int drr,
+                 int inc) {
+  *pclient = nullptr;
+  *pserver = nullptr;
+
+  auto mem = nghttp3_mem_default();
+
+  nghttp3_settings settings;
+  nghttp3_settings_default(&settings);
+  settings.enable_drr_scheduler = static_cast<uint8_t>(drr);
+
+  nghttp3_callbacks callbacks{};
+
+  auto rv = nghttp3_conn_client_new(pclient, &callbacks, &settings, mem,
+                                    nullptr);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_client_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto client = *pclient;
+
+  rv = nghttp3_conn_server_new(pserver, &callbacks, &settings, mem, nullptr);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_server_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto server = *pserver;
+
+  nghttp3_conn_set_max_client_streams_bidi(server, config.nstreams);
+
+  if (nghttp3_conn_bind_control_stream(client, 2) != 0 ||
+      nghttp3_conn_bind_qpack_streams(client, 6, 10) != 0 ||
+      nghttp3_conn_bind_control_stream(server, 3) != 0 ||
+      nghttp3_conn_bind_qpack_streams(server, 7, 11) != 0) {
+    std::cerr << "Could not bind streams" << std::endl;
+    return -1;
+  }
+
+  std::array<nghttp3_nv, 4> reqnva{
+      nghttp3_nv{(uint8_t *)":method", (uint8_t *)"GET", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":scheme", (uint8_t *)"https", 7, 5,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":authority", (uint8_t *)"example.com", 10, 11,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":path", (uint8_t *)"/", 5, 1,
+                 NGHTTP3_NV_FLAG_NONE},
+  };
+
+  for (size_t i = 0; i < config.nstreams; ++i) {
+    rv = nghttp3_conn_submit_request(client, static_cast<int64_t>(i * 4),
+                                     reqnva.data(), reqnva.size(), nullptr,
+                                     nullptr);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_submit_request: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+  }
+
+  if (flush(client, server) != 0) {
+    return -1;
+  }
+
+  std::array<nghttp3_nv, 1> respnva{
+      nghttp3_nv{(uint8_t *)":status", (uint8_t *)"200", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+  };
+
+  nghttp3_data_reader dr{read_data};
+  nghttp3_pri pri{NGHTTP3_DEFAULT_URGENCY, static_cast<uint8_t>(inc)};
+
+  for (size_t i = 0; i < config.nstreams; ++i) {
+    auto stream_id = static_cast<int64_t>(i * 4);
+
+    rv = nghttp3_conn_set_server_stream_priority(server, stream_id, &pri);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_set_server_stream_priority: "
+                << nghttp3_strerror(rv) << std::endl;
+      return -1;
+    }
+
+    rv = nghttp3_conn_submit_response(server, stream_id, respnva.data(),
+                                      respnva.size(), &dr);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_submit_response: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int bench_sched(SchedResult &res, int drr, int inc) {
+  nghttp3_conn *client, *server;
+
+  auto rv = setup_server(&client, &server, drr, inc);
+
+  auto clientd = defer(nghttp3_conn_del, client);
+  auto serverd = defer(nghttp3_conn_del, server);
+
+  if (rv != 0) {
+    return -1;
+  }
+
+  std::array<nghttp3_vec, 16> vec;
+  std::vector<uint8_t> seen(config.nstreams);
+
+  res = SchedResult{};
+
+  auto ts = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < config.ncalls; ++i) {
+    int64_t stream_id;
+    int fin;
+
+    auto sveccnt = nghttp3_conn_writev_stream(server, &stream_id, &fin,
+                                              vec.data(), vec.size());
+    if (sveccnt < 0) {
+      std::cerr << "nghttp3_conn_writev_stream: " << nghttp3_strerror(sveccnt)
+                << std::endl;
+      return -1;
+    }
+
+    if (stream_id == -1) {
+      break;
+    }
+
+    auto n = nghttp3_vec_len(vec.data(), static_cast<size_t>(sveccnt));
+
+    rv = nghttp3_conn_add_write_offset(server, stream_id, n);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_add_write_offset: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    // Pretend that the peer acknowledges everything immediately so
+    // that the stream buffers do not grow.
+    rv = nghttp3_conn_add_ack_offset(server, stream_id, n);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_add_ack_offset: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    if (stream_id % 4 == 0 &&
+        static_cast<size_t>(stream_id / 4) < config.nstreams &&
+        !seen[stream_id / 4]) {
+      seen[stream_id / 4] = 1;
+      ++res.nstreams;
+    }
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int run_sched() {
+  std::cout << std::setw(10) << "scheduler" << std::setw(14) << "incremental"
+            << std::setw(10) << "streams" << std::setw(12) << "calls"
+            << std::setw(12) << "ns/call" << std::setw(10) << "served"
+            << std::endl;
+
+  for (auto drr : {0, 1}) {
+    for (auto inc : {0, 1}) {
+      SchedResult res;
+
+      if (bench_sched(res, drr, inc) != 0) {
+        return -1;
+      }
+
+      auto ns =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(res.elapsed)
+              .count();
+
+      std::cout << std::setw(10) << (drr ? "drr" : "pq") << std::setw(14)
+                << (inc ? "yes" : "no") << std::setw(10) << config.nstreams
+                << std::setw(12) << config.ncalls << std::setw(12)
+                << std::fixed << std::setprecision(2)
+                << static_cast<double>(ns) /
+                       static_cast<double>(config.ncalls)
+                << std::setw(10) << res.nstreams << std::endl;
+    }
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// gso_batchlen is the number of bytes which a single UDP GSO send
+// carries.
+constexpr size_t gso_batchlen = 64_k;
+} // namespace
+
+namespace {
+struct BatchResult {
+  // nrecords is the number of stream records per batch.
+  double nrecords;
+  std::chrono::steady_clock::duration elapsed;
+};
+} // namespace
+
+namespace {
+// commit tells |server| that |n| bytes were sent to |stream_id| and
+// were acknowledged immediately so that the stream buffers do not
+// grow.
+int commit(nghttp3_conn *server, int64_t stream_id, size_t n) {
+  auto rv = nghttp3_conn_add_write_offset(server, stream_id, n);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_add_write_offset: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  rv = nghttp3_conn_add_ack_offset(server, stream_id, n);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_add_ack_offset: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// fill_batch_loop fills a batch by calling nghttp3_conn_writev_stream
+// repeatedly.
+nghttp3_ssize fill_batch_loop(nghttp3_conn *server) {
+  std::array<nghttp3_vec, 16> vec;
+  size_t left = gso_batchlen;
+  nghttp3_ssize nrecords = 0;
+
+  for (; left;) {
+    int64_t stream_id;
+    int fin;
+
+    auto sveccnt = nghttp3_conn_writev_stream(server, &stream_id, &fin,
+                                              vec.data(), vec.size());
+    if (sveccnt < 0) {
+      std::cerr << "nghttp3_conn_writev_stream: " << nghttp3_strerror(sveccnt)
+                << std::endl;
+      return -1;
+    }
+
+    if (stream_id == -1) {
+      break;
+    }
+
+    auto n = std::min(
+        static_cast<size_t>(
+            nghttp3_vec_len(vec.data(), static_cast<size_t>(sveccnt))),
+        left);
+
+    if (commit(server, stream_id, n) != 0) {
+      return -1;
+    }
+
+    left -= n;
+    ++nrecords;
+  }
+
+  return nrecords;
+}
+} // namespace
+
+namespace {
+// fill_batch_gather fills a batch by calling
+// nghttp3_conn_writev_streams once.
+nghttp3_ssize fill_batch_gather(nghttp3_conn *server) {
+  std::array<nghttp3_vec, 256> vec;
+  std::array<nghttp3_stream_vec, 128> svec;
+
+  auto nsvec = nghttp3_conn_writev_streams(server, svec.data(), svec.size(),
+                                           vec.data(), vec.size(),
+                                           gso_batchlen);
+  if (nsvec < 0) {
+    std::cerr << "nghttp3_conn_writev_streams: " << nghttp3_strerror(nsvec)
+              << std::endl;
+    return -1;
+  }
+
+  auto rv = nghttp3_conn_add_write_offsets(server, svec.data(),
+                                           static_cast<size_t>(nsvec));
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_add_write_offsets: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  for (nghttp3_ssize i = 0; i < nsvec; ++i) {
+    rv = nghttp3_conn_add_ack_offset(server, svec[i].stream_id,
+                                     svec[i].datalen);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_add_ack_offset: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+  }
+
+  return nsvec;
+}
+} // namespace
+
+namespace {
+int bench_batch(BatchResult &res, int gather, int inc) {
+  nghttp3_conn *client, *server;
+
+  auto rv = setup_server(&client, &server, /* drr = */ 1, inc);
+
+  auto clientd = defer(nghttp3_conn_del, client);
+  auto serverd = defer(nghttp3_conn_del, server);
+
+  if (rv != 0) {
+    return -1;
+  }
+
+  size_t nrecords = 0;
+
+  auto ts = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < config.ncalls; ++i) {
+    auto n = gather ? fill_batch_gather(server) : fill_batch_loop(server);
+    if (n < 0) {
+      return -1;
+    }
+
+    nrecords += static_cast<size_t>(n);
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+  res.nrecords =
+      static_cast<double>(nrecords) / static_cast<double>(config.ncalls);
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int run_batch() {
+  std::cout << std::setw(10) << "api" << std::setw(14) << "incremental"
+            << std::setw(10) << "streams" << std::setw(12) << "batches"
+            << std::setw(12) << "ns/batch" << std::setw(12) << "recs/batch"
+            << std::endl;
+
+  for (auto gather : {0, 1}) {
+    for (auto inc : {0, 1}) {
+      BatchResult res;
+
+      if (bench_batch(res, gather, inc) != 0) {
+        return -1;
+      }
+
+      auto ns =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(res.elapsed)
+              .count();
+
+      std::cout << std::setw(10) << (gather ? "gather" : "loop")
+                << std::setw(14) << (inc ? "yes" : "no") << std::setw(10)
+                << config.nstreams << std::setw(12) << config.ncalls
+                << std::setw(12) << std::fixed << std::setprecision(2)
+                << static_cast<double>(ns) /
+                       static_cast<double>(config.ncalls)
+                << std::setw(12) << res.nrecords << std::endl;
+    }
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+struct LifetimeResult {
+  std::chrono::steady_clock::duration elapsed;
+  // lookup is the time spent in stream lookups.
+  std::chrono::steady_clock::duration lookup;
+  size_t nlookups;
+};
+} // namespace
+
+namespace {
+// bench_lifetime opens and closes config.ntotal_streams streams over a
+// connection lifetime while keeping config.nstreams streams open.
+// Each time a stream is opened, it looks up random open streams.
+int bench_lifetime(LifetimeResult &res) {
+  constexpr size_t nlookups_per_stream = 16;
+
+  auto mem = nghttp3_mem_default();
+
+  nghttp3_settings settings;
+  nghttp3_settings_default(&settings);
+
+  nghttp3_callbacks callbacks{};
+
+  nghttp3_conn *client, *server;
+
+  auto rv = nghttp3_conn_client_new(&client, &callbacks, &settings, mem,
+                                    nullptr);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_client_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto clientd = defer(nghttp3_conn_del, client);
+
+  rv = nghttp3_conn_server_new(&server, &callbacks, &settings, mem, nullptr);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_server_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto serverd = defer(nghttp3_conn_del, server);
+
+  nghttp3_conn_set_max_client_streams_bidi(server, config.ntotal_streams);
+
+  if (nghttp3_conn_bind_control_stream(client, 2) != 0 ||
+      nghttp3_conn_bind_qpack_streams(client, 6, 10) != 0 ||
+      nghttp3_conn_bind_control_stream(server, 3) != 0 ||
+      nghttp3_conn_bind_qpack_streams(server, 7, 11) != 0) {
+    std::cerr << "Could not bind streams" << std::endl;
+    return -1;
+  }
+
+  std::array<nghttp3_nv, 4> reqnva{
+      nghttp3_nv{(uint8_t *)":method", (uint8_t *)"GET", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":scheme", (uint8_t *)"https", 7, 5,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":authority", (uint8_t *)"example.com", 10, 11,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":path", (uint8_t *)"/", 5, 1,
+                 NGHTTP3_NV_FLAG_NONE},
+  };
+  std::array<nghttp3_nv, 1> respnva{
+      nghttp3_nv{(uint8_t *)":status", (uint8_t *)"200", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+  };
+
+  auto nconcurrent = std::max(config.nstreams, static_cast<size_t>(1));
+  uint64_t rand = 0x9e3779b97f4a7c15u;
+
+  res = LifetimeResult{};
+
+  auto ts = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < config.ntotal_streams; ++i) {
+    auto stream_id = static_cast<int64_t>(i * 4);
+
+    rv = nghttp3_conn_submit_request(client, stream_id, reqnva.data(),
+                                     reqnva.size(), nullptr, nullptr);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_submit_request: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    if (flush(client, server) != 0) {
+      return -1;
+    }
+
+    rv = nghttp3_conn_submit_response(server, stream_id, respnva.data(),
+                                      respnva.size(), nullptr);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_submit_response: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    if (flush(server, client) != 0) {
+      return -1;
+    }
+
+    auto nopen = std::min(i + 1, nconcurrent);
+
+    auto lts = std::chrono::steady_clock::now();
+
+    for (size_t j = 0; j < nlookups_per_stream; ++j) {
+      // xorshift64
+      rand ^= rand << 13;
+      rand ^= rand >> 7;
+      rand ^= rand << 17;
+
+      auto id = static_cast<int64_t>((i - rand % nopen) * 4);
+
+      rv = nghttp3_conn_set_stream_user_data(server, id, nullptr);
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_set_stream_user_data: "
+                  << nghttp3_strerror(rv) << std::endl;
+        return -1;
+      }
+    }
+
+    res.lookup += std::chrono::steady_clock::now() - lts;
+    res.nlookups += nlookups_per_stream;
+
+    if (i + 1 < nconcurrent) {
+      continue;
+    }
+
+    auto close_id = static_cast<int64_t>((i + 1 - nconcurrent) * 4);
+
+    rv = nghttp3_conn_close_stream(server, close_id, NGHTTP3_H3_NO_ERROR);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_close_stream: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    rv = nghttp3_conn_close_stream(client, close_id, NGHTTP3_H3_NO_ERROR);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_close_stream: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int run_lifetime() {
+  LifetimeResult res;
+
+  if (bench_lifetime(res) != 0) {
+    return -1;
+  }
+
+  auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(res.elapsed).count();
+  auto lookup_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(res.lookup).count();
+
+  std::cout << std::setw(10) << "streams" << std::setw(12) << "concurrent"
+            << std::setw(14) << "ns/stream" << std::setw(12) << "lookups"
+            << std::setw(12) << "ns/lookup" << std::endl;
+
+  std::cout << std::setw(10) << config.ntotal_streams << std::setw(12)
+            << config.nstreams << std::setw(14) << std::fixed
+            << std::setprecision(2)
+            << static_cast<double>(ns) /
+                   static_cast<double>(config.ntotal_streams)
+            << std::setw(12) << res.nlookups << std::setw(12)
+            << static_cast<double>(lookup_ns) /
+                   static_cast<double>(res.nlookups)
+            << std::endl;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// app_segmentlen is the number of bytes which the application reads
+// from a file at once when it buffers a response body by itself.
+constexpr size_t app_segmentlen = 64_k;
+} // namespace
+
+namespace {
+struct Segment {
+  std::unique_ptr<uint8_t[]> data;
+  size_t len;
+};
+} // namespace
+
+namespace {
+// AppFileBody is a response body which the application reads from a
+// file into its own buffers.
+struct AppFileBody {
+  int fd;
+  int64_t offset;
+  uint64_t left;
+  // segments is the buffers which are not acknowledged yet.
+  std::deque<Segment> segments;
+  // nacked is the number of acknowledged bytes in the first element
+  // of segments.
+  size_t nacked;
+};
+} // namespace
+
+namespace {
+nghttp3_ssize read_app_file_data(nghttp3_conn *, int64_t, nghttp3_vec *vec,
+                                 size_t, uint32_t *pflags, void *,
+                                 void *stream_user_data) {
+  auto body = static_cast<AppFileBody *>(stream_user_data);
+
+  if (body->left == 0) {
+    *pflags |= NGHTTP3_DATA_FLAG_EOF;
+    return 0;
+  }
+
+  auto len =
+      static_cast<size_t>(std::min(body->left, uint64_t{app_segmentlen}));
+  auto &seg = body->segments.emplace_back(
+      Segment{std::unique_ptr<uint8_t[]>(new uint8_t[len]), len});
+
+  for (size_t nread = 0; nread < len;) {
+    auto n = pread(body->fd, seg.data.get() + nread, len - nread,
+                   body->offset + static_cast<off_t>(nread));
+    if (n <= 0) {
+      return NGHTTP3_ERR_CALLBACK_FAILURE;
+    }
+
+    nread += static_cast<size_t>(n);
+  }
+
+  body->offset += static_cast<int64_t>(len);
+  body->left -= len;
+
+  if (body->left == 0) {
+    *pflags |= NGHTTP3_DATA_FLAG_EOF;
+  }
+
+  vec[0].base = seg.data.get();
+  vec[0].len = len;
+
+  return 1;
+}
+} // namespace
+
+namespace {
+int acked_app_file_data(nghttp3_conn *, int64_t, uint64_t datalen, void *,
+                        void *stream_user_data) {
+  auto body = static_cast<AppFileBody *>(stream_user_data);
+
+  body->nacked += static_cast<size_t>(datalen);
+
+  for (; !body->segments.empty() &&
+         body->nacked >= body->segments.front().len;) {
+    body->nacked -= body->segments.front().len;
+    body->segments.pop_front();
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// transfer writes all data that |src| produces into |dest| as if they
+// were connected by a lossless transport which acknowledges data
+// immediately.  It adds the number of bytes written to |*pnwrite|.
+int transfer(nghttp3_conn *src, nghttp3_conn *dest, uint64_t *pnwrite) {
+  std::array<nghttp3_vec, 16> vec;
+  std::vector<uint8_t> buf;
+
+  for (;;) {
+    int64_t stream_id;
+    int fin;
+
+    auto sveccnt = nghttp3_conn_writev_stream(src, &stream_id, &fin,
+                                              vec.data(), vec.size());
+    if (sveccnt < 0) {
+      std::cerr << "nghttp3_conn_writev_stream: " << nghttp3_strerror(sveccnt)
+                << std::endl;
+      return -1;
+    }
+
+    if (stream_id == -1) {
+      return 0;
+    }
+
+    buf.clear();
+
+    for (nghttp3_ssize i = 0; i < sveccnt; ++i) {
+      buf.insert(std::end(buf), vec[i].base, vec[i].base + vec[i].len);
+    }
+
+    auto nread = nghttp3_conn_read_stream(dest, stream_id, buf.data(),
+                                          buf.size(), fin);
+    if (nread < 0) {
+      std::cerr << "nghttp3_conn_read_stream: " << nghttp3_strerror(nread)
+                << std::endl;
+      return -1;
+    }
+
+    auto rv = nghttp3_conn_add_write_offset(src, stream_id, buf.size());
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_add_write_offset: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    rv = nghttp3_conn_add_ack_offset(src, stream_id, buf.size());
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_add_ack_offset: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    *pnwrite += buf.size();
+  }
+}
+} // namespace
+
+namespace {
+struct FileResult {
+  // nwrite is the number of bytes that server wrote.
+  uint64_t nwrite;
+  std::chrono::steady_clock::duration elapsed;
+};
+} // namespace
+
+namespace {
+// bench_file serves the file denoted by |fd| of config.file_size
+// bytes over a client and a server connected with each other.  If
+// |lib| is nonzero, the library reads the file with
+// nghttp3_conn_submit_response_file.  Otherwise, the application
+// reads the file into its own buffers.
+int bench_file(FileResult &res, int fd, int lib) {
+  auto mem = nghttp3_mem_default();
+
+  nghttp3_settings settings;
+  nghttp3_settings_default(&settings);
+
+  nghttp3_callbacks callbacks{};
+
+  nghttp3_conn *client, *server;
+
+  auto rv = nghttp3_conn_client_new(&client, &callbacks, &settings, mem,
+                                    nullptr);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_client_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto clientd = defer(nghttp3_conn_del, client);
+
+  callbacks.acked_stream_data = acked_app_file_data;
+
+  rv = nghttp3_conn_server_new(&server, &callbacks, &settings, mem, nullptr);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_server_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto serverd = defer(nghttp3_conn_del, server);
+
+  nghttp3_conn_set_max_client_streams_bidi(server, 1);
+
+  if (nghttp3_conn_bind_control_stream(client, 2) != 0 ||
+      nghttp3_conn_bind_qpack_streams(client, 6, 10) != 0 ||
+      nghttp3_conn_bind_control_stream(server, 3) != 0 ||
+      nghttp3_conn_bind_qpack_streams(server, 7, 11) != 0) {
+    std::cerr << "Could not bind streams" << std::endl;
+    return -1;
+  }
+
+  std::array<nghttp3_nv, 4> reqnva{
+      nghttp3_nv{(uint8_t *)":method", (uint8_t *)"GET", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":scheme", (uint8_t *)"https", 7, 5,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":authority", (uint8_t *)"example.com", 10, 11,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":path", (uint8_t *)"/", 5, 1,
+                 NGHTTP3_NV_FLAG_NONE},
+  };
+  std::array<nghttp3_nv, 1> respnva{
+      nghttp3_nv{(uint8_t *)":status", (uint8_t *)"200", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+  };
+
+  rv = nghttp3_conn_submit_request(client, 0, reqnva.data(), reqnva.size(),
+                                   nullptr, nullptr);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_submit_request: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  if (flush(client, server) != 0) {
+    return -1;
+  }
+
+  AppFileBody body{fd, 0, config.file_size, {}, 0};
+
+  auto ts = std::chrono::steady_clock::now();
+
+  if (lib) {
+    rv = nghttp3_conn_submit_response_file(server, 0, respnva.data(),
+                                           respnva.size(), fd, 0,
+                                           config.file_size);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_submit_response_file: "
+                << nghttp3_strerror(rv) << std::endl;
+      return -1;
+    }
+  } else {
+    rv = nghttp3_conn_set_stream_user_data(server, 0, &body);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_set_stream_user_data: "
+                << nghttp3_strerror(rv) << std::endl;
+      return -1;
+    }
+
+    nghttp3_data_reader dr{read_app_file_data};
+
+    rv = nghttp3_conn_submit_response(server, 0, respnva.data(),
+                                      respnva.size(), &dr);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_submit_response: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+  }
+
+  res.nwrite = 0;
+
+  if (transfer(server, client, &res.nwrite) != 0) {
+    return -1;
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int run_file() {
+  auto fp = tmpfile();
+  if (fp == nullptr) {
+    std::cerr << "tmpfile: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  auto fpd = defer(fclose, fp);
+
+  std::vector<uint8_t> buf(1_m);
+
+  for (size_t i = 0; i < buf.size(); ++i) {
+    buf[i] = static_cast<uint8_t>(i);
+  }
+
+  for (uint64_t left = config.file_size; left;) {
+    auto len = static_cast<size_t>(std::min(left, uint64_t{buf.size()}));
+
+    if (fwrite(buf.data(), 1, len, fp) != len) {
+      std::cerr << "fwrite: " << strerror(errno) << std::endl;
+      return -1;
+    }
+
+    left -= len;
+  }
+
+  if (fflush(fp) != 0) {
+    std::cerr << "fflush: " << strerror(errno) << std::endl;
+    return -1;
+  }
+
+  std::cout << std::setw(10) << "reader" << std::setw(14) << "file bytes"
+            << std::setw(14) << "wire bytes" << std::setw(12) << "ms"
+            << std::setw(12) << "MiB/s" << std::endl;
+
+  for (auto lib : {0, 1}) {
+    FileResult res;
+
+    if (bench_file(res, fileno(fp), lib) != 0) {
+      return -1;
+    }
+
+    auto ms =
+        std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+            res.elapsed)
+            .count();
+
+    std::cout << std::setw(10) << (lib ? "library" : "app")
+              << std::setw(14) << config.file_size << std::setw(14)
+              << res.nwrite << std::setw(12) << std::fixed
+              << std::setprecision(2) << ms << std::setw(12)
+              << static_cast<double>(config.file_size) / 1_m / (ms / 1000)
+              << std::endl;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+struct AllocCounter {
+  size_t nalloc;
+};
+} // namespace
+
+namespace {
+void *counting_malloc(size_t size, void *user_data) {
+  ++static_cast<AllocCounter *>(user_data)->nalloc;
+  return malloc(size);
+}
+} // namespace
+
+namespace {
+void counting_free(void *ptr, void *) { free(ptr); }
+} // namespace
+
+namespace {
+void *counting_calloc(size_t nmemb, size_t size, void *user_data) {
+  ++static_cast<AllocCounter *>(user_data)->nalloc;
+  return calloc(nmemb, size);
+}
+} // namespace
+
+namespace {
+void *counting_realloc(void *ptr, size_t size, void *user_data) {
+  ++static_cast<AllocCounter *>(user_data)->nalloc;
+  return realloc(ptr, size);
+}
+} // namespace
+
+namespace {
+// read_cycles returns the value of CPU time stamp counter, or 0 if
+// it is not available.
+uint64_t read_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else  // !(defined(__x86_64__) || defined(__i386__))
+  return 0;
+#endif // !(defined(__x86_64__) || defined(__i386__))
+}
+} // namespace
+
+namespace {
+std::array<uint8_t, 16_k> e2e_body;
+} // namespace
+
+namespace {
+struct E2EScenario {
+  std::string_view name;
+  // nrequests is the number of requests.
+  size_t nrequests;
+  // nconcurrent is the number of requests which are in flight at
+  // once.
+  size_t nconcurrent;
+  // bodylen is the length of each response body.
+  uint64_t bodylen;
+  // heavy is true if requests and responses carry many header
+  // fields.
+  bool heavy;
+};
+} // namespace
+
+namespace {
+struct E2EResult {
+  // nbody is the number of response body bytes that client received.
+  uint64_t nbody;
+  // nwrite is the number of bytes that client and server wrote.
+  uint64_t nwrite;
+  // nalloc is the number of memory allocations.
+  size_t nalloc;
+  uint64_t cycles;
+  std::chrono::steady_clock::duration elapsed;
+};
+} // namespace
+
+namespace {
+nghttp3_ssize read_e2e_data(nghttp3_conn *, int64_t, nghttp3_vec *vec, size_t,
+                            uint32_t *pflags, void *, void *stream_user_data) {
+  auto left = static_cast<uint64_t *>(stream_user_data);
+  auto len = std::min(*left, uint64_t{e2e_body.size()});
+
+  *left -= len;
+
+  if (*left == 0) {
+    *pflags |= NGHTTP3_DATA_FLAG_EOF;
+  }
+
+  if (len == 0) {
+    return 0;
+  }
+
+  vec[0].base = e2e_body.data();
+  vec[0].len = static_cast<size_t>(len);
+
+  return 1;
+}
+} // namespace
+
+namespace {
+int recv_e2e_data(nghttp3_conn *, int64_t, const uint8_t *, size_t datalen,
+                  void *conn_user_data, void *) {
+  static_cast<E2EResult *>(conn_user_data)->nbody += datalen;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+nghttp3_nv make_nv(const std::string_view &name,
+                   const std::string_view &value) {
+  return nghttp3_nv{(uint8_t *)name.data(), (uint8_t *)value.data(),
+                    name.size(), value.size(), NGHTTP3_NV_FLAG_NONE};
+}
+} // namespace
+
+namespace {
+// heavy_reqnva and heavy_respnva are the header fields which a
+// browser and a web server typically send in addition to the
+// mandatory ones.
+const nghttp3_nv heavy_reqnva[] = {
+    make_nv("user-agent", "Mozilla/5.0 (X11; Linux x86_64; rv:128.0) "
+                          "Gecko/20100101 Firefox/128.0"),
+    make_nv("accept", "text/html,application/xhtml+xml,application/"
+                      "xml;q=0.9,*/*;q=0.8"),
+    make_nv("accept-language", "en-US,en;q=0.5"),
+    make_nv("accept-encoding", "gzip, deflate, br, zstd"),
+    make_nv("referer", "https://example.com/index.html"),
+    make_nv("cookie", "session=4b1e9a2c7d3f4e6a8b0c1d2e3f405162"),
+    make_nv("cookie", "prefs=theme%3Ddark%26lang%3Den"),
+    make_nv("sec-fetch-dest", "script"),
+    make_nv("sec-fetch-mode", "no-cors"),
+    make_nv("sec-fetch-site", "same-origin"),
+    make_nv("priority", "u=2"),
+    make_nv("cache-control", "no-cache"),
+    make_nv("pragma", "no-cache"),
+    make_nv("te", "trailers"),
+};
+
+const nghttp3_nv heavy_respnva[] = {
+    make_nv("content-type", "application/javascript"),
+    make_nv("server", "nghttp3"),
+    make_nv("date", "Sun, 18 Oct 2026 00:00:00 GMT"),
+    make_nv("cache-control", "public, max-age=31536000, immutable"),
+    make_nv("etag", "\"5f3a1c9e-2b41\""),
+    make_nv("last-modified", "Sat, 17 Oct 2026 00:00:00 GMT"),
+    make_nv("vary", "accept-encoding"),
+    make_nv("x-content-type-options", "nosniff"),
+    make_nv("strict-transport-security", "max-age=31536000; includesubdomains"),
+    make_nv("alt-svc", "h3=\":443\"; ma=86400"),
+    make_nv("access-control-allow-origin", "*"),
+    make_nv("timing-allow-origin", "*"),
+};
+} // namespace
+
+namespace {
+// bench_e2e runs |sc| over a client and a server which are connected
+// back-to-back with a lossless transport that acknowledges data
+// immediately.  The client sends |sc|.nconcurrent requests at once,
+// and closes them after it receives the responses.
+int bench_e2e(E2EResult &res, const E2EScenario &sc) {
+  AllocCounter counter{};
+  nghttp3_mem mem{&counter, counting_malloc, counting_free, counting_calloc,
+                  counting_realloc};
+
+  nghttp3_settings settings;
+  nghttp3_settings_default(&settings);
+  settings.qpack_max_dtable_capacity = 4_k;
+  settings.qpack_blocked_streams = 100;
+
+  nghttp3_callbacks callbacks{};
+  callbacks.recv_data = recv_e2e_data;
+
+  nghttp3_conn *client, *server;
+
+  res = E2EResult{};
+
+  auto rv =
+      nghttp3_conn_client_new(&client, &callbacks, &settings, &mem, &res);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_client_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto clientd = defer(nghttp3_conn_del, client);
+
+  callbacks.recv_data = nullptr;
+
+  rv = nghttp3_conn_server_new(&server, &callbacks, &settings, &mem, nullptr);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_server_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto serverd = defer(nghttp3_conn_del, server);
+
+  nghttp3_conn_set_max_client_streams_bidi(server, sc.nrequests);
+  nghttp3_conn_set_max_concurrent_streams(client, sc.nconcurrent);
+  nghttp3_conn_set_max_concurrent_streams(server, sc.nconcurrent);
+
+  if (nghttp3_conn_bind_control_stream(client, 2) != 0 ||
+      nghttp3_conn_bind_qpack_streams(client, 6, 10) != 0 ||
+      nghttp3_conn_bind_control_stream(server, 3) != 0 ||
+      nghttp3_conn_bind_qpack_streams(server, 7, 11) != 0) {
+    std::cerr << "Could not bind streams" << std::endl;
+    return -1;
+  }
+
+  std::array<uint8_t, 32> path;
+  std::vector<nghttp3_nv> reqnva{
+      nghttp3_nv{(uint8_t *)":method", (uint8_t *)"GET", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":scheme", (uint8_t *)"https", 7, 5,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":authority", (uint8_t *)"example.com", 10, 11,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":path", path.data(), 5, 0, NGHTTP3_NV_FLAG_NONE},
+  };
+  std::vector<nghttp3_nv> respnva{
+      nghttp3_nv{(uint8_t *)":status", (uint8_t *)"200", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+  };
+
+  if (sc.heavy) {
+    reqnva.insert(std::end(reqnva), std::begin(heavy_reqnva),
+                  std::end(heavy_reqnva));
+    respnva.insert(std::end(respnva), std::begin(heavy_respnva),
+                   std::end(heavy_respnva));
+  }
+
+  nghttp3_data_reader dr{read_e2e_data};
+  std::vector<uint64_t> left(std::max(sc.nconcurrent, size_t{1}));
+
+  counter.nalloc = 0;
+
+  auto cts = read_cycles();
+  auto ts = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < sc.nrequests;) {
+    auto n = std::min(left.size(), sc.nrequests - i);
+
+    for (size_t j = 0; j < n; ++j) {
+      auto stream_id = static_cast<int64_t>((i + j) * 4);
+
+      reqnva[3].valuelen = static_cast<size_t>(
+          snprintf(reinterpret_cast<char *>(path.data()), path.size(),
+                   "/assets/%zu.js", (i + j) % 100));
+
+      rv = nghttp3_conn_submit_request(client, stream_id, reqnva.data(),
+                                       reqnva.size(), nullptr, nullptr);
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_submit_request: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+    }
+
+    if (transfer(client, server, &res.nwrite) != 0) {
+      return -1;
+    }
+
+    for (size_t j = 0; j < n; ++j) {
+      auto stream_id = static_cast<int64_t>((i + j) * 4);
+
+      left[j] = sc.bodylen;
+
+      rv = nghttp3_conn_set_stream_user_data(server, stream_id, &left[j]);
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_set_stream_user_data: "
+                  << nghttp3_strerror(rv) << std::endl;
+        return -1;
+      }
+
+      rv = nghttp3_conn_submit_response(server, stream_id, respnva.data(),
+                                        respnva.size(), &dr);
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_submit_response: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+    }
+
+    if (transfer(server, client, &res.nwrite) != 0) {
+      return -1;
+    }
+
+    for (size_t j = 0; j < n; ++j) {
+      auto stream_id = static_cast<int64_t>((i + j) * 4);
+
+      rv = nghttp3_conn_close_stream(server, stream_id, NGHTTP3_H3_NO_ERROR);
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_close_stream: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+
+      rv = nghttp3_conn_close_stream(client, stream_id, NGHTTP3_H3_NO_ERROR);
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_close_stream: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+    }
+
+    i += n;
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+  res.cycles = read_cycles() - cts;
+  res.nalloc = counter.nalloc;
+
+  if (res.nbody != sc.bodylen * sc.nrequests) {
+    std::cerr << "Response body length mismatch: want "
+              << sc.bodylen * sc.nrequests << ", got " << res.nbody
+              << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int run_e2e() {
+  std::array<E2EScenario, 4> scenarios{
+      E2EScenario{"small", config.nrequests, 1, 1_k, false},
+      E2EScenario{"large", std::max(config.nrequests / 10000, size_t{1}), 1,
+                  100_m, false},
+      E2EScenario{"concurrent", config.nrequests, config.nstreams, 1_k,
+                  false},
+      E2EScenario{"headers", config.nrequests, 1, 1_k, true},
+  };
+
+  std::cout << std::setw(12) << "scenario" << std::setw(10) << "requests"
+            << std::setw(12) << "concurrent" << std::setw(12) << "body"
+            << std::setw(12) << "req/s" << std::setw(12) << "MiB/s"
+            << std::setw(12) << "allocs/req" << std::setw(10) << "cycles/B"
+            << std::endl;
+
+  for (auto &sc : scenarios) {
+    E2EResult res;
+
+    if (bench_e2e(res, sc) != 0) {
+      return -1;
+    }
+
+    auto secs =
+        std::chrono::duration_cast<std::chrono::duration<double>>(res.elapsed)
+            .count();
+
+    std::cout << std::setw(12) << sc.name << std::setw(10) << sc.nrequests
+              << std::setw(12) << sc.nconcurrent << std::setw(12)
+              << sc.bodylen << std::setw(12) << std::fixed
+              << std::setprecision(0)
+              << static_cast<double>(sc.nrequests) / secs << std::setw(12)
+              << std::setprecision(2)
+              << static_cast<double>(res.nbody) / 1_m / secs << std::setw(12)
+              << static_cast<double>(res.nalloc) /
+                     static_cast<double>(sc.nrequests)
+              << std::setw(10);
+
+    if (res.cycles) {
+      std::cout << static_cast<double>(res.cycles) /
+                       static_cast<double>(res.nwrite);
+    } else {
+      std::cout << "-";
+    }
+
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// sim_packetlen is the maximum number of bytes of stream data which
+// a simulated packet carries.
+constexpr size_t sim_packetlen = 1200;
+// sim_request_interval is the interval in microseconds between the
+// requests which the simulated client sends.
+constexpr uint64_t sim_request_interval = 1000;
+} // namespace
+
+namespace {
+struct SimPacket {
+  // ts is the time in microseconds when the packet is delivered.
+  uint64_t ts;
+  // seq is the sequence number to break ties.
+  uint64_t seq;
+  int64_t stream_id;
+  std::vector<uint8_t> data;
+  bool fin;
+};
+} // namespace
+
+namespace {
+struct SimPacketGreater {
+  bool operator()(const SimPacket &lhs, const SimPacket &rhs) const {
+    return lhs.ts > rhs.ts || (lhs.ts == rhs.ts && lhs.seq > rhs.seq);
+  }
+};
+} // namespace
+
+namespace {
+// SimEndpoint is the receiving side of a simulated direction, and
+// the client or the server which owns it.
+struct SimEndpoint {
+  nghttp3_conn *conn;
+  // now points to the current simulated time.
+  const uint64_t *now;
+  // buffered is the number of bytes of each request stream which the
+  // library buffers because the stream is blocked by QPACK decoder.
+  std::vector<uint64_t> buffered;
+  // blocked_since is the time when each request stream is blocked.
+  std::vector<uint64_t> blocked_since;
+  // ttfh is the time when each request stream was opened, and then
+  // the time until its header fields are decoded.  It is only used
+  // by client.
+  std::vector<uint64_t> ttfh;
+  // nbuffered is the total number of buffered bytes.
+  uint64_t nbuffered;
+  uint64_t max_nbuffered;
+  // nblocked is the number of the streams which are blocked now.
+  size_t nblocked;
+  size_t max_nblocked;
+  // nblocked_total is the number of the streams which have been
+  // blocked.
+  size_t nblocked_total;
+  // blocked_time is the sum of the time that streams are blocked.
+  uint64_t blocked_time;
+  // headers_done is the list of the streams whose header fields have
+  // been decoded since it was last cleared.
+  std::vector<int64_t> headers_done;
+  // finished is the list of the streams which have been finished
+  // since it was last cleared.
+  std::vector<int64_t> finished;
+};
+} // namespace
+
+namespace {
+void sim_unblock(SimEndpoint *ep, int64_t stream_id, uint64_t consumed) {
+  auto idx = static_cast<size_t>(stream_id / 4);
+
+  assert(ep->buffered[idx] >= consumed);
+
+  ep->buffered[idx] -= consumed;
+  ep->nbuffered -= consumed;
+
+  if (ep->buffered[idx] == 0) {
+    --ep->nblocked;
+    ep->blocked_time += *ep->now - ep->blocked_since[idx];
+  }
+}
+} // namespace
+
+namespace {
+int sim_deferred_consume(nghttp3_conn *, int64_t stream_id, size_t consumed,
+                         void *conn_user_data, void *) {
+  sim_unblock(static_cast<SimEndpoint *>(conn_user_data), stream_id, consumed);
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int sim_end_headers(nghttp3_conn *, int64_t stream_id, int,
+                    void *conn_user_data, void *) {
+  auto ep = static_cast<SimEndpoint *>(conn_user_data);
+  auto idx = static_cast<size_t>(stream_id / 4);
+
+  ep->ttfh[idx] = *ep->now - ep->ttfh[idx];
+  ep->headers_done.push_back(stream_id);
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int sim_end_stream(nghttp3_conn *, int64_t stream_id, void *conn_user_data,
+                   void *) {
+  static_cast<SimEndpoint *>(conn_user_data)->finished.push_back(stream_id);
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// sim_stream_type returns the type of a stream denoted by
+// |stream_id|.  bench_sim binds control stream, QPACK encoder stream,
+// and QPACK decoder stream to the first three unidirectional streams
+// of each endpoint in this order.
+SimStreamType sim_stream_type(int64_t stream_id) {
+  if ((stream_id & 0x2) == 0) {
+    return SimStreamType::REQUEST;
+  }
+
+  switch (stream_id / 4) {
+  case 0:
+    return SimStreamType::CONTROL;
+  case 1:
+    return SimStreamType::QPACK_ENCODER;
+  default:
+    return SimStreamType::QPACK_DECODER;
+  }
+}
+} // namespace
+
+namespace {
+// sim_link_params returns the parameters of the simulated network
+// which apply to a stream denoted by |stream_id|.
+const SimLinkParams &sim_link_params(int64_t stream_id) {
+  auto it = config.sim_stream_links.find(sim_stream_type(stream_id));
+  if (it == std::end(config.sim_stream_links)) {
+    return config.sim_link;
+  }
+
+  return (*it).second;
+}
+} // namespace
+
+namespace {
+// SimLink is a unidirectional lossy link which delivers stream data
+// in order within each stream, but not across streams.
+class SimLink {
+public:
+  SimLink(uint64_t *rand) : rand_(rand), seq_(0) {}
+
+  // send splits the data that |src| produces into packets, and
+  // schedules their delivery.  It returns the number of bytes sent.
+  nghttp3_ssize send(nghttp3_conn *src, uint64_t now) {
+    std::array<nghttp3_vec, 16> vec;
+    std::vector<uint8_t> buf;
+    uint64_t nsent = 0;
+
+    for (;;) {
+      int64_t stream_id;
+      int fin;
+
+      auto sveccnt = nghttp3_conn_writev_stream(src, &stream_id, &fin,
+                                                vec.data(), vec.size());
+      if (sveccnt < 0) {
+        std::cerr << "nghttp3_conn_writev_stream: "
+                  << nghttp3_strerror(sveccnt) << std::endl;
+        return -1;
+      }
+
+      if (stream_id == -1) {
+        return static_cast<nghttp3_ssize>(nsent);
+      }
+
+      buf.clear();
+
+      for (nghttp3_ssize i = 0; i < sveccnt; ++i) {
+        buf.insert(std::end(buf), vec[i].base, vec[i].base + vec[i].len);
+      }
+
+      auto rv = nghttp3_conn_add_write_offset(src, stream_id, buf.size());
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_add_write_offset: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+
+      // The link keeps the copy of data until it is delivered.
+      rv = nghttp3_conn_add_ack_offset(src, stream_id, buf.size());
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_add_ack_offset: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+
+      nsent += buf.size();
+
+      for (size_t off = 0;;) {
+        auto len = std::min(sim_packetlen, buf.size() - off);
+        auto last = off + len == buf.size();
+
+        schedule(now, stream_id,
+                 std::vector<uint8_t>(std::begin(buf) + off,
+                                      std::begin(buf) + off + len),
+                 last && fin);
+
+        off += len;
+
+        if (last) {
+          break;
+        }
+      }
+    }
+  }
+
+  bool empty() const { return queue_.empty(); }
+
+  uint64_t next_ts() const { return queue_.top().ts; }
+
+  SimPacket pop() {
+    auto pkt = queue_.top();
+    queue_.pop();
+    return pkt;
+  }
+
+private:
+  uint64_t next_rand() {
+    // xorshift64
+    *rand_ ^= *rand_ << 13;
+    *rand_ ^= *rand_ >> 7;
+    *rand_ ^= *rand_ << 17;
+
+    return *rand_;
+  }
+
+  void schedule(uint64_t now, int64_t stream_id, std::vector<uint8_t> data,
+                bool fin) {
+    auto &params = sim_link_params(stream_id);
+    auto ts = now + params.delay;
+
+    if (params.jitter) {
+      ts += next_rand() % (params.jitter + 1);
+    }
+
+    // A lost packet is retransmitted after a probe timeout, and it
+    // might be lost again.
+    while (static_cast<double>(next_rand() % 1000000) < params.loss * 10000) {
+      ts += params.delay * 3;
+    }
+
+    // Stream data is delivered in order.
+    auto &last_ts = last_ts_[stream_id];
+    ts = std::max(ts, last_ts);
+    last_ts = ts;
+
+    queue_.push(SimPacket{ts, seq_++, stream_id, std::move(data), fin});
+  }
+
+  uint64_t *rand_;
+  uint64_t seq_;
+  std::priority_queue<SimPacket, std::vector<SimPacket>, SimPacketGreater>
+      queue_;
+  std::unordered_map<int64_t, uint64_t> last_ts_;
+};
+} // namespace
+
+namespace {
+// sim_deliver delivers |pkt| to |ep|, and records the bytes which the
+// library buffers because of QPACK blocking.
+int sim_deliver(SimEndpoint &ep, const SimPacket &pkt) {
+  auto nread = nghttp3_conn_read_stream(ep.conn, pkt.stream_id,
+                                        pkt.data.data(), pkt.data.size(),
+                                        pkt.fin);
+  if (nread < 0) {
+    std::cerr << "nghttp3_conn_read_stream: " << nghttp3_strerror(nread)
+              << std::endl;
+    return -1;
+  }
+
+  // Neither requests nor responses have body, so the data which is
+  // not consumed is buffered.
+  auto nbuffered = pkt.data.size() - static_cast<size_t>(nread);
+  if (nbuffered == 0) {
+    return 0;
+  }
+
+  auto idx = static_cast<size_t>(pkt.stream_id / 4);
+
+  if (ep.buffered[idx] == 0) {
+    ep.blocked_since[idx] = *ep.now;
+    ++ep.nblocked_total;
+    ep.max_nblocked = std::max(ep.max_nblocked, ++ep.nblocked);
+  }
+
+  ep.buffered[idx] += nbuffered;
+  ep.nbuffered += nbuffered;
+  ep.max_nbuffered = std::max(ep.max_nbuffered, ep.nbuffered);
+
+  return 0;
+}
+} // namespace
+
+namespace {
+struct SimResult {
+  // ttfh is the time until the header fields of each response are
+  // decoded since the request was sent.
+  std::vector<uint64_t> ttfh;
+  // nblocked is the number of the streams which client and server
+  // found blocked.
+  size_t nblocked;
+  // max_nblocked is the maximum number of the streams which are
+  // blocked at the same time on either endpoint.
+  size_t max_nblocked;
+  // max_nbuffered is the maximum number of bytes which are buffered
+  // for the blocked streams on either endpoint.
+  uint64_t max_nbuffered;
+  // blocked_time is the sum of the time that streams are blocked.
+  uint64_t blocked_time;
+  // nwrite is the number of bytes that client and server wrote.
+  uint64_t nwrite;
+};
+} // namespace
+
+namespace {
+// bench_sim sends config.nrequests requests over a client and a
+// server connected with each other by simulated lossy links.  The
+// both endpoints use |dtable_capacity| and |blocked_streams| for
+// QPACK.
+int bench_sim(SimResult &res, size_t dtable_capacity, size_t blocked_streams) {
+  auto mem = nghttp3_mem_default();
+  auto nrequests = config.nrequests;
+  uint64_t now = 0;
+  uint64_t rand = config.sim_seed ? config.sim_seed : 1;
+
+  nghttp3_settings settings;
+  nghttp3_settings_default(&settings);
+  settings.qpack_max_dtable_capacity = dtable_capacity;
+  settings.qpack_encoder_max_dtable_capacity = dtable_capacity;
+  settings.qpack_blocked_streams = blocked_streams;
+
+  nghttp3_callbacks callbacks{};
+  callbacks.deferred_consume = sim_deferred_consume;
+  callbacks.end_headers = sim_end_headers;
+  callbacks.end_stream = sim_end_stream;
+
+  SimEndpoint client{}, server{};
+
+  for (auto ep : {&client, &server}) {
+    ep->now = &now;
+    ep->buffered.resize(nrequests);
+    ep->blocked_since.resize(nrequests);
+    ep->ttfh.resize(nrequests);
+  }
+
+  auto rv = nghttp3_conn_client_new(&client.conn, &callbacks, &settings, mem,
+                                    &client);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_client_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto clientd = defer(nghttp3_conn_del, client.conn);
+
+  rv = nghttp3_conn_server_new(&server.conn, &callbacks, &settings, mem,
+                               &server);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_server_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto serverd = defer(nghttp3_conn_del, server.conn);
+
+  nghttp3_conn_set_max_client_streams_bidi(server.conn, nrequests);
+  nghttp3_conn_set_max_concurrent_streams(client.conn, nrequests);
+  nghttp3_conn_set_max_concurrent_streams(server.conn, nrequests);
+
+  if (nghttp3_conn_bind_control_stream(client.conn, 2) != 0 ||
+      nghttp3_conn_bind_qpack_streams(client.conn, 6, 10) != 0 ||
+      nghttp3_conn_bind_control_stream(server.conn, 3) != 0 ||
+      nghttp3_conn_bind_qpack_streams(server.conn, 7, 11) != 0) {
+    std::cerr << "Could not bind streams" << std::endl;
+    return -1;
+  }
+
+  std::array<uint8_t, 32> path;
+  std::vector<nghttp3_nv> reqnva{
+      nghttp3_nv{(uint8_t *)":method", (uint8_t *)"GET", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":scheme", (uint8_t *)"https", 7, 5,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":authority", (uint8_t *)"example.com", 10, 11,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)":path", path.data(), 5, 0,
+                 NGHTTP3_NV_FLAG_TRY_INDEX},
+  };
+  reqnva.insert(std::end(reqnva), std::begin(heavy_reqnva),
+                std::end(heavy_reqnva));
+
+  std::array<uint8_t, 32> etag;
+  std::vector<nghttp3_nv> respnva{
+      nghttp3_nv{(uint8_t *)":status", (uint8_t *)"200", 7, 3,
+                 NGHTTP3_NV_FLAG_NONE},
+      nghttp3_nv{(uint8_t *)"etag", etag.data(), 4, 0,
+                 NGHTTP3_NV_FLAG_TRY_INDEX},
+  };
+  respnva.insert(std::end(respnva), std::begin(heavy_respnva),
+                 std::end(heavy_respnva));
+
+  SimLink c2s(&rand), s2c(&rand);
+  uint64_t next_submit = 0;
+  size_t nsubmitted = 0, ncompleted = 0;
+
+  res = SimResult{};
+
+  for (; ncompleted < nrequests;) {
+    for (; nsubmitted < nrequests && next_submit <= now; ++nsubmitted) {
+      auto stream_id = static_cast<int64_t>(nsubmitted * 4);
+
+      // Paths and entity tags are indexed, and they are drawn from
+      // the sets larger than what the dynamic table can hold, so
+      // that the encoders keep inserting new entries.
+      reqnva[3].valuelen = static_cast<size_t>(
+          snprintf(reinterpret_cast<char *>(path.data()), path.size(),
+                   "/assets/%zu.js", nsubmitted % 500));
+
+      rv = nghttp3_conn_submit_request(client.conn, stream_id, reqnva.data(),
+                                       reqnva.size(), nullptr, nullptr);
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_submit_request: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+
+      client.ttfh[nsubmitted] = now;
+      next_submit += sim_request_interval;
+    }
+
+    auto nsent = c2s.send(client.conn, now);
+    if (nsent < 0) {
+      return -1;
+    }
+
+    res.nwrite += static_cast<uint64_t>(nsent);
+
+    nsent = s2c.send(server.conn, now);
+    if (nsent < 0) {
+      return -1;
+    }
+
+    res.nwrite += static_cast<uint64_t>(nsent);
+
+    auto link = &c2s;
+    if (c2s.empty() || (!s2c.empty() && s2c.next_ts() < c2s.next_ts())) {
+      link = &s2c;
+    }
+
+    if (link->empty()) {
+      if (nsubmitted == nrequests) {
+        std::cerr << "Simulation stalled" << std::endl;
+        return -1;
+      }
+
+      now = next_submit;
+      continue;
+    }
+
+    if (nsubmitted < nrequests && next_submit < link->next_ts()) {
+      now = next_submit;
+      continue;
+    }
+
+    auto pkt = link->pop();
+    auto &ep = link == &c2s ? server : client;
+
+    now = pkt.ts;
+
+    if (sim_deliver(ep, pkt) != 0) {
+      return -1;
+    }
+
+    for (auto stream_id : server.headers_done) {
+      respnva[1].valuelen = static_cast<size_t>(
+          snprintf(reinterpret_cast<char *>(etag.data()), etag.size(),
+                   "\"%08zx\"", static_cast<size_t>(stream_id / 4) % 500));
+
+      rv = nghttp3_conn_submit_response(server.conn, stream_id,
+                                        respnva.data(), respnva.size(),
+                                        nullptr);
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_submit_response: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+    }
+
+    server.headers_done.clear();
+    client.headers_done.clear();
+
+    for (auto stream_id : client.finished) {
+      for (auto conn : {client.conn, server.conn}) {
+        rv = nghttp3_conn_close_stream(conn, stream_id, NGHTTP3_H3_NO_ERROR);
+        if (rv != 0) {
+          std::cerr << "nghttp3_conn_close_stream: " << nghttp3_strerror(rv)
+                    << std::endl;
+          return -1;
+        }
+      }
+
+      ++ncompleted;
+    }
+
+    client.finished.clear();
+    server.finished.clear();
+  }
+
+  res.ttfh = std::move(client.ttfh);
+  res.nblocked = client.nblocked_total + server.nblocked_total;
+  res.max_nblocked = std::max(client.max_nblocked, server.max_nblocked);
+  res.max_nbuffered = std::max(client.max_nbuffered, server.max_nbuffered);
+  res.blocked_time = client.blocked_time + server.blocked_time;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int run_sim() {
+  std::cout << "requests=" << config.nrequests << " seed=" << config.sim_seed
+            << " delay=" << config.sim_link.delay << "us"
+            << " jitter=" << config.sim_link.jitter << "us"
+            << " loss=" << config.sim_link.loss << "%" << std::endl;
+
+  for (auto &[type, name] : sim_stream_type_names) {
+    auto it = config.sim_stream_links.find(type);
+    if (it == std::end(config.sim_stream_links)) {
+      continue;
+    }
+
+    auto &params = (*it).second;
+
+    std::cout << "  " << name << ": delay=" << params.delay << "us"
+              << " jitter=" << params.jitter << "us"
+              << " loss=" << params.loss << "%" << std::endl;
+  }
+
+  std::cout << std::setw(8) << "dtable" << std::setw(9) << "blocked"
+            << std::setw(11) << "ttfh(ms)" << std::setw(10) << "p99(ms)"
+            << std::setw(10) << "nblocked" << std::setw(12) << "max blocked"
+            << std::setw(13) << "max buffered" << std::setw(14)
+            << "blocked(ms)" << std::setw(10) << "B/req" << std::endl;
+
+  for (auto dtable_capacity : {size_t{0}, size_t{4_k}, size_t{16_k}}) {
+    for (auto blocked_streams : {size_t{0}, size_t{16}, size_t{100}}) {
+      // Without dynamic table, nothing is blocked.
+      if (dtable_capacity == 0 && blocked_streams) {
+        continue;
+      }
+
+      SimResult res;
+
+      if (bench_sim(res, dtable_capacity, blocked_streams) != 0) {
+        return -1;
+      }
+
+      std::sort(std::begin(res.ttfh), std::end(res.ttfh));
+
+      uint64_t sum = 0;
+
+      for (auto t : res.ttfh) {
+        sum += t;
+      }
+
+      auto n = res.ttfh.size();
+      auto p99 = n ? res.ttfh[(n - 1) * 99 / 100] : 0;
+
+      std::cout << std::setw(8) << dtable_capacity << std::setw(9)
+                << blocked_streams << std::setw(11) << std::fixed
+                << std::setprecision(3)
+                << (n ? static_cast<double>(sum) / static_cast<double>(n) /
+                            1000
+                      : 0.)
+                << std::setw(10) << static_cast<double>(p99) / 1000
+                << std::setw(10) << res.nblocked << std::setw(12)
+                << res.max_nblocked << std::setw(13) << res.max_nbuffered
+                << std::setw(14)
+                << static_cast<double>(res.blocked_time) / 1000
+                << std::setw(10) << std::setprecision(1)
+                << (n ? static_cast<double>(res.nwrite) /
+                            static_cast<double>(n)
+                      : 0.)
+                << std::endl;
+    }
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// frame_type_data and frame_type_headers are the types of DATA and
+// HEADERS frame.
+constexpr uint64_t frame_type_data = 0x00;
+constexpr uint64_t frame_type_headers = 0x01;
+} // namespace
+
+namespace {
+// put_varint writes |n| in QUIC variable-length integer encoding to
+// |dest|.
+void put_varint(std::vector<uint8_t> &dest, uint64_t n) {
+  if (n < 64) {
+    dest.push_back(static_cast<uint8_t>(n));
+    return;
+  }
+
+  if (n < 16384) {
+    dest.push_back(static_cast<uint8_t>((n >> 8) | 0x40));
+    dest.push_back(static_cast<uint8_t>(n));
+    return;
+  }
+
+  if (n < 1073741824) {
+    dest.push_back(static_cast<uint8_t>((n >> 24) | 0x80));
+    dest.push_back(static_cast<uint8_t>(n >> 16));
+    dest.push_back(static_cast<uint8_t>(n >> 8));
+    dest.push_back(static_cast<uint8_t>(n));
+    return;
+  }
+
+  dest.push_back(static_cast<uint8_t>((n >> 56) | 0xc0));
+  for (auto shift = 48; shift >= 0; shift -= 8) {
+    dest.push_back(static_cast<uint8_t>(n >> shift));
+  }
+}
+} // namespace
+
+namespace {
+// write_headers_frame appends HEADERS frame which carries |nva| of
+// length |nvlen| to |dest|.  The field section only refers to the
+// static table, so that any stream can decode it.
+int write_headers_frame(std::vector<uint8_t> &dest, const nghttp3_nv *nva,
+                        size_t nvlen) {
+  auto mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder *qenc;
+
+  auto rv = nghttp3_qpack_encoder_new(&qenc, 0, mem);
+  if (rv != 0) {
+    std::cerr << "nghttp3_qpack_encoder_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto qencd = defer(nghttp3_qpack_encoder_del, qenc);
+
+  nghttp3_buf pbuf, rbuf, ebuf;
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+
+  auto pbufd = defer(nghttp3_buf_free, &pbuf, mem);
+  auto rbufd = defer(nghttp3_buf_free, &rbuf, mem);
+  auto ebufd = defer(nghttp3_buf_free, &ebuf, mem);
+
+  rv = nghttp3_qpack_encoder_encode(qenc, &pbuf, &rbuf, &ebuf, 0, nva, nvlen);
+  if (rv != 0) {
+    std::cerr << "nghttp3_qpack_encoder_encode: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  put_varint(dest, frame_type_headers);
+  put_varint(dest, nghttp3_buf_len(&pbuf) + nghttp3_buf_len(&rbuf));
+  dest.insert(std::end(dest), pbuf.pos, pbuf.last);
+  dest.insert(std::end(dest), rbuf.pos, rbuf.last);
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// write_data_frame appends DATA frame which carries |len| bytes of
+// payload to |dest|.
+void write_data_frame(std::vector<uint8_t> &dest, size_t len) {
+  put_varint(dest, frame_type_data);
+  put_varint(dest, len);
+  dest.resize(dest.size() + len);
+}
+} // namespace
+
+namespace {
+struct ParseResult {
+  // nread is the number of bytes which server read.
+  uint64_t nread;
+  // nbody is the number of request body bytes which server received.
+  uint64_t nbody;
+  std::chrono::steady_clock::duration elapsed;
+};
+} // namespace
+
+namespace {
+int recv_parse_data(nghttp3_conn *, int64_t, const uint8_t *, size_t datalen,
+                    void *conn_user_data, void *) {
+  static_cast<ParseResult *>(conn_user_data)->nbody += datalen;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// read_chunked makes |conn| read |data| of length |datalen| on a
+// stream denoted by |stream_id| in pieces of at most |chunklen|
+// bytes.  If |chunklen| is 0, |data| is read at once.  If |batch| is
+// true, up to 64 pieces, which are as many as a UDP GSO batch of
+// 1200 bytes packets carries, are passed to each
+// nghttp3_conn_read_streams call.
+int read_chunked(nghttp3_conn *conn, int64_t stream_id, const uint8_t *data,
+                 size_t datalen, size_t chunklen, int fin, bool batch) {
+  std::array<nghttp3_stream_data, 64> sdata;
+  std::array<size_t, 64> nconsumed;
+
+  if (chunklen == 0) {
+    chunklen = datalen;
+  }
+
+  if (batch) {
+    for (;;) {
+      size_t nsdata = 0;
+      auto last = false;
+
+      for (; nsdata < sdata.size() && !last; ++nsdata) {
+        auto n = std::min(chunklen, datalen);
+        last = n == datalen;
+
+        sdata[nsdata] = {stream_id, data, n, last && fin};
+
+        data += n;
+        datalen -= n;
+      }
+
+      auto rv = nghttp3_conn_read_streams(conn, sdata.data(), nsdata,
+                                          nconsumed.data());
+      if (rv != 0) {
+        std::cerr << "nghttp3_conn_read_streams: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+
+      if (last) {
+        return 0;
+      }
+    }
+  }
+
+  for (;;) {
+    auto n = std::min(chunklen, datalen);
+    auto last = n == datalen;
+    auto nread =
+        nghttp3_conn_read_stream(conn, stream_id, data, n, last && fin);
+    if (nread < 0) {
+      std::cerr << "nghttp3_conn_read_stream: "
+                << nghttp3_strerror(static_cast<int>(nread)) << std::endl;
+      return -1;
+    }
+
+    if (last) {
+      return 0;
+    }
+
+    data += n;
+    datalen -= n;
+  }
+}
+} // namespace
+
+namespace {
+// bench_parse_small measures the cost of reading config.nrequests
+// small POST requests, each of which consists of HEADERS and DATA
+// frame, on their own streams.
+int bench_parse_small(ParseResult &res, size_t chunklen, bool batch) {
+  const nghttp3_nv nva[] = {
+      make_nv(":method", "POST"),
+      make_nv(":scheme", "https"),
+      make_nv(":authority", "example.com"),
+      make_nv(":path", "/api/v1/items"),
+      make_nv("content-type", "application/json"),
+  };
+  std::vector<uint8_t> req;
+
+  if (write_headers_frame(req, nva, std::size(nva)) != 0) {
+    return -1;
+  }
+
+  write_data_frame(req, 64);
+
+  nghttp3_settings settings;
+  nghttp3_settings_default(&settings);
+
+  nghttp3_callbacks callbacks{};
+  callbacks.recv_data = recv_parse_data;
+
+  nghttp3_conn *server;
+
+  res = ParseResult{};
+
+  auto rv = nghttp3_conn_server_new(&server, &callbacks, &settings,
+                                    nghttp3_mem_default(), &res);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_server_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto serverd = defer(nghttp3_conn_del, server);
+
+  nghttp3_conn_set_max_client_streams_bidi(server, config.nrequests);
+
+  auto ts = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < config.nrequests; ++i) {
+    auto stream_id = static_cast<int64_t>(i * 4);
+
+    if (read_chunked(server, stream_id, req.data(), req.size(), chunklen,
+                     /* fin = */ 1, batch) != 0) {
+      return -1;
+    }
+
+    rv = nghttp3_conn_close_stream(server, stream_id, NGHTTP3_H3_NO_ERROR);
+    if (rv != 0) {
+      std::cerr << "nghttp3_conn_close_stream: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+  res.nread = req.size() * config.nrequests;
+
+  if (res.nbody != 64 * config.nrequests) {
+    std::cerr << "Request body length mismatch: want "
+              << 64 * config.nrequests << ", got " << res.nbody << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// bench_parse_large measures the cost of reading a request body of
+// config.file_size bytes, rounded up to 1MiB, in DATA frames of
+// 16KiB.
+int bench_parse_large(ParseResult &res, size_t chunklen, bool batch) {
+  constexpr size_t framelen = 16_k;
+  constexpr size_t nframes = 64;
+  auto nrounds = std::max((config.file_size + framelen * nframes - 1) /
+                              (framelen * nframes),
+                          uint64_t{1});
+  auto bodylen = nrounds * framelen * nframes;
+  const nghttp3_nv nva[] = {
+      make_nv(":method", "PUT"),
+      make_nv(":scheme", "https"),
+      make_nv(":authority", "example.com"),
+      make_nv(":path", "/upload"),
+  };
+  std::vector<uint8_t> hd, data;
+
+  if (write_headers_frame(hd, nva, std::size(nva)) != 0) {
+    return -1;
+  }
+
+  for (size_t i = 0; i < nframes; ++i) {
+    write_data_frame(data, framelen);
+  }
+
+  nghttp3_settings settings;
+  nghttp3_settings_default(&settings);
+
+  nghttp3_callbacks callbacks{};
+  callbacks.recv_data = recv_parse_data;
+
+  nghttp3_conn *server;
+
+  res = ParseResult{};
+
+  auto rv = nghttp3_conn_server_new(&server, &callbacks, &settings,
+                                    nghttp3_mem_default(), &res);
+  if (rv != 0) {
+    std::cerr << "nghttp3_conn_server_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto serverd = defer(nghttp3_conn_del, server);
+
+  nghttp3_conn_set_max_client_streams_bidi(server, 1);
+
+  auto ts = std::chrono::steady_clock::now();
+
+  if (read_chunked(server, 0, hd.data(), hd.size(), chunklen,
+                   /* fin = */ 0, batch) != 0) {
+    return -1;
+  }
+
+  for (uint64_t i = 0; i < nrounds; ++i) {
+    if (read_chunked(server, 0, data.data(), data.size(), chunklen,
+                     /* fin = */ 0, batch) != 0) {
+      return -1;
+    }
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+  res.nread = hd.size() + data.size() * nrounds;
+
+  if (res.nbody != bodylen) {
+    std::cerr << "Request body length mismatch: want " << bodylen
+              << ", got " << res.nbody << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int run_parse() {
+  std::cout << std::setw(10) << "workload" << std::setw(8) << "chunk"
+            << std::setw(8) << "read" << std::setw(12) << "MiB/s"
+            << std::setw(12) << "req/s" << std::endl;
+
+  // Chunk length 0 means that a whole request, or 1MiB of request
+  // body is read at once.  1200 is a typical QUIC packet payload, and
+  // 16 splits most of the frame headers.  The pieces are either read
+  // one by one, or in a batch.
+  for (auto large : {false, true}) {
+    for (auto chunklen : {size_t{0}, size_t{1200}, size_t{16}}) {
+      for (auto batch : {false, true}) {
+        ParseResult res;
+
+        if ((large ? bench_parse_large(res, chunklen, batch)
+                   : bench_parse_small(res, chunklen, batch)) != 0) {
+          return -1;
+        }
+
+        auto secs =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                res.elapsed)
+                .count();
+
+        std::cout << std::setw(10) << (large ? "large" : "small")
+                  << std::setw(8);
+
+        if (chunklen) {
+          std::cout << chunklen;
+        } else {
+          std::cout << "whole";
+        }
+
+        std::cout << std::setw(8) << (batch ? "batch" : "single")
+                  << std::setw(12) << std::fixed << std::setprecision(2)
+                  << static_cast<double>(res.nread) / 1_m / secs
+                  << std::setw(12);
+
+        if (large) {
+          std::cout << "-";
+        } else {
+          std::cout << std::setprecision(0)
+                    << static_cast<double>(config.nrequests) / secs;
+        }
+
+        std::cout << std::endl;
+      }
+    }
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// parse_stream_link parses |s| of the form
+// <TYPE>:<DELAY>,<JITTER>,<LOSS>, and stores the link parameters for
+// the stream type to config.sim_stream_links.  It returns 0 if it
+// succeeds, or -1.
+int parse_stream_link(const char *s) {
+  auto sep = strchr(s, ':');
+  if (sep == nullptr) {
+    return -1;
+  }
+
+  auto name = std::string_view(s, static_cast<size_t>(sep - s));
+  auto it = std::find_if(
+      std::begin(sim_stream_type_names), std::end(sim_stream_type_names),
+      [&name](const auto &ent) { return ent.second == name; });
+  if (it == std::end(sim_stream_type_names)) {
+    return -1;
+  }
+
+  SimLinkParams params;
+  char *end;
+
+  params.delay = strtoull(sep + 1, &end, 10);
+  if (end == sep + 1 || *end != ',') {
+    return -1;
+  }
+
+  auto p = end + 1;
+
+  params.jitter = strtoull(p, &end, 10);
+  if (end == p || *end != ',') {
+    return -1;
+  }
+
+  p = end + 1;
+
+  params.loss = strtod(p, &end);
+  if (end == p || *end != '\0') {
+    return -1;
+  }
+
+  config.sim_stream_links[(*it).first] = params;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+void print_usage() {
+  std::cerr << "Usage: conn_bench [OPTIONS] <COMMAND>" << std::endl;
+}
+} // namespace
+
+namespace {
+void print_help() {
+  print_usage();
+
+  std::cerr << R"(
+  <COMMAND>   "sched", "batch", "lifetime", "file", "e2e", "sim" or
+              "parse"
+Commands:
+  sched       Measure the cost per nghttp3_conn_writev_stream call of
+              stream schedulers with many concurrent streams which
+              always have data to send.
+  batch       Measure the cost of filling a 64KiB UDP GSO batch with
+              nghttp3_conn_writev_stream in a loop, and with a single
+              nghttp3_conn_writev_streams call.
+  lifetime    Measure the cost of opening and closing many streams
+              over a connection lifetime, and the cost of looking up
+              an open stream by stream ID.
+  file        Measure the cost of serving a file over a client and a
+              server connected with each other when the application
+              reads the file into its own buffers, and when the
+              library reads it with nghttp3_conn_submit_response_file.
+  e2e         Measure requests per second, response body goodput,
+              memory allocations per request, and CPU cycles per
+              byte written of a client and a server connected with
+              each other for small responses, large downloads, many
+              concurrent streams, and large header sets.
+  sim         Measure the time until response header fields are
+              decoded, and the streams and the bytes which are held
+              back by QPACK blocking, for various dynamic table
+              capacities and blocked streams limits.  A client sends
+              a request every millisecond to a server over simulated
+              links which delay, reorder, and lose packets
+              deterministically, and deliver data in order only
+              within each stream.
+  parse       Measure the throughput of a server reading small
+              requests, and a large request body in DATA frames,
+              when a whole request or 1MiB of body is read at once,
+              and when it is read in 1200 and 16 bytes pieces, one
+              piece per nghttp3_conn_read_stream call, or all pieces
+              in a nghttp3_conn_read_streams call.
+Options:
+  -h, --help  Display this help and exit.
+  -n, --streams=<N>
+              The number of concurrent request streams.
+              Default: )"
+            << config.nstreams << R"(
+  -c, --calls=<N>
+              The number of nghttp3_conn_writev_stream calls, or the
+              number of batches to measure.
+              Default: )"
+            << config.ncalls << R"(
+  -t, --total-streams=<N>
+              The number of streams which are opened and closed over a
+              connection lifetime.
+              Default: )"
+            << config.ntotal_streams << R"(
+  -s, --file-size=<N>
+              The size of a file which the server serves, and the
+              length of a request body which parse command reads.
+              Default: )"
+            << config.file_size << R"(
+  -r, --requests=<N>
+              The number of requests in each end-to-end scenario, and
+              the number of small requests which parse command reads.
+              The large download scenario makes N/10000 requests.
+              Default: )"
+            << config.nrequests << R"(
+  -S, --seed=<N>
+              The seed of the network simulator.
+              Default: )"
+            << config.sim_seed << R"(
+  -d, --delay=<USEC>
+              The one-way delay of the simulated network in
+              microseconds.  A lost packet is delivered after 3 times
+              the delay.
+              Default: )"
+            << config.sim_link.delay << R"(
+  -j, --jitter=<USEC>
+              The maximum additional delay of each simulated packet in
+              microseconds.
+              Default: )"
+            << config.sim_link.jitter << R"(
+  -l, --loss=<PERCENT>
+              The packet loss rate of the simulated network.
+              Default: )"
+            << config.sim_link.loss << R"(
+  -L, --stream-link=<TYPE>:<USEC>,<USEC>,<PERCENT>
+              The delay, the jitter, and the packet loss rate of the
+              simulated network for the streams of TYPE, which
+              overrides --delay, --jitter, and --loss.  TYPE is one
+              of request, control, qpack-encoder, and qpack-decoder.
+              This option can be given multiple times.)"
+            << std::endl;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  for (;;) {
+    constexpr static option long_opts[] = {
+        {"help", no_argument, nullptr, 'h'},
+        {"streams", required_argument, nullptr, 'n'},
+        {"calls", required_argument, nullptr, 'c'},
+        {"total-streams", required_argument, nullptr, 't'},
+        {"file-size", required_argument, nullptr, 's'},
+        {"requests", required_argument, nullptr, 'r'},
+        {"seed", required_argument, nullptr, 'S'},
+        {"delay", required_argument, nullptr, 'd'},
+        {"jitter", required_argument, nullptr, 'j'},
+        {"loss", required_argument, nullptr, 'l'},
+        {"stream-link", required_argument, nullptr, 'L'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    auto optidx = 0;
+    auto c =
+        getopt_long(argc, argv, "hn:c:t:s:r:S:d:j:l:L:", long_opts, &optidx);
+    if (c == -1) {
+      break;
+    }
+    switch (c) {
+    case 'h':
+      // --help
+      print_help();
+      exit(EXIT_SUCCESS);
+    case 'n':
+      // --streams
+      config.nstreams = strtoul(optarg, nullptr, 10);
+      break;
+    case 'c':
+      // --calls
+      config.ncalls = strtoul(optarg, nullptr, 10);
+      break;
+    case 't':
+      // --total-streams
+      config.ntotal_streams = strtoul(optarg, nullptr, 10);
+      break;
+    case 's':
+      // --file-size
+      config.file_size = strtoull(optarg, nullptr, 10);
+      break;
+    case 'r':
+      // --requests
+      config.nrequests = strtoul(optarg, nullptr, 10);
+      break;
+    case 'S':
+      // --seed
+      config.sim_seed = strtoull(optarg, nullptr, 10);
+      break;
+    case 'd':
+      // --delay
+      config.sim_link.delay = strtoull(optarg, nullptr, 10);
+      break;
+    case 'j':
+      // --jitter
+      config.sim_link.jitter = strtoull(optarg, nullptr, 10);
+      break;
+    case 'l':
+      // --loss
+      config.sim_link.loss = strtod(optarg, nullptr);
+      break;
+    case 'L':
+      // --stream-link
+      if (parse_stream_link(optarg) != 0) {
+        std::cerr << "stream-link: invalid argument: " << optarg << std::endl;
+        exit(EXIT_FAILURE);
+      }
+      break;
+    case '?':
+      print_usage();
+      exit(EXIT_FAILURE);
+    default:
+      break;
+    };
+  }
+
+  if (argc - optind < 1) {
+    std::cerr << "Too few arguments" << std::endl;
+    print_usage();
+    exit(EXIT_FAILURE);
+  }
+
+  auto command = std::string_view(argv[optind++]);
+
+  int rv;
+  if (command == "sched") {
+    rv = run_sched();
+  } else if (command == "batch") {
+    rv = run_batch();
+  } else if (command == "lifetime") {
+    rv = run_lifetime();
+  } else if (command == "file") {
+    rv = run_file();
+  } else if (command == "e2e") {
+    rv = run_e2e();
+  } else if (command == "sim") {
+    rv = run_sim();
+  } else if (command == "parse") {
+    rv = run_parse();
+  } else {
+    std::cerr << "Unrecognized command: " << command << std::endl;
+    print_usage();
+    exit(EXIT_FAILURE);
+  }
+
+  if (rv != 0) {
+    exit(EXIT_FAILURE);
+  }
+
+  return 0;
+}
+
+} // namespace nghttp3
+
+int main(int argc, char **argv) { return nghttp3::main(argc, argv); }
@@ -60,6 +60,9 @@ Options:
               The maximum size of dynamic table.
   -a, --immediate-ack
               Turn on immediate acknowlegement.
+  -f, --frequency-indexing
+              Insert a header field into dynamic table only after it is
+              seen repeatedly (NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY).
 )";
 }
 } // namespace
@@ -73,11 +76,12 @@ int main(int argc, char **argv) {
         {"max-blocked", required_argument, nullptr, 'm'},
         {"max-dtable-size", required_argument, nullptr, 's'},
         {"immediate-ack", no_argument, nullptr, 'a'},
+        {"frequency-indexing", no_argument, nullptr, 'f'},
         {nullptr, 0, nullptr, 0},
     };
 
     auto optidx = 0;
-    auto c = getopt_long(argc, argv, "hm:s:a", long_opts, &optidx);
+    auto c = getopt_long(argc, argv, "hm:s:af", long_opts, &optidx);
     if (c == -1) {
       break;
     }
@@ -100,6 +104,10 @@ int main(int argc, char **argv) {
       // --immediate-ack
       config.immediate_ack = true;
       break;
+    case 'f':
+      // --frequency-indexing
+      config.indexing_policy = NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY;
+      break;
     case '?':
       print_usage();
       exit(EXIT_FAILURE);
@@ -37,6 +37,7 @@ struct Config {
   size_t max_blocked;
   size_t max_dtable_size;
   bool immediate_ack;
+  uint8_t indexing_policy;
 };
 
 } // namespace nghttp3
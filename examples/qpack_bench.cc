@@ -0,0 +1,823 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2024 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <getopt.h>
+
+#include <nghttp3/nghttp3.h>
+
+#include "template.h"
+
+namespace nghttp3 {
+
+namespace {
+struct Config {
+  // nblocks is the number of header blocks in a generated corpus.
+  size_t nblocks;
+  // passes is the number of times a corpus is encoded.
+  size_t passes;
+  // seed is a seed for corpus generator.
+  uint32_t seed;
+} config{
+    10000,
+    10,
+    1,
+};
+} // namespace
+
+namespace {
+struct Header {
+  std::string name;
+  std::string value;
+  uint8_t flags;
+};
+} // namespace
+
+namespace {
+using HeaderBlock = std::vector<Header>;
+} // namespace
+
+namespace {
+std::string random_hex(std::mt19937 &gen, size_t len) {
+  static constexpr char digits[] = "0123456789abcdef";
+  auto dis = std::uniform_int_distribution<size_t>(0, 15);
+  std::string s;
+
+  s.resize(len);
+
+  for (auto &c : s) {
+    c = digits[dis(gen)];
+  }
+
+  return s;
+}
+} // namespace
+
+namespace {
+// make_request_corpus generates |n| request header blocks which
+// resemble the traffic an API gateway sees: a handful of hosts and
+// user agents, a large but skewed set of paths, per-session cookies
+// and tenant identifiers, and per-request unique tracing headers.
+std::vector<HeaderBlock> make_request_corpus(size_t n, uint32_t seed) {
+  static constexpr std::string_view user_agents[] = {
+      "Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, "
+      "like Gecko) Chrome/120.0.0.0 Safari/537.36",
+      "Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/605.1.15 "
+      "(KHTML, like Gecko) Version/17.1 Safari/605.1.15",
+      "Mozilla/5.0 (X11; Linux x86_64; rv:121.0) Gecko/20100101 Firefox/121.0",
+      "okhttp/4.12.0",
+      "curl/8.5.0",
+      "Go-http-client/2.0",
+  };
+  static constexpr std::string_view accepts[] = {
+      "*/*",
+      "application/json",
+      "text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,"
+      "image/webp,*/*;q=0.8",
+  };
+  std::mt19937 gen(seed);
+  std::vector<std::string> hosts, sessions, tenants;
+
+  for (size_t i = 0; i < 8; ++i) {
+    hosts.emplace_back("api" + std::to_string(i) + ".example.com");
+  }
+  for (size_t i = 0; i < 512; ++i) {
+    sessions.emplace_back("sid=" + random_hex(gen, 32) +
+                          "; theme=dark; lang=en-US");
+  }
+  for (size_t i = 0; i < 128; ++i) {
+    tenants.emplace_back(random_hex(gen, 12));
+  }
+
+  // Skewed toward small IDs so that a fraction of paths repeats.
+  auto path_dis = std::geometric_distribution<size_t>(0.002);
+  auto pick = [&gen](size_t len) {
+    return std::uniform_int_distribution<size_t>(0, len - 1)(gen);
+  };
+
+  std::vector<HeaderBlock> corpus;
+  corpus.reserve(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    auto post = pick(8) == 0;
+
+    corpus.emplace_back(HeaderBlock{
+        {":method", post ? "POST" : "GET", NGHTTP3_NV_FLAG_NONE},
+        {":scheme", "https", NGHTTP3_NV_FLAG_NONE},
+        {":authority", hosts[pick(hosts.size())], NGHTTP3_NV_FLAG_NONE},
+        {":path",
+         "/api/v1/items/" + std::to_string(path_dis(gen)) + "?fields=id,name",
+         NGHTTP3_NV_FLAG_TRY_INDEX},
+        {"user-agent", std::string(user_agents[pick(std::size(user_agents))]),
+         NGHTTP3_NV_FLAG_NONE},
+        {"accept", std::string(accepts[pick(std::size(accepts))]),
+         NGHTTP3_NV_FLAG_NONE},
+        {"accept-encoding", "gzip, deflate, br", NGHTTP3_NV_FLAG_NONE},
+        {"accept-language", "en-US,en;q=0.9", NGHTTP3_NV_FLAG_NONE},
+        {"cookie", sessions[pick(sessions.size())], NGHTTP3_NV_FLAG_NONE},
+        {"x-tenant-id", tenants[pick(tenants.size())],
+         NGHTTP3_NV_FLAG_TRY_INDEX},
+        {"x-request-id", random_hex(gen, 32), NGHTTP3_NV_FLAG_NONE},
+    });
+  }
+
+  return corpus;
+}
+} // namespace
+
+namespace {
+std::string random_base64(std::mt19937 &gen, size_t len) {
+  static constexpr char digits[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  auto dis = std::uniform_int_distribution<size_t>(0, 63);
+  std::string s;
+
+  s.resize(len);
+
+  for (auto &c : s) {
+    c = digits[dis(gen)];
+  }
+
+  return s;
+}
+} // namespace
+
+namespace {
+std::string random_uuid(std::mt19937 &gen) {
+  return random_hex(gen, 8) + '-' + random_hex(gen, 4) + '-' +
+         random_hex(gen, 4) + '-' + random_hex(gen, 4) + '-' +
+         random_hex(gen, 12);
+}
+} // namespace
+
+namespace {
+// make_response_corpus generates |n| response header blocks which
+// resemble the traffic a CDN edge sends: mostly repeated fields, plus
+// dates, validators, session tokens and tracing identifiers which are
+// random looking and barely compress.
+std::vector<HeaderBlock> make_response_corpus(size_t n, uint32_t seed) {
+  static constexpr std::string_view content_types[] = {
+      "application/json",
+      "text/html; charset=utf-8",
+      "image/webp",
+      "application/javascript",
+  };
+  static constexpr std::string_view days[] = {
+      "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun",
+  };
+  std::mt19937 gen(seed);
+  auto pick = [&gen](size_t len) {
+    return std::uniform_int_distribution<size_t>(0, len - 1)(gen);
+  };
+
+  std::vector<HeaderBlock> corpus;
+  corpus.reserve(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    auto date = std::string(days[pick(std::size(days))]) + ", " +
+                std::to_string(1 + pick(28)) + " Nov 2024 " +
+                std::to_string(10 + pick(14)) + ':' +
+                std::to_string(10 + pick(50)) + ':' +
+                std::to_string(10 + pick(50)) + " GMT";
+
+    corpus.emplace_back(HeaderBlock{
+        {":status", "200", NGHTTP3_NV_FLAG_NONE},
+        {"content-type",
+         std::string(content_types[pick(std::size(content_types))]),
+         NGHTTP3_NV_FLAG_NONE},
+        {"content-length", std::to_string(pick(1 << 20)),
+         NGHTTP3_NV_FLAG_NONE},
+        {"date", date, NGHTTP3_NV_FLAG_NONE},
+        {"last-modified", date, NGHTTP3_NV_FLAG_NONE},
+        {"etag", '"' + random_hex(gen, 32) + '"', NGHTTP3_NV_FLAG_NONE},
+        {"cache-control", "public, max-age=31536000, immutable",
+         NGHTTP3_NV_FLAG_NONE},
+        {"set-cookie",
+         "session=" + random_base64(gen, 44) +
+             "; Path=/; Secure; HttpOnly; SameSite=Lax",
+         NGHTTP3_NV_FLAG_NONE},
+        {"x-request-id", random_uuid(gen), NGHTTP3_NV_FLAG_NONE},
+        {"x-amz-cf-id", random_base64(gen, 56), NGHTTP3_NV_FLAG_NONE},
+        {"strict-transport-security", "max-age=63072000; includeSubDomains",
+         NGHTTP3_NV_FLAG_NONE},
+        {"server", "nghttp3", NGHTTP3_NV_FLAG_NONE},
+    });
+  }
+
+  return corpus;
+}
+} // namespace
+
+namespace {
+std::vector<nghttp3_nv> make_nva(const HeaderBlock &hb) {
+  std::vector<nghttp3_nv> nva;
+
+  nva.reserve(hb.size());
+
+  for (auto &h : hb) {
+    nva.emplace_back(nghttp3_nv{
+        reinterpret_cast<uint8_t *>(const_cast<char *>(h.name.data())),
+        reinterpret_cast<uint8_t *>(const_cast<char *>(h.value.data())),
+        h.name.size(),
+        h.value.size(),
+        h.flags,
+    });
+  }
+
+  return nva;
+}
+} // namespace
+
+namespace {
+struct EncodeResult {
+  // nheaders is the number of header fields encoded.
+  size_t nheaders;
+  // srclen is the sum of length of header names and values.
+  size_t srclen;
+  // rslen is the number of bytes written to request streams.
+  size_t rslen;
+  // eslen is the number of bytes written to encoder stream.
+  size_t eslen;
+  std::chrono::steady_clock::duration elapsed;
+};
+} // namespace
+
+namespace {
+int bench_encode(EncodeResult &res, const std::vector<HeaderBlock> &corpus,
+                 size_t dtable_capacity, uint8_t indexing_policy) {
+  auto mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder *enc;
+
+  auto rv = nghttp3_qpack_encoder_new(&enc, dtable_capacity, mem);
+  if (rv != 0) {
+    std::cerr << "nghttp3_qpack_encoder_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto encd = defer(nghttp3_qpack_encoder_del, enc);
+
+  nghttp3_qpack_encoder_set_max_dtable_capacity(enc, dtable_capacity);
+  nghttp3_qpack_encoder_set_max_blocked_streams(enc, 100);
+  nghttp3_qpack_encoder_set_indexing_policy(enc, indexing_policy);
+
+  std::vector<std::vector<nghttp3_nv>> nvas;
+  nvas.reserve(corpus.size());
+
+  res = EncodeResult{};
+
+  for (auto &hb : corpus) {
+    nvas.emplace_back(make_nva(hb));
+
+    for (auto &h : hb) {
+      res.srclen += h.name.size() + h.value.size();
+    }
+  }
+
+  res.srclen *= config.passes;
+
+  nghttp3_buf pbuf, rbuf, ebuf;
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+
+  auto pbufd = defer(nghttp3_buf_free, &pbuf, mem);
+  auto rbufd = defer(nghttp3_buf_free, &rbuf, mem);
+  auto ebufd = defer(nghttp3_buf_free, &ebuf, mem);
+
+  int64_t stream_id = 0;
+
+  auto ts = std::chrono::steady_clock::now();
+
+  for (size_t pass = 0; pass < config.passes; ++pass) {
+    for (auto &nva : nvas) {
+      rv = nghttp3_qpack_encoder_encode(enc, &pbuf, &rbuf, &ebuf, stream_id,
+                                        nva.data(), nva.size());
+      if (rv != 0) {
+        std::cerr << "nghttp3_qpack_encoder_encode: " << nghttp3_strerror(rv)
+                  << std::endl;
+        return -1;
+      }
+
+      // Pretend that the decoder acknowledges everything
+      // immediately so that the dynamic table is fully usable.
+      nghttp3_qpack_encoder_ack_everything(enc);
+
+      res.nheaders += nva.size();
+      res.rslen += nghttp3_buf_len(&pbuf) + nghttp3_buf_len(&rbuf);
+      res.eslen += nghttp3_buf_len(&ebuf);
+
+      nghttp3_buf_reset(&pbuf);
+      nghttp3_buf_reset(&rbuf);
+      nghttp3_buf_reset(&ebuf);
+
+      stream_id += 4;
+    }
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+int run_encode() {
+  static constexpr size_t capacities[] = {4_k, 16_k, 64_k, 256_k};
+
+  auto corpus = make_request_corpus(config.nblocks, config.seed);
+
+  std::cout << std::setw(10) << "capacity" << std::setw(12) << "headers"
+            << std::setw(14) << "ns/header" << std::setw(14) << "request"
+            << std::setw(14) << "encoder" << std::setw(12) << "ratio"
+            << std::endl;
+
+  for (auto cap : capacities) {
+    EncodeResult res;
+
+    if (bench_encode(res, corpus, cap,
+                     NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT) != 0) {
+      return -1;
+    }
+
+    auto ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(res.elapsed)
+            .count();
+
+    std::cout << std::setw(10) << cap << std::setw(12) << res.nheaders
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << static_cast<double>(ns) / static_cast<double>(res.nheaders)
+              << std::setw(14) << res.rslen << std::setw(14) << res.eslen
+              << std::setw(12) << std::setprecision(4)
+              << static_cast<double>(res.rslen + res.eslen) /
+                     static_cast<double>(res.srclen)
+              << std::endl;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// run_response measures encoding cost of response header fields.
+// Without dynamic table, every value is written as a string literal,
+// which makes string encoding dominate.
+int run_response() {
+  static constexpr size_t capacities[] = {0, 4_k};
+
+  auto corpus = make_response_corpus(config.nblocks, config.seed);
+
+  std::cout << std::setw(10) << "capacity" << std::setw(12) << "headers"
+            << std::setw(14) << "ns/header" << std::setw(14) << "request"
+            << std::setw(14) << "encoder" << std::setw(12) << "ratio"
+            << std::endl;
+
+  for (auto cap : capacities) {
+    EncodeResult res;
+
+    if (bench_encode(res, corpus, cap,
+                     NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT) != 0) {
+      return -1;
+    }
+
+    auto ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(res.elapsed)
+            .count();
+
+    std::cout << std::setw(10) << cap << std::setw(12) << res.nheaders
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << static_cast<double>(ns) / static_cast<double>(res.nheaders)
+              << std::setw(14) << res.rslen << std::setw(14) << res.eslen
+              << std::setw(12) << std::setprecision(4)
+              << static_cast<double>(res.rslen + res.eslen) /
+                     static_cast<double>(res.srclen)
+              << std::endl;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+struct EncodedBlock {
+  // encoder is the encoder stream emitted while encoding this block.
+  std::vector<uint8_t> encoder;
+  // request is the encoded field section prefix and field section.
+  std::vector<uint8_t> request;
+  // nheaders is the number of header fields in this block.
+  size_t nheaders;
+};
+} // namespace
+
+namespace {
+int encode_corpus(std::vector<EncodedBlock> &blocks,
+                  const std::vector<HeaderBlock> &corpus,
+                  size_t dtable_capacity) {
+  auto mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder *enc;
+
+  auto rv = nghttp3_qpack_encoder_new(&enc, dtable_capacity, mem);
+  if (rv != 0) {
+    std::cerr << "nghttp3_qpack_encoder_new: " << nghttp3_strerror(rv)
+              << std::endl;
+    return -1;
+  }
+
+  auto encd = defer(nghttp3_qpack_encoder_del, enc);
+
+  nghttp3_qpack_encoder_set_max_dtable_capacity(enc, dtable_capacity);
+
+  nghttp3_buf pbuf, rbuf, ebuf;
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+
+  auto pbufd = defer(nghttp3_buf_free, &pbuf, mem);
+  auto rbufd = defer(nghttp3_buf_free, &rbuf, mem);
+  auto ebufd = defer(nghttp3_buf_free, &ebuf, mem);
+
+  int64_t stream_id = 0;
+
+  blocks.clear();
+  blocks.reserve(corpus.size());
+
+  for (auto &hb : corpus) {
+    auto nva = make_nva(hb);
+
+    rv = nghttp3_qpack_encoder_encode(enc, &pbuf, &rbuf, &ebuf, stream_id,
+                                      nva.data(), nva.size());
+    if (rv != 0) {
+      std::cerr << "nghttp3_qpack_encoder_encode: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    nghttp3_qpack_encoder_ack_everything(enc);
+
+    auto &blk = blocks.emplace_back();
+
+    blk.encoder.assign(ebuf.pos, ebuf.last);
+    blk.request.assign(pbuf.pos, pbuf.last);
+    blk.request.insert(std::end(blk.request), rbuf.pos, rbuf.last);
+    blk.nheaders = nva.size();
+
+    nghttp3_buf_reset(&pbuf);
+    nghttp3_buf_reset(&rbuf);
+    nghttp3_buf_reset(&ebuf);
+
+    stream_id += 4;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+struct DecodeResult {
+  // nheaders is the number of header fields decoded.
+  size_t nheaders;
+  // inlen is the number of bytes of encoder and request streams
+  // decoded.
+  size_t inlen;
+  std::chrono::steady_clock::duration elapsed;
+};
+} // namespace
+
+namespace {
+int bench_decode(DecodeResult &res, const std::vector<EncodedBlock> &blocks,
+                 size_t dtable_capacity) {
+  auto mem = nghttp3_mem_default();
+  std::array<uint8_t, 4_k> dbufmem;
+
+  res = DecodeResult{};
+
+  auto ts = std::chrono::steady_clock::now();
+
+  for (size_t pass = 0; pass < config.passes; ++pass) {
+    nghttp3_qpack_decoder *dec;
+
+    auto rv = nghttp3_qpack_decoder_new(&dec, dtable_capacity, 0, mem);
+    if (rv != 0) {
+      std::cerr << "nghttp3_qpack_decoder_new: " << nghttp3_strerror(rv)
+                << std::endl;
+      return -1;
+    }
+
+    auto decd = defer(nghttp3_qpack_decoder_del, dec);
+
+    rv = nghttp3_qpack_decoder_set_max_dtable_capacity(dec, dtable_capacity);
+    if (rv != 0) {
+      std::cerr << "nghttp3_qpack_decoder_set_max_dtable_capacity: "
+                << nghttp3_strerror(rv) << std::endl;
+      return -1;
+    }
+
+    int64_t stream_id = 0;
+
+    for (auto &blk : blocks) {
+      auto nread = nghttp3_qpack_decoder_read_encoder(dec, blk.encoder.data(),
+                                                      blk.encoder.size());
+      if (nread < 0) {
+        std::cerr << "nghttp3_qpack_decoder_read_encoder: "
+                  << nghttp3_strerror(static_cast<int>(nread)) << std::endl;
+        return -1;
+      }
+
+      nghttp3_qpack_stream_context *sctx;
+
+      rv = nghttp3_qpack_stream_context_new(&sctx, stream_id, mem);
+      if (rv != 0) {
+        std::cerr << "nghttp3_qpack_stream_context_new: "
+                  << nghttp3_strerror(rv) << std::endl;
+        return -1;
+      }
+
+      auto sctxd = defer(nghttp3_qpack_stream_context_del, sctx);
+
+      auto p = blk.request.data();
+      auto end = p + blk.request.size();
+
+      for (;;) {
+        nghttp3_qpack_nv nv;
+        uint8_t flags;
+
+        nread = nghttp3_qpack_decoder_read_request(
+            dec, sctx, &nv, &flags, p, static_cast<size_t>(end - p), 1);
+        if (nread < 0) {
+          std::cerr << "nghttp3_qpack_decoder_read_request: "
+                    << nghttp3_strerror(static_cast<int>(nread)) << std::endl;
+          return -1;
+        }
+
+        p += nread;
+
+        if (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) {
+          break;
+        }
+
+        if (flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT) {
+          nghttp3_rcbuf_decref(nv.name);
+          nghttp3_rcbuf_decref(nv.value);
+        }
+      }
+
+      // Discard Section Acknowledgement and Insert Count Increment.
+      nghttp3_buf dbuf{dbufmem.data(), dbufmem.data() + dbufmem.size(),
+                       dbufmem.data(), dbufmem.data()};
+      nghttp3_qpack_decoder_write_decoder(dec, &dbuf);
+
+      res.nheaders += blk.nheaders;
+      res.inlen += blk.encoder.size() + blk.request.size();
+
+      stream_id += 4;
+    }
+  }
+
+  res.elapsed = std::chrono::steady_clock::now() - ts;
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// run_decode measures decoding cost.  Without dynamic table, every
+// header field which is not in static table is sent as a Huffman
+// encoded literal, which makes string decoding dominate.
+int run_decode() {
+  static constexpr size_t capacities[] = {0, 4_k, 64_k};
+
+  auto corpus = make_request_corpus(config.nblocks, config.seed);
+
+  std::cout << std::setw(10) << "capacity" << std::setw(12) << "headers"
+            << std::setw(14) << "ns/header" << std::setw(14) << "input"
+            << std::setw(12) << "MiB/s" << std::endl;
+
+  for (auto cap : capacities) {
+    std::vector<EncodedBlock> blocks;
+
+    if (encode_corpus(blocks, corpus, cap) != 0) {
+      return -1;
+    }
+
+    DecodeResult res;
+
+    if (bench_decode(res, blocks, cap) != 0) {
+      return -1;
+    }
+
+    auto ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(res.elapsed)
+            .count();
+
+    std::cout << std::setw(10) << cap << std::setw(12) << res.nheaders
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << static_cast<double>(ns) / static_cast<double>(res.nheaders)
+              << std::setw(14) << res.inlen << std::setw(12)
+              << static_cast<double>(res.inlen) * 1e9 /
+                     static_cast<double>(ns) / (1 << 20)
+              << std::endl;
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+// run_policy compares indexing policies on the same corpus.  The
+// corpus carries no NGHTTP3_NV_FLAG_TRY_INDEX hints so that each
+// policy decides which fields to index on its own.
+int run_policy() {
+  static constexpr size_t capacities[] = {4_k, 16_k, 64_k};
+  static constexpr std::pair<std::string_view, uint8_t> policies[] = {
+      {"default", NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT},
+      {"frequency", NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY},
+  };
+
+  auto corpus = make_request_corpus(config.nblocks, config.seed);
+
+  for (auto &hb : corpus) {
+    for (auto &h : hb) {
+      h.flags = NGHTTP3_NV_FLAG_NONE;
+    }
+  }
+
+  std::cout << std::setw(10) << "capacity" << std::setw(12) << "policy"
+            << std::setw(14) << "ns/header" << std::setw(14) << "request"
+            << std::setw(14) << "encoder" << std::setw(14) << "total"
+            << std::setw(12) << "ratio" << std::endl;
+
+  for (auto cap : capacities) {
+    for (auto &[name, policy] : policies) {
+      EncodeResult res;
+
+      if (bench_encode(res, corpus, cap, policy) != 0) {
+        return -1;
+      }
+
+      auto ns =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(res.elapsed)
+              .count();
+
+      std::cout << std::setw(10) << cap << std::setw(12) << name
+                << std::setw(14) << std::fixed << std::setprecision(2)
+                << static_cast<double>(ns) / static_cast<double>(res.nheaders)
+                << std::setw(14) << res.rslen << std::setw(14) << res.eslen
+                << std::setw(14) << res.rslen + res.eslen << std::setw(12)
+                << std::setprecision(4)
+                << static_cast<double>(res.rslen + res.eslen) /
+                       static_cast<double>(res.srclen)
+                << std::endl;
+    }
+  }
+
+  return 0;
+}
+} // namespace
+
+namespace {
+void print_usage() {
+  std::cerr << "Usage: qpack_bench [OPTIONS] <COMMAND>" << std::endl;
+}
+} // namespace
+
+namespace {
+void print_help() {
+  print_usage();
+
+  std::cerr << R"(
+  <COMMAND>   "encode", "response", "decode", or "policy"
+Commands:
+  encode      Measure encoding cost per header field with various dynamic
+              table capacities.
+  response    Measure encoding cost per response header field, which is
+              dominated by string literals.
+  decode      Measure decoding cost per header field with various dynamic
+              table capacities.
+  policy      Compare wire bytes and encoding cost per header field of
+              QPACK indexing policies.
+Options:
+  -h, --help  Display this help and exit.
+  -n, --blocks=<N>
+              The number of header blocks in a generated corpus.
+              Default: )"
+            << config.nblocks << R"(
+  -p, --passes=<N>
+              The number of times a corpus is processed.
+              Default: )"
+            << config.passes << R"(
+  -s, --seed=<N>
+              The seed for the corpus generator.
+              Default: )"
+            << config.seed << std::endl;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+  for (;;) {
+    constexpr static option long_opts[] = {
+        {"help", no_argument, nullptr, 'h'},
+        {"blocks", required_argument, nullptr, 'n'},
+        {"passes", required_argument, nullptr, 'p'},
+        {"seed", required_argument, nullptr, 's'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    auto optidx = 0;
+    auto c = getopt_long(argc, argv, "hn:p:s:", long_opts, &optidx);
+    if (c == -1) {
+      break;
+    }
+    switch (c) {
+    case 'h':
+      // --help
+      print_help();
+      exit(EXIT_SUCCESS);
+    case 'n':
+      // --blocks
+      config.nblocks = strtoul(optarg, nullptr, 10);
+      break;
+    case 'p':
+      // --passes
+      config.passes = strtoul(optarg, nullptr, 10);
+      break;
+    case 's':
+      // --seed
+      config.seed = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+      break;
+    case '?':
+      print_usage();
+      exit(EXIT_FAILURE);
+    default:
+      break;
+    };
+  }
+
+  if (argc - optind < 1) {
+    std::cerr << "Too few arguments" << std::endl;
+    print_usage();
+    exit(EXIT_FAILURE);
+  }
+
+  auto command = std::string_view(argv[optind++]);
+
+  int rv;
+  if (command == "encode") {
+    rv = run_encode();
+  } else if (command == "response") {
+    rv = run_response();
+  } else if (command == "decode") {
+    rv = run_decode();
+  } else if (command == "policy") {
+    rv = run_policy();
+  } else {
+    std::cerr << "Unrecognized command: " << command << std::endl;
+    print_usage();
+    exit(EXIT_FAILURE);
+  }
+
+  if (rv != 0) {
+    exit(EXIT_FAILURE);
+  }
+
+  return 0;
+}
+
+} // namespace nghttp3
+
+int main(int argc, char **argv) { return nghttp3::main(argc, argv); }
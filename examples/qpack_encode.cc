@@ -44,12 +44,14 @@ namespace nghttp3 {
 
 extern Config config;
 
-Encoder::Encoder(size_t max_dtable_size, size_t max_blocked, bool immediate_ack)
+Encoder::Encoder(size_t max_dtable_size, size_t max_blocked, bool immediate_ack,
+                 uint8_t indexing_policy)
     : mem_(nghttp3_mem_default()),
       enc_(nullptr),
       max_dtable_size_(max_dtable_size),
       max_blocked_(max_blocked),
-      immediate_ack_(immediate_ack) {}
+      immediate_ack_(immediate_ack),
+      indexing_policy_(indexing_policy) {}
 
 Encoder::~Encoder() { nghttp3_qpack_encoder_del(enc_); }
 
@@ -65,6 +67,7 @@ int Encoder::init() {
 
   nghttp3_qpack_encoder_set_max_dtable_capacity(enc_, max_dtable_size_);
   nghttp3_qpack_encoder_set_max_blocked_streams(enc_, max_blocked_);
+  nghttp3_qpack_encoder_set_indexing_policy(enc_, indexing_policy_);
 
   return 0;
 }
@@ -122,8 +125,8 @@ int encode(const std::string_view &outfile, const std::string_view &infile) {
     return -1;
   }
 
-  auto enc =
-      Encoder(config.max_dtable_size, config.max_blocked, config.immediate_ack);
+  auto enc = Encoder(config.max_dtable_size, config.max_blocked,
+                     config.immediate_ack, config.indexing_policy);
   if (enc.init() != 0) {
     return -1;
   }
@@ -176,7 +179,7 @@ int encode(const std::string_view &outfile, const std::string_view &infile) {
           const_cast<uint8_t *>(reinterpret_cast<const uint8_t *>(name.data())),
           const_cast<uint8_t *>(
               reinterpret_cast<const uint8_t *>(value.data())),
-          name.size(), value.size()});
+          name.size(), value.size(), NGHTTP3_NV_FLAG_NONE});
     }
 
     if (nva.empty()) {
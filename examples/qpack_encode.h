@@ -37,7 +37,8 @@ namespace nghttp3 {
 
 class Encoder {
 public:
-  Encoder(size_t max_dtable_size, size_t max_blocked, bool immediate_ack);
+  Encoder(size_t max_dtable_size, size_t max_blocked, bool immediate_ack,
+          uint8_t indexing_policy);
   ~Encoder();
 
   int init();
@@ -50,6 +51,7 @@ private:
   size_t max_dtable_size_;
   size_t max_blocked_;
   bool immediate_ack_;
+  uint8_t indexing_policy_;
 };
 
 int encode(const std::string_view &outfile, const std::string_view &infile);
@@ -264,6 +264,13 @@ typedef ptrdiff_t nghttp3_ssize;
  * allowed.
  */
 #define NGHTTP3_ERR_H3_STREAM_CREATION_ERROR -609
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_ERR_H3_EXCESSIVE_LOAD` indicates that a remote
+ * endpoint makes a local endpoint buffer more data than it allows.
+ */
+#define NGHTTP3_ERR_H3_EXCESSIVE_LOAD -610
 /**
  * @macro
  *
@@ -1206,6 +1213,43 @@ NGHTTP3_EXTERN void
 nghttp3_qpack_encoder_set_max_blocked_streams(nghttp3_qpack_encoder *encoder,
                                               size_t max_blocked_streams);
 
+/**
+ * @function
+ *
+ * `nghttp3_qpack_encoder_set_indexing_policy` sets the policy which
+ * |encoder| uses to decide which header fields are inserted into the
+ * dynamic table to |policy|.  |policy| must be one of
+ * :macro:`NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT` and
+ * :macro:`NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY`.  The default is
+ * :macro:`NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT`.
+ */
+NGHTTP3_EXTERN void
+nghttp3_qpack_encoder_set_indexing_policy(nghttp3_qpack_encoder *encoder,
+                                          uint8_t policy);
+
+/**
+ * @function
+ *
+ * `nghttp3_qpack_encoder_enable_ring_dtable` makes |encoder| store
+ * its dynamic table in a single preallocated circular buffer instead
+ * of allocating memory per entry.  This function allocates all
+ * memory which the dynamic table needs up to the
+ * |hard_max_dtable_capacity| passed to `nghttp3_qpack_encoder_new`,
+ * and inserting and evicting an entry never allocate or free memory
+ * afterwards.  This function must be called before |encoder|
+ * inserts any entry into the dynamic table.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_STATE`
+ *     |encoder| has already inserted an entry into the dynamic table.
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ */
+NGHTTP3_EXTERN int
+nghttp3_qpack_encoder_enable_ring_dtable(nghttp3_qpack_encoder *encoder);
+
 /**
  * @function
  *
@@ -1227,6 +1271,108 @@ nghttp3_qpack_encoder_ack_everything(nghttp3_qpack_encoder *encoder);
 NGHTTP3_EXTERN size_t
 nghttp3_qpack_encoder_get_num_blocked_streams(nghttp3_qpack_encoder *encoder);
 
+#define NGHTTP3_QPACK_STATS_V1 1
+#define NGHTTP3_QPACK_STATS_VERSION NGHTTP3_QPACK_STATS_V1
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_qpack_stats` is the compression statistics of QPACK
+ * encoder or decoder.  The same structure is used for both sides.
+ * Encoder counts what it writes, and decoder counts what it reads.
+ * The counters are maintained only if the library is built with
+ * QPACK statistics enabled (ENABLE_QPACK_STATS, which is the
+ * default).  Otherwise, all fields are 0.
+ */
+typedef struct nghttp3_qpack_stats {
+  /**
+   * :member:`static_indexed` is the number of field lines which are
+   * represented as an index into the static table.
+   */
+  uint64_t static_indexed;
+  /**
+   * :member:`dynamic_indexed` is the number of field lines which are
+   * represented as an index into the dynamic table.
+   */
+  uint64_t dynamic_indexed;
+  /**
+   * :member:`static_name` is the number of field lines which are
+   * represented as a literal value with a name reference into the
+   * static table.
+   */
+  uint64_t static_name;
+  /**
+   * :member:`dynamic_name` is the number of field lines which are
+   * represented as a literal value with a name reference into the
+   * dynamic table.
+   */
+  uint64_t dynamic_name;
+  /**
+   * :member:`literal` is the number of field lines which are
+   * represented with a literal name and value.
+   */
+  uint64_t literal;
+  /**
+   * :member:`huffman_saved` is the number of bytes saved by Huffman
+   * coding in string literals on both request streams and encoder
+   * stream.  On decoder side, it might be negative if a remote
+   * encoder uses Huffman coding which makes strings longer.
+   */
+  int64_t huffman_saved;
+  /**
+   * :member:`inserts` is the number of entries inserted into the
+   * dynamic table, including duplicates.
+   */
+  uint64_t inserts;
+  /**
+   * :member:`duplicates` is the number of Duplicate instructions.
+   */
+  uint64_t duplicates;
+  /**
+   * :member:`evictions` is the number of entries evicted from the
+   * dynamic table.
+   */
+  uint64_t evictions;
+  /**
+   * :member:`encoder_stream_bytes` is the number of bytes written to
+   * (by encoder) or read from (by decoder) encoder stream.
+   */
+  uint64_t encoder_stream_bytes;
+  /**
+   * :member:`decoder_stream_bytes` is the number of bytes read from
+   * (by encoder) or written to (by decoder) decoder stream.
+   */
+  uint64_t decoder_stream_bytes;
+  /**
+   * :member:`blocked_sections` is the number of encoded field
+   * sections which refer to the dynamic table entries that decoder
+   * has not acknowledged (by encoder), or which decoder could not
+   * decode immediately (by decoder).
+   */
+  uint64_t blocked_sections;
+  /**
+   * :member:`raw_bytes` is the sum of the length of name and value
+   * of the encoded or decoded field lines.
+   */
+  uint64_t raw_bytes;
+  /**
+   * :member:`encoded_bytes` is the number of bytes of the encoded
+   * field sections, including field section prefix.
+   */
+  uint64_t encoded_bytes;
+} nghttp3_qpack_stats;
+
+/**
+ * @function
+ *
+ * `nghttp3_qpack_encoder_get_stats` stores the compression statistics
+ * of |encoder| into |*dest|.  Only the fields which are available in
+ * |stats_version| are written.
+ */
+NGHTTP3_EXTERN void nghttp3_qpack_encoder_get_stats_versioned(
+    const nghttp3_qpack_encoder *encoder, int stats_version,
+    nghttp3_qpack_stats *dest);
+
 /**
  * @struct
  *
@@ -1353,6 +1499,101 @@ NGHTTP3_EXTERN nghttp3_ssize nghttp3_qpack_decoder_read_encoder(
 NGHTTP3_EXTERN uint64_t
 nghttp3_qpack_decoder_get_icnt(const nghttp3_qpack_decoder *decoder);
 
+/**
+ * @function
+ *
+ * `nghttp3_qpack_decoder_get_stats` stores the compression statistics
+ * of |decoder| into |*dest|.  Only the fields which are available in
+ * |stats_version| are written.
+ */
+NGHTTP3_EXTERN void nghttp3_qpack_decoder_get_stats_versioned(
+    const nghttp3_qpack_decoder *decoder, int stats_version,
+    nghttp3_qpack_stats *dest);
+
+/**
+ * @function
+ *
+ * `nghttp3_qpack_decoder_set_borrow_literals` controls how |decoder|
+ * emits string literals which are not Huffman encoded.  If |borrow|
+ * is nonzero, and a literal name or value is entirely contained in
+ * the buffer passed to `nghttp3_qpack_decoder_read_request`,
+ * |decoder| emits :type:`nghttp3_rcbuf` which refers to that buffer
+ * directly instead of allocating a new buffer and copying the
+ * literal into it.  Such :type:`nghttp3_rcbuf` is only valid until
+ * the next call of `nghttp3_qpack_decoder_read_request` with the same
+ * |sctx|, or until the buffer is freed or modified, whichever comes
+ * first.  `nghttp3_rcbuf_is_static` returns nonzero for it, and
+ * `nghttp3_rcbuf_incref` does not extend its lifetime.  Unlike the
+ * buffer allocated by |decoder|, it is not NULL-terminated.  By
+ * default, this feature is disabled.
+ */
+NGHTTP3_EXTERN void
+nghttp3_qpack_decoder_set_borrow_literals(nghttp3_qpack_decoder *decoder,
+                                          int borrow);
+
+/**
+ * @function
+ *
+ * `nghttp3_qpack_decoder_set_value_chunk_size` makes |decoder| emit
+ * a literal field value, whose encoded length exceeds |chunk_size|
+ * bytes, in fragments instead of decoding it into a single buffer.
+ * Each fragment is decoded from at most |chunk_size| bytes of
+ * input, and Huffman decoding is done per fragment, so that the
+ * memory which |decoder| uses for such value is bounded by
+ * |chunk_size| rather than by the length of the value.
+ *
+ * `nghttp3_qpack_decoder_read_request` emits such field in the
+ * following order:
+ *
+ * 1. :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_BEGIN` with the name of
+ *    the field.
+ * 2. :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_CHUNK` with a fragment
+ *    of the value, zero or more times.
+ * 3. :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_END`, which might be set
+ *    together with the last
+ *    :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_CHUNK`.
+ *
+ * The values which are not longer than |chunk_size| and the values
+ * in the static or dynamic table are emitted with
+ * :macro:`NGHTTP3_QPACK_DECODE_FLAG_EMIT` as usual.  If |chunk_size|
+ * is 0, this feature is disabled, which is the default.  This
+ * feature must not be enabled for the decoder which
+ * :type:`nghttp3_conn` uses internally.
+ */
+NGHTTP3_EXTERN void
+nghttp3_qpack_decoder_set_value_chunk_size(nghttp3_qpack_decoder *decoder,
+                                           size_t chunk_size);
+
+/**
+ * @function
+ *
+ * `nghttp3_qpack_decoder_enable_ring_dtable` makes |decoder| store
+ * its dynamic table in a single preallocated circular buffer instead
+ * of allocating memory per entry.  This function allocates all
+ * memory which the dynamic table needs up to the
+ * |hard_max_dtable_capacity| passed to `nghttp3_qpack_decoder_new`.
+ * Afterwards, processing encoder stream does not allocate memory per
+ * instruction either.  This function must be called before |decoder|
+ * inserts any entry into the dynamic table.
+ *
+ * If this feature is enabled, the name and value which |decoder|
+ * emits from its dynamic table refer to the circular buffer, and they
+ * are only valid until the next call of
+ * `nghttp3_qpack_decoder_read_encoder`.  `nghttp3_rcbuf_is_static`
+ * returns nonzero for them, `nghttp3_rcbuf_incref` does not extend
+ * their lifetime, and they are not NULL-terminated.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_STATE`
+ *     |decoder| has already inserted an entry into the dynamic table.
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ */
+NGHTTP3_EXTERN int
+nghttp3_qpack_decoder_enable_ring_dtable(nghttp3_qpack_decoder *decoder);
+
 /**
  * @macrosection
  *
@@ -1390,6 +1631,31 @@ nghttp3_qpack_decoder_get_icnt(const nghttp3_qpack_decoder *decoder);
  */
 #define NGHTTP3_QPACK_DECODE_FLAG_BLOCKED 0x04u
 
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_BEGIN` indicates that an
+ * HTTP field whose value is emitted in fragments has started.  See
+ * `nghttp3_qpack_decoder_set_value_chunk_size`.
+ */
+#define NGHTTP3_QPACK_DECODE_FLAG_VALUE_BEGIN 0x08u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_CHUNK` indicates that a
+ * fragment of HTTP field value is decoded.
+ */
+#define NGHTTP3_QPACK_DECODE_FLAG_VALUE_CHUNK 0x10u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_END` indicates that all
+ * fragments of HTTP field value have been decoded.
+ */
+#define NGHTTP3_QPACK_DECODE_FLAG_VALUE_END 0x20u
+
 /**
  * @function
  *
@@ -1407,6 +1673,20 @@ nghttp3_qpack_decoder_get_icnt(const nghttp3_qpack_decoder *decoder);
  * :macro:`NGHTTP3_QPACK_DECODE_FLAG_BLOCKED` set, decoding is blocked
  * due to required insert count.
  *
+ * If |*pflags| has :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_BEGIN`
+ * set, :member:`nv->name <nghttp3_qpack_nv.name>`,
+ * :member:`nv->token <nghttp3_qpack_nv.token>`, and
+ * :member:`nv->flags <nghttp3_qpack_nv.flags>` are assigned as if
+ * :macro:`NGHTTP3_QPACK_DECODE_FLAG_EMIT` is set, and
+ * :member:`nv->value <nghttp3_qpack_nv.value>` is NULL.  If |*pflags|
+ * has :macro:`NGHTTP3_QPACK_DECODE_FLAG_VALUE_CHUNK` set, a fragment
+ * of the value is assigned to :member:`nv->value
+ * <nghttp3_qpack_nv.value>`, and :member:`nv->name
+ * <nghttp3_qpack_nv.name>` is NULL.  The fragment is only valid until
+ * the next call of this function with the same |sctx|.
+ * `nghttp3_rcbuf_is_static` returns nonzero for it, it need not be
+ * released, and it is not NULL-terminated.
+ *
  * When an HTTP field is decoded, an application receives it in |nv|.
  * :member:`nv->name <nghttp3_qpack_nv.name>` and :member:`nv->value
  * <nghttp3_qpack_nv.value>` are reference counted buffer, and their
@@ -1414,7 +1694,8 @@ nghttp3_qpack_decoder_get_icnt(const nghttp3_qpack_decoder *decoder);
  * Therefore, when application finishes processing |nv|, it must call
  * `nghttp3_rcbuf_decref(nv->name) <nghttp3_rcbuf_decref>` and
  * `nghttp3_rcbuf_decref(nv->value) <nghttp3_rcbuf_decref>`, or memory
- * leak might occur.  These :type:`nghttp3_rcbuf` objects hold the
+ * leak might occur.  Calling `nghttp3_rcbuf_decref` with NULL is
+ * allowed.  These :type:`nghttp3_rcbuf` objects hold the
  * pointer to :type:`nghttp3_mem` that is passed to
  * `nghttp3_qpack_decoder_new` (or either `nghttp3_conn_client_new` or
  * `nghttp3_conn_server_new` if it is used indirectly).  As long as
@@ -1604,8 +1885,40 @@ NGHTTP3_EXTERN void nghttp3_set_debug_vprintf_callback(
  */
 typedef struct nghttp3_conn nghttp3_conn;
 
+/**
+ * @macrosection
+ *
+ * QPACK indexing policies
+ */
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT` is the default QPACK
+ * indexing policy.  QPACK encoder inserts a header field into the
+ * dynamic table based on a fixed list of header field names which
+ * tend to be repeated, and :macro:`NGHTTP3_NV_FLAG_TRY_INDEX`.
+ */
+#define NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT 0x00u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY` is a QPACK
+ * indexing policy which inserts a header field into the dynamic
+ * table only after the same header field name and value pair has
+ * been seen enough times to pay back the table space it occupies.
+ * The larger the header field is, the more repetitions are required.
+ * The frequency is estimated per connection with a small fixed size
+ * counter table whose counts decay over time.
+ * :macro:`NGHTTP3_NV_FLAG_TRY_INDEX` and
+ * :macro:`NGHTTP3_NV_FLAG_NEVER_INDEX` are still honored.
+ */
+#define NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY 0x01u
+
 #define NGHTTP3_SETTINGS_V1 1
-#define NGHTTP3_SETTINGS_VERSION NGHTTP3_SETTINGS_V1
+#define NGHTTP3_SETTINGS_V2 2
+#define NGHTTP3_SETTINGS_VERSION NGHTTP3_SETTINGS_V2
 
 /**
  * @struct
@@ -1652,6 +1965,132 @@ typedef struct nghttp3_settings {
    * Datagrams (see :rfc:`9297`).
    */
   uint8_t h3_datagram;
+  /**
+   * :member:`qpack_indexing_policy` is the policy which QPACK encoder
+   * uses to decide which header fields are inserted into the dynamic
+   * table.  It must be one of
+   * :macro:`NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT` and
+   * :macro:`NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY`.
+   *
+   * When :type:`nghttp3_settings` is passed to
+   * :member:`nghttp3_callbacks.recv_settings` callback, this field
+   * should be ignored.
+   *
+   * This field is available since :macro:`NGHTTP3_SETTINGS_V2`.
+   */
+  uint8_t qpack_indexing_policy;
+  /**
+   * :member:`qpack_borrow_literals`, if set to nonzero, lets QPACK
+   * decoder pass the string literals which are not Huffman encoded to
+   * :member:`nghttp3_callbacks.recv_header` and
+   * :member:`nghttp3_callbacks.recv_trailer` without copying them if
+   * they are entirely contained in the buffer passed to
+   * `nghttp3_conn_read_stream`.  In that case, the field name and
+   * value passed to those callbacks are only valid during the
+   * callback.
+   * Calling `nghttp3_rcbuf_incref` does not extend their lifetime,
+   * and application must copy them if it needs them after the
+   * callback returns.  They are not NULL-terminated.  See
+   * `nghttp3_qpack_decoder_set_borrow_literals` for details.
+   *
+   * When :type:`nghttp3_settings` is passed to
+   * :member:`nghttp3_callbacks.recv_settings` callback, this field
+   * should be ignored.
+   *
+   * This field is available since :macro:`NGHTTP3_SETTINGS_V2`.
+   */
+  uint8_t qpack_borrow_literals;
+  /**
+   * :member:`enable_request_view`, if set to nonzero, makes server
+   * keep the values of well-known request header fields while
+   * decoding them, so that application can get them with
+   * `nghttp3_conn_get_request_view` without processing each header
+   * field.  Client ignores this field.
+   *
+   * When :type:`nghttp3_settings` is passed to
+   * :member:`nghttp3_callbacks.recv_settings` callback, this field
+   * should be ignored.
+   *
+   * This field is available since :macro:`NGHTTP3_SETTINGS_V2`.
+   */
+  uint8_t enable_request_view;
+  /**
+   * :member:`qpack_ring_dtable`, if set to nonzero, makes QPACK
+   * encoder and decoder store their dynamic tables in preallocated
+   * circular buffers so that inserting and evicting an entry do not
+   * allocate or free memory.  The field name and value which QPACK
+   * decoder takes from its dynamic table and passes to
+   * :member:`nghttp3_callbacks.recv_header` and
+   * :member:`nghttp3_callbacks.recv_trailer` are only valid during
+   * the callback.  Calling `nghttp3_rcbuf_incref` does not extend
+   * their lifetime, and they are not NULL-terminated.  See
+   * `nghttp3_qpack_decoder_enable_ring_dtable` for details.
+   *
+   * When :type:`nghttp3_settings` is passed to
+   * :member:`nghttp3_callbacks.recv_settings` callback, this field
+   * should be ignored.
+   *
+   * This field is available since :macro:`NGHTTP3_SETTINGS_V2`.
+   */
+  uint8_t qpack_ring_dtable;
+  /**
+   * :member:`enable_drr_scheduler`, if set to nonzero, makes
+   * `nghttp3_conn_writev_stream` choose request streams with a
+   * deficit round-robin scheduler which costs O(1) per call.  Each
+   * urgency level has a first-in first-out queue of non-incremental
+   * streams and a round-robin queue of incremental streams.  A
+   * non-incremental stream keeps sending until it is blocked or
+   * finished, and is served before the incremental streams at the
+   * same urgency.  An incremental stream yields to the next one
+   * after it has written its quantum.  If this field is 0, streams
+   * are ordered by a priority queue which costs O(log n) per write.
+   *
+   * When :type:`nghttp3_settings` is passed to
+   * :member:`nghttp3_callbacks.recv_settings` callback, this field
+   * should be ignored.
+   *
+   * This field is available since :macro:`NGHTTP3_SETTINGS_V2`.
+   */
+  uint8_t enable_drr_scheduler;
+  /**
+   * :member:`qpack_max_blocked_datalen` is the maximum number of
+   * bytes of request stream data which a connection buffers in total
+   * while the streams are blocked by QPACK decoder.  If a remote
+   * endpoint sends more, `nghttp3_conn_read_stream` returns
+   * :macro:`NGHTTP3_ERR_H3_EXCESSIVE_LOAD`.  The buffers are pooled
+   * and reused, and they are not freed until `nghttp3_conn_del` is
+   * called.  This field therefore also bounds the memory that the
+   * pool keeps.  Setting it to :macro:`SIZE_MAX` removes the limit.
+   *
+   * When :type:`nghttp3_settings` is passed to
+   * :member:`nghttp3_callbacks.recv_settings` callback, this field
+   * should be ignored.
+   *
+   * This field is available since :macro:`NGHTTP3_SETTINGS_V2`.
+   */
+  size_t qpack_max_blocked_datalen;
+  /**
+   * :member:`eager_header_encoding`, if set to nonzero, makes
+   * `nghttp3_conn_submit_request`, `nghttp3_conn_submit_info`,
+   * `nghttp3_conn_submit_response`, and
+   * `nghttp3_conn_submit_trailers` encode HTTP fields with QPACK
+   * encoder immediately instead of copying them to encode later when
+   * the stream is written.  An application can free or reuse the
+   * memory pointed by the fields as soon as these functions return in
+   * either case.  HTTP fields are still copied if the stream has
+   * frames which are not written yet, so that the frames are sent in
+   * order.  They are also copied until SETTINGS frame from a remote
+   * endpoint is received, because QPACK encoder cannot use the
+   * dynamic table before it learns the capacity that the remote
+   * endpoint allows.
+   *
+   * When :type:`nghttp3_settings` is passed to
+   * :member:`nghttp3_callbacks.recv_settings` callback, this field
+   * should be ignored.
+   *
+   * This field is available since :macro:`NGHTTP3_SETTINGS_V2`.
+   */
+  uint8_t eager_header_encoding;
 } nghttp3_settings;
 
 /**
@@ -1728,6 +2167,35 @@ typedef int (*nghttp3_deferred_consume)(nghttp3_conn *conn, int64_t stream_id,
                                         size_t consumed, void *conn_user_data,
                                         void *stream_user_data);
 
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_retain_buf` is a callback function which is invoked
+ * when the library keeps a reference to a part of the buffer
+ * identified by |buf_user_data| which is passed to
+ * `nghttp3_conn_read_stream_ref`, instead of copying it.  The
+ * application must keep the buffer alive and unchanged until
+ * :type:`nghttp3_release_buf` is invoked with the same
+ * |buf_user_data|.  This callback may be invoked more than once for
+ * the same buffer.
+ */
+typedef void (*nghttp3_retain_buf)(nghttp3_conn *conn, void *buf_user_data,
+                                   void *conn_user_data);
+
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_release_buf` is a callback function which is invoked
+ * when the library drops the reference to the buffer identified by
+ * |buf_user_data| which it took by invoking
+ * :type:`nghttp3_retain_buf`.  It is invoked exactly once for each
+ * invocation of :type:`nghttp3_retain_buf`, either when the stream
+ * has consumed the data, or when the stream or the connection is
+ * deleted.
+ */
+typedef void (*nghttp3_release_buf)(nghttp3_conn *conn, void *buf_user_data,
+                                    void *conn_user_data);
+
 /**
  * @functypedef
  *
@@ -1760,7 +2228,10 @@ typedef int (*nghttp3_begin_headers)(nghttp3_conn *conn, int64_t stream_id,
  * The buffers for |name| and |value| are reference counted. If
  * application needs to keep them, increment the reference count with
  * `nghttp3_rcbuf_incref`.  When they are no longer used, call
- * `nghttp3_rcbuf_decref`.
+ * `nghttp3_rcbuf_decref`.  If
+ * :member:`nghttp3_settings.qpack_borrow_literals` is nonzero, they
+ * might refer to the buffer passed to `nghttp3_conn_read_stream`, and
+ * are only valid during this callback.
  *
  * The implementation of this callback must return 0 if it succeeds.
  * Returning :macro:`NGHTTP3_ERR_CALLBACK_FAILURE` will return to the
@@ -1773,6 +2244,33 @@ typedef int (*nghttp3_recv_header)(nghttp3_conn *conn, int64_t stream_id,
                                    void *conn_user_data,
                                    void *stream_user_data);
 
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_recv_header_section` is a callback function which is
+ * invoked when an entire HTTP field section is received on a stream
+ * denoted by |stream_id|.  |nva| of length |nvlen| contains the HTTP
+ * fields in the order they appear in the field section.  The fields
+ * which are removed or rejected by HTTP messaging validation are not
+ * included.
+ *
+ * |nva| and the buffers pointed by each :member:`nghttp3_qpack_nv.name`
+ * and :member:`nghttp3_qpack_nv.value` are owned by the stream, and
+ * are only valid during this callback.  Application must not call
+ * `nghttp3_rcbuf_incref` or `nghttp3_rcbuf_decref` on them, and must
+ * copy the data if it needs them after the callback returns.
+ *
+ * The implementation of this callback must return 0 if it succeeds.
+ * Returning :macro:`NGHTTP3_ERR_CALLBACK_FAILURE` will return to the
+ * caller immediately.  Any values other than 0 is treated as
+ * :macro:`NGHTTP3_ERR_CALLBACK_FAILURE`.
+ */
+typedef int (*nghttp3_recv_header_section)(nghttp3_conn *conn,
+                                           int64_t stream_id,
+                                           const nghttp3_qpack_nv *nva,
+                                           size_t nvlen, void *conn_user_data,
+                                           void *stream_user_data);
+
 /**
  * @functypedef
  *
@@ -1892,7 +2390,8 @@ typedef int (*nghttp3_recv_settings)(nghttp3_conn *conn,
                                      void *conn_user_data);
 
 #define NGHTTP3_CALLBACKS_V1 1
-#define NGHTTP3_CALLBACKS_VERSION NGHTTP3_CALLBACKS_V1
+#define NGHTTP3_CALLBACKS_V2 2
+#define NGHTTP3_CALLBACKS_VERSION NGHTTP3_CALLBACKS_V2
 
 /**
  * @struct
@@ -1986,6 +2485,44 @@ typedef struct nghttp3_callbacks {
    * when SETTINGS frame is received.
    */
   nghttp3_recv_settings recv_settings;
+  /**
+   * :member:`recv_header_section` is a callback function which is
+   * invoked when an entire HTTP header field section is received on a
+   * particular stream.  If this field is set, :member:`recv_header`
+   * is not called, and the fields are delivered to this callback at
+   * once.
+   *
+   * This field is available since :macro:`NGHTTP3_CALLBACKS_V2`.
+   */
+  nghttp3_recv_header_section recv_header_section;
+  /**
+   * :member:`recv_trailer_section` is a callback function which is
+   * invoked when an entire HTTP trailer field section is received on
+   * a particular stream.  If this field is set,
+   * :member:`recv_trailer` is not called, and the fields are
+   * delivered to this callback at once.
+   *
+   * This field is available since :macro:`NGHTTP3_CALLBACKS_V2`.
+   */
+  nghttp3_recv_header_section recv_trailer_section;
+  /**
+   * :member:`retain_buf` is a callback function which is invoked when
+   * the library keeps a reference to the buffer passed to
+   * `nghttp3_conn_read_stream_ref`.  If either this field or
+   * :member:`release_buf` is NULL, the library copies the data
+   * instead.
+   *
+   * This field is available since :macro:`NGHTTP3_CALLBACKS_V2`.
+   */
+  nghttp3_retain_buf retain_buf;
+  /**
+   * :member:`release_buf` is a callback function which is invoked
+   * when the library drops the reference taken by
+   * :member:`retain_buf`.
+   *
+   * This field is available since :macro:`NGHTTP3_CALLBACKS_V2`.
+   */
+  nghttp3_release_buf release_buf;
 } nghttp3_callbacks;
 
 /**
@@ -2004,6 +2541,24 @@ typedef struct nghttp3_callbacks {
  *   <nghttp3_settings.qpack_blocked_streams>` = 0
  * - :member:`enable_connect_protocol
  *   <nghttp3_settings.enable_connect_protocol>` = 0
+ * - :member:`qpack_indexing_policy
+ *   <nghttp3_settings.qpack_indexing_policy>` =
+ *   :macro:`NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT`
+ * - :member:`qpack_borrow_literals
+ *   <nghttp3_settings.qpack_borrow_literals>` = 0
+ * - :member:`enable_request_view
+ *   <nghttp3_settings.enable_request_view>` = 0
+ * - :member:`qpack_ring_dtable
+ *   <nghttp3_settings.qpack_ring_dtable>` = 0
+ * - :member:`enable_drr_scheduler
+ *   <nghttp3_settings.enable_drr_scheduler>` = 0
+ * - :member:`qpack_max_blocked_datalen
+ *   <nghttp3_settings.qpack_max_blocked_datalen>` = 1048576
+ * - :member:`eager_header_encoding
+ *   <nghttp3_settings.eager_header_encoding>` = 0
+ *
+ * Only the fields which are available in |settings_version| are
+ * written.
  */
 NGHTTP3_EXTERN void
 nghttp3_settings_default_versioned(int settings_version,
@@ -2060,6 +2615,58 @@ nghttp3_conn_server_new_versioned(nghttp3_conn **pconn, int callbacks_version,
  */
 NGHTTP3_EXTERN void nghttp3_conn_del(nghttp3_conn *conn);
 
+/**
+ * @function
+ *
+ * `nghttp3_conn_reset_client` makes |conn|, which has been created by
+ * `nghttp3_conn_client_new`, the state as if it were created by
+ * `nghttp3_conn_client_new` with |callbacks|, |settings|, and
+ * |conn_user_data|, and the memory allocator which |conn| was created
+ * with.  All streams are closed without calling any callback, and
+ * the memory which they have used is kept for the next connection.
+ * If the QPACK settings in |settings| are the same as before, QPACK
+ * encoder and decoder reuse their dynamic table and the other memory
+ * as well.  An application can use this function instead of
+ * `nghttp3_conn_del` to keep a finished connection for the next one,
+ * and save the cost of allocations made during its setup.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_ARGUMENT`
+ *     |conn| is not created for client use.
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * If this function fails, |conn| is left unchanged.
+ */
+NGHTTP3_EXTERN int nghttp3_conn_reset_client_versioned(
+    nghttp3_conn *conn, int callbacks_version,
+    const nghttp3_callbacks *callbacks, int settings_version,
+    const nghttp3_settings *settings, void *conn_user_data);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_reset_server` is the server side counterpart of
+ * `nghttp3_conn_reset_client`.  |conn| must have been created by
+ * `nghttp3_conn_server_new`.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_ARGUMENT`
+ *     |conn| is not created for server use.
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * If this function fails, |conn| is left unchanged.
+ */
+NGHTTP3_EXTERN int nghttp3_conn_reset_server_versioned(
+    nghttp3_conn *conn, int callbacks_version,
+    const nghttp3_callbacks *callbacks, int settings_version,
+    const nghttp3_settings *settings, void *conn_user_data);
+
 /**
  * @function
  *
@@ -2130,27 +2737,98 @@ NGHTTP3_EXTERN nghttp3_ssize nghttp3_conn_read_stream(nghttp3_conn *conn,
 /**
  * @function
  *
- * `nghttp3_conn_writev_stream` stores stream data to send to |vec| of
- * length |veccnt|, and returns the number of nghttp3_vec object in
- * which it stored data.  It stores stream ID to |*pstream_id|.  An
- * application has to call `nghttp3_conn_add_write_offset` to inform
- * |conn| of the actual number of bytes that underlying QUIC stack
- * accepted.  |*pfin| will be nonzero if this is the last data to
- * send.  If there is no stream to write data or send fin, this
- * function returns 0, and -1 is assigned to |*pstream_id|.  This
- * function may return 0, and |*pstream_id| is not -1, and |*pfin| is
- * nonzero.  It means 0 length data to |*pstream_id|, and it is the
- * last data to the stream.  They must be passed to QUIC stack, and
- * they are accepted, the application has to call
- * `nghttp3_conn_add_write_offset` with 0 byte.
+ * `nghttp3_conn_read_stream_ref` is similar to
+ * `nghttp3_conn_read_stream`, but |src| is a part of the buffer owned
+ * by application which is identified by |buf_user_data|.  If the
+ * stream is blocked by QPACK decoder, the library does not copy the
+ * unprocessed part of |src|.  Instead, it invokes
+ * :member:`nghttp3_callbacks.retain_buf` and keeps a reference to
+ * |src| until it processes the data, and then invokes
+ * :member:`nghttp3_callbacks.release_buf`.  If either callback is
+ * NULL, the data is copied as `nghttp3_conn_read_stream` does.
  *
- * This function returns the number of bytes consumed, or one of the
- * following negative error codes:
+ * This function returns the same values as
+ * `nghttp3_conn_read_stream`.
+ */
+NGHTTP3_EXTERN nghttp3_ssize nghttp3_conn_read_stream_ref(
+    nghttp3_conn *conn, int64_t stream_id, const uint8_t *src, size_t srclen,
+    int fin, void *buf_user_data);
+
+/**
+ * @struct
  *
- * :macro:`NGHTTP3_ERR_NOMEM`
- *     Out of memory.
- * :macro:`NGHTTP3_ERR_CALLBACK_FAILURE`
- *     User callback failed.
+ * :type:`nghttp3_stream_data` is the data received on a stream which
+ * is passed to `nghttp3_conn_read_streams`.
+ */
+typedef struct nghttp3_stream_data {
+  /**
+   * :member:`stream_id` is the stream ID which the data is received
+   * on.
+   */
+  int64_t stream_id;
+  /**
+   * :member:`data` points to the received data.
+   */
+  const uint8_t *data;
+  /**
+   * :member:`datalen` is the length of :member:`data`.
+   */
+  size_t datalen;
+  /**
+   * :member:`fin`, if nonzero, indicates that this is the last data
+   * from remote endpoint in the stream.
+   */
+  int fin;
+} nghttp3_stream_data;
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_read_streams` reads |sdatalen| pieces of stream data
+ * pointed by |sdata| in order.  It is equivalent to calling
+ * `nghttp3_conn_read_stream` for each element of |sdata|, but
+ * consecutive elements for the same stream share the stream lookup.
+ * The number of bytes consumed for each element of |sdata| is stored
+ * in the element of |pnconsumed| at the same index.  |pnconsumed|
+ * must have at least |sdatalen| elements.
+ *
+ * This function returns 0 if it succeeds, or one of the negative
+ * error codes that `nghttp3_conn_read_stream` returns.  If it fails,
+ * the elements before the one that caused the error have been
+ * processed, and their consumed bytes have been stored in
+ * |pnconsumed|.  The negative error code means that |conn|
+ * encountered a connection error, and the connection should be
+ * closed.
+ */
+NGHTTP3_EXTERN int nghttp3_conn_read_streams(nghttp3_conn *conn,
+                                             const nghttp3_stream_data *sdata,
+                                             size_t sdatalen,
+                                             size_t *pnconsumed);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_writev_stream` stores stream data to send to |vec| of
+ * length |veccnt|, and returns the number of nghttp3_vec object in
+ * which it stored data.  It stores stream ID to |*pstream_id|.  An
+ * application has to call `nghttp3_conn_add_write_offset` to inform
+ * |conn| of the actual number of bytes that underlying QUIC stack
+ * accepted.  |*pfin| will be nonzero if this is the last data to
+ * send.  If there is no stream to write data or send fin, this
+ * function returns 0, and -1 is assigned to |*pstream_id|.  This
+ * function may return 0, and |*pstream_id| is not -1, and |*pfin| is
+ * nonzero.  It means 0 length data to |*pstream_id|, and it is the
+ * last data to the stream.  They must be passed to QUIC stack, and
+ * they are accepted, the application has to call
+ * `nghttp3_conn_add_write_offset` with 0 byte.
+ *
+ * This function returns the number of bytes consumed, or one of the
+ * following negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ * :macro:`NGHTTP3_ERR_CALLBACK_FAILURE`
+ *     User callback failed.
  *
  * It may return the other error codes.  In general, the negative
  * error code means that |conn| encountered a connection error, and
@@ -2189,6 +2867,102 @@ NGHTTP3_EXTERN nghttp3_ssize nghttp3_conn_writev_stream(nghttp3_conn *conn,
 NGHTTP3_EXTERN int nghttp3_conn_add_write_offset(nghttp3_conn *conn,
                                                  int64_t stream_id, size_t n);
 
+/**
+ * @struct
+ *
+ * :type:`nghttp3_stream_vec` describes the data to send to a single
+ * stream, which `nghttp3_conn_writev_streams` produces.
+ */
+typedef struct nghttp3_stream_vec {
+  /**
+   * :member:`stream_id` is the stream ID to which the data is sent.
+   */
+  int64_t stream_id;
+  /**
+   * :member:`vec` points to the first :type:`nghttp3_vec` of the data
+   * inside the array passed to `nghttp3_conn_writev_streams`.
+   */
+  nghttp3_vec *vec;
+  /**
+   * :member:`veccnt` is the number of :type:`nghttp3_vec` pointed by
+   * :member:`vec`.  It might be 0 if only fin is sent.
+   */
+  size_t veccnt;
+  /**
+   * :member:`datalen` is the number of bytes pointed by :member:`vec`.
+   * If QUIC stack accepts fewer bytes, an application should update
+   * this field before passing this object to
+   * `nghttp3_conn_add_write_offsets`.
+   */
+  size_t datalen;
+  /**
+   * :member:`fin` is nonzero if this is the last data to send to the
+   * stream.
+   */
+  int fin;
+} nghttp3_stream_vec;
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_writev_streams` is the batch variant of
+ * `nghttp3_conn_writev_stream`.  It collects the data to send from
+ * as many streams as the scheduler selects in priority order, up to
+ * |maxdatalen| bytes in total.  The data of each stream is described
+ * by an element of |svec| of length |sveccnt|, and its
+ * :type:`nghttp3_vec` are stored to the consecutive range of |vec| of
+ * length |veccnt|.  This function returns the number of elements of
+ * |svec| it filled, and each stream appears at most once.  If the
+ * data of the last stream is truncated to fit into |maxdatalen|, its
+ * :member:`nghttp3_stream_vec.fin` is 0.  The data of QPACK encoder
+ * stream which is produced while this function encodes header fields
+ * after QPACK encoder stream has been taken is left for the next
+ * call.
+ *
+ * The streams are put back to the scheduler before this function
+ * returns, but their data are not consumed until an application
+ * calls `nghttp3_conn_add_write_offsets` or
+ * `nghttp3_conn_add_write_offset` for them.  If this function is
+ * called again before the returned data are committed, it may return
+ * the same data again.
+ *
+ * This function returns the number of elements of |svec| it filled,
+ * or one of the following negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ * :macro:`NGHTTP3_ERR_CALLBACK_FAILURE`
+ *     User callback failed.
+ *
+ * It may return the other error codes.  In general, the negative
+ * error code means that |conn| encountered a connection error, and
+ * the connection should be closed.
+ */
+NGHTTP3_EXTERN nghttp3_ssize
+nghttp3_conn_writev_streams(nghttp3_conn *conn, nghttp3_stream_vec *svec,
+                            size_t sveccnt, nghttp3_vec *vec, size_t veccnt,
+                            size_t maxdatalen);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_add_write_offsets` calls
+ * `nghttp3_conn_add_write_offset` for each element of |svec| of
+ * length |sveccnt| with its :member:`nghttp3_stream_vec.stream_id`
+ * and :member:`nghttp3_stream_vec.datalen`.  |svec| is typically the
+ * array filled by `nghttp3_conn_writev_streams`.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ */
+NGHTTP3_EXTERN int
+nghttp3_conn_add_write_offsets(nghttp3_conn *conn,
+                               const nghttp3_stream_vec *svec,
+                               size_t sveccnt);
+
 /**
  * @function
  *
@@ -2422,6 +3196,70 @@ typedef nghttp3_ssize (*nghttp3_read_data_callback)(
     nghttp3_conn *conn, int64_t stream_id, nghttp3_vec *vec, size_t veccnt,
     uint32_t *pflags, void *conn_user_data, void *stream_user_data);
 
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_release_vec` is a callback function which is invoked
+ * when the library no longer refers to the data of
+ * :type:`nghttp3_ref_vec` which carries |vec_user_data|.  It is
+ * invoked exactly once for each :type:`nghttp3_ref_vec`, either when
+ * all of its bytes are acknowledged by a remote endpoint, or when the
+ * stream denoted by |stream_id| is closed.
+ */
+typedef void (*nghttp3_release_vec)(nghttp3_conn *conn, int64_t stream_id,
+                                    void *vec_user_data, void *conn_user_data,
+                                    void *stream_user_data);
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_ref_vec` is a piece of stream data with a handle
+ * which tells application when the data is safe to free.
+ */
+typedef struct nghttp3_ref_vec {
+  /**
+   * :member:`base` points to the data.
+   */
+  uint8_t *base;
+  /**
+   * :member:`len` is the number of bytes which the buffer pointed by
+   * :member:`base` contains.
+   */
+  size_t len;
+  /**
+   * :member:`release` is a callback function which is invoked when
+   * the library no longer refers to the data.  It may be NULL.
+   */
+  nghttp3_release_vec release;
+  /**
+   * :member:`user_data` is an opaque pointer which is passed to
+   * :member:`release`.
+   */
+  void *user_data;
+} nghttp3_ref_vec;
+
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_read_data_ref_callback` is similar to
+ * :type:`nghttp3_read_data_callback`, but the application fills
+ * |rvec| of length |rveccnt|.  Instead of
+ * :type:`nghttp3_acked_stream_data` callback, the library notifies
+ * the application that the data of each object is safe to free by
+ * calling its :member:`nghttp3_ref_vec.release` callback once.
+ *
+ * The callback should return the number of objects in |rvec| that
+ * the application filled if it succeeds, or
+ * :macro:`NGHTTP3_ERR_WOULDBLOCK`, or
+ * :macro:`NGHTTP3_ERR_CALLBACK_FAILURE`.  If the callback fails, the
+ * library does not call :member:`nghttp3_ref_vec.release` for the
+ * objects filled in this call.
+ */
+typedef nghttp3_ssize (*nghttp3_read_data_ref_callback)(
+    nghttp3_conn *conn, int64_t stream_id, nghttp3_ref_vec *rvec,
+    size_t rveccnt, uint32_t *pflags, void *conn_user_data,
+    void *stream_user_data);
+
 /**
  * @struct
  *
@@ -2435,6 +3273,21 @@ typedef struct nghttp3_data_reader {
   nghttp3_read_data_callback read_data;
 } nghttp3_data_reader;
 
+/**
+ * @struct
+ *
+ * :type:`nghttp3_data_ref_reader` specifies the way how to generate
+ * request or response body whose pieces are released individually.
+ * It is passed to `nghttp3_conn_submit_request_ref` and
+ * `nghttp3_conn_submit_response_ref`.
+ */
+typedef struct nghttp3_data_ref_reader {
+  /**
+   * :member:`read_data_ref` is a callback function to generate body.
+   */
+  nghttp3_read_data_ref_callback read_data_ref;
+} nghttp3_data_ref_reader;
+
 /**
  * @function
  *
@@ -2463,6 +3316,30 @@ NGHTTP3_EXTERN int nghttp3_conn_submit_request(
     nghttp3_conn *conn, int64_t stream_id, const nghttp3_nv *nva, size_t nvlen,
     const nghttp3_data_reader *dr, void *stream_user_data);
 
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_request_ref` is similar to
+ * `nghttp3_conn_submit_request`, but a request body is generated by
+ * |rdr|, whose pieces are released individually.  |rdr| must not be
+ * NULL.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_ARGUMENT`
+ *     |stream_id| identifies unidirectional stream.
+ * :macro:`NGHTTP3_ERR_CONN_CLOSING`
+ *     Connection is shutting down, and no new stream is allowed.
+ * :macro:`NGHTTP3_ERR_STREAM_IN_USE`
+ *     Stream has already been opened.
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ */
+NGHTTP3_EXTERN int nghttp3_conn_submit_request_ref(
+    nghttp3_conn *conn, int64_t stream_id, const nghttp3_nv *nva, size_t nvlen,
+    const nghttp3_data_ref_reader *rdr, void *stream_user_data);
+
 /**
  * @function
  *
@@ -2506,6 +3383,135 @@ NGHTTP3_EXTERN int nghttp3_conn_submit_response(nghttp3_conn *conn,
                                                 size_t nvlen,
                                                 const nghttp3_data_reader *dr);
 
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_response_ref` is similar to
+ * `nghttp3_conn_submit_response`, but a response body is generated
+ * by |rdr|, whose pieces are released individually.  |rdr| must not
+ * be NULL.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_STREAM_NOT_FOUND`
+ *     Stream not found
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ */
+NGHTTP3_EXTERN int nghttp3_conn_submit_response_ref(
+    nghttp3_conn *conn, int64_t stream_id, const nghttp3_nv *nva, size_t nvlen,
+    const nghttp3_data_ref_reader *rdr);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_response_file` is similar to
+ * `nghttp3_conn_submit_response`, but the response body is |len|
+ * bytes of the file denoted by the file descriptor |fd| starting at
+ * |offset|.  The library reads the file with pread(2) lazily in
+ * segments when it needs more data to send, and frees each segment
+ * when it is acknowledged by a remote endpoint.  The application
+ * must keep |fd| open until the stream is closed.  If the file
+ * cannot be read, or it ends before |len| bytes are read,
+ * `nghttp3_conn_writev_stream` and `nghttp3_conn_writev_streams`
+ * return :macro:`NGHTTP3_ERR_CALLBACK_FAILURE`.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_ARGUMENT`
+ *     |fd| or |offset| is negative, |len| is too large, or |offset| +
+ *     |len| exceeds :macro:`INT64_MAX`.
+ * :macro:`NGHTTP3_ERR_INVALID_STATE`
+ *     The library is built without pread(2).
+ * :macro:`NGHTTP3_ERR_STREAM_NOT_FOUND`
+ *     Stream not found
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ */
+NGHTTP3_EXTERN int nghttp3_conn_submit_response_file(
+    nghttp3_conn *conn, int64_t stream_id, const nghttp3_nv *nva, size_t nvlen,
+    int fd, int64_t offset, uint64_t len);
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_encoded_field_section` is an immutable QPACK encoded
+ * field section which only refers to the static table and literals.
+ * Because it does not depend on the dynamic table of any connection,
+ * it can be sent on any stream of any :type:`nghttp3_conn` with
+ * `nghttp3_conn_submit_response_encoded`, which makes it suitable to
+ * cache the response header fields of a frequently served object.
+ * The details of this structure are intentionally hidden from the
+ * public API.
+ */
+typedef struct nghttp3_encoded_field_section nghttp3_encoded_field_section;
+
+/**
+ * @function
+ *
+ * `nghttp3_encoded_field_section_new` encodes |nva| of length |nvlen|
+ * without dynamic table, and assigns the pointer to the object that
+ * holds the encoded field section to |*pefs|.  Header fields which
+ * must not be indexed, such as those with
+ * :macro:`NGHTTP3_NV_FLAG_NEVER_INDEX`, are encoded so that
+ * intermediaries do not index them.  |mem| is a memory allocator.
+ * If |mem| is ``NULL``, the memory allocator returned by
+ * `nghttp3_mem_default` is used.
+ *
+ * The returned object is reference counted, and the library holds a
+ * reference to it while it has a pending HEADERS frame that uses it.
+ * The reference counting is not thread-safe, and the object must not
+ * be shared between threads.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ */
+NGHTTP3_EXTERN int
+nghttp3_encoded_field_section_new(nghttp3_encoded_field_section **pefs,
+                                  const nghttp3_nv *nva, size_t nvlen,
+                                  const nghttp3_mem *mem);
+
+/**
+ * @function
+ *
+ * `nghttp3_encoded_field_section_decref` decrements the reference
+ * count of |efs| by 1, and frees it if the reference count becomes
+ * 0.  Call this function to release the reference which
+ * `nghttp3_encoded_field_section_new` returned.  |efs| is freed once
+ * the library no longer uses it.  If |efs| is NULL, this function
+ * does nothing.
+ */
+NGHTTP3_EXTERN void
+nghttp3_encoded_field_section_decref(nghttp3_encoded_field_section *efs);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_response_encoded` is similar to
+ * `nghttp3_conn_submit_response`, but HTTP response header fields are
+ * given as |efs| that is encoded in advance, and they are sent
+ * without being encoded again.  The library keeps a reference to
+ * |efs| until it is no longer needed, so that an application can
+ * call `nghttp3_encoded_field_section_decref` right after this function
+ * returns.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_STREAM_NOT_FOUND`
+ *     Stream not found
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ */
+NGHTTP3_EXTERN int nghttp3_conn_submit_response_encoded(
+    nghttp3_conn *conn, int64_t stream_id,
+    nghttp3_encoded_field_section *efs, const nghttp3_data_reader *dr);
+
 /**
  * @function
  *
@@ -2589,6 +3595,18 @@ NGHTTP3_EXTERN int nghttp3_conn_set_stream_user_data(nghttp3_conn *conn,
 NGHTTP3_EXTERN uint64_t nghttp3_conn_get_frame_payload_left(nghttp3_conn *conn,
                                                             int64_t stream_id);
 
+/**
+ * @function
+ *
+ * `nghttp3_conn_get_qpack_stats` stores the compression statistics
+ * of QPACK encoder of |conn| into |*encoder_stats|, and those of
+ * QPACK decoder into |*decoder_stats|.  Either of them can be NULL.
+ * See :type:`nghttp3_qpack_stats` for the meaning of each counter.
+ */
+NGHTTP3_EXTERN void nghttp3_conn_get_qpack_stats_versioned(
+    const nghttp3_conn *conn, int stats_version,
+    nghttp3_qpack_stats *encoder_stats, nghttp3_qpack_stats *decoder_stats);
+
 /**
  * @macrosection
  *
@@ -2669,6 +3687,163 @@ typedef struct NGHTTP3_ALIGN(8) nghttp3_pri {
 NGHTTP3_EXTERN int nghttp3_conn_get_stream_priority_versioned(
     nghttp3_conn *conn, int pri_version, nghttp3_pri *dest, int64_t stream_id);
 
+/**
+ * @macrosection
+ *
+ * HTTP request methods
+ */
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_UNKNOWN` indicates that a request method is
+ * not one of the methods defined below, or it is not known yet.
+ */
+#define NGHTTP3_METHOD_UNKNOWN 0x00u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_GET` indicates GET method.
+ */
+#define NGHTTP3_METHOD_GET 0x01u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_HEAD` indicates HEAD method.
+ */
+#define NGHTTP3_METHOD_HEAD 0x02u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_POST` indicates POST method.
+ */
+#define NGHTTP3_METHOD_POST 0x03u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_PUT` indicates PUT method.
+ */
+#define NGHTTP3_METHOD_PUT 0x04u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_DELETE` indicates DELETE method.
+ */
+#define NGHTTP3_METHOD_DELETE 0x05u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_CONNECT` indicates CONNECT method.
+ */
+#define NGHTTP3_METHOD_CONNECT 0x06u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_OPTIONS` indicates OPTIONS method.
+ */
+#define NGHTTP3_METHOD_OPTIONS 0x07u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_TRACE` indicates TRACE method.
+ */
+#define NGHTTP3_METHOD_TRACE 0x08u
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_METHOD_PATCH` indicates PATCH method.
+ */
+#define NGHTTP3_METHOD_PATCH 0x09u
+
+#define NGHTTP3_REQUEST_VIEW_V1 1
+#define NGHTTP3_REQUEST_VIEW_VERSION NGHTTP3_REQUEST_VIEW_V1
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_request_view` is a view of the well-known header
+ * fields of a request which server has received.  The buffers
+ * pointed by the members of :type:`nghttp3_vec` type are owned by the
+ * stream, and they are valid until the stream is closed.  If a header
+ * field is not present, the corresponding :type:`nghttp3_vec` has
+ * zero length.
+ */
+typedef struct nghttp3_request_view {
+  /**
+   * :member:`method` is the request method.  It is one of
+   * :macro:`NGHTTP3_METHOD_* <NGHTTP3_METHOD_UNKNOWN>`.
+   */
+  uint8_t method;
+  /**
+   * :member:`method_name` is the value of :method header field.
+   * Application should look at this field if :member:`method` is
+   * :macro:`NGHTTP3_METHOD_UNKNOWN`.
+   */
+  nghttp3_vec method_name;
+  /**
+   * :member:`path` is the value of :path header field.
+   */
+  nghttp3_vec path;
+  /**
+   * :member:`authority` is the value of :authority header field.  If
+   * it is absent, it is the value of host header field.
+   */
+  nghttp3_vec authority;
+  /**
+   * :member:`scheme` is the value of :scheme header field.
+   */
+  nghttp3_vec scheme;
+  /**
+   * :member:`content_length` is the value of content-length header
+   * field.  It is -1 if the header field is not present.
+   */
+  int64_t content_length;
+  /**
+   * :member:`pri` is the priority specified by priority header field.
+   * If the header field is absent or invalid, it has the default
+   * priority.  It does not reflect PRIORITY_UPDATE frame.  Use
+   * `nghttp3_conn_get_stream_priority` to get the effective priority.
+   */
+  nghttp3_pri pri;
+} nghttp3_request_view;
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_get_request_view` stores the view of the request
+ * header fields received on a stream denoted by |stream_id| into
+ * |*dest|.  |stream_id| must identify client initiated bidirectional
+ * stream.  It is intended to be called from
+ * :member:`nghttp3_callbacks.end_headers` callback or later.  Only
+ * server can use this function, and
+ * :member:`nghttp3_settings.enable_request_view` must be nonzero.
+ *
+ * This function must not be called if |conn| is initialized as
+ * client.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_ARGUMENT`
+ *     |stream_id| is not a client initiated bidirectional stream ID.
+ * :macro:`NGHTTP3_ERR_INVALID_STATE`
+ *     :member:`nghttp3_settings.enable_request_view` is not enabled.
+ * :macro:`NGHTTP3_ERR_STREAM_NOT_FOUND`
+ *     Stream not found.
+ */
+NGHTTP3_EXTERN int nghttp3_conn_get_request_view_versioned(
+    nghttp3_conn *conn, int request_view_version, nghttp3_request_view *dest,
+    int64_t stream_id);
+
 /**
  * @function
  *
@@ -2877,6 +4052,26 @@ NGHTTP3_EXTERN int nghttp3_err_is_fatal(int liberr);
                                     (CALLBACKS), NGHTTP3_SETTINGS_VERSION,     \
                                     (SETTINGS), (MEM), (USER_DATA))
 
+/*
+ * `nghttp3_conn_reset_client` is a wrapper around
+ * `nghttp3_conn_reset_client_versioned` to set the correct struct
+ * version.
+ */
+#define nghttp3_conn_reset_client(CONN, CALLBACKS, SETTINGS, USER_DATA)        \
+  nghttp3_conn_reset_client_versioned((CONN), NGHTTP3_CALLBACKS_VERSION,       \
+                                      (CALLBACKS), NGHTTP3_SETTINGS_VERSION,   \
+                                      (SETTINGS), (USER_DATA))
+
+/*
+ * `nghttp3_conn_reset_server` is a wrapper around
+ * `nghttp3_conn_reset_server_versioned` to set the correct struct
+ * version.
+ */
+#define nghttp3_conn_reset_server(CONN, CALLBACKS, SETTINGS, USER_DATA)        \
+  nghttp3_conn_reset_server_versioned((CONN), NGHTTP3_CALLBACKS_VERSION,       \
+                                      (CALLBACKS), NGHTTP3_SETTINGS_VERSION,   \
+                                      (SETTINGS), (USER_DATA))
+
 /*
  * `nghttp3_conn_set_server_stream_priority` is a wrapper around
  * `nghttp3_conn_set_server_stream_priority_versioned` to set the
@@ -2895,6 +4090,42 @@ NGHTTP3_EXTERN int nghttp3_err_is_fatal(int liberr);
   nghttp3_conn_get_stream_priority_versioned((CONN), NGHTTP3_PRI_VERSION,      \
                                              (DEST), (STREAM_ID))
 
+/*
+ * `nghttp3_conn_get_request_view` is a wrapper around
+ * `nghttp3_conn_get_request_view_versioned` to set the correct struct
+ * version.
+ */
+#define nghttp3_conn_get_request_view(CONN, DEST, STREAM_ID)                   \
+  nghttp3_conn_get_request_view_versioned(                                     \
+      (CONN), NGHTTP3_REQUEST_VIEW_VERSION, (DEST), (STREAM_ID))
+
+/*
+ * `nghttp3_qpack_encoder_get_stats` is a wrapper around
+ * `nghttp3_qpack_encoder_get_stats_versioned` to set the correct
+ * struct version.
+ */
+#define nghttp3_qpack_encoder_get_stats(ENCODER, DEST)                         \
+  nghttp3_qpack_encoder_get_stats_versioned(                                   \
+      (ENCODER), NGHTTP3_QPACK_STATS_VERSION, (DEST))
+
+/*
+ * `nghttp3_qpack_decoder_get_stats` is a wrapper around
+ * `nghttp3_qpack_decoder_get_stats_versioned` to set the correct
+ * struct version.
+ */
+#define nghttp3_qpack_decoder_get_stats(DECODER, DEST)                         \
+  nghttp3_qpack_decoder_get_stats_versioned(                                   \
+      (DECODER), NGHTTP3_QPACK_STATS_VERSION, (DEST))
+
+/*
+ * `nghttp3_conn_get_qpack_stats` is a wrapper around
+ * `nghttp3_conn_get_qpack_stats_versioned` to set the correct struct
+ * version.
+ */
+#define nghttp3_conn_get_qpack_stats(CONN, ENCODER_STATS, DECODER_STATS)       \
+  nghttp3_conn_get_qpack_stats_versioned(                                      \
+      (CONN), NGHTTP3_QPACK_STATS_VERSION, (ENCODER_STATS), (DECODER_STATS))
+
 /*
  * `nghttp3_pri_parse_priority` is a wrapper around
  * `nghttp3_pri_parse_priority_versioned` to set the correct struct
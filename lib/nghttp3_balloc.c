@@ -36,6 +36,7 @@ void nghttp3_balloc_init(nghttp3_balloc *balloc, size_t blklen,
   balloc->mem = mem;
   balloc->blklen = blklen;
   balloc->head = NULL;
+  balloc->unused = NULL;
   nghttp3_buf_wrap_init(&balloc->buf, (void *)"", 0);
 }
 
@@ -50,11 +51,25 @@ void nghttp3_balloc_free(nghttp3_balloc *balloc) {
 void nghttp3_balloc_clear(nghttp3_balloc *balloc) {
   nghttp3_memblock_hd *p, *next;
 
-  for (p = balloc->head; p; p = next) {
+  nghttp3_balloc_reset(balloc);
+
+  for (p = balloc->unused; p; p = next) {
     next = p->next;
     nghttp3_mem_free(balloc->mem, p);
   }
 
+  balloc->unused = NULL;
+}
+
+void nghttp3_balloc_reset(nghttp3_balloc *balloc) {
+  nghttp3_memblock_hd *p, *next;
+
+  for (p = balloc->head; p; p = next) {
+    next = p->next;
+    p->next = balloc->unused;
+    balloc->unused = p;
+  }
+
   balloc->head = NULL;
   nghttp3_buf_wrap_init(&balloc->buf, (void *)"", 0);
 }
@@ -66,13 +81,20 @@ int nghttp3_balloc_get(nghttp3_balloc *balloc, void **pbuf, size_t n) {
   assert(n <= balloc->blklen);
 
   if (nghttp3_buf_left(&balloc->buf) < n) {
-    p = nghttp3_mem_malloc(balloc->mem, sizeof(nghttp3_memblock_hd) + 0x10u +
-                                            balloc->blklen);
-    if (p == NULL) {
-      return NGHTTP3_ERR_NOMEM;
+    if (balloc->unused) {
+      hd = balloc->unused;
+      balloc->unused = hd->next;
+      p = (uint8_t *)hd;
+    } else {
+      p = nghttp3_mem_malloc(balloc->mem, sizeof(nghttp3_memblock_hd) +
+                                              0x10u + balloc->blklen);
+      if (p == NULL) {
+        return NGHTTP3_ERR_NOMEM;
+      }
+
+      hd = (nghttp3_memblock_hd *)(void *)p;
     }
 
-    hd = (nghttp3_memblock_hd *)(void *)p;
     hd->next = balloc->head;
     balloc->head = hd;
     nghttp3_buf_wrap_init(
@@ -55,6 +55,9 @@ typedef struct nghttp3_balloc {
   size_t blklen;
   /* head points to the list of memory block allocated so far. */
   nghttp3_memblock_hd *head;
+  /* unused points to the list of memory block which
+     nghttp3_balloc_reset has put back for reuse. */
+  nghttp3_memblock_hd *unused;
   /* buf wraps the current memory block for allocation requests. */
   nghttp3_buf buf;
 } nghttp3_balloc;
@@ -89,4 +92,12 @@ int nghttp3_balloc_get(nghttp3_balloc *balloc, void **pbuf, size_t n);
  */
 void nghttp3_balloc_clear(nghttp3_balloc *balloc);
 
+/*
+ * nghttp3_balloc_reset invalidates all memory which |balloc| has
+ * returned, and initializes its state.  Unlike nghttp3_balloc_clear,
+ * it keeps the memory blocks, and the subsequent allocation requests
+ * reuse them.
+ */
+void nghttp3_balloc_reset(nghttp3_balloc *balloc);
+
 #endif /* NGHTTP3_BALLOC_H */
@@ -59,6 +59,10 @@ typedef enum nghttp3_buf_type {
   /* NGHTTP3_BUF_TYPE_ALIEN indicates that the buffer points to a
      memory which comes from outside of the library. */
   NGHTTP3_BUF_TYPE_ALIEN,
+  /* NGHTTP3_BUF_TYPE_ALIEN_REF is like NGHTTP3_BUF_TYPE_ALIEN, but
+     the application is told that the memory is no longer used by its
+     release callback rather than by acknowledged byte counts. */
+  NGHTTP3_BUF_TYPE_ALIEN_REF,
 } nghttp3_buf_type;
 
 typedef struct nghttp3_typed_buf {
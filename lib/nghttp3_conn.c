@@ -27,18 +27,25 @@
 #include <assert.h>
 #include <string.h>
 #include <stdio.h>
+#include <stddef.h>
 
 #include "nghttp3_mem.h"
 #include "nghttp3_macro.h"
 #include "nghttp3_err.h"
 #include "nghttp3_conv.h"
 #include "nghttp3_http.h"
+#include "nghttp3_encoded_field_section.h"
 #include "nghttp3_unreachable.h"
 
 /* NGHTTP3_QPACK_ENCODER_MAX_DTABLE_CAPACITY is the upper bound of the
    dynamic table capacity that QPACK encoder is willing to use. */
 #define NGHTTP3_QPACK_ENCODER_MAX_DTABLE_CAPACITY 4096
 
+/* NGHTTP3_QPACK_MAX_BLOCKED_DATALEN is the default upper bound of
+   the number of bytes buffered for the streams blocked by QPACK
+   decoder. */
+#define NGHTTP3_QPACK_MAX_BLOCKED_DATALEN (1024 * 1024)
+
 nghttp3_objalloc_def(chunk, nghttp3_chunk, oplent);
 
 /*
@@ -229,15 +236,148 @@ static int cycle_less(const nghttp3_pq_entry *lhsx,
   return rhs->cycle - lhs->cycle <= NGHTTP3_TNODE_MAX_CYCLE_GAP;
 }
 
+/*
+ * settingslen_version returns the effective length of
+ * nghttp3_settings at the version |settings_version|.
+ */
+static size_t settingslen_version(int settings_version) {
+  nghttp3_settings settings;
+
+  switch (settings_version) {
+  case NGHTTP3_SETTINGS_VERSION:
+    return sizeof(settings);
+  case NGHTTP3_SETTINGS_V1:
+    return offsetof(nghttp3_settings, h3_datagram) +
+           sizeof(settings.h3_datagram);
+  default:
+    nghttp3_unreachable();
+  }
+}
+
+/*
+ * settings_convert_to_latest converts |src| of version
+ * |settings_version| to the latest version.  If |settings_version|
+ * is the latest, it returns |src|.  Otherwise, it fills |dest| with
+ * the default values, copies the fields available in
+ * |settings_version| from |src| to |dest|, and returns |dest|.
+ */
+static const nghttp3_settings *
+settings_convert_to_latest(nghttp3_settings *dest, int settings_version,
+                           const nghttp3_settings *src) {
+  if (settings_version == NGHTTP3_SETTINGS_VERSION) {
+    return src;
+  }
+
+  nghttp3_settings_default(dest);
+
+  memcpy(dest, src, settingslen_version(settings_version));
+
+  return dest;
+}
+
+/*
+ * callbackslen_version returns the effective length of
+ * nghttp3_callbacks at the version |callbacks_version|.
+ */
+static size_t callbackslen_version(int callbacks_version) {
+  nghttp3_callbacks callbacks;
+
+  switch (callbacks_version) {
+  case NGHTTP3_CALLBACKS_VERSION:
+    return sizeof(callbacks);
+  case NGHTTP3_CALLBACKS_V1:
+    return offsetof(nghttp3_callbacks, recv_settings) +
+           sizeof(callbacks.recv_settings);
+  default:
+    nghttp3_unreachable();
+  }
+}
+
+/*
+ * callbacks_convert_to_latest converts |src| of version
+ * |callbacks_version| to the latest version.  If |callbacks_version|
+ * is the latest, it returns |src|.  Otherwise, it copies the fields
+ * available in |callbacks_version| from |src| to |dest|, sets the
+ * other fields to NULL, and returns |dest|.
+ */
+static const nghttp3_callbacks *
+callbacks_convert_to_latest(nghttp3_callbacks *dest, int callbacks_version,
+                            const nghttp3_callbacks *src) {
+  if (callbacks_version == NGHTTP3_CALLBACKS_VERSION) {
+    return src;
+  }
+
+  memset(dest, 0, sizeof(*dest));
+
+  memcpy(dest, src, callbackslen_version(callbacks_version));
+
+  return dest;
+}
+
+/*
+ * conn_qpack_init initializes |qenc| and |qdec| as configured by
+ * |settings|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int conn_qpack_init(nghttp3_qpack_encoder *qenc,
+                           nghttp3_qpack_decoder *qdec,
+                           const nghttp3_settings *settings,
+                           const nghttp3_mem *mem) {
+  int rv;
+
+  rv = nghttp3_qpack_decoder_init(qdec, settings->qpack_max_dtable_capacity,
+                                  settings->qpack_blocked_streams, mem);
+  if (rv != 0) {
+    return rv;
+  }
+
+  rv = nghttp3_qpack_encoder_init(
+      qenc, settings->qpack_encoder_max_dtable_capacity, mem);
+  if (rv != 0) {
+    goto qenc_init_fail;
+  }
+
+  if (settings->qpack_ring_dtable) {
+    rv = nghttp3_qpack_encoder_enable_ring_dtable(qenc);
+    if (rv != 0) {
+      goto qpack_ring_fail;
+    }
+
+    rv = nghttp3_qpack_decoder_enable_ring_dtable(qdec);
+    if (rv != 0) {
+      goto qpack_ring_fail;
+    }
+  }
+
+  return 0;
+
+qpack_ring_fail:
+  nghttp3_qpack_encoder_free(qenc);
+qenc_init_fail:
+  nghttp3_qpack_decoder_free(qdec);
+
+  return rv;
+}
+
 static int conn_new(nghttp3_conn **pconn, int server, int callbacks_version,
                     const nghttp3_callbacks *callbacks, int settings_version,
                     const nghttp3_settings *settings, const nghttp3_mem *mem,
                     void *user_data) {
   int rv;
   nghttp3_conn *conn;
+  nghttp3_settings settingsbuf;
+  nghttp3_callbacks callbacksbuf;
   size_t i;
-  (void)callbacks_version;
-  (void)settings_version;
+
+  callbacks = callbacks_convert_to_latest(&callbacksbuf, callbacks_version,
+                                          callbacks);
+  settings = settings_convert_to_latest(&settingsbuf, settings_version,
+                                        settings);
 
   if (mem == NULL) {
     mem = nghttp3_mem_default();
@@ -250,27 +390,28 @@ static int conn_new(nghttp3_conn **pconn, int server, int callbacks_version,
 
   nghttp3_objalloc_init(&conn->out_chunk_objalloc,
                         NGHTTP3_STREAM_MIN_CHUNK_SIZE * 16, mem);
+  nghttp3_objalloc_init(&conn->in_chunk_objalloc,
+                        NGHTTP3_STREAM_INQ_CHUNK_SIZE * 4, mem);
   nghttp3_objalloc_stream_init(&conn->stream_objalloc, 64, mem);
 
-  nghttp3_map_init(&conn->streams, mem);
+  nghttp3_stmap_init(&conn->streams, mem);
 
-  rv = nghttp3_qpack_decoder_init(&conn->qdec,
-                                  settings->qpack_max_dtable_capacity,
-                                  settings->qpack_blocked_streams, mem);
+  rv = conn_qpack_init(&conn->qenc, &conn->qdec, settings, mem);
   if (rv != 0) {
-    goto qdec_init_fail;
+    goto qpack_init_fail;
   }
 
-  rv = nghttp3_qpack_encoder_init(
-      &conn->qenc, settings->qpack_encoder_max_dtable_capacity, mem);
-  if (rv != 0) {
-    goto qenc_init_fail;
-  }
+  nghttp3_qpack_encoder_set_indexing_policy(&conn->qenc,
+                                            settings->qpack_indexing_policy);
+  nghttp3_qpack_decoder_set_borrow_literals(&conn->qdec,
+                                            settings->qpack_borrow_literals);
 
   nghttp3_pq_init(&conn->qpack_blocked_streams, ricnt_less, mem);
 
   for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
     nghttp3_pq_init(&conn->sched[i].spq, cycle_less, mem);
+    nghttp3_tnode_queue_init(&conn->sched[i].fifo);
+    nghttp3_tnode_queue_init(&conn->sched[i].drr);
   }
 
   nghttp3_idtr_init(&conn->remote.bidi.idtr, server, mem);
@@ -292,11 +433,10 @@ static int conn_new(nghttp3_conn **pconn, int server, int callbacks_version,
 
   return 0;
 
-qenc_init_fail:
-  nghttp3_qpack_decoder_free(&conn->qdec);
-qdec_init_fail:
-  nghttp3_map_free(&conn->streams);
+qpack_init_fail:
+  nghttp3_stmap_free(&conn->streams);
   nghttp3_objalloc_free(&conn->stream_objalloc);
+  nghttp3_objalloc_free(&conn->in_chunk_objalloc);
   nghttp3_objalloc_free(&conn->out_chunk_objalloc);
   nghttp3_mem_free(mem, conn);
 
@@ -368,15 +508,142 @@ void nghttp3_conn_del(nghttp3_conn *conn) {
   nghttp3_qpack_encoder_free(&conn->qenc);
   nghttp3_qpack_decoder_free(&conn->qdec);
 
-  nghttp3_map_each_free(&conn->streams, free_stream, NULL);
-  nghttp3_map_free(&conn->streams);
+  nghttp3_stmap_each_free(&conn->streams, free_stream, NULL);
+  nghttp3_stmap_free(&conn->streams);
 
   nghttp3_objalloc_free(&conn->stream_objalloc);
+  nghttp3_objalloc_free(&conn->in_chunk_objalloc);
   nghttp3_objalloc_free(&conn->out_chunk_objalloc);
 
   nghttp3_mem_free(conn->mem, conn);
 }
 
+/*
+ * conn_reset makes |conn| the state right after conn_new with the
+ * given parameters, keeping the memory which |conn| has allocated.
+ * |server| must match conn->server.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_INVALID_ARGUMENT
+ *     |server| does not match conn->server.
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int conn_reset(nghttp3_conn *conn, int server, int callbacks_version,
+                      const nghttp3_callbacks *callbacks, int settings_version,
+                      const nghttp3_settings *settings, void *user_data) {
+  nghttp3_qpack_encoder qenc;
+  nghttp3_qpack_decoder qdec;
+  nghttp3_settings settingsbuf;
+  nghttp3_callbacks callbacksbuf;
+  int reuse_qpack;
+  size_t i;
+  int rv;
+
+  if (conn->server != server) {
+    return NGHTTP3_ERR_INVALID_ARGUMENT;
+  }
+
+  callbacks = callbacks_convert_to_latest(&callbacksbuf, callbacks_version,
+                                          callbacks);
+  settings = settings_convert_to_latest(&settingsbuf, settings_version,
+                                        settings);
+
+  /* QPACK encoder and decoder are reused only if the memory which
+     they have allocated for dynamic table fits the new settings. */
+  reuse_qpack = conn->local.settings.qpack_max_dtable_capacity ==
+                    settings->qpack_max_dtable_capacity &&
+                conn->local.settings.qpack_encoder_max_dtable_capacity ==
+                    settings->qpack_encoder_max_dtable_capacity &&
+                !conn->local.settings.qpack_ring_dtable ==
+                    !settings->qpack_ring_dtable;
+
+  if (!reuse_qpack) {
+    /* Do this first so that |conn| is left unchanged on failure. */
+    rv = conn_qpack_init(&qenc, &qdec, settings, conn->mem);
+    if (rv != 0) {
+      return rv;
+    }
+  }
+
+  nghttp3_stmap_each_free(&conn->streams, free_stream, NULL);
+  nghttp3_stmap_clear(&conn->streams);
+
+  if (reuse_qpack) {
+    nghttp3_qpack_encoder_reset(&conn->qenc);
+    nghttp3_qpack_decoder_reset(&conn->qdec, settings->qpack_blocked_streams);
+  } else {
+    nghttp3_qpack_encoder_free(&conn->qenc);
+    nghttp3_qpack_decoder_free(&conn->qdec);
+
+    conn->qenc = qenc;
+    conn->qdec = qdec;
+  }
+
+  nghttp3_qpack_encoder_set_indexing_policy(&conn->qenc,
+                                            settings->qpack_indexing_policy);
+  nghttp3_qpack_decoder_set_borrow_literals(&conn->qdec,
+                                            settings->qpack_borrow_literals);
+
+  nghttp3_pq_clear(&conn->qpack_blocked_streams);
+
+  for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
+    nghttp3_pq_clear(&conn->sched[i].spq);
+    nghttp3_tnode_queue_init(&conn->sched[i].fifo);
+    nghttp3_tnode_queue_init(&conn->sched[i].drr);
+  }
+
+  nghttp3_idtr_clear(&conn->remote.bidi.idtr);
+
+  nghttp3_buf_reset(&conn->tx.qpack.rbuf);
+  nghttp3_buf_reset(&conn->tx.qpack.ebuf);
+
+  conn->callbacks = *callbacks;
+  conn->local.settings = *settings;
+  if (!server) {
+    conn->local.settings.enable_connect_protocol = 0;
+  }
+  conn->local.uni.max_pushes = 0;
+  conn->remote.bidi.max_client_streams = 0;
+  conn->remote.bidi.num_streams = 0;
+  nghttp3_settings_default(&conn->remote.settings);
+  conn->user_data = user_data;
+  conn->flags = NGHTTP3_CONN_FLAG_NONE;
+
+  memset(&conn->rx, 0, sizeof(conn->rx));
+  conn->rx.goaway_id = NGHTTP3_VARINT_MAX + 1;
+  conn->rx.max_stream_id_bidi = -4;
+
+  conn->tx.ctrl = NULL;
+  conn->tx.qenc = NULL;
+  conn->tx.qdec = NULL;
+  conn->tx.goaway_id = NGHTTP3_VARINT_MAX + 1;
+
+  return 0;
+}
+
+int nghttp3_conn_reset_client_versioned(nghttp3_conn *conn,
+                                        int callbacks_version,
+                                        const nghttp3_callbacks *callbacks,
+                                        int settings_version,
+                                        const nghttp3_settings *settings,
+                                        void *user_data) {
+  return conn_reset(conn, /* server = */ 0, callbacks_version, callbacks,
+                    settings_version, settings, user_data);
+}
+
+int nghttp3_conn_reset_server_versioned(nghttp3_conn *conn,
+                                        int callbacks_version,
+                                        const nghttp3_callbacks *callbacks,
+                                        int settings_version,
+                                        const nghttp3_settings *settings,
+                                        void *user_data) {
+  return conn_reset(conn, /* server = */ 1, callbacks_version, callbacks,
+                    settings_version, settings, user_data);
+}
+
 static int conn_bidi_idtr_open(nghttp3_conn *conn, int64_t stream_id) {
   int rv;
 
@@ -392,13 +659,27 @@ static int conn_bidi_idtr_open(nghttp3_conn *conn, int64_t stream_id) {
   return 0;
 }
 
-nghttp3_ssize nghttp3_conn_read_stream(nghttp3_conn *conn, int64_t stream_id,
-                                       const uint8_t *src, size_t srclen,
-                                       int fin) {
+/*
+ * conn_get_rx_stream finds the stream identified by |stream_id| which
+ * receives |srclen| bytes of data, creating it if it is a new stream
+ * opened by remote endpoint, and assigns it to |*pstream|.  If the
+ * data should be ignored, it assigns NULL to |*pstream|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ * NGHTTP3_ERR_H3_STREAM_CREATION_ERROR
+ *     Server opened bidirectional stream.
+ */
+static int conn_get_rx_stream(nghttp3_conn *conn, nghttp3_stream **pstream,
+                              int64_t stream_id, size_t srclen, int fin) {
   nghttp3_stream *stream;
-  size_t bidi_nproc;
   int rv;
 
+  *pstream = NULL;
+
   stream = nghttp3_conn_find_stream(conn, stream_id);
   if (stream == NULL) {
     /* TODO Assert idtr */
@@ -474,18 +755,126 @@ nghttp3_ssize nghttp3_conn_read_stream(nghttp3_conn *conn, int64_t stream_id,
     }
   }
 
+  *pstream = stream;
+
+  return 0;
+}
+
+/*
+ * conn_read_stream_data reads data |src| of length |srclen| on
+ * |stream|.  If |pbuf_user_data| is not NULL, |src| belongs to the
+ * application buffer identified by *|pbuf_user_data|.  It returns the
+ * number of bytes consumed as nghttp3_conn_read_stream does.
+ */
+static nghttp3_ssize conn_read_stream_data(nghttp3_conn *conn,
+                                           nghttp3_stream *stream,
+                                           const uint8_t *src, size_t srclen,
+                                           int fin,
+                                           void *const *pbuf_user_data) {
+  size_t bidi_nproc;
+
   if (srclen == 0 && !fin) {
     return 0;
   }
 
-  if (nghttp3_stream_uni(stream_id)) {
+  if (nghttp3_stream_uni(stream->node.id)) {
     return nghttp3_conn_read_uni(conn, stream, src, srclen, fin);
   }
 
   if (fin) {
     stream->flags |= NGHTTP3_STREAM_FLAG_READ_EOF;
   }
-  return nghttp3_conn_read_bidi(conn, &bidi_nproc, stream, src, srclen, fin);
+  return nghttp3_conn_read_bidi(conn, &bidi_nproc, stream, src, srclen, fin,
+                                pbuf_user_data);
+}
+
+/*
+ * conn_read_stream is the implementation of nghttp3_conn_read_stream
+ * and nghttp3_conn_read_stream_ref.  If |pbuf_user_data| is not NULL,
+ * |src| belongs to the application buffer identified by
+ * *|pbuf_user_data|.
+ */
+static nghttp3_ssize conn_read_stream(nghttp3_conn *conn, int64_t stream_id,
+                                      const uint8_t *src, size_t srclen,
+                                      int fin, void *const *pbuf_user_data) {
+  nghttp3_stream *stream;
+  int rv;
+
+  rv = conn_get_rx_stream(conn, &stream, stream_id, srclen, fin);
+  if (rv != 0) {
+    return rv;
+  }
+
+  if (stream == NULL) {
+    return 0;
+  }
+
+  return conn_read_stream_data(conn, stream, src, srclen, fin,
+                               pbuf_user_data);
+}
+
+nghttp3_ssize nghttp3_conn_read_stream(nghttp3_conn *conn, int64_t stream_id,
+                                       const uint8_t *src, size_t srclen,
+                                       int fin) {
+  return conn_read_stream(conn, stream_id, src, srclen, fin, NULL);
+}
+
+nghttp3_ssize nghttp3_conn_read_stream_ref(nghttp3_conn *conn,
+                                           int64_t stream_id,
+                                           const uint8_t *src, size_t srclen,
+                                           int fin, void *buf_user_data) {
+  return conn_read_stream(conn, stream_id, src, srclen, fin, &buf_user_data);
+}
+
+int nghttp3_conn_read_streams(nghttp3_conn *conn,
+                              const nghttp3_stream_data *sdata,
+                              size_t sdatalen, size_t *pnconsumed) {
+  nghttp3_stream *stream;
+  const nghttp3_stream_data *sd, *prev = NULL;
+  nghttp3_ssize nconsumed;
+  size_t i;
+  int rv;
+
+  for (i = 0; i < sdatalen; ++i) {
+    sd = &sdata[i];
+
+    /* Consecutive records of the same stream skip the stream setup in
+       conn_get_rx_stream.  The stream is still looked up by its ID
+       because the stream might have been deleted while the previous
+       record was read, in which case it is set up again as
+       nghttp3_conn_read_stream does. */
+    if (prev && prev->stream_id == sd->stream_id && !prev->fin) {
+      stream = nghttp3_conn_find_stream(conn, sd->stream_id);
+    } else {
+      stream = NULL;
+    }
+
+    if (stream == NULL) {
+      rv = conn_get_rx_stream(conn, &stream, sd->stream_id, sd->datalen,
+                              sd->fin);
+      if (rv != 0) {
+        return rv;
+      }
+
+      if (stream == NULL) {
+        pnconsumed[i] = 0;
+        prev = sd;
+
+        continue;
+      }
+    }
+
+    nconsumed = conn_read_stream_data(conn, stream, sd->data, sd->datalen,
+                                      sd->fin, NULL);
+    if (nconsumed < 0) {
+      return (int)nconsumed;
+    }
+
+    pnconsumed[i] = (size_t)nconsumed;
+    prev = sd;
+  }
+
+  return 0;
 }
 
 static nghttp3_ssize conn_read_type(nghttp3_conn *conn, nghttp3_stream *stream,
@@ -1075,8 +1464,9 @@ static int conn_delete_stream(nghttp3_conn *conn, nghttp3_stream *stream) {
     --conn->remote.bidi.num_streams;
   }
 
-  rv =
-      nghttp3_map_remove(&conn->streams, (nghttp3_map_key_type)stream->node.id);
+  conn->rx.blocked_datalen -= nghttp3_stream_get_buffered_datalen(stream);
+
+  rv = nghttp3_stmap_remove(&conn->streams, stream->node.id);
 
   assert(0 == rv);
 
@@ -1087,6 +1477,7 @@ static int conn_delete_stream(nghttp3_conn *conn, nghttp3_stream *stream) {
 
 static int conn_process_blocked_stream_data(nghttp3_conn *conn,
                                             nghttp3_stream *stream) {
+  nghttp3_stream_inq_buf *ibuf;
   nghttp3_buf *buf;
   size_t nproc;
   nghttp3_ssize nconsumed;
@@ -1101,16 +1492,18 @@ static int conn_process_blocked_stream_data(nghttp3_conn *conn,
       break;
     }
 
-    buf = nghttp3_ringbuf_get(&stream->inq, 0);
+    ibuf = nghttp3_ringbuf_get(&stream->inq, 0);
+    buf = &ibuf->buf;
 
     nconsumed = nghttp3_conn_read_bidi(
         conn, &nproc, stream, buf->pos, nghttp3_buf_len(buf),
-        len == 1 && (stream->flags & NGHTTP3_STREAM_FLAG_READ_EOF));
+        len == 1 && (stream->flags & NGHTTP3_STREAM_FLAG_READ_EOF), NULL);
     if (nconsumed < 0) {
       return (int)nconsumed;
     }
 
     buf->pos += nproc;
+    conn->rx.blocked_datalen -= nproc;
 
     rv = conn_call_deferred_consume(conn, stream, (size_t)nconsumed);
     if (rv != 0) {
@@ -1118,8 +1511,7 @@ static int conn_process_blocked_stream_data(nghttp3_conn *conn,
     }
 
     if (nghttp3_buf_len(buf) == 0) {
-      nghttp3_buf_free(buf, stream->mem);
-      nghttp3_ringbuf_pop_front(&stream->inq);
+      nghttp3_stream_inq_pop_front(stream);
     }
 
     if (stream->flags & NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED) {
@@ -1203,9 +1595,81 @@ static int conn_update_stream_priority(nghttp3_conn *conn,
   return 0;
 }
 
+/*
+ * conn_buffer_stream_data buffers |data| of length |datalen| which
+ * |stream| cannot process because it is blocked by QPACK decoder.  If
+ * |pbuf_user_data| is not NULL and the application provides
+ * retain_buf and release_buf callbacks, |data| is referenced rather
+ * than copied.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_H3_EXCESSIVE_LOAD
+ *     The total amount of buffered data would exceed
+ *     local.settings.qpack_max_blocked_datalen.
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int conn_buffer_stream_data(nghttp3_conn *conn, nghttp3_stream *stream,
+                                   const uint8_t *data, size_t datalen,
+                                   void *const *pbuf_user_data) {
+  int rv;
+
+  if (datalen > conn->local.settings.qpack_max_blocked_datalen -
+                    conn->rx.blocked_datalen) {
+    return NGHTTP3_ERR_H3_EXCESSIVE_LOAD;
+  }
+
+  if (pbuf_user_data && conn->callbacks.retain_buf &&
+      conn->callbacks.release_buf) {
+    rv = nghttp3_stream_buffer_data_ref(stream, data, datalen,
+                                        *pbuf_user_data);
+    if (rv != 0) {
+      return rv;
+    }
+
+    conn->callbacks.retain_buf(conn, *pbuf_user_data, conn->user_data);
+  } else {
+    rv = nghttp3_stream_buffer_data(stream, data, datalen);
+    if (rv != 0) {
+      return rv;
+    }
+  }
+
+  conn->rx.blocked_datalen += datalen;
+
+  return 0;
+}
+
+/*
+ * conn_read_bidi_frame_hd decodes the header of DATA or HEADERS
+ * frame which begins at |p| into |hd| if the whole frame header is
+ * in the buffer [p, end).  Both frame types are encoded in a single
+ * byte, so that the type is decided by one comparison.  It returns
+ * the length of the frame header, or 0 if the frame header is
+ * incomplete, or the frame is of any other type.  In the latter
+ * case, the frame must be read by the resumable state machine.
+ */
+static size_t conn_read_bidi_frame_hd(nghttp3_frame_hd *hd, const uint8_t *p,
+                                      const uint8_t *end) {
+  size_t len;
+
+  if (*p > NGHTTP3_FRAME_HEADERS || end - p < 2 ||
+      (size_t)(end - p) - 1 < nghttp3_get_varintlen(p + 1)) {
+    return 0;
+  }
+
+  hd->type = *p;
+  hd->length = nghttp3_get_varint(&len, p + 1);
+
+  return len + 1;
+}
+
 nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
                                      nghttp3_stream *stream, const uint8_t *src,
-                                     size_t srclen, int fin) {
+                                     size_t srclen, int fin,
+                                     void *const *pbuf_user_data) {
   const uint8_t *p = src, *end = src ? src + srclen : src;
   int rv;
   nghttp3_stream_read_state *rstate = &stream->rstate;
@@ -1228,7 +1692,8 @@ nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
       return 0;
     }
 
-    rv = nghttp3_stream_buffer_data(stream, p, (size_t)(end - p));
+    rv = conn_buffer_stream_data(conn, stream, p, (size_t)(end - p),
+                                 pbuf_user_data);
     if (rv != 0) {
       return rv;
     }
@@ -1240,6 +1705,20 @@ nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
     switch (rstate->state) {
     case NGHTTP3_REQ_STREAM_STATE_FRAME_TYPE:
       assert(end - p > 0);
+
+      /* Fast path: DATA or HEADERS frame header which is not split
+         across buffers. */
+      if (rvint->left == 0) {
+        len = conn_read_bidi_frame_hd(&rstate->fr.hd, p, end);
+        if (len) {
+          p += len;
+          nconsumed += len;
+          rstate->left = rstate->fr.hd.length;
+
+          goto frame_hd_read;
+        }
+      }
+
       nread = nghttp3_read_varint(rvint, p, (size_t)(end - p), fin);
       if (nread < 0) {
         return NGHTTP3_ERR_H3_GENERAL_PROTOCOL_ERROR;
@@ -1274,6 +1753,7 @@ nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
       rstate->left = rstate->fr.hd.length = rvint->acc;
       nghttp3_varint_read_state_reset(rvint);
 
+    frame_hd_read:
       switch (rstate->fr.hd.type) {
       case NGHTTP3_FRAME_DATA:
         rv = nghttp3_stream_transit_rx_http_state(
@@ -1387,7 +1867,8 @@ nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
 
       if (stream->flags & NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED) {
         if (p != end && nghttp3_stream_get_buffered_datalen(stream) == 0) {
-          rv = nghttp3_stream_buffer_data(stream, p, (size_t)(end - p));
+          rv = conn_buffer_stream_data(conn, stream, p, (size_t)(end - p),
+                                       pbuf_user_data);
           if (rv != 0) {
             return rv;
           }
@@ -1552,6 +2033,17 @@ static nghttp3_pq *conn_get_sched_pq(nghttp3_conn *conn, nghttp3_tnode *tnode) {
   return &conn->sched[tnode->pri.urgency].spq;
 }
 
+static nghttp3_tnode_queue *conn_get_sched_queue(nghttp3_conn *conn,
+                                                 nghttp3_tnode *tnode) {
+  assert(tnode->pri.urgency < NGHTTP3_URGENCY_LEVELS);
+
+  if (tnode->pri.inc) {
+    return &conn->sched[tnode->pri.urgency].drr;
+  }
+
+  return &conn->sched[tnode->pri.urgency].fifo;
+}
+
 static nghttp3_ssize conn_decode_headers(nghttp3_conn *conn,
                                          nghttp3_stream *stream,
                                          const uint8_t *src, size_t srclen,
@@ -1563,16 +2055,20 @@ static nghttp3_ssize conn_decode_headers(nghttp3_conn *conn,
   uint8_t flags;
   nghttp3_buf buf;
   nghttp3_recv_header recv_header = NULL;
+  nghttp3_recv_header_section recv_header_section = NULL;
   nghttp3_http_state *http;
   int request = 0;
   int trailers = 0;
+  int keep_request_fields = 0;
 
   switch (stream->rx.hstate) {
   case NGHTTP3_HTTP_STATE_REQ_HEADERS_BEGIN:
     request = 1;
+    keep_request_fields = conn->local.settings.enable_request_view;
     /* Fall through */
   case NGHTTP3_HTTP_STATE_RESP_HEADERS_BEGIN:
     recv_header = conn->callbacks.recv_header;
+    recv_header_section = conn->callbacks.recv_header_section;
     break;
   case NGHTTP3_HTTP_STATE_REQ_TRAILERS_BEGIN:
     request = 1;
@@ -1580,6 +2076,7 @@ static nghttp3_ssize conn_decode_headers(nghttp3_conn *conn,
   case NGHTTP3_HTTP_STATE_RESP_TRAILERS_BEGIN:
     trailers = 1;
     recv_header = conn->callbacks.recv_trailer;
+    recv_header_section = conn->callbacks.recv_trailer_section;
     break;
   default:
     nghttp3_unreachable();
@@ -1616,6 +2113,19 @@ static nghttp3_ssize conn_decode_headers(nghttp3_conn *conn,
 
     if (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) {
       nghttp3_qpack_stream_context_reset(&stream->qpack_sctx);
+
+      if (recv_header_section) {
+        rv = recv_header_section(conn, stream->node.id, stream->rx.fields.nva,
+                                 stream->rx.fields.nvlen, conn->user_data,
+                                 stream->user_data);
+
+        nghttp3_stream_clear_fields(stream);
+
+        if (rv != 0) {
+          return NGHTTP3_ERR_CALLBACK_FAILURE;
+        }
+      }
+
       break;
     }
 
@@ -1634,6 +2144,23 @@ static nghttp3_ssize conn_decode_headers(nghttp3_conn *conn,
         rv = 0;
         break;
       case 0:
+        if (keep_request_fields) {
+          rv = nghttp3_stream_keep_request_field(stream, &nv);
+          if (rv != 0) {
+            break;
+          }
+        }
+
+        if (recv_header_section) {
+          /* nghttp3_stream_add_field takes the ownership of nv. */
+          rv = nghttp3_stream_add_field(stream, &nv);
+          if (rv != 0) {
+            return rv;
+          }
+
+          continue;
+        }
+
         if (recv_header) {
           rv = recv_header(conn, stream->node.id, nv.token, nv.name, nv.value,
                            nv.flags, conn->user_data, stream->user_data);
@@ -1831,16 +2358,25 @@ static int conn_stream_acked_data(nghttp3_stream *stream, int64_t stream_id,
   return 0;
 }
 
+static void conn_stream_release_buf(nghttp3_stream *stream,
+                                    void *buf_user_data) {
+  nghttp3_conn *conn = stream->conn;
+
+  conn->callbacks.release_buf(conn, buf_user_data, conn->user_data);
+}
+
 int nghttp3_conn_create_stream(nghttp3_conn *conn, nghttp3_stream **pstream,
                                int64_t stream_id) {
   nghttp3_stream *stream;
   int rv;
   nghttp3_stream_callbacks callbacks = {
       conn_stream_acked_data,
+      conn_stream_release_buf,
   };
 
   rv = nghttp3_stream_new(&stream, stream_id, &callbacks,
-                          &conn->out_chunk_objalloc, &conn->stream_objalloc,
+                          &conn->out_chunk_objalloc, &conn->in_chunk_objalloc,
+                          &conn->stream_objalloc,
                           conn->mem);
   if (rv != 0) {
     return rv;
@@ -1848,8 +2384,7 @@ int nghttp3_conn_create_stream(nghttp3_conn *conn, nghttp3_stream **pstream,
 
   stream->conn = conn;
 
-  rv = nghttp3_map_insert(&conn->streams, (nghttp3_map_key_type)stream->node.id,
-                          stream);
+  rv = nghttp3_stmap_insert(&conn->streams, stream->node.id, stream);
   if (rv != 0) {
     nghttp3_stream_del(stream);
     return rv;
@@ -1866,7 +2401,7 @@ int nghttp3_conn_create_stream(nghttp3_conn *conn, nghttp3_stream **pstream,
 
 nghttp3_stream *nghttp3_conn_find_stream(nghttp3_conn *conn,
                                          int64_t stream_id) {
-  return nghttp3_map_find(&conn->streams, (nghttp3_map_key_type)stream_id);
+  return nghttp3_stmap_find(&conn->streams, stream_id);
 }
 
 int nghttp3_conn_bind_control_stream(nghttp3_conn *conn, int64_t stream_id) {
@@ -2045,10 +2580,26 @@ nghttp3_stream *nghttp3_conn_get_next_tx_stream(nghttp3_conn *conn) {
   nghttp3_tnode *tnode;
   nghttp3_pq *pq;
 
-  for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
-    pq = &conn->sched[i].spq;
-    if (nghttp3_pq_empty(pq)) {
-      continue;
+  if (conn->local.settings.enable_drr_scheduler) {
+    for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
+      tnode = conn->sched[i].fifo.head;
+      if (tnode == NULL) {
+        tnode = conn->sched[i].drr.head;
+        if (tnode == NULL) {
+          continue;
+        }
+      }
+
+      return nghttp3_struct_of(tnode, nghttp3_stream, node);
+    }
+
+    return NULL;
+  }
+
+  for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
+    pq = &conn->sched[i].spq;
+    if (nghttp3_pq_empty(pq)) {
+      continue;
     }
 
     tnode = nghttp3_struct_of(nghttp3_pq_top(pq), nghttp3_tnode, pe);
@@ -2087,6 +2638,275 @@ int nghttp3_conn_add_write_offset(nghttp3_conn *conn, int64_t stream_id,
   return nghttp3_conn_schedule_stream(conn, stream);
 }
 
+/*
+ * conn_stream_batch is the state of nghttp3_conn_writev_streams.
+ */
+typedef struct conn_stream_batch {
+  nghttp3_stream_vec *svec;
+  size_t sveccnt;
+  /* nsvec is the number of elements of svec filled so far. */
+  size_t nsvec;
+  /* vec and veccnt are the unused part of the vector array. */
+  nghttp3_vec *vec;
+  size_t veccnt;
+  /* left is the number of bytes which can still be added. */
+  size_t left;
+} conn_stream_batch;
+
+static int conn_stream_batch_full(const conn_stream_batch *batch) {
+  return batch->nsvec == batch->sveccnt || batch->veccnt == 0 ||
+         batch->left == 0;
+}
+
+/*
+ * conn_stream_batch_add appends the data to send to |stream| to
+ * |batch|.  The data is truncated to the remaining budget of |batch|.
+ * It returns nonzero if it appended the data or fin.
+ */
+static int conn_stream_batch_add(conn_stream_batch *batch,
+                                 nghttp3_stream *stream) {
+  nghttp3_stream_vec *sv;
+  size_t n, i, len = 0;
+  int fin;
+
+  assert(!conn_stream_batch_full(batch));
+
+  n = nghttp3_stream_writev(stream, &fin, batch->vec, batch->veccnt);
+  if (n == 0 && !fin) {
+    return 0;
+  }
+
+  for (i = 0; i < n && len < batch->left; ++i) {
+    if (batch->vec[i].len > batch->left - len) {
+      batch->vec[i].len = batch->left - len;
+      fin = 0;
+    }
+
+    len += batch->vec[i].len;
+  }
+
+  if (i < n) {
+    fin = 0;
+  }
+
+  sv = &batch->svec[batch->nsvec++];
+  sv->stream_id = stream->node.id;
+  sv->vec = batch->vec;
+  sv->veccnt = i;
+  sv->datalen = len;
+  sv->fin = fin;
+
+  batch->vec += i;
+  batch->veccnt -= i;
+  batch->left -= len;
+
+  return 1;
+}
+
+static int conn_stream_fill_outq(nghttp3_stream *stream) {
+  /* If stream is blocked by read callback, don't attempt to fill
+     more. */
+  if (stream->flags & NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED) {
+    return 0;
+  }
+
+  return nghttp3_stream_fill_outq(stream);
+}
+
+/*
+ * conn_hold_stream takes |stream| off the scheduler, and prepends it
+ * to |*pheld| so that nghttp3_conn_get_next_tx_stream selects the
+ * next stream.  conn_release_held_streams puts it back to the same
+ * position.
+ */
+static void conn_hold_stream(nghttp3_conn *conn, nghttp3_stream *stream,
+                             nghttp3_tnode **pheld) {
+  nghttp3_tnode *node = stream_get_sched_node(stream);
+
+  nghttp3_conn_unschedule_stream(conn, stream);
+
+  node->held_next = *pheld;
+  *pheld = node;
+}
+
+/*
+ * conn_release_held_streams puts the streams in |held| back to the
+ * scheduler unless they have nothing to send.  Because conn_hold_stream
+ * prepends a node, the nodes are pushed to the front of the deficit
+ * round-robin queues in reverse order.  The priority queue restores
+ * the order from the cycle which unscheduling a node leaves intact.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int conn_release_held_streams(nghttp3_conn *conn,
+                                     nghttp3_tnode *held) {
+  nghttp3_tnode *node;
+  nghttp3_stream *stream;
+  int rv = 0;
+
+  for (; held;) {
+    node = held;
+    held = node->held_next;
+    node->held_next = NULL;
+
+    stream = nghttp3_struct_of(node, nghttp3_stream, node);
+
+    if (rv != 0 || nghttp3_tnode_is_scheduled(node) ||
+        !nghttp3_stream_require_schedule(stream)) {
+      continue;
+    }
+
+    if (conn->local.settings.enable_drr_scheduler) {
+      nghttp3_tnode_drr_push_front(node, conn_get_sched_queue(conn, node));
+      continue;
+    }
+
+    rv = nghttp3_pq_push(conn_get_sched_pq(conn, node), &node->pe);
+  }
+
+  return rv;
+}
+
+/*
+ * conn_stream_batch_add_qenc appends QPACK encoder stream to |batch|
+ * if it has not been added yet.  |*padded| is nonzero if it has been
+ * added.
+ */
+static int conn_stream_batch_add_qenc(nghttp3_conn *conn,
+                                      conn_stream_batch *batch,
+                                      int *padded) {
+  int rv;
+
+  if (*padded || !conn->tx.qenc || nghttp3_stream_is_blocked(conn->tx.qenc)) {
+    return 0;
+  }
+
+  rv = conn_stream_fill_outq(conn->tx.qenc);
+  if (rv != 0) {
+    return rv;
+  }
+
+  *padded = conn_stream_batch_add(batch, conn->tx.qenc);
+
+  return 0;
+}
+
+nghttp3_ssize nghttp3_conn_writev_streams(nghttp3_conn *conn,
+                                          nghttp3_stream_vec *svec,
+                                          size_t sveccnt, nghttp3_vec *vec,
+                                          size_t veccnt, size_t maxdatalen) {
+  conn_stream_batch batch;
+  nghttp3_stream *stream;
+  nghttp3_tnode *held = NULL;
+  int qenc_added = 0;
+  int rv;
+
+  batch.svec = svec;
+  batch.sveccnt = sveccnt;
+  batch.nsvec = 0;
+  batch.vec = vec;
+  batch.veccnt = veccnt;
+  batch.left = maxdatalen;
+
+  if (conn_stream_batch_full(&batch)) {
+    return 0;
+  }
+
+  if (conn->tx.ctrl && !nghttp3_stream_is_blocked(conn->tx.ctrl)) {
+    rv = conn_stream_fill_outq(conn->tx.ctrl);
+    if (rv != 0) {
+      return rv;
+    }
+
+    conn_stream_batch_add(&batch, conn->tx.ctrl);
+    if (conn_stream_batch_full(&batch)) {
+      return (nghttp3_ssize)batch.nsvec;
+    }
+  }
+
+  if (conn->tx.qdec && !nghttp3_stream_is_blocked(conn->tx.qdec)) {
+    rv = nghttp3_stream_write_qpack_decoder_stream(conn->tx.qdec);
+    if (rv != 0) {
+      return rv;
+    }
+
+    rv = conn_stream_fill_outq(conn->tx.qdec);
+    if (rv != 0) {
+      return rv;
+    }
+
+    conn_stream_batch_add(&batch, conn->tx.qdec);
+    if (conn_stream_batch_full(&batch)) {
+      return (nghttp3_ssize)batch.nsvec;
+    }
+  }
+
+  rv = conn_stream_batch_add_qenc(conn, &batch, &qenc_added);
+  if (rv != 0) {
+    return rv;
+  }
+
+  while (!conn_stream_batch_full(&batch)) {
+    stream = nghttp3_conn_get_next_tx_stream(conn);
+    if (stream == NULL) {
+      break;
+    }
+
+    rv = conn_stream_fill_outq(stream);
+    if (rv != 0) {
+      goto fail;
+    }
+
+    /* Filling stream might encode header fields, and QPACK encoder
+       stream should precede the request stream which refers to the
+       new entries. */
+    rv = conn_stream_batch_add_qenc(conn, &batch, &qenc_added);
+    if (rv != 0) {
+      goto fail;
+    }
+
+    if (conn_stream_batch_full(&batch)) {
+      break;
+    }
+
+    conn_stream_batch_add(&batch, stream);
+    conn_hold_stream(conn, stream, &held);
+  }
+
+  rv = conn_release_held_streams(conn, held);
+  if (rv != 0) {
+    return rv;
+  }
+
+  return (nghttp3_ssize)batch.nsvec;
+
+fail:
+  conn_release_held_streams(conn, held);
+
+  return rv;
+}
+
+int nghttp3_conn_add_write_offsets(nghttp3_conn *conn,
+                                   const nghttp3_stream_vec *svec,
+                                   size_t sveccnt) {
+  size_t i;
+  int rv;
+
+  for (i = 0; i < sveccnt; ++i) {
+    rv = nghttp3_conn_add_write_offset(conn, svec[i].stream_id,
+                                       svec[i].datalen);
+    if (rv != 0) {
+      return rv;
+    }
+  }
+
+  return 0;
+}
+
 int nghttp3_conn_add_ack_offset(nghttp3_conn *conn, int64_t stream_id,
                                 uint64_t n) {
   nghttp3_stream *stream = nghttp3_conn_find_stream(conn, stream_id);
@@ -2098,21 +2918,37 @@ int nghttp3_conn_add_ack_offset(nghttp3_conn *conn, int64_t stream_id,
   return nghttp3_stream_add_ack_offset(stream, n);
 }
 
-static int conn_submit_headers_data(nghttp3_conn *conn, nghttp3_stream *stream,
-                                    const nghttp3_nv *nva, size_t nvlen,
-                                    const nghttp3_data_reader *dr) {
+/*
+ * conn_queue_headers adds HEADERS frame which contains |nva| of
+ * length |nvlen|, or |efs| if it is not NULL, to frq of |stream|.
+ * |nva| is copied, and the reference count of |efs| is incremented.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int conn_queue_headers(nghttp3_conn *conn, nghttp3_stream *stream,
+                              const nghttp3_nv *nva, size_t nvlen,
+                              nghttp3_encoded_field_section *efs) {
   int rv;
-  nghttp3_nv *nnva;
+  nghttp3_nv *nnva = NULL;
   nghttp3_frame_entry frent = {0};
 
-  rv = nghttp3_nva_copy(&nnva, nva, nvlen, conn->mem);
-  if (rv != 0) {
-    return rv;
+  if (efs) {
+    nvlen = 0;
+  } else {
+    rv = nghttp3_nva_copy(&nnva, nva, nvlen, conn->mem);
+    if (rv != 0) {
+      return rv;
+    }
   }
 
   frent.fr.hd.type = NGHTTP3_FRAME_HEADERS;
   frent.fr.headers.nva = nnva;
   frent.fr.headers.nvlen = nvlen;
+  frent.aux.headers.efs = efs;
 
   rv = nghttp3_stream_frq_add(stream, &frent);
   if (rv != 0) {
@@ -2120,11 +2956,51 @@ static int conn_submit_headers_data(nghttp3_conn *conn, nghttp3_stream *stream,
     return rv;
   }
 
-  if (dr) {
-    frent.fr.hd.type = NGHTTP3_FRAME_DATA;
-    frent.aux.data.dr = *dr;
+  if (efs) {
+    nghttp3_encoded_field_section_incref(efs);
+  }
+
+  return 0;
+}
+
+/*
+ * conn_submit_headers_data_frent submits HEADERS frame which contains
+ * |nva| of length |nvlen|, or |efs| if it is not NULL, followed by
+ * DATA frames described by |datafrent| if it is not NULL.  If
+ * eager_header_encoding is enabled, SETTINGS frame has been received,
+ * and nothing precedes HEADERS frame in frq, |nva| is encoded into
+ * the stream immediately.  Before SETTINGS frame is received, QPACK
+ * encoder cannot use the dynamic table, so |nva| is queued to be
+ * encoded when the stream is written.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int
+conn_submit_headers_data_frent(nghttp3_conn *conn, nghttp3_stream *stream,
+                               const nghttp3_nv *nva, size_t nvlen,
+                               nghttp3_encoded_field_section *efs,
+                               const nghttp3_frame_entry *datafrent) {
+  int rv;
+
+  if (!efs && conn->local.settings.eager_header_encoding &&
+      (conn->flags & NGHTTP3_CONN_FLAG_SETTINGS_RECVED) &&
+      nghttp3_ringbuf_len(&stream->frq) == 0) {
+    rv = nghttp3_stream_write_header_block(
+        stream, &conn->qenc, conn->tx.qenc, &conn->tx.qpack.rbuf,
+        &conn->tx.qpack.ebuf, NGHTTP3_FRAME_HEADERS, nva, nvlen);
+  } else {
+    rv = conn_queue_headers(conn, stream, nva, nvlen, efs);
+  }
+  if (rv != 0) {
+    return rv;
+  }
 
-    rv = nghttp3_stream_frq_add(stream, &frent);
+  if (datafrent) {
+    rv = nghttp3_stream_frq_add(stream, datafrent);
     if (rv != 0) {
       return rv;
     }
@@ -2137,15 +3013,37 @@ static int conn_submit_headers_data(nghttp3_conn *conn, nghttp3_stream *stream,
   return 0;
 }
 
+static int conn_submit_headers_data(nghttp3_conn *conn, nghttp3_stream *stream,
+                                    const nghttp3_nv *nva, size_t nvlen,
+                                    const nghttp3_data_reader *dr) {
+  nghttp3_frame_entry frent = {0};
+
+  if (dr == NULL) {
+    return conn_submit_headers_data_frent(conn, stream, nva, nvlen, NULL,
+                                          NULL);
+  }
+
+  frent.fr.hd.type = NGHTTP3_FRAME_DATA;
+  frent.aux.data.dr = *dr;
+
+  return conn_submit_headers_data_frent(conn, stream, nva, nvlen, NULL,
+                                        &frent);
+}
+
 int nghttp3_conn_schedule_stream(nghttp3_conn *conn, nghttp3_stream *stream) {
   /* Assume that stream stays on the same urgency level */
   nghttp3_tnode *node = stream_get_sched_node(stream);
   int rv;
 
-  rv = nghttp3_tnode_schedule(node, conn_get_sched_pq(conn, node),
-                              stream->unscheduled_nwrite);
-  if (rv != 0) {
-    return rv;
+  if (conn->local.settings.enable_drr_scheduler) {
+    nghttp3_tnode_drr_schedule(node, conn_get_sched_queue(conn, node),
+                               stream->unscheduled_nwrite);
+  } else {
+    rv = nghttp3_tnode_schedule(node, conn_get_sched_pq(conn, node),
+                                stream->unscheduled_nwrite);
+    if (rv != 0) {
+      return rv;
+    }
   }
 
   stream->unscheduled_nwrite = 0;
@@ -2166,13 +3064,36 @@ void nghttp3_conn_unschedule_stream(nghttp3_conn *conn,
                                     nghttp3_stream *stream) {
   nghttp3_tnode *node = stream_get_sched_node(stream);
 
+  if (conn->local.settings.enable_drr_scheduler) {
+    nghttp3_tnode_drr_unschedule(node);
+    return;
+  }
+
   nghttp3_tnode_unschedule(node, conn_get_sched_pq(conn, node));
 }
 
-int nghttp3_conn_submit_request(nghttp3_conn *conn, int64_t stream_id,
-                                const nghttp3_nv *nva, size_t nvlen,
-                                const nghttp3_data_reader *dr,
-                                void *stream_user_data) {
+/*
+ * conn_submit_request opens the stream denoted by |stream_id|, and
+ * submits HTTP request header fields |nva| of length |nvlen| followed
+ * by the body described by |datafrent| on it.  If |datafrent| is
+ * NULL, there is no request body.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_INVALID_ARGUMENT
+ *     |stream_id| identifies unidirectional stream.
+ * NGHTTP3_ERR_CONN_CLOSING
+ *     Connection is shutting down, and no new stream is allowed.
+ * NGHTTP3_ERR_STREAM_IN_USE
+ *     Stream has already been opened.
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int conn_submit_request(nghttp3_conn *conn, int64_t stream_id,
+                               const nghttp3_nv *nva, size_t nvlen,
+                               const nghttp3_frame_entry *datafrent,
+                               void *stream_user_data) {
   nghttp3_stream *stream;
   int rv;
 
@@ -2206,11 +3127,47 @@ int nghttp3_conn_submit_request(nghttp3_conn *conn, int64_t stream_id,
 
   nghttp3_http_record_request_method(stream, nva, nvlen);
 
-  if (dr == NULL) {
+  if (datafrent == NULL) {
     stream->flags |= NGHTTP3_STREAM_FLAG_WRITE_END_STREAM;
   }
 
-  return conn_submit_headers_data(conn, stream, nva, nvlen, dr);
+  return conn_submit_headers_data_frent(conn, stream, nva, nvlen, NULL,
+                                        datafrent);
+}
+
+int nghttp3_conn_submit_request(nghttp3_conn *conn, int64_t stream_id,
+                                const nghttp3_nv *nva, size_t nvlen,
+                                const nghttp3_data_reader *dr,
+                                void *stream_user_data) {
+  nghttp3_frame_entry frent = {0};
+
+  if (dr == NULL) {
+    return conn_submit_request(conn, stream_id, nva, nvlen, NULL,
+                               stream_user_data);
+  }
+
+  frent.fr.hd.type = NGHTTP3_FRAME_DATA;
+  frent.aux.data.dr = *dr;
+
+  return conn_submit_request(conn, stream_id, nva, nvlen, &frent,
+                             stream_user_data);
+}
+
+int nghttp3_conn_submit_request_ref(nghttp3_conn *conn, int64_t stream_id,
+                                    const nghttp3_nv *nva, size_t nvlen,
+                                    const nghttp3_data_ref_reader *rdr,
+                                    void *stream_user_data) {
+  nghttp3_frame_entry frent = {0};
+
+  assert(rdr);
+  assert(rdr->read_data_ref);
+
+  frent.fr.hd.type = NGHTTP3_FRAME_DATA;
+  frent.aux.data.source = NGHTTP3_DATA_SOURCE_READ_DATA_REF;
+  frent.aux.data.rdr = *rdr;
+
+  return conn_submit_request(conn, stream_id, nva, nvlen, &frent,
+                             stream_user_data);
 }
 
 int nghttp3_conn_submit_info(nghttp3_conn *conn, int64_t stream_id,
@@ -2251,6 +3208,99 @@ int nghttp3_conn_submit_response(nghttp3_conn *conn, int64_t stream_id,
   return conn_submit_headers_data(conn, stream, nva, nvlen, dr);
 }
 
+int nghttp3_conn_submit_response_ref(nghttp3_conn *conn, int64_t stream_id,
+                                     const nghttp3_nv *nva, size_t nvlen,
+                                     const nghttp3_data_ref_reader *rdr) {
+  nghttp3_stream *stream;
+  nghttp3_frame_entry frent = {0};
+
+  assert(conn->server);
+  assert(conn->tx.qenc);
+  assert(rdr);
+  assert(rdr->read_data_ref);
+
+  stream = nghttp3_conn_find_stream(conn, stream_id);
+  if (stream == NULL) {
+    return NGHTTP3_ERR_STREAM_NOT_FOUND;
+  }
+
+  frent.fr.hd.type = NGHTTP3_FRAME_DATA;
+  frent.aux.data.source = NGHTTP3_DATA_SOURCE_READ_DATA_REF;
+  frent.aux.data.rdr = *rdr;
+
+  return conn_submit_headers_data_frent(conn, stream, nva, nvlen, NULL,
+                                        &frent);
+}
+
+int nghttp3_conn_submit_response_encoded(nghttp3_conn *conn,
+                                         int64_t stream_id,
+                                         nghttp3_encoded_field_section *efs,
+                                         const nghttp3_data_reader *dr) {
+  nghttp3_stream *stream;
+  nghttp3_frame_entry frent = {0};
+
+  assert(conn->server);
+  assert(conn->tx.qenc);
+  assert(efs);
+
+  stream = nghttp3_conn_find_stream(conn, stream_id);
+  if (stream == NULL) {
+    return NGHTTP3_ERR_STREAM_NOT_FOUND;
+  }
+
+  if (dr == NULL) {
+    stream->flags |= NGHTTP3_STREAM_FLAG_WRITE_END_STREAM;
+
+    return conn_submit_headers_data_frent(conn, stream, NULL, 0, efs, NULL);
+  }
+
+  frent.fr.hd.type = NGHTTP3_FRAME_DATA;
+  frent.aux.data.dr = *dr;
+
+  return conn_submit_headers_data_frent(conn, stream, NULL, 0, efs, &frent);
+}
+
+int nghttp3_conn_submit_response_file(nghttp3_conn *conn, int64_t stream_id,
+                                      const nghttp3_nv *nva, size_t nvlen,
+                                      int fd, int64_t offset, uint64_t len) {
+#ifdef HAVE_PREAD
+  nghttp3_stream *stream;
+  nghttp3_frame_entry frent = {0};
+
+  assert(conn->server);
+  assert(conn->tx.qenc);
+
+  if (fd < 0 || offset < 0 || len > NGHTTP3_MAX_VARINT ||
+      len > (uint64_t)(INT64_MAX - offset)) {
+    return NGHTTP3_ERR_INVALID_ARGUMENT;
+  }
+
+  stream = nghttp3_conn_find_stream(conn, stream_id);
+  if (stream == NULL) {
+    return NGHTTP3_ERR_STREAM_NOT_FOUND;
+  }
+
+  frent.fr.hd.type = NGHTTP3_FRAME_DATA;
+  frent.aux.data.source = NGHTTP3_DATA_SOURCE_FILE;
+  frent.aux.data.file.fd = fd;
+  frent.aux.data.file.offset = offset;
+  frent.aux.data.file.left = len;
+
+  return conn_submit_headers_data_frent(conn, stream, nva, nvlen, NULL,
+                                        &frent);
+#else  /* !HAVE_PREAD */
+  (void)conn;
+  (void)stream_id;
+  (void)nva;
+  (void)nvlen;
+  (void)fd;
+  (void)offset;
+  (void)len;
+
+  return NGHTTP3_ERR_INVALID_STATE;
+#endif /* !HAVE_PREAD */
+}
+
 int nghttp3_conn_submit_trailers(nghttp3_conn *conn, int64_t stream_id,
                                  const nghttp3_nv *nva, size_t nvlen) {
   nghttp3_stream *stream;
@@ -2519,6 +3569,20 @@ uint64_t nghttp3_conn_get_frame_payload_left(nghttp3_conn *conn,
   return (uint64_t)stream->rstate.left;
 }
 
+void nghttp3_conn_get_qpack_stats_versioned(
+    const nghttp3_conn *conn, int stats_version,
+    nghttp3_qpack_stats *encoder_stats, nghttp3_qpack_stats *decoder_stats) {
+  if (encoder_stats) {
+    nghttp3_qpack_encoder_get_stats_versioned(&conn->qenc, stats_version,
+                                              encoder_stats);
+  }
+
+  if (decoder_stats) {
+    nghttp3_qpack_decoder_get_stats_versioned(&conn->qdec, stats_version,
+                                              decoder_stats);
+  }
+}
+
 int nghttp3_conn_get_stream_priority_versioned(nghttp3_conn *conn,
                                                int pri_version,
                                                nghttp3_pri *dest,
@@ -2542,6 +3606,55 @@ int nghttp3_conn_get_stream_priority_versioned(nghttp3_conn *conn,
   return 0;
 }
 
+static nghttp3_vec rcbuf_get_vec(const nghttp3_rcbuf *rcbuf) {
+  nghttp3_vec vec = {0};
+
+  if (rcbuf) {
+    vec = nghttp3_rcbuf_get_buf(rcbuf);
+  }
+
+  return vec;
+}
+
+int nghttp3_conn_get_request_view_versioned(nghttp3_conn *conn,
+                                            int request_view_version,
+                                            nghttp3_request_view *dest,
+                                            int64_t stream_id) {
+  nghttp3_stream *stream;
+  (void)request_view_version;
+
+  assert(conn->server);
+
+  if (!nghttp3_client_stream_bidi(stream_id)) {
+    return NGHTTP3_ERR_INVALID_ARGUMENT;
+  }
+
+  if (!conn->local.settings.enable_request_view) {
+    return NGHTTP3_ERR_INVALID_STATE;
+  }
+
+  stream = nghttp3_conn_find_stream(conn, stream_id);
+  if (stream == NULL) {
+    return NGHTTP3_ERR_STREAM_NOT_FOUND;
+  }
+
+  dest->method = stream->rx.http.method;
+  dest->method_name = rcbuf_get_vec(stream->rx.req.method);
+  dest->path = rcbuf_get_vec(stream->rx.req.path);
+  dest->authority = rcbuf_get_vec(stream->rx.req.authority);
+  dest->scheme = rcbuf_get_vec(stream->rx.req.scheme);
+  dest->content_length = stream->rx.http.content_length;
+
+  if (stream->rx.http.flags & NGHTTP3_HTTP_FLAG_PRIORITY) {
+    dest->pri = stream->rx.http.pri;
+  } else {
+    dest->pri.urgency = NGHTTP3_DEFAULT_URGENCY;
+    dest->pri.inc = 0;
+  }
+
+  return 0;
+}
+
 int nghttp3_conn_set_client_stream_priority(nghttp3_conn *conn,
                                             int64_t stream_id,
                                             const uint8_t *data,
@@ -2614,10 +3727,19 @@ int nghttp3_conn_is_drained(nghttp3_conn *conn) {
 
 void nghttp3_settings_default_versioned(int settings_version,
                                         nghttp3_settings *settings) {
-  (void)settings_version;
-
-  memset(settings, 0, sizeof(nghttp3_settings));
-  settings->max_field_section_size = NGHTTP3_VARINT_MAX;
-  settings->qpack_encoder_max_dtable_capacity =
-      NGHTTP3_QPACK_ENCODER_MAX_DTABLE_CAPACITY;
+  size_t len = settingslen_version(settings_version);
+
+  memset(settings, 0, len);
+
+  switch (settings_version) {
+  case NGHTTP3_SETTINGS_VERSION:
+    settings->qpack_max_blocked_datalen =
+        NGHTTP3_QPACK_MAX_BLOCKED_DATALEN;
+    /* fall through */
+  case NGHTTP3_SETTINGS_V1:
+    settings->max_field_section_size = NGHTTP3_VARINT_MAX;
+    settings->qpack_encoder_max_dtable_capacity =
+        NGHTTP3_QPACK_ENCODER_MAX_DTABLE_CAPACITY;
+    break;
+  }
 }
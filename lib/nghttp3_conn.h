@@ -33,6 +33,7 @@
 
 #include "nghttp3_stream.h"
 #include "nghttp3_map.h"
+#include "nghttp3_stmap.h"
 #include "nghttp3_qpack.h"
 #include "nghttp3_tnode.h"
 #include "nghttp3_idtr.h"
@@ -80,14 +81,22 @@ nghttp3_objalloc_decl(chunk, nghttp3_chunk, oplent);
 
 struct nghttp3_conn {
   nghttp3_objalloc out_chunk_objalloc;
+  /* in_chunk_objalloc is the pool of the chunks which buffer the
+     data of the streams blocked by QPACK decoder. */
+  nghttp3_objalloc in_chunk_objalloc;
   nghttp3_objalloc stream_objalloc;
   nghttp3_callbacks callbacks;
-  nghttp3_map streams;
+  nghttp3_stmap streams;
   nghttp3_qpack_decoder qdec;
   nghttp3_qpack_encoder qenc;
   nghttp3_pq qpack_blocked_streams;
   struct {
     nghttp3_pq spq;
+    /* fifo and drr are the queues of non-incremental and
+       incremental streams respectively.  They are used instead of
+       spq if local.settings.enable_drr_scheduler is nonzero. */
+    nghttp3_tnode_queue fifo;
+    nghttp3_tnode_queue drr;
   } sched[NGHTTP3_URGENCY_LEVELS];
   const nghttp3_mem *mem;
   void *user_data;
@@ -131,6 +140,9 @@ struct nghttp3_conn {
     /* pri_fieldlen is the number of bytes written into
        pri_fieldbuf. */
     size_t pri_fieldbuflen;
+    /* blocked_datalen is the number of bytes buffered in total by
+       the streams blocked by QPACK decoder. */
+    size_t blocked_datalen;
   } rx;
 
   struct {
@@ -153,7 +165,8 @@ int nghttp3_conn_create_stream(nghttp3_conn *conn, nghttp3_stream **pstream,
 
 nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
                                      nghttp3_stream *stream, const uint8_t *src,
-                                     size_t srclen, int fin);
+                                     size_t srclen, int fin,
+                                     void *const *pbuf_user_data);
 
 nghttp3_ssize nghttp3_conn_read_uni(nghttp3_conn *conn, nghttp3_stream *stream,
                                     const uint8_t *src, size_t srclen, int fin);
@@ -0,0 +1,79 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "nghttp3_encoded_field_section.h"
+
+#include <assert.h>
+
+#include "nghttp3_mem.h"
+#include "nghttp3_qpack.h"
+
+int nghttp3_encoded_field_section_new(nghttp3_encoded_field_section **pefs,
+                                      const nghttp3_nv *nva, size_t nvlen,
+                                      const nghttp3_mem *mem) {
+  size_t len = nghttp3_qpack_static_field_section_bound(nva, nvlen);
+  uint8_t *p;
+  nghttp3_encoded_field_section *efs;
+
+  if (mem == NULL) {
+    mem = nghttp3_mem_default();
+  }
+
+  p = nghttp3_mem_malloc(mem, sizeof(nghttp3_encoded_field_section) + len);
+  if (p == NULL) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  efs = (void *)p;
+  efs->mem = mem;
+  efs->base = p + sizeof(nghttp3_encoded_field_section);
+  efs->len = (size_t)(nghttp3_qpack_write_static_field_section(efs->base, nva,
+                                                              nvlen) -
+                      efs->base);
+  efs->ref = 1;
+
+  assert(efs->len <= len);
+
+  *pefs = efs;
+
+  return 0;
+}
+
+void nghttp3_encoded_field_section_incref(nghttp3_encoded_field_section *efs) {
+  assert(efs->ref > 0);
+
+  ++efs->ref;
+}
+
+void nghttp3_encoded_field_section_decref(nghttp3_encoded_field_section *efs) {
+  if (efs == NULL) {
+    return;
+  }
+
+  assert(efs->ref > 0);
+
+  if (--efs->ref == 0) {
+    nghttp3_mem_free(efs->mem, efs);
+  }
+}
@@ -74,6 +74,8 @@ const char *nghttp3_strerror(int liberr) {
     return "ERR_H3_SETTINGS_ERROR";
   case NGHTTP3_ERR_H3_STREAM_CREATION_ERROR:
     return "ERR_H3_STREAM_CREATION_ERROR";
+  case NGHTTP3_ERR_H3_EXCESSIVE_LOAD:
+    return "ERR_H3_EXCESSIVE_LOAD";
   case NGHTTP3_ERR_NOMEM:
     return "ERR_NOMEM";
   case NGHTTP3_ERR_CALLBACK_FAILURE:
@@ -116,6 +118,8 @@ uint64_t nghttp3_err_infer_quic_app_error_code(int liberr) {
     return NGHTTP3_H3_SETTINGS_ERROR;
   case NGHTTP3_ERR_H3_STREAM_CREATION_ERROR:
     return NGHTTP3_H3_STREAM_CREATION_ERROR;
+  case NGHTTP3_ERR_H3_EXCESSIVE_LOAD:
+    return NGHTTP3_H3_EXCESSIVE_LOAD;
   case NGHTTP3_ERR_MALFORMED_HTTP_HEADER:
   case NGHTTP3_ERR_MALFORMED_HTTP_MESSAGING:
     return NGHTTP3_H3_MESSAGE_ERROR;
@@ -55,6 +55,10 @@ void nghttp3_gaptr_free(nghttp3_gaptr *gaptr) {
   nghttp3_ksl_free(&gaptr->gap);
 }
 
+void nghttp3_gaptr_clear(nghttp3_gaptr *gaptr) {
+  nghttp3_ksl_clear(&gaptr->gap);
+}
+
 int nghttp3_gaptr_push(nghttp3_gaptr *gaptr, uint64_t offset,
                        uint64_t datalen) {
   int rv;
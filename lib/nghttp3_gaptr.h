@@ -57,6 +57,13 @@ void nghttp3_gaptr_init(nghttp3_gaptr *gaptr, const nghttp3_mem *mem);
  */
 void nghttp3_gaptr_free(nghttp3_gaptr *gaptr);
 
+/*
+ * nghttp3_gaptr_clear makes |gaptr| the initial state, that is, the
+ * gap is [0, UINT64_MAX).  The memory which |gaptr| has allocated is
+ * kept for reuse.
+ */
+void nghttp3_gaptr_clear(nghttp3_gaptr *gaptr);
+
 /*
  * nghttp3_gaptr_push adds new data of length |datalen| at the stream
  * offset |offset|.
@@ -175,6 +175,79 @@ int nghttp3_pri_parse_priority_versioned(int pri_version, nghttp3_pri *dest,
   return nghttp3_http_parse_priority(dest, value, valuelen);
 }
 
+/*
+ * http_lookup_method returns one of NGHTTP3_METHOD_* which |name| of
+ * length |namelen| denotes.  It returns NGHTTP3_METHOD_UNKNOWN if
+ * |name| is not a well-known method.
+ */
+static uint8_t http_lookup_method(const uint8_t *name, size_t namelen) {
+  switch (namelen) {
+  case 3:
+    switch (name[0]) {
+    case 'G':
+      if (lstreq("GET", name, namelen)) {
+        return NGHTTP3_METHOD_GET;
+      }
+      break;
+    case 'P':
+      if (lstreq("PUT", name, namelen)) {
+        return NGHTTP3_METHOD_PUT;
+      }
+      break;
+    }
+    break;
+  case 4:
+    switch (name[0]) {
+    case 'H':
+      if (lstreq("HEAD", name, namelen)) {
+        return NGHTTP3_METHOD_HEAD;
+      }
+      break;
+    case 'P':
+      if (lstreq("POST", name, namelen)) {
+        return NGHTTP3_METHOD_POST;
+      }
+      break;
+    }
+    break;
+  case 5:
+    switch (name[0]) {
+    case 'P':
+      if (lstreq("PATCH", name, namelen)) {
+        return NGHTTP3_METHOD_PATCH;
+      }
+      break;
+    case 'T':
+      if (lstreq("TRACE", name, namelen)) {
+        return NGHTTP3_METHOD_TRACE;
+      }
+      break;
+    }
+    break;
+  case 6:
+    if (lstreq("DELETE", name, namelen)) {
+      return NGHTTP3_METHOD_DELETE;
+    }
+    break;
+  case 7:
+    switch (name[6]) {
+    case 'T':
+      if (lstreq("CONNECT", name, namelen)) {
+        return NGHTTP3_METHOD_CONNECT;
+      }
+      break;
+    case 'S':
+      if (lstreq("OPTIONS", name, namelen)) {
+        return NGHTTP3_METHOD_OPTIONS;
+      }
+      break;
+    }
+    break;
+  }
+
+  return NGHTTP3_METHOD_UNKNOWN;
+}
+
 static int http_request_on_header(nghttp3_http_state *http,
                                   nghttp3_qpack_nv *nv, int trailers,
                                   int connect_protocol) {
@@ -197,25 +270,16 @@ static int http_request_on_header(nghttp3_http_state *http,
     if (!check_pseudo_header(http, nv, NGHTTP3_HTTP_FLAG__METHOD)) {
       return NGHTTP3_ERR_MALFORMED_HTTP_HEADER;
     }
-    switch (nv->value->len) {
-    case 4:
-      if (lstreq("HEAD", nv->value->base, nv->value->len)) {
-        http->flags |= NGHTTP3_HTTP_FLAG_METH_HEAD;
-      }
+    http->method = http_lookup_method(nv->value->base, nv->value->len);
+    switch (http->method) {
+    case NGHTTP3_METHOD_HEAD:
+      http->flags |= NGHTTP3_HTTP_FLAG_METH_HEAD;
       break;
-    case 7:
-      switch (nv->value->base[6]) {
-      case 'T':
-        if (lstreq("CONNECT", nv->value->base, nv->value->len)) {
-          http->flags |= NGHTTP3_HTTP_FLAG_METH_CONNECT;
-        }
-        break;
-      case 'S':
-        if (lstreq("OPTIONS", nv->value->base, nv->value->len)) {
-          http->flags |= NGHTTP3_HTTP_FLAG_METH_OPTIONS;
-        }
-        break;
-      }
+    case NGHTTP3_METHOD_CONNECT:
+      http->flags |= NGHTTP3_HTTP_FLAG_METH_CONNECT;
+      break;
+    case NGHTTP3_METHOD_OPTIONS:
+      http->flags |= NGHTTP3_HTTP_FLAG_METH_OPTIONS;
       break;
     }
     break;
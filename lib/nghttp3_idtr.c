@@ -41,6 +41,10 @@ void nghttp3_idtr_free(nghttp3_idtr *idtr) {
   nghttp3_gaptr_free(&idtr->gap);
 }
 
+void nghttp3_idtr_clear(nghttp3_idtr *idtr) {
+  nghttp3_gaptr_clear(&idtr->gap);
+}
+
 /*
  * id_from_stream_id translates |stream_id| to id space used by
  * nghttp3_idtr.
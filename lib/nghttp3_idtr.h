@@ -60,6 +60,13 @@ void nghttp3_idtr_init(nghttp3_idtr *idtr, int server, const nghttp3_mem *mem);
  */
 void nghttp3_idtr_free(nghttp3_idtr *idtr);
 
+/*
+ * nghttp3_idtr_clear makes |idtr| the initial state, in which no ID
+ * is in use.  The memory which |idtr| has allocated is kept for
+ * reuse.
+ */
+void nghttp3_idtr_clear(nghttp3_idtr *idtr);
+
 /*
  * nghttp3_idtr_open claims that |stream_id| is in used.
  *
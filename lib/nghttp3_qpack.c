@@ -738,39 +738,348 @@ static int qpack_nv_value_eq(const nghttp3_qpack_nv *a, const nghttp3_nv *b) {
          memeq(a->value->base, b->value, b->valuelen);
 }
 
-static void qpack_map_init(nghttp3_qpack_map *map) {
-  memset(map, 0, sizeof(nghttp3_qpack_map));
+#define NGHTTP3_QPACK_MAP_INITIAL_TABLE_LENBITS 4
+
+static void qpack_map_table_init(nghttp3_qpack_map_table *tbl) {
+  tbl->table = NULL;
+  tbl->size = 0;
+  tbl->tablelen = 0;
+  tbl->tablelenbits = 0;
 }
 
-static void qpack_map_insert(nghttp3_qpack_map *map, nghttp3_qpack_entry *ent) {
-  nghttp3_qpack_entry **bucket;
+static size_t qpack_map_h2idx(uint32_t hash, uint32_t bits) {
+  return hash >> (32 - bits);
+}
 
-  bucket = &map->table[ent->hash & (NGHTTP3_QPACK_MAP_SIZE - 1)];
+static size_t qpack_map_distance(const nghttp3_qpack_map_table *tbl,
+                                 const nghttp3_qpack_map_bucket *bkt,
+                                 size_t idx) {
+  return (idx - qpack_map_h2idx(bkt->hash, tbl->tablelenbits)) &
+         (tbl->tablelen - 1);
+}
 
-  if (*bucket == NULL) {
-    *bucket = ent;
-    return;
-  }
+static void qpack_map_table_insert_bucket(nghttp3_qpack_map_table *tbl,
+                                          nghttp3_qpack_map_bucket *nbkt) {
+  size_t idx = qpack_map_h2idx(nbkt->hash, tbl->tablelenbits);
+  size_t d = 0, dd;
+  nghttp3_qpack_map_bucket *bkt, tmp;
+
+  for (;;) {
+    bkt = &tbl->table[idx];
+
+    if (bkt->ent == NULL) {
+      *bkt = *nbkt;
+      return;
+    }
+
+    dd = qpack_map_distance(tbl, bkt, idx);
+    if (d > dd) {
+      tmp = *bkt;
+      *bkt = *nbkt;
+      *nbkt = tmp;
+      d = dd;
+    }
 
-  /* larger absidx is linked near the root */
-  ent->map_next = *bucket;
-  *bucket = ent;
+    ++d;
+    idx = (idx + 1) & (tbl->tablelen - 1);
+  }
 }
 
-static void qpack_map_remove(nghttp3_qpack_map *map, nghttp3_qpack_entry *ent) {
-  nghttp3_qpack_entry **dst;
+/* new_tablelen == (1 << new_tablelenbits) must hold. */
+static int qpack_map_table_resize(nghttp3_qpack_map_table *tbl,
+                                  uint32_t new_tablelen,
+                                  uint32_t new_tablelenbits,
+                                  const nghttp3_mem *mem) {
+  nghttp3_qpack_map_bucket *old_table = tbl->table, bkt;
+  uint32_t old_tablelen = tbl->tablelen;
+  uint32_t i;
+
+  tbl->table =
+      nghttp3_mem_calloc(mem, new_tablelen, sizeof(nghttp3_qpack_map_bucket));
+  if (tbl->table == NULL) {
+    tbl->table = old_table;
+    return NGHTTP3_ERR_NOMEM;
+  }
 
-  dst = &map->table[ent->hash & (NGHTTP3_QPACK_MAP_SIZE - 1)];
+  tbl->tablelen = new_tablelen;
+  tbl->tablelenbits = new_tablelenbits;
 
-  for (; *dst; dst = &(*dst)->map_next) {
-    if (*dst != ent) {
+  for (i = 0; i < old_tablelen; ++i) {
+    if (old_table[i].ent == NULL) {
       continue;
     }
 
-    *dst = ent->map_next;
-    ent->map_next = NULL;
+    bkt = old_table[i];
+    qpack_map_table_insert_bucket(tbl, &bkt);
+  }
+
+  nghttp3_mem_free(mem, old_table);
+
+  return 0;
+}
+
+/*
+ * qpack_map_table_reserve makes sure that |tbl| can store one more
+ * bucket.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int qpack_map_table_reserve(nghttp3_qpack_map_table *tbl,
+                                   const nghttp3_mem *mem) {
+  /* Load factor is 0.75 */
+  if ((tbl->size + 1) * 4 <= (size_t)tbl->tablelen * 3) {
+    return 0;
+  }
+
+  if (tbl->tablelen) {
+    return qpack_map_table_resize(tbl, tbl->tablelen * 2,
+                                  tbl->tablelenbits + 1, mem);
+  }
+
+  return qpack_map_table_resize(tbl,
+                                1 << NGHTTP3_QPACK_MAP_INITIAL_TABLE_LENBITS,
+                                NGHTTP3_QPACK_MAP_INITIAL_TABLE_LENBITS, mem);
+}
+
+/*
+ * qpack_map_table_insert inserts |ent| to |tbl| with key |hash|.
+ * This function assumes that qpack_map_table_reserve has been called
+ * successfully.
+ */
+static void qpack_map_table_insert(nghttp3_qpack_map_table *tbl,
+                                   nghttp3_qpack_entry *ent, uint32_t hash) {
+  nghttp3_qpack_map_bucket bkt;
+
+  bkt.ent = ent;
+  bkt.absidx = ent->absidx;
+  bkt.hash = hash;
+
+  qpack_map_table_insert_bucket(tbl, &bkt);
+
+  ++tbl->size;
+}
+
+/*
+ * qpack_map_table_find_bucket returns the bucket which stores |ent|
+ * with key |hash|.  It returns NULL if there is no such bucket.
+ */
+static nghttp3_qpack_map_bucket *
+qpack_map_table_find_bucket(nghttp3_qpack_map_table *tbl,
+                            const nghttp3_qpack_entry *ent, uint32_t hash) {
+  size_t idx;
+  size_t d = 0;
+  nghttp3_qpack_map_bucket *bkt;
+
+  if (tbl->size == 0) {
+    return NULL;
+  }
+
+  idx = qpack_map_h2idx(hash, tbl->tablelenbits);
+
+  for (;;) {
+    bkt = &tbl->table[idx];
+
+    if (bkt->ent == NULL || d > qpack_map_distance(tbl, bkt, idx)) {
+      return NULL;
+    }
+
+    if (bkt->ent == ent) {
+      return bkt;
+    }
+
+    ++d;
+    idx = (idx + 1) & (tbl->tablelen - 1);
+  }
+}
+
+/*
+ * qpack_map_table_remove_bucket removes |bkt| from |tbl|.  It uses
+ * backward shift deletion, and no tombstone is left behind.
+ */
+static void qpack_map_table_remove_bucket(nghttp3_qpack_map_table *tbl,
+                                          nghttp3_qpack_map_bucket *bkt) {
+  size_t didx = (size_t)(bkt - tbl->table);
+  size_t idx = (didx + 1) & (tbl->tablelen - 1);
+
+  for (;;) {
+    bkt = &tbl->table[idx];
+    if (bkt->ent == NULL || qpack_map_distance(tbl, bkt, idx) == 0) {
+      break;
+    }
+
+    tbl->table[didx] = *bkt;
+    didx = idx;
+
+    idx = (idx + 1) & (tbl->tablelen - 1);
+  }
+
+  memset(&tbl->table[didx], 0, sizeof(tbl->table[didx]));
+
+  --tbl->size;
+}
+
+static void qpack_map_init(nghttp3_qpack_map *map, const nghttp3_mem *mem) {
+  qpack_map_table_init(&map->nv_table);
+  qpack_map_table_init(&map->name_table);
+  map->mem = mem;
+}
+
+static void qpack_map_free(nghttp3_qpack_map *map) {
+  nghttp3_mem_free(map->mem, map->name_table.table);
+  nghttp3_mem_free(map->mem, map->nv_table.table);
+}
+
+static void qpack_map_table_clear(nghttp3_qpack_map_table *tbl) {
+  if (tbl->tablelen) {
+    memset(tbl->table, 0, sizeof(*tbl->table) * tbl->tablelen);
+  }
+
+  tbl->size = 0;
+}
+
+/*
+ * qpack_map_clear removes all entries from |map|.  It keeps the
+ * bucket tables for reuse.
+ */
+static void qpack_map_clear(nghttp3_qpack_map *map) {
+  qpack_map_table_clear(&map->nv_table);
+  qpack_map_table_clear(&map->name_table);
+}
+
+static int qpack_nv_token_name_eq(const nghttp3_qpack_nv *a,
+                                  const nghttp3_qpack_nv *b) {
+  if (a->token != b->token) {
+    return 0;
+  }
+
+  if (a->token != -1) {
+    return 1;
+  }
+
+  return a->name->len == b->name->len &&
+         memeq(a->name->base, b->name->base, b->name->len);
+}
+
+/*
+ * qpack_map_find_name returns the bucket in map->name_table which
+ * stores the most recently inserted entry that has the same name as
+ * |nv|.  |token| is a token of nv->name.  |hash| is a hash of
+ * nv->name.  It returns NULL if there is no such bucket.
+ */
+static nghttp3_qpack_map_bucket *
+qpack_map_find_name(nghttp3_qpack_map *map, const nghttp3_nv *nv,
+                    int32_t token, uint32_t hash) {
+  nghttp3_qpack_map_table *tbl = &map->name_table;
+  nghttp3_qpack_map_bucket *bkt;
+  size_t idx;
+  size_t d = 0;
+
+  if (tbl->size == 0) {
+    return NULL;
+  }
+
+  idx = qpack_map_h2idx(hash, tbl->tablelenbits);
+
+  for (;;) {
+    bkt = &tbl->table[idx];
+
+    if (bkt->ent == NULL || d > qpack_map_distance(tbl, bkt, idx)) {
+      return NULL;
+    }
+
+    if (bkt->hash == hash && bkt->ent->nv.token == token &&
+        (token != -1 || qpack_nv_name_eq(&bkt->ent->nv, nv))) {
+      return bkt;
+    }
+
+    ++d;
+    idx = (idx + 1) & (tbl->tablelen - 1);
+  }
+}
+
+/*
+ * qpack_map_insert inserts |ent| to |map|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int qpack_map_insert(nghttp3_qpack_map *map, nghttp3_qpack_entry *ent) {
+  nghttp3_qpack_map_table *tbl = &map->name_table;
+  nghttp3_qpack_map_bucket *bkt;
+  size_t idx;
+  size_t d = 0;
+  int rv;
+
+  rv = qpack_map_table_reserve(&map->nv_table, map->mem);
+  if (rv != 0) {
+    return rv;
+  }
+
+  rv = qpack_map_table_reserve(tbl, map->mem);
+  if (rv != 0) {
+    return rv;
+  }
+
+  qpack_map_table_insert(&map->nv_table, ent, ent->nvhash);
+
+  idx = qpack_map_h2idx(ent->hash, tbl->tablelenbits);
+
+  for (;; ++d, idx = (idx + 1) & (tbl->tablelen - 1)) {
+    bkt = &tbl->table[idx];
+
+    if (bkt->ent == NULL || d > qpack_map_distance(tbl, bkt, idx)) {
+      break;
+    }
+
+    if (bkt->hash == ent->hash &&
+        qpack_nv_token_name_eq(&bkt->ent->nv, &ent->nv)) {
+      /* larger absidx is placed at the head of the list */
+      ent->name_prev = bkt->ent;
+      bkt->ent->name_next = ent;
+      bkt->ent = ent;
+      bkt->absidx = ent->absidx;
+
+      return 0;
+    }
+  }
+
+  qpack_map_table_insert(tbl, ent, ent->hash);
+
+  return 0;
+}
+
+/*
+ * qpack_map_remove removes |ent| from |map|.  |ent| must be the
+ * oldest entry in dynamic table.
+ */
+static void qpack_map_remove(nghttp3_qpack_map *map, nghttp3_qpack_entry *ent) {
+  nghttp3_qpack_map_bucket *bkt;
+
+  assert(ent->name_prev == NULL);
+
+  bkt = qpack_map_table_find_bucket(&map->nv_table, ent, ent->nvhash);
+  if (bkt) {
+    qpack_map_table_remove_bucket(&map->nv_table, bkt);
+  }
+
+  if (ent->name_next) {
+    ent->name_next->name_prev = NULL;
+    ent->name_next = NULL;
+
     return;
   }
+
+  bkt = qpack_map_table_find_bucket(&map->name_table, ent, ent->hash);
+  if (bkt) {
+    qpack_map_table_remove_bucket(&map->name_table, bkt);
+  }
 }
 
 /*
@@ -784,46 +1093,107 @@ static int qpack_context_can_reference(nghttp3_qpack_context *ctx,
   return ctx->dtable_sum - ent->sum <= ctx->max_dtable_capacity;
 }
 
-/* |*ppb_match| (post-base match), if it is not NULL, is always exact
-     match. */
+/*
+ * encoder_qpack_map_find searches |nv| in dynamic table.  Among the
+ * matching entries, the most recently inserted one is chosen.
+ * |*ppb_match| (post-base match), if it is not NULL, is always exact
+ * match.
+ */
 static void encoder_qpack_map_find(nghttp3_qpack_encoder *encoder,
                                    int *exact_match,
                                    nghttp3_qpack_entry **pmatch,
                                    nghttp3_qpack_entry **ppb_match,
                                    const nghttp3_nv *nv, int32_t token,
-                                   uint32_t hash, uint64_t krcnt,
-                                   int allow_blocking, int name_only) {
-  nghttp3_qpack_entry *p;
+                                   uint32_t hash, uint32_t nvhash,
+                                   uint64_t krcnt, int allow_blocking,
+                                   int name_only) {
+  nghttp3_qpack_map_table *tbl = &encoder->dtable_map.nv_table;
+  nghttp3_qpack_map_bucket *bkt;
+  nghttp3_qpack_entry *p, *exact = NULL, *pb_match = NULL;
+  size_t idx;
+  size_t d = 0;
 
   *exact_match = 0;
   *pmatch = NULL;
   *ppb_match = NULL;
 
-  for (p = encoder->dtable_map.table[hash & (NGHTTP3_QPACK_MAP_SIZE - 1)]; p;
-       p = p->map_next) {
-    if (token != p->nv.token ||
-        (token == -1 && (hash != p->hash || !qpack_nv_name_eq(&p->nv, nv))) ||
-        !qpack_context_can_reference(&encoder->ctx, p->absidx)) {
-      continue;
-    }
-    if (allow_blocking || p->absidx + 1 <= krcnt) {
-      if (!*pmatch) {
-        *pmatch = p;
-        if (name_only) {
-          return;
-        }
+  if (!name_only && tbl->size) {
+    idx = qpack_map_h2idx(nvhash, tbl->tablelenbits);
+
+    for (;; ++d, idx = (idx + 1) & (tbl->tablelen - 1)) {
+      bkt = &tbl->table[idx];
+
+      if (bkt->ent == NULL || d > qpack_map_distance(tbl, bkt, idx)) {
+        break;
       }
-      if (qpack_nv_value_eq(&p->nv, nv)) {
-        *pmatch = p;
-        *exact_match = 1;
-        return;
+
+      if (bkt->hash != nvhash) {
+        continue;
+      }
+
+      p = bkt->ent;
+
+      if (token != p->nv.token ||
+          (token == -1 && !qpack_nv_name_eq(&p->nv, nv)) ||
+          !qpack_nv_value_eq(&p->nv, nv) ||
+          !qpack_context_can_reference(&encoder->ctx, bkt->absidx)) {
+        continue;
       }
-    } else if (!*ppb_match && qpack_nv_value_eq(&p->nv, nv)) {
-      *ppb_match = p;
+
+      if (allow_blocking || bkt->absidx + 1 <= krcnt) {
+        if (!exact || exact->absidx < bkt->absidx) {
+          exact = p;
+        }
+      } else if (!pb_match || pb_match->absidx < bkt->absidx) {
+        pb_match = p;
+      }
+    }
+
+    if (exact) {
+      *pmatch = exact;
+      *exact_match = 1;
+
+      return;
+    }
+
+    *ppb_match = pb_match;
+  }
+
+  bkt = qpack_map_find_name(&encoder->dtable_map, nv, token, hash);
+  if (!bkt) {
+    return;
+  }
+
+  for (p = bkt->ent; p; p = p->name_prev) {
+    if (!qpack_context_can_reference(&encoder->ctx, p->absidx)) {
+      /* Older entries cannot be referenced either. */
+      return;
+    }
+
+    if (allow_blocking || p->absidx + 1 <= krcnt) {
+      *pmatch = p;
+      return;
     }
   }
 }
 
+/*
+ * qpack_rcbuf_view_init initializes |rcbuf| as a borrowed
+ * nghttp3_rcbuf which refers to the buffer pointed by |p| of length
+ * |len|, and returns |rcbuf|.
+ */
+static nghttp3_rcbuf *qpack_rcbuf_view_init(nghttp3_rcbuf *rcbuf,
+                                            const uint8_t *p, size_t len) {
+  rcbuf->mem = NULL;
+  /* Zero length view still points to a valid byte so that the
+     callers can safely look at base[0]. */
+  rcbuf->base = len ? (uint8_t *)p : (uint8_t *)"";
+  rcbuf->len = len;
+  rcbuf->ref = NGHTTP3_RCBUF_REF_BORROWED;
+
+  return rcbuf;
+}
+
 /*
  * qpack_context_init initializes |ctx|.  |hard_max_dtable_capacity|
  * is the upper bound of the dynamic table capacity.  |mem| is a
@@ -864,21 +1234,157 @@ static int qpack_context_init(nghttp3_qpack_context *ctx,
   ctx->max_dtable_capacity = 0;
   ctx->max_blocked_streams = max_blocked_streams;
   ctx->next_absidx = 0;
+  ctx->ring.ents = NULL;
+  ctx->ring.entslen = 0;
+  ctx->ring.buf = NULL;
+  ctx->ring.buflen = 0;
+  ctx->ring.head = 0;
+  ctx->ring.stage = NULL;
+#ifdef ENABLE_QPACK_STATS
+  memset(&ctx->stats, 0, sizeof(ctx->stats));
+#endif /* ENABLE_QPACK_STATS */
   ctx->bad = 0;
 
   return 0;
 }
 
+/*
+ * qpack_context_init_ring makes |ctx| store dynamic table entries in
+ * nghttp3_qpack_ring.  It allocates all memory which dynamic table
+ * needs up to ctx->hard_max_dtable_capacity.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_INVALID_STATE
+ *     An entry has already been inserted into dynamic table.
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int qpack_context_init_ring(nghttp3_qpack_context *ctx) {
+  nghttp3_qpack_ring *ring = &ctx->ring;
+  size_t len = ctx->hard_max_dtable_capacity / NGHTTP3_QPACK_ENTRY_OVERHEAD;
+  size_t len2;
+  int rv;
+
+  if (ring->ents) {
+    return 0;
+  }
+
+  if (ctx->next_absidx) {
+    return NGHTTP3_ERR_INVALID_STATE;
+  }
+
+  for (len2 = 1; len2 < len; len2 <<= 1)
+    ;
+
+  rv = nghttp3_ringbuf_reserve(&ctx->dtable, len2);
+  if (rv != 0) {
+    return rv;
+  }
+
+  ring->buf =
+      nghttp3_mem_malloc(ctx->mem, ctx->hard_max_dtable_capacity * 3 + 1);
+  if (ring->buf == NULL) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  ring->ents =
+      nghttp3_mem_malloc(ctx->mem, sizeof(nghttp3_qpack_ring_entry) * len2);
+  if (ring->ents == NULL) {
+    nghttp3_mem_free(ctx->mem, ring->buf);
+    ring->buf = NULL;
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  ring->entslen = len2;
+  ring->buflen = ctx->hard_max_dtable_capacity * 2;
+  ring->head = 0;
+  ring->stage = ring->buf + ring->buflen;
+
+  return 0;
+}
+
+/*
+ * qpack_context_free_entry frees |ent| which has been removed from
+ * dynamic table of |ctx|.
+ */
+static void qpack_context_free_entry(nghttp3_qpack_context *ctx,
+                                     nghttp3_qpack_entry *ent) {
+  nghttp3_qpack_entry_free(ent);
+
+  if (ctx->ring.ents == NULL) {
+    nghttp3_mem_free(ctx->mem, ent);
+  }
+}
+
 static void qpack_context_free(nghttp3_qpack_context *ctx) {
   nghttp3_qpack_entry *ent;
   size_t i, len = nghttp3_ringbuf_len(&ctx->dtable);
 
   for (i = 0; i < len; ++i) {
     ent = *(nghttp3_qpack_entry **)nghttp3_ringbuf_get(&ctx->dtable, i);
-    nghttp3_qpack_entry_free(ent);
-    nghttp3_mem_free(ctx->mem, ent);
+    qpack_context_free_entry(ctx, ent);
   }
   nghttp3_ringbuf_free(&ctx->dtable);
+  nghttp3_mem_free(ctx->mem, ctx->ring.ents);
+  nghttp3_mem_free(ctx->mem, ctx->ring.buf);
+}
+
+/*
+ * qpack_context_reset removes all entries from dynamic table of |ctx|
+ * and makes |ctx| the state right after qpack_context_init.  Unlike
+ * qpack_context_free, it keeps the memory for dynamic table,
+ * including nghttp3_qpack_ring if it has been allocated.
+ */
+static void qpack_context_reset(nghttp3_qpack_context *ctx) {
+  nghttp3_qpack_entry *ent;
+  size_t i, len = nghttp3_ringbuf_len(&ctx->dtable);
+
+  for (i = 0; i < len; ++i) {
+    ent = *(nghttp3_qpack_entry **)nghttp3_ringbuf_get(&ctx->dtable, i);
+    qpack_context_free_entry(ctx, ent);
+  }
+  nghttp3_ringbuf_resize(&ctx->dtable, 0);
+
+  ctx->dtable_size = 0;
+  ctx->dtable_sum = 0;
+  ctx->max_dtable_capacity = 0;
+  ctx->next_absidx = 0;
+  ctx->ring.head = 0;
+  if (ctx->ring.buf) {
+    ctx->ring.stage = ctx->ring.buf + ctx->ring.buflen;
+  }
+#ifdef ENABLE_QPACK_STATS
+  memset(&ctx->stats, 0, sizeof(ctx->stats));
+#endif /* ENABLE_QPACK_STATS */
+  ctx->bad = 0;
+}
+
+/*
+ * qpack_context_rcbuf_new assigns nghttp3_rcbuf which refers to a
+ * copy of the buffer pointed by |base| of length |len| to |*prcbuf|
+ * for nghttp3_qpack_context_dtable_add.  If |ctx| uses
+ * nghttp3_qpack_ring, nghttp3_qpack_context_dtable_add copies the
+ * buffer by itself, and |rcbuf| is initialized as a borrowed
+ * nghttp3_rcbuf which refers to |base| instead.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int qpack_context_rcbuf_new(nghttp3_qpack_context *ctx,
+                                   nghttp3_rcbuf **prcbuf,
+                                   nghttp3_rcbuf *rcbuf, const uint8_t *base,
+                                   size_t len) {
+  if (ctx->ring.ents) {
+    *prcbuf = qpack_rcbuf_view_init(rcbuf, base, len);
+    return 0;
+  }
+
+  return nghttp3_rcbuf_new2(prcbuf, base, len, ctx->mem);
 }
 
 static int ref_min_cnt_less(const nghttp3_pq_entry *lhsx,
@@ -918,15 +1424,22 @@ int nghttp3_qpack_encoder_init(nghttp3_qpack_encoder *encoder,
   nghttp3_ksl_init(&encoder->blocked_streams, max_cnt_greater,
                    sizeof(nghttp3_blocked_streams_key), mem);
 
-  qpack_map_init(&encoder->dtable_map);
+  qpack_map_init(&encoder->dtable_map, mem);
   nghttp3_pq_init(&encoder->min_cnts, ref_min_cnt_less, mem);
 
+  nghttp3_objalloc_qpack_header_block_ref_init(&encoder->ref_objalloc, 16,
+                                               mem);
+  nghttp3_objalloc_qpack_stream_init(&encoder->stream_objalloc, 16, mem);
+
   encoder->krcnt = 0;
   encoder->state = NGHTTP3_QPACK_DS_STATE_OPCODE;
   encoder->opcode = 0;
   encoder->min_dtable_update = SIZE_MAX;
   encoder->last_max_dtable_update = 0;
+  encoder->freq = NULL;
+  encoder->freq_nincr = 0;
   encoder->flags = NGHTTP3_QPACK_ENCODER_FLAG_NONE;
+  encoder->indexing_policy = NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT;
 
   nghttp3_qpack_read_state_reset(&encoder->rstate);
 
@@ -934,21 +1447,53 @@ int nghttp3_qpack_encoder_init(nghttp3_qpack_encoder *encoder,
 }
 
 static int map_stream_free(void *data, void *ptr) {
-  const nghttp3_mem *mem = ptr;
+  nghttp3_qpack_encoder *encoder = ptr;
   nghttp3_qpack_stream *stream = data;
-  nghttp3_qpack_stream_del(stream, mem);
+  nghttp3_qpack_stream_del(stream, &encoder->stream_objalloc,
+                           &encoder->ref_objalloc);
   return 0;
 }
 
 void nghttp3_qpack_encoder_free(nghttp3_qpack_encoder *encoder) {
   nghttp3_pq_free(&encoder->min_cnts);
   nghttp3_ksl_free(&encoder->blocked_streams);
-  nghttp3_map_each_free(&encoder->streams, map_stream_free,
-                        (void *)encoder->ctx.mem);
+  nghttp3_map_each_free(&encoder->streams, map_stream_free, encoder);
   nghttp3_map_free(&encoder->streams);
+  nghttp3_objalloc_free(&encoder->stream_objalloc);
+  nghttp3_objalloc_free(&encoder->ref_objalloc);
+  qpack_map_free(&encoder->dtable_map);
+  nghttp3_mem_free(encoder->ctx.mem, encoder->freq);
   qpack_context_free(&encoder->ctx);
 }
 
+void nghttp3_qpack_encoder_reset(nghttp3_qpack_encoder *encoder) {
+  qpack_context_reset(&encoder->ctx);
+
+  nghttp3_pq_clear(&encoder->min_cnts);
+  nghttp3_ksl_clear(&encoder->blocked_streams);
+  nghttp3_map_each_free(&encoder->streams, map_stream_free, encoder);
+  nghttp3_map_clear(&encoder->streams);
+  qpack_map_clear(&encoder->dtable_map);
+
+  if (encoder->freq) {
+    memset(encoder->freq, 0,
+           NGHTTP3_QPACK_FREQ_DEPTH * NGHTTP3_QPACK_FREQ_WIDTH);
+  }
+
+  encoder->ctx.max_blocked_streams = 0;
+  encoder->krcnt = 0;
+  encoder->state = NGHTTP3_QPACK_DS_STATE_OPCODE;
+  encoder->opcode = 0;
+  encoder->min_dtable_update = SIZE_MAX;
+  encoder->last_max_dtable_update = 0;
+  encoder->freq_nincr = 0;
+  encoder->flags = NGHTTP3_QPACK_ENCODER_FLAG_NONE;
+  encoder->indexing_policy = NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT;
+
+  nghttp3_qpack_read_state_free(&encoder->rstate);
+  nghttp3_qpack_read_state_reset(&encoder->rstate);
+}
+
 void nghttp3_qpack_encoder_set_max_dtable_capacity(
     nghttp3_qpack_encoder *encoder, size_t max_dtable_capacity) {
   max_dtable_capacity =
@@ -972,6 +1517,15 @@ void nghttp3_qpack_encoder_set_max_blocked_streams(
   encoder->ctx.max_blocked_streams = max_blocked_streams;
 }
 
+void nghttp3_qpack_encoder_set_indexing_policy(nghttp3_qpack_encoder *encoder,
+                                               uint8_t policy) {
+  encoder->indexing_policy = policy;
+}
+
+int nghttp3_qpack_encoder_enable_ring_dtable(nghttp3_qpack_encoder *encoder) {
+  return qpack_context_init_ring(&encoder->ctx);
+}
+
 uint64_t nghttp3_qpack_encoder_get_min_cnt(nghttp3_qpack_encoder *encoder) {
   assert(!nghttp3_pq_empty(&encoder->min_cnts));
 
@@ -982,7 +1536,6 @@ uint64_t nghttp3_qpack_encoder_get_min_cnt(nghttp3_qpack_encoder *encoder) {
 
 void nghttp3_qpack_encoder_shrink_dtable(nghttp3_qpack_encoder *encoder) {
   nghttp3_ringbuf *dtable = &encoder->ctx.dtable;
-  const nghttp3_mem *mem = encoder->ctx.mem;
   uint64_t min_cnt = UINT64_MAX;
   size_t len;
   nghttp3_qpack_entry *ent;
@@ -1008,8 +1561,9 @@ void nghttp3_qpack_encoder_shrink_dtable(nghttp3_qpack_encoder *encoder) {
     nghttp3_ringbuf_pop_back(dtable);
     qpack_map_remove(&encoder->dtable_map, ent);
 
-    nghttp3_qpack_entry_free(ent);
-    nghttp3_mem_free(mem, ent);
+    qpack_context_free_entry(&encoder->ctx, ent);
+
+    NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, evictions, 1);
   }
 }
 
@@ -1031,12 +1585,12 @@ static int qpack_encoder_add_stream_ref(nghttp3_qpack_encoder *encoder,
                                         nghttp3_qpack_stream *stream,
                                         uint64_t max_cnt, uint64_t min_cnt) {
   nghttp3_qpack_header_block_ref *ref;
-  const nghttp3_mem *mem = encoder->ctx.mem;
   uint64_t prev_max_cnt = 0;
   int rv;
 
   if (stream == NULL) {
-    rv = nghttp3_qpack_stream_new(&stream, stream_id, mem);
+    rv = nghttp3_qpack_stream_new(&stream, stream_id,
+                                  &encoder->stream_objalloc);
     if (rv != 0) {
       assert(rv == NGHTTP3_ERR_NOMEM);
       return rv;
@@ -1045,7 +1599,8 @@ static int qpack_encoder_add_stream_ref(nghttp3_qpack_encoder *encoder,
                             (nghttp3_map_key_type)stream->stream_id, stream);
     if (rv != 0) {
       assert(rv == NGHTTP3_ERR_NOMEM);
-      nghttp3_qpack_stream_del(stream, mem);
+      nghttp3_qpack_stream_del(stream, &encoder->stream_objalloc,
+                               &encoder->ref_objalloc);
       return rv;
     }
   } else {
@@ -1056,16 +1611,13 @@ static int qpack_encoder_add_stream_ref(nghttp3_qpack_encoder *encoder,
     }
   }
 
-  rv = nghttp3_qpack_header_block_ref_new(&ref, max_cnt, min_cnt, mem);
+  rv = nghttp3_qpack_header_block_ref_new(&ref, max_cnt, min_cnt,
+                                          &encoder->ref_objalloc);
   if (rv != 0) {
     return rv;
   }
 
-  rv = nghttp3_qpack_stream_add_ref(stream, ref);
-  if (rv != 0) {
-    nghttp3_qpack_header_block_ref_del(ref, mem);
-    return rv;
-  }
+  nghttp3_qpack_stream_add_ref(stream, ref);
 
   if (max_cnt > prev_max_cnt &&
       nghttp3_qpack_encoder_stream_is_blocked(encoder, stream)) {
@@ -1080,17 +1632,12 @@ static int qpack_encoder_add_stream_ref(nghttp3_qpack_encoder *encoder,
 
 static void qpack_encoder_remove_stream(nghttp3_qpack_encoder *encoder,
                                         nghttp3_qpack_stream *stream) {
-  size_t i, len;
   nghttp3_qpack_header_block_ref *ref;
 
   nghttp3_map_remove(&encoder->streams,
                      (nghttp3_map_key_type)stream->stream_id);
 
-  len = nghttp3_ringbuf_len(&stream->refs);
-  for (i = 0; i < len; ++i) {
-    ref = *(nghttp3_qpack_header_block_ref **)nghttp3_ringbuf_get(&stream->refs,
-                                                                  i);
-
+  for (ref = stream->refs_head; ref; ref = ref->next) {
     assert(ref->min_cnts_pe.index != NGHTTP3_PQ_BAD_INDEX);
 
     nghttp3_pq_remove(&encoder->min_cnts, &ref->min_cnts_pe);
@@ -1148,6 +1695,11 @@ int nghttp3_qpack_encoder_encode(nghttp3_qpack_encoder *encoder,
   int allow_blocking;
   int blocked_stream;
   nghttp3_qpack_stream *stream;
+#ifdef ENABLE_QPACK_STATS
+  size_t pbuflen = nghttp3_buf_len(pbuf);
+  size_t rbuflen = nghttp3_buf_len(rbuf);
+  size_t ebuflen = nghttp3_buf_len(ebuf);
+#endif /* ENABLE_QPACK_STATS */
 
   if (encoder->ctx.bad) {
     return NGHTTP3_ERR_QPACK_FATAL;
@@ -1176,11 +1728,23 @@ int nghttp3_qpack_encoder_encode(nghttp3_qpack_encoder *encoder,
     if (rv != 0) {
       goto fail;
     }
+
+    NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, raw_bytes,
+                           nva[i].namelen + nva[i].valuelen);
   }
 
   nghttp3_qpack_encoder_write_field_section_prefix(encoder, pbuf, max_cnt,
                                                    base);
 
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, encoded_bytes,
+                         nghttp3_buf_len(pbuf) - pbuflen +
+                             nghttp3_buf_len(rbuf) - rbuflen);
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, encoder_stream_bytes,
+                         nghttp3_buf_len(ebuf) - ebuflen);
+  if (max_cnt > encoder->krcnt) {
+    NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, blocked_sections, 1);
+  }
+
   /* TODO If max_cnt == 0, no reference is made to dtable. */
   if (!max_cnt) {
     return 0;
@@ -1295,6 +1859,41 @@ static uint32_t qpack_hash_name(const nghttp3_nv *nv) {
   return h;
 }
 
+/*
+ * qpack_hash_nv returns the hash of header field name and value.
+ * |hash| is the hash of nv->name.
+ */
+static uint32_t qpack_hash_nv(uint32_t hash, const nghttp3_nv *nv) {
+  uint32_t h = hash;
+  size_t i;
+
+  for (i = 0; i < nv->valuelen; ++i) {
+    h ^= nv->value[i];
+    h += (h << 1) + (h << 4) + (h << 7) + (h << 8) + (h << 24);
+  }
+
+  return h;
+}
+
+/*
+ * qpack_nv_never_index returns nonzero if header field |nv| must not
+ * be indexed.  |token| is a token of header field name.
+ */
+static int qpack_nv_never_index(const nghttp3_nv *nv, int32_t token) {
+  if (nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) {
+    return 1;
+  }
+
+  switch (token) {
+  case NGHTTP3_QPACK_TOKEN_AUTHORIZATION:
+    return 1;
+  case NGHTTP3_QPACK_TOKEN_COOKIE:
+    return nv->valuelen < 20;
+  default:
+    return 0;
+  }
+}
+
 /*
  * qpack_encoder_decide_indexing_mode determines and returns indexing
  * mode for header field |nv|.  |token| is a token of header field
@@ -1303,18 +1902,16 @@ static uint32_t qpack_hash_name(const nghttp3_nv *nv) {
 static nghttp3_qpack_indexing_mode
 qpack_encoder_decide_indexing_mode(nghttp3_qpack_encoder *encoder,
                                    const nghttp3_nv *nv, int32_t token) {
-  if (nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) {
+  if (qpack_nv_never_index(nv, token)) {
     return NGHTTP3_QPACK_INDEXING_MODE_NEVER;
   }
 
+  if (encoder->indexing_policy == NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY) {
+    /* The decision is refined by qpack_encoder_admit_nv. */
+    goto fin;
+  }
+
   switch (token) {
-  case NGHTTP3_QPACK_TOKEN_AUTHORIZATION:
-    return NGHTTP3_QPACK_INDEXING_MODE_NEVER;
-  case NGHTTP3_QPACK_TOKEN_COOKIE:
-    if (nv->valuelen < 20) {
-      return NGHTTP3_QPACK_INDEXING_MODE_NEVER;
-    }
-    break;
   case -1:
   case NGHTTP3_QPACK_TOKEN__PATH:
   case NGHTTP3_QPACK_TOKEN_AGE:
@@ -1344,6 +1941,7 @@ qpack_encoder_decide_indexing_mode(nghttp3_qpack_encoder *encoder,
     }
   }
 
+fin:
   if (table_space(nv->namelen, nv->valuelen) >
       encoder->ctx.max_dtable_capacity * 3 / 4) {
     return NGHTTP3_QPACK_INDEXING_MODE_LITERAL;
@@ -1352,6 +1950,102 @@ qpack_encoder_decide_indexing_mode(nghttp3_qpack_encoder *encoder,
   return NGHTTP3_QPACK_INDEXING_MODE_STORE;
 }
 
+/* qpack_freq_seeds are the multipliers to derive the column of each
+   row of count-min sketch from a hash. */
+static const uint32_t qpack_freq_seeds[NGHTTP3_QPACK_FREQ_DEPTH] = {
+    0x9e3779b1u,
+    0x85ebca77u,
+    0xc2b2ae3du,
+    0x27d4eb2fu,
+};
+
+/*
+ * qpack_encoder_freq_incr increments the count of header field whose
+ * hash of name and value is |nvhash| in encoder->freq, and returns
+ * the estimated count after the increment.  Only the smallest
+ * counters are incremented (conservative update) to reduce the
+ * overestimation caused by hash collisions.
+ */
+static size_t qpack_encoder_freq_incr(nghttp3_qpack_encoder *encoder,
+                                      uint32_t nvhash) {
+  uint8_t *counters[NGHTTP3_QPACK_FREQ_DEPTH];
+  uint8_t min = UINT8_MAX;
+  size_t i;
+
+  for (i = 0; i < NGHTTP3_QPACK_FREQ_DEPTH; ++i) {
+    counters[i] = encoder->freq + i * NGHTTP3_QPACK_FREQ_WIDTH +
+                  ((nvhash * qpack_freq_seeds[i]) >>
+                   (32 - NGHTTP3_QPACK_FREQ_WIDTHBITS));
+    min = nghttp3_min(min, *counters[i]);
+  }
+
+  if (min == UINT8_MAX) {
+    return min;
+  }
+
+  for (i = 0; i < NGHTTP3_QPACK_FREQ_DEPTH; ++i) {
+    if (*counters[i] == min) {
+      ++*counters[i];
+    }
+  }
+
+  if (++encoder->freq_nincr == NGHTTP3_QPACK_FREQ_AGING_PERIOD) {
+    for (i = 0; i < NGHTTP3_QPACK_FREQ_DEPTH * NGHTTP3_QPACK_FREQ_WIDTH; ++i) {
+      encoder->freq[i] >>= 1;
+    }
+
+    encoder->freq_nincr = NGHTTP3_QPACK_FREQ_AGING_PERIOD / 2;
+
+    return (size_t)(min + 1) / 2;
+  }
+
+  return (size_t)min + 1;
+}
+
+/*
+ * qpack_encoder_admit_nv decides whether header field |nv|, which
+ * qpack_encoder_decide_indexing_mode chose to store under
+ * NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY, is actually inserted into
+ * dynamic table.  |nvhash| is the hash of name and value of |nv|.
+ * The field is stored if it has been seen at least twice, and larger
+ * fields which evict more entries need more repetitions.  It assigns
+ * the decision to |*pindexing_mode|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int
+qpack_encoder_admit_nv(nghttp3_qpack_encoder *encoder,
+                       nghttp3_qpack_indexing_mode *pindexing_mode,
+                       const nghttp3_nv *nv, uint32_t nvhash) {
+  size_t space, need;
+
+  if (nv->flags & NGHTTP3_NV_FLAG_TRY_INDEX) {
+    return 0;
+  }
+
+  if (encoder->freq == NULL) {
+    encoder->freq =
+        nghttp3_mem_calloc(encoder->ctx.mem, NGHTTP3_QPACK_FREQ_DEPTH,
+                           NGHTTP3_QPACK_FREQ_WIDTH);
+    if (encoder->freq == NULL) {
+      return NGHTTP3_ERR_NOMEM;
+    }
+  }
+
+  space = table_space(nv->namelen, nv->valuelen);
+  need = 2 + space * 8 / encoder->ctx.max_dtable_capacity;
+
+  if (qpack_encoder_freq_incr(encoder, nvhash) < need) {
+    *pindexing_mode = NGHTTP3_QPACK_INDEXING_MODE_LITERAL;
+  }
+
+  return 0;
+}
+
 /*
  * qpack_encoder_can_index returns nonzero if an entry which occupies
  * |need| bytes can be inserted into dynamic table.  |min_cnt| is the
@@ -1439,7 +2133,7 @@ int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
                                     nghttp3_buf *rbuf, nghttp3_buf *ebuf,
                                     const nghttp3_nv *nv, uint64_t base,
                                     int allow_blocking) {
-  uint32_t hash = 0;
+  uint32_t hash = 0, nvhash = 0;
   int32_t token;
   nghttp3_qpack_indexing_mode indexing_mode;
   nghttp3_qpack_lookup_result sres = {-1, 0, -1}, dres = {-1, 0, -1};
@@ -1483,9 +2177,22 @@ int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
   }
 
   if (nghttp3_map_size(&encoder->streams) < NGHTTP3_QPACK_MAX_QPACK_STREAMS) {
-    dres = nghttp3_qpack_encoder_lookup_dtable(encoder, nv, token, hash,
-                                               indexing_mode, encoder->krcnt,
-                                               allow_blocking);
+    if (indexing_mode != NGHTTP3_QPACK_INDEXING_MODE_NEVER) {
+      nvhash = qpack_hash_nv(hash, nv);
+
+      if (indexing_mode == NGHTTP3_QPACK_INDEXING_MODE_STORE &&
+          encoder->indexing_policy ==
+              NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY) {
+        rv = qpack_encoder_admit_nv(encoder, &indexing_mode, nv, nvhash);
+        if (rv != 0) {
+          return rv;
+        }
+      }
+    }
+
+    dres = nghttp3_qpack_encoder_lookup_dtable(
+        encoder, nv, token, hash, nvhash, indexing_mode, encoder->krcnt,
+        allow_blocking);
     just_index = indexing_mode == NGHTTP3_QPACK_INDEXING_MODE_STORE &&
                  dres.pb_index == -1;
   }
@@ -1524,7 +2231,7 @@ int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
         return rv;
       }
       rv = nghttp3_qpack_encoder_dtable_static_add(encoder, (size_t)sres.index,
-                                                   nv, hash);
+                                                   nv, hash, nvhash);
       if (rv != 0) {
         return rv;
       }
@@ -1559,7 +2266,7 @@ int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
       }
 
       rv = nghttp3_qpack_encoder_dtable_dynamic_add(encoder, (size_t)dres.index,
-                                                    nv, hash);
+                                                    nv, hash, nvhash);
       if (rv != 0) {
         return rv;
       }
@@ -1582,7 +2289,8 @@ int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
   }
 
   if (just_index && qpack_encoder_can_index_nv(encoder, nv, *pmin_cnt)) {
-    rv = nghttp3_qpack_encoder_dtable_literal_add(encoder, nv, token, hash);
+    rv = nghttp3_qpack_encoder_dtable_literal_add(encoder, nv, token, hash,
+                                                  nvhash);
     if (rv != 0) {
       return rv;
     }
@@ -1635,14 +2343,14 @@ nghttp3_qpack_lookup_stable(const nghttp3_nv *nv, int32_t token,
 
 nghttp3_qpack_lookup_result nghttp3_qpack_encoder_lookup_dtable(
     nghttp3_qpack_encoder *encoder, const nghttp3_nv *nv, int32_t token,
-    uint32_t hash, nghttp3_qpack_indexing_mode indexing_mode, uint64_t krcnt,
-    int allow_blocking) {
+    uint32_t hash, uint32_t nvhash, nghttp3_qpack_indexing_mode indexing_mode,
+    uint64_t krcnt, int allow_blocking) {
   nghttp3_qpack_lookup_result res = {-1, 0, -1};
   int exact_match = 0;
   nghttp3_qpack_entry *match, *pb_match;
 
   encoder_qpack_map_find(encoder, &exact_match, &match, &pb_match, nv, token,
-                         hash, krcnt, allow_blocking,
+                         hash, nvhash, krcnt, allow_blocking,
                          indexing_mode == NGHTTP3_QPACK_INDEXING_MODE_NEVER);
   if (match) {
     res.index = (nghttp3_ssize)match->absidx;
@@ -1655,18 +2363,21 @@ nghttp3_qpack_lookup_result nghttp3_qpack_encoder_lookup_dtable(
   return res;
 }
 
+nghttp3_objalloc_def(qpack_header_block_ref, nghttp3_qpack_header_block_ref,
+                     oplent);
+
 int nghttp3_qpack_header_block_ref_new(nghttp3_qpack_header_block_ref **pref,
                                        uint64_t max_cnt, uint64_t min_cnt,
-                                       const nghttp3_mem *mem) {
+                                       nghttp3_objalloc *objalloc) {
   nghttp3_qpack_header_block_ref *ref =
-      nghttp3_mem_malloc(mem, sizeof(nghttp3_qpack_header_block_ref));
+      nghttp3_objalloc_qpack_header_block_ref_get(objalloc);
 
   if (ref == NULL) {
     return NGHTTP3_ERR_NOMEM;
   }
 
-  ref->max_cnts_pe.index = NGHTTP3_PQ_BAD_INDEX;
   ref->min_cnts_pe.index = NGHTTP3_PQ_BAD_INDEX;
+  ref->next = NULL;
   ref->max_cnt = max_cnt;
   ref->min_cnt = min_cnt;
 
@@ -1676,40 +2387,25 @@ int nghttp3_qpack_header_block_ref_new(nghttp3_qpack_header_block_ref **pref,
 }
 
 void nghttp3_qpack_header_block_ref_del(nghttp3_qpack_header_block_ref *ref,
-                                        const nghttp3_mem *mem) {
-  nghttp3_mem_free(mem, ref);
+                                        nghttp3_objalloc *objalloc) {
+  nghttp3_objalloc_qpack_header_block_ref_release(objalloc, ref);
 }
 
-static int ref_max_cnt_greater(const nghttp3_pq_entry *lhsx,
-                               const nghttp3_pq_entry *rhsx) {
-  const nghttp3_qpack_header_block_ref *lhs =
-      nghttp3_struct_of(lhsx, nghttp3_qpack_header_block_ref, max_cnts_pe);
-  const nghttp3_qpack_header_block_ref *rhs =
-      nghttp3_struct_of(rhsx, nghttp3_qpack_header_block_ref, max_cnts_pe);
-
-  return lhs->max_cnt > rhs->max_cnt;
-}
+nghttp3_objalloc_def(qpack_stream, nghttp3_qpack_stream, oplent);
 
 int nghttp3_qpack_stream_new(nghttp3_qpack_stream **pstream, int64_t stream_id,
-                             const nghttp3_mem *mem) {
-  int rv;
+                             nghttp3_objalloc *objalloc) {
   nghttp3_qpack_stream *stream;
 
-  stream = nghttp3_mem_malloc(mem, sizeof(nghttp3_qpack_stream));
+  stream = nghttp3_objalloc_qpack_stream_get(objalloc);
   if (stream == NULL) {
     return NGHTTP3_ERR_NOMEM;
   }
 
-  rv = nghttp3_ringbuf_init(&stream->refs, 4,
-                            sizeof(nghttp3_qpack_header_block_ref *), mem);
-  if (rv != 0) {
-    nghttp3_mem_free(mem, stream);
-    return rv;
-  }
-
-  nghttp3_pq_init(&stream->max_cnts, ref_max_cnt_greater, mem);
-
   stream->stream_id = stream_id;
+  stream->refs_head = NULL;
+  stream->refs_tail = NULL;
+  stream->max_cnt = 0;
 
   *pstream = stream;
 
@@ -1717,72 +2413,63 @@ int nghttp3_qpack_stream_new(nghttp3_qpack_stream **pstream, int64_t stream_id,
 }
 
 void nghttp3_qpack_stream_del(nghttp3_qpack_stream *stream,
-                              const nghttp3_mem *mem) {
-  nghttp3_qpack_header_block_ref *ref;
-  size_t i, len;
+                              nghttp3_objalloc *objalloc,
+                              nghttp3_objalloc *ref_objalloc) {
+  nghttp3_qpack_header_block_ref *ref, *next;
 
   if (stream == NULL) {
     return;
   }
 
-  nghttp3_pq_free(&stream->max_cnts);
-
-  len = nghttp3_ringbuf_len(&stream->refs);
-  for (i = 0; i < len; ++i) {
-    ref = *(nghttp3_qpack_header_block_ref **)nghttp3_ringbuf_get(&stream->refs,
-                                                                  i);
-    nghttp3_qpack_header_block_ref_del(ref, mem);
+  for (ref = stream->refs_head; ref; ref = next) {
+    next = ref->next;
+    nghttp3_qpack_header_block_ref_del(ref, ref_objalloc);
   }
 
-  nghttp3_ringbuf_free(&stream->refs);
-
-  nghttp3_mem_free(mem, stream);
+  nghttp3_objalloc_qpack_stream_release(objalloc, stream);
 }
 
 uint64_t nghttp3_qpack_stream_get_max_cnt(const nghttp3_qpack_stream *stream) {
-  nghttp3_qpack_header_block_ref *ref;
-
-  if (nghttp3_pq_empty(&stream->max_cnts)) {
-    return 0;
-  }
-
-  ref = nghttp3_struct_of(nghttp3_pq_top(&stream->max_cnts),
-                          nghttp3_qpack_header_block_ref, max_cnts_pe);
-  return ref->max_cnt;
+  return stream->max_cnt;
 }
 
-int nghttp3_qpack_stream_add_ref(nghttp3_qpack_stream *stream,
-                                 nghttp3_qpack_header_block_ref *ref) {
-  nghttp3_qpack_header_block_ref **dest;
-  int rv;
-
-  if (nghttp3_ringbuf_full(&stream->refs)) {
-    rv = nghttp3_ringbuf_reserve(&stream->refs,
-                                 nghttp3_ringbuf_len(&stream->refs) * 2);
-    if (rv != 0) {
-      return rv;
-    }
+void nghttp3_qpack_stream_add_ref(nghttp3_qpack_stream *stream,
+                                  nghttp3_qpack_header_block_ref *ref) {
+  if (stream->refs_tail) {
+    stream->refs_tail->next = ref;
+  } else {
+    stream->refs_head = ref;
   }
 
-  dest = nghttp3_ringbuf_push_back(&stream->refs);
-  *dest = ref;
-
-  return nghttp3_pq_push(&stream->max_cnts, &ref->max_cnts_pe);
+  stream->refs_tail = ref;
+  stream->max_cnt = nghttp3_max(stream->max_cnt, ref->max_cnt);
 }
 
 void nghttp3_qpack_stream_pop_ref(nghttp3_qpack_stream *stream) {
-  nghttp3_qpack_header_block_ref *ref;
+  nghttp3_qpack_header_block_ref *ref = stream->refs_head;
+
+  assert(ref);
 
-  assert(nghttp3_ringbuf_len(&stream->refs));
+  stream->refs_head = ref->next;
 
-  ref =
-      *(nghttp3_qpack_header_block_ref **)nghttp3_ringbuf_get(&stream->refs, 0);
+  if (stream->refs_head == NULL) {
+    stream->refs_tail = NULL;
+    stream->max_cnt = 0;
 
-  assert(ref->max_cnts_pe.index != NGHTTP3_PQ_BAD_INDEX);
+    return;
+  }
+
+  if (ref->max_cnt < stream->max_cnt) {
+    return;
+  }
 
-  nghttp3_pq_remove(&stream->max_cnts, &ref->max_cnts_pe);
+  /* The number of header blocks per stream is small, and scanning
+     them is cheaper than maintaining a priority queue. */
+  stream->max_cnt = 0;
 
-  nghttp3_ringbuf_pop_front(&stream->refs);
+  for (ref = stream->refs_head; ref; ref = ref->next) {
+    stream->max_cnt = nghttp3_max(stream->max_cnt, ref->max_cnt);
+  }
 }
 
 int nghttp3_qpack_encoder_write_static_indexed(nghttp3_qpack_encoder *encoder,
@@ -1790,6 +2477,9 @@ int nghttp3_qpack_encoder_write_static_indexed(nghttp3_qpack_encoder *encoder,
                                                uint64_t absidx) {
   DEBUGF("qpack::encode: Indexed Field Line (static) absidx=%" PRIu64 "\n",
          absidx);
+
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, static_indexed, 1);
+
   return qpack_write_number(rbuf, 0xc0, absidx, 6, encoder->ctx.mem);
 }
 
@@ -1801,6 +2491,8 @@ int nghttp3_qpack_encoder_write_dynamic_indexed(nghttp3_qpack_encoder *encoder,
          " base=%" PRIu64 "\n",
          absidx, base);
 
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, dynamic_indexed, 1);
+
   if (absidx < base) {
     return qpack_write_number(rbuf, 0x80, base - absidx - 1, 6,
                               encoder->ctx.mem);
@@ -1809,6 +2501,54 @@ int nghttp3_qpack_encoder_write_dynamic_indexed(nghttp3_qpack_encoder *encoder,
   return qpack_write_number(rbuf, 0x10, absidx - base, 4, encoder->ctx.mem);
 }
 
+/*
+ * qpack_put_string writes string literal |str| of length |len| to
+ * |p|.  |prefix| is a prefix of variable integer encoding for the
+ * string length, and the bit just above the prefix is Huffman flag.
+ * The other bits in the first byte must be set by caller.  |str| is
+ * Huffman encoded if it makes the string shorter.  If |early_abort|
+ * is nonzero, Huffman encoding is given up as soon as it looks
+ * unlikely to make the string shorter.  The buffer pointed by |p|
+ * must have at least nghttp3_qpack_put_varint_len(len, prefix) + len
+ * bytes.
+ *
+ * This function returns the pointer to the one beyond the last byte
+ * written.
+ */
+static uint8_t *qpack_put_string(uint8_t *p, const uint8_t *str, size_t len,
+                                 size_t prefix, int early_abort) {
+  size_t hdlen = nghttp3_qpack_put_varint_len(len, prefix);
+  size_t hlen, hhdlen;
+  uint8_t *end;
+
+  if (len > 1) {
+    /* Encode in place assuming the longest length prefix, and move
+       the result if the length prefix gets shorter. */
+    end = nghttp3_qpack_huffman_encode_bounded(p + hdlen, len - 1, str, len,
+                                               early_abort);
+    if (end) {
+      hlen = (size_t)(end - (p + hdlen));
+      hhdlen = nghttp3_qpack_put_varint_len(hlen, prefix);
+      if (hhdlen < hdlen) {
+        memmove(p + hhdlen, p + hdlen, hlen);
+      }
+
+      *p = (uint8_t)(*p | (1 << prefix));
+      p = nghttp3_qpack_put_varint(p, hlen, prefix);
+
+      return p + hlen;
+    }
+  }
+
+  *p = (uint8_t)(*p & ~(1 << prefix));
+  p = nghttp3_qpack_put_varint(p, len, prefix);
+  if (len) {
+    p = nghttp3_cpymem(p, str, len);
+  }
+
+  return p;
+}
+
 /*
  * qpack_encoder_write_indexed_name writes generic indexed name.  |fb|
  * is the first byte.  |nameidx| is an index of referenced name.
@@ -1826,18 +2566,9 @@ static int qpack_encoder_write_indexed_name(nghttp3_qpack_encoder *encoder,
                                             uint64_t nameidx, size_t prefix,
                                             const nghttp3_nv *nv) {
   int rv;
-  size_t len = nghttp3_qpack_put_varint_len(nameidx, prefix);
+  size_t len = nghttp3_qpack_put_varint_len(nameidx, prefix) +
+               nghttp3_qpack_put_varint_len(nv->valuelen, 7) + nv->valuelen;
   uint8_t *p;
-  size_t hlen;
-  int h = 0;
-
-  hlen = nghttp3_qpack_huffman_encode_count(nv->value, nv->valuelen);
-  if (hlen < nv->valuelen) {
-    h = 1;
-    len += nghttp3_qpack_put_varint_len(hlen, 7) + hlen;
-  } else {
-    len += nghttp3_qpack_put_varint_len(nv->valuelen, 7) + nv->valuelen;
-  }
 
   rv = reserve_buf(buf, len, encoder->ctx.mem);
   if (rv != 0) {
@@ -1849,19 +2580,13 @@ static int qpack_encoder_write_indexed_name(nghttp3_qpack_encoder *encoder,
   *p = fb;
   p = nghttp3_qpack_put_varint(p, nameidx, prefix);
 
-  if (h) {
-    *p = 0x80;
-    p = nghttp3_qpack_put_varint(p, hlen, 7);
-    p = nghttp3_qpack_huffman_encode(p, nv->value, nv->valuelen);
-  } else {
-    *p = 0;
-    p = nghttp3_qpack_put_varint(p, nv->valuelen, 7);
-    if (nv->valuelen) {
-      p = nghttp3_cpymem(p, nv->value, nv->valuelen);
-    }
-  }
+  *p = 0;
+  p = qpack_put_string(p, nv->value, nv->valuelen, 7, 1);
+
+  assert((size_t)(p - buf->last) <= len);
 
-  assert((size_t)(p - buf->last) == len);
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, huffman_saved,
+                         (int64_t)(len - (size_t)(p - buf->last)));
 
   buf->last = p;
 
@@ -1877,6 +2602,9 @@ int nghttp3_qpack_encoder_write_static_indexed_name(
   DEBUGF("qpack::encode: Literal Field Line With Name Reference (static) "
          "absidx=%" PRIu64 " never=%d\n",
          absidx, (nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) != 0);
+
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, static_name, 1);
+
   return qpack_encoder_write_indexed_name(encoder, rbuf, fb, absidx, 4, nv);
 }
 
@@ -1889,6 +2617,8 @@ int nghttp3_qpack_encoder_write_dynamic_indexed_name(
          "absidx=%" PRIu64 " base=%" PRIu64 " never=%d\n",
          absidx, base, (nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) != 0);
 
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, dynamic_name, 1);
+
   if (absidx < base) {
     fb = (uint8_t)(0x40 |
                    ((nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) ? 0x20 : 0));
@@ -1917,26 +2647,10 @@ static int qpack_encoder_write_literal(nghttp3_qpack_encoder *encoder,
                                        nghttp3_buf *buf, uint8_t fb,
                                        size_t prefix, const nghttp3_nv *nv) {
   int rv;
-  size_t len;
+  size_t len = nghttp3_qpack_put_varint_len(nv->namelen, prefix) +
+               nv->namelen + nghttp3_qpack_put_varint_len(nv->valuelen, 7) +
+               nv->valuelen;
   uint8_t *p;
-  size_t nhlen, vhlen;
-  int nh = 0, vh = 0;
-
-  nhlen = nghttp3_qpack_huffman_encode_count(nv->name, nv->namelen);
-  if (nhlen < nv->namelen) {
-    nh = 1;
-    len = nghttp3_qpack_put_varint_len(nhlen, prefix) + nhlen;
-  } else {
-    len = nghttp3_qpack_put_varint_len(nv->namelen, prefix) + nv->namelen;
-  }
-
-  vhlen = nghttp3_qpack_huffman_encode_count(nv->value, nv->valuelen);
-  if (vhlen < nv->valuelen) {
-    vh = 1;
-    len += nghttp3_qpack_put_varint_len(vhlen, 7) + vhlen;
-  } else {
-    len += nghttp3_qpack_put_varint_len(nv->valuelen, 7) + nv->valuelen;
-  }
 
   rv = reserve_buf(buf, len, encoder->ctx.mem);
   if (rv != 0) {
@@ -1946,31 +2660,15 @@ static int qpack_encoder_write_literal(nghttp3_qpack_encoder *encoder,
   p = buf->last;
 
   *p = fb;
-  if (nh) {
-    *p |= (uint8_t)(1 << prefix);
-    p = nghttp3_qpack_put_varint(p, nhlen, prefix);
-    p = nghttp3_qpack_huffman_encode(p, nv->name, nv->namelen);
-  } else {
-    p = nghttp3_qpack_put_varint(p, nv->namelen, prefix);
-    if (nv->namelen) {
-      p = nghttp3_cpymem(p, nv->name, nv->namelen);
-    }
-  }
+  p = qpack_put_string(p, nv->name, nv->namelen, prefix, 0);
 
   *p = 0;
+  p = qpack_put_string(p, nv->value, nv->valuelen, 7, 1);
 
-  if (vh) {
-    *p |= 0x80;
-    p = nghttp3_qpack_put_varint(p, vhlen, 7);
-    p = nghttp3_qpack_huffman_encode(p, nv->value, nv->valuelen);
-  } else {
-    p = nghttp3_qpack_put_varint(p, nv->valuelen, 7);
-    if (nv->valuelen) {
-      p = nghttp3_cpymem(p, nv->value, nv->valuelen);
-    }
-  }
+  assert((size_t)(p - buf->last) <= len);
 
-  assert((size_t)(p - buf->last) == len);
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, huffman_saved,
+                         (int64_t)(len - (size_t)(p - buf->last)));
 
   buf->last = p;
 
@@ -1984,6 +2682,9 @@ int nghttp3_qpack_encoder_write_literal(nghttp3_qpack_encoder *encoder,
       (uint8_t)(0x20 | ((nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) ? 0x10 : 0));
 
   DEBUGF("qpack::encode: Literal Field Line With Literal Name\n");
+
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, literal, 1);
+
   return qpack_encoder_write_literal(encoder, rbuf, fb, 3, nv);
 }
 
@@ -2016,38 +2717,150 @@ int nghttp3_qpack_encoder_write_duplicate_insert(nghttp3_qpack_encoder *encoder,
   uint8_t *p;
   int rv;
 
-  DEBUGF("qpack::encode: Insert duplicate absidx=%" PRIu64 "\n", absidx);
+  DEBUGF("qpack::encode: Insert duplicate absidx=%" PRIu64 "\n", absidx);
+
+  rv = reserve_buf(ebuf, len, encoder->ctx.mem);
+  if (rv != 0) {
+    return rv;
+  }
+
+  p = ebuf->last;
+
+  *p = 0;
+  p = nghttp3_qpack_put_varint(p, idx, 5);
+
+  assert((size_t)(p - ebuf->last) == len);
+
+  ebuf->last = p;
+
+  return 0;
+}
+
+int nghttp3_qpack_encoder_write_literal_insert(nghttp3_qpack_encoder *encoder,
+                                               nghttp3_buf *ebuf,
+                                               const nghttp3_nv *nv) {
+  DEBUGF("qpack::encode: Insert With Literal Name\n");
+  return qpack_encoder_write_literal(encoder, ebuf, 0x40, 5, nv);
+}
+
+/*
+ * qpack_ring_contains returns nonzero if |p| points to the buffer of
+ * |ring|.
+ */
+static int qpack_ring_contains(const nghttp3_qpack_ring *ring,
+                               const uint8_t *p) {
+  return ring->buf <= p && p < ring->buf + ring->buflen;
+}
+
+/*
+ * qpack_ring_alloc returns the offset in ring->buf where |len| bytes
+ * of the new entry are written.  |ctx| must have enough room for the
+ * new entry in dynamic table.
+ */
+static size_t qpack_ring_alloc(nghttp3_qpack_context *ctx, size_t len) {
+  nghttp3_qpack_ring *ring = &ctx->ring;
+  nghttp3_qpack_ring_entry *rent;
+  size_t n = nghttp3_ringbuf_len(&ctx->dtable);
+  size_t tail;
+
+  if (n == 0) {
+    return 0;
+  }
+
+  /* tail is the offset of the oldest entry. */
+  rent = nghttp3_struct_of(
+      *(nghttp3_qpack_entry **)nghttp3_ringbuf_get(&ctx->dtable, n - 1),
+      nghttp3_qpack_ring_entry, ent);
+  tail = rent->offset;
+
+  /* The entries occupy at most hard_max_dtable_capacity bytes, which
+     is a half of ring->buf.  Thus either side of the live region has
+     enough room. */
+  if (ring->head >= tail) {
+    if (ring->head + len <= ring->buflen) {
+      return ring->head;
+    }
+
+    assert(len <= tail);
+
+    return 0;
+  }
+
+  assert(ring->head + len <= tail);
+
+  return ring->head;
+}
+
+/*
+ * qpack_context_ring_add is nghttp3_qpack_context_dtable_add for
+ * |ctx| which uses nghttp3_qpack_ring.  Eviction must have been done
+ * before calling this function.  |name| and |value| are the buffers
+ * which are copied into dynamic table.  They must not be overwritten
+ * by the new entry.
+ */
+static int qpack_context_ring_add(nghttp3_qpack_context *ctx,
+                                  nghttp3_qpack_nv *qnv,
+                                  nghttp3_qpack_map *dtable_map,
+                                  uint32_t hash, uint32_t nvhash,
+                                  const uint8_t *name, const uint8_t *value) {
+  nghttp3_qpack_ring *ring = &ctx->ring;
+  nghttp3_qpack_ring_entry *rent;
+  nghttp3_qpack_nv nv;
+  nghttp3_qpack_entry **p;
+  size_t namelen = name ? qnv->name->len : 0;
+  size_t offset;
+  uint8_t *dest;
+  int rv;
+
+  offset = qpack_ring_alloc(ctx, namelen + qnv->value->len);
+  dest = ring->buf + offset;
 
-  rv = reserve_buf(ebuf, len, encoder->ctx.mem);
-  if (rv != 0) {
-    return rv;
+  rent = &ring->ents[ctx->next_absidx & (ring->entslen - 1)];
+  rent->offset = offset;
+
+  nv = *qnv;
+
+  if (name) {
+    nv.name = qpack_rcbuf_view_init(&rent->name, dest, namelen);
+    if (namelen) {
+      dest = nghttp3_cpymem(dest, name, namelen);
+    }
   }
 
-  p = ebuf->last;
+  nv.value = qpack_rcbuf_view_init(&rent->value, dest, qnv->value->len);
+  if (qnv->value->len) {
+    dest = nghttp3_cpymem(dest, value, qnv->value->len);
+  }
 
-  *p = 0;
-  p = nghttp3_qpack_put_varint(p, idx, 5);
+  nghttp3_qpack_entry_init(&rent->ent, &nv, ctx->dtable_sum,
+                           ctx->next_absidx, hash, nvhash);
 
-  assert((size_t)(p - ebuf->last) == len);
+  if (dtable_map) {
+    rv = qpack_map_insert(dtable_map, &rent->ent);
+    if (rv != 0) {
+      return rv;
+    }
+  }
 
-  ebuf->last = p;
+  ++ctx->next_absidx;
 
-  return 0;
-}
+  assert(!nghttp3_ringbuf_full(&ctx->dtable));
 
-int nghttp3_qpack_encoder_write_literal_insert(nghttp3_qpack_encoder *encoder,
-                                               nghttp3_buf *ebuf,
-                                               const nghttp3_nv *nv) {
-  DEBUGF("qpack::encode: Insert With Literal Name\n");
-  return qpack_encoder_write_literal(encoder, ebuf, 0x40, 5, nv);
+  p = nghttp3_ringbuf_push_front(&ctx->dtable);
+  *p = &rent->ent;
+
+  ring->head = (size_t)(dest - ring->buf);
+
+  return 0;
 }
 
 int nghttp3_qpack_context_dtable_add(nghttp3_qpack_context *ctx,
                                      nghttp3_qpack_nv *qnv,
                                      nghttp3_qpack_map *dtable_map,
-                                     uint32_t hash) {
+                                     uint32_t hash, uint32_t nvhash) {
   nghttp3_qpack_entry *new_ent, **p, *ent;
   const nghttp3_mem *mem = ctx->mem;
+  const uint8_t *name = NULL, *value = NULL;
   size_t space;
   size_t i;
   int rv;
@@ -2056,6 +2869,27 @@ int nghttp3_qpack_context_dtable_add(nghttp3_qpack_context *ctx,
 
   assert(space <= ctx->max_dtable_capacity);
 
+  if (ctx->ring.ents) {
+    /* The name from static table is not copied. */
+    if (qnv->name->ref != NGHTTP3_RCBUF_REF_STATIC) {
+      name = qnv->name->base;
+    }
+    value = qnv->value->base;
+
+    /* The name or value of the existing entry might be overwritten
+       by eviction and the new entry. */
+    if ((name && qpack_ring_contains(&ctx->ring, name)) ||
+        qpack_ring_contains(&ctx->ring, value)) {
+      if (name) {
+        memcpy(ctx->ring.stage, name, qnv->name->len);
+        name = ctx->ring.stage;
+      }
+
+      memcpy(ctx->ring.stage + qnv->name->len, value, qnv->value->len);
+      value = ctx->ring.stage + qnv->name->len;
+    }
+  }
+
   while (ctx->dtable_size + space > ctx->max_dtable_capacity) {
     i = nghttp3_ringbuf_len(&ctx->dtable);
     assert(i);
@@ -2068,8 +2902,24 @@ int nghttp3_qpack_context_dtable_add(nghttp3_qpack_context *ctx,
       qpack_map_remove(dtable_map, ent);
     }
 
-    nghttp3_qpack_entry_free(ent);
-    nghttp3_mem_free(mem, ent);
+    qpack_context_free_entry(ctx, ent);
+
+    NGHTTP3_QPACK_STAT_ADD(ctx, evictions, 1);
+  }
+
+  NGHTTP3_QPACK_STAT_ADD(ctx, inserts, 1);
+
+  if (ctx->ring.ents) {
+    rv = qpack_context_ring_add(ctx, qnv, dtable_map, hash, nvhash, name,
+                                value);
+    if (rv != 0) {
+      return rv;
+    }
+
+    ctx->dtable_size += space;
+    ctx->dtable_sum += space;
+
+    return 0;
   }
 
   new_ent = nghttp3_mem_malloc(mem, sizeof(nghttp3_qpack_entry));
@@ -2078,7 +2928,7 @@ int nghttp3_qpack_context_dtable_add(nghttp3_qpack_context *ctx,
   }
 
   nghttp3_qpack_entry_init(new_ent, qnv, ctx->dtable_sum, ctx->next_absidx++,
-                           hash);
+                           hash, nvhash);
 
   if (nghttp3_ringbuf_full(&ctx->dtable)) {
     rv = nghttp3_ringbuf_reserve(&ctx->dtable,
@@ -2088,13 +2938,16 @@ int nghttp3_qpack_context_dtable_add(nghttp3_qpack_context *ctx,
     }
   }
 
-  p = nghttp3_ringbuf_push_front(&ctx->dtable);
-  *p = new_ent;
-
   if (dtable_map) {
-    qpack_map_insert(dtable_map, new_ent);
+    rv = qpack_map_insert(dtable_map, new_ent);
+    if (rv != 0) {
+      goto fail;
+    }
   }
 
+  p = nghttp3_ringbuf_push_front(&ctx->dtable);
+  *p = new_ent;
+
   ctx->dtable_size += space;
   ctx->dtable_sum += space;
 
@@ -2110,13 +2963,14 @@ fail:
 int nghttp3_qpack_encoder_dtable_static_add(nghttp3_qpack_encoder *encoder,
                                             uint64_t absidx,
                                             const nghttp3_nv *nv,
-                                            uint32_t hash) {
+                                            uint32_t hash, uint32_t nvhash) {
   const nghttp3_qpack_static_header *shd;
   nghttp3_qpack_nv qnv;
-  const nghttp3_mem *mem = encoder->ctx.mem;
+  nghttp3_rcbuf value;
   int rv;
 
-  rv = nghttp3_rcbuf_new2(&qnv.value, nv->value, nv->valuelen, mem);
+  rv = qpack_context_rcbuf_new(&encoder->ctx, &qnv.value, &value, nv->value,
+                               nv->valuelen);
   if (rv != 0) {
     return rv;
   }
@@ -2130,7 +2984,7 @@ int nghttp3_qpack_encoder_dtable_static_add(nghttp3_qpack_encoder *encoder,
   qnv.flags = NGHTTP3_NV_FLAG_NONE;
 
   rv = nghttp3_qpack_context_dtable_add(&encoder->ctx, &qnv,
-                                        &encoder->dtable_map, hash);
+                                        &encoder->dtable_map, hash, nvhash);
 
   nghttp3_rcbuf_decref(qnv.value);
 
@@ -2140,13 +2994,14 @@ int nghttp3_qpack_encoder_dtable_static_add(nghttp3_qpack_encoder *encoder,
 int nghttp3_qpack_encoder_dtable_dynamic_add(nghttp3_qpack_encoder *encoder,
                                              uint64_t absidx,
                                              const nghttp3_nv *nv,
-                                             uint32_t hash) {
+                                             uint32_t hash, uint32_t nvhash) {
   nghttp3_qpack_nv qnv;
   nghttp3_qpack_entry *ent;
-  const nghttp3_mem *mem = encoder->ctx.mem;
+  nghttp3_rcbuf value;
   int rv;
 
-  rv = nghttp3_rcbuf_new2(&qnv.value, nv->value, nv->valuelen, mem);
+  rv = qpack_context_rcbuf_new(&encoder->ctx, &qnv.value, &value, nv->value,
+                               nv->valuelen);
   if (rv != 0) {
     return rv;
   }
@@ -2160,7 +3015,7 @@ int nghttp3_qpack_encoder_dtable_dynamic_add(nghttp3_qpack_encoder *encoder,
   nghttp3_rcbuf_incref(qnv.name);
 
   rv = nghttp3_qpack_context_dtable_add(&encoder->ctx, &qnv,
-                                        &encoder->dtable_map, hash);
+                                        &encoder->dtable_map, hash, nvhash);
 
   nghttp3_rcbuf_decref(qnv.value);
   nghttp3_rcbuf_decref(qnv.name);
@@ -2180,28 +3035,35 @@ int nghttp3_qpack_encoder_dtable_duplicate_add(nghttp3_qpack_encoder *encoder,
   nghttp3_rcbuf_incref(qnv.name);
   nghttp3_rcbuf_incref(qnv.value);
 
-  rv = nghttp3_qpack_context_dtable_add(&encoder->ctx, &qnv,
-                                        &encoder->dtable_map, ent->hash);
+  rv = nghttp3_qpack_context_dtable_add(
+      &encoder->ctx, &qnv, &encoder->dtable_map, ent->hash, ent->nvhash);
 
   nghttp3_rcbuf_decref(qnv.name);
   nghttp3_rcbuf_decref(qnv.value);
 
+  if (rv == 0) {
+    NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, duplicates, 1);
+  }
+
   return rv;
 }
 
 int nghttp3_qpack_encoder_dtable_literal_add(nghttp3_qpack_encoder *encoder,
                                              const nghttp3_nv *nv,
-                                             int32_t token, uint32_t hash) {
+                                             int32_t token, uint32_t hash,
+                                             uint32_t nvhash) {
   nghttp3_qpack_nv qnv;
-  const nghttp3_mem *mem = encoder->ctx.mem;
+  nghttp3_rcbuf name, value;
   int rv;
 
-  rv = nghttp3_rcbuf_new2(&qnv.name, nv->name, nv->namelen, mem);
+  rv = qpack_context_rcbuf_new(&encoder->ctx, &qnv.name, &name, nv->name,
+                               nv->namelen);
   if (rv != 0) {
     return rv;
   }
 
-  rv = nghttp3_rcbuf_new2(&qnv.value, nv->value, nv->valuelen, mem);
+  rv = qpack_context_rcbuf_new(&encoder->ctx, &qnv.value, &value, nv->value,
+                               nv->valuelen);
   if (rv != 0) {
     nghttp3_rcbuf_decref(qnv.name);
     return rv;
@@ -2211,7 +3073,7 @@ int nghttp3_qpack_encoder_dtable_literal_add(nghttp3_qpack_encoder *encoder,
   qnv.flags = NGHTTP3_NV_FLAG_NONE;
 
   rv = nghttp3_qpack_context_dtable_add(&encoder->ctx, &qnv,
-                                        &encoder->dtable_map, hash);
+                                        &encoder->dtable_map, hash, nvhash);
 
   nghttp3_rcbuf_decref(qnv.value);
   nghttp3_rcbuf_decref(qnv.name);
@@ -2238,12 +3100,15 @@ nghttp3_qpack_context_dtable_top(nghttp3_qpack_context *ctx) {
 }
 
 void nghttp3_qpack_entry_init(nghttp3_qpack_entry *ent, nghttp3_qpack_nv *qnv,
-                              size_t sum, uint64_t absidx, uint32_t hash) {
+                              size_t sum, uint64_t absidx, uint32_t hash,
+                              uint32_t nvhash) {
   ent->nv = *qnv;
-  ent->map_next = NULL;
+  ent->name_prev = NULL;
+  ent->name_next = NULL;
   ent->sum = sum;
   ent->absidx = absidx;
   ent->hash = hash;
+  ent->nvhash = nvhash;
 
   nghttp3_rcbuf_incref(ent->nv.name);
   nghttp3_rcbuf_incref(ent->nv.value);
@@ -2256,22 +3121,16 @@ void nghttp3_qpack_entry_free(nghttp3_qpack_entry *ent) {
 
 int nghttp3_qpack_encoder_block_stream(nghttp3_qpack_encoder *encoder,
                                        nghttp3_qpack_stream *stream) {
-  nghttp3_blocked_streams_key bsk = {
-      nghttp3_struct_of(nghttp3_pq_top(&stream->max_cnts),
-                        nghttp3_qpack_header_block_ref, max_cnts_pe)
-          ->max_cnt,
-      (uint64_t)stream->stream_id};
+  nghttp3_blocked_streams_key bsk = {stream->max_cnt,
+                                     (uint64_t)stream->stream_id};
 
   return nghttp3_ksl_insert(&encoder->blocked_streams, NULL, &bsk, stream);
 }
 
 void nghttp3_qpack_encoder_unblock_stream(nghttp3_qpack_encoder *encoder,
                                           nghttp3_qpack_stream *stream) {
-  nghttp3_blocked_streams_key bsk = {
-      nghttp3_struct_of(nghttp3_pq_top(&stream->max_cnts),
-                        nghttp3_qpack_header_block_ref, max_cnts_pe)
-          ->max_cnt,
-      (uint64_t)stream->stream_id};
+  nghttp3_blocked_streams_key bsk = {stream->max_cnt,
+                                     (uint64_t)stream->stream_id};
   nghttp3_ksl_it it;
 
   /* This is purely debugging purpose only */
@@ -2300,17 +3159,15 @@ int nghttp3_qpack_encoder_ack_header(nghttp3_qpack_encoder *encoder,
                                      int64_t stream_id) {
   nghttp3_qpack_stream *stream =
       nghttp3_qpack_encoder_find_stream(encoder, stream_id);
-  const nghttp3_mem *mem = encoder->ctx.mem;
   nghttp3_qpack_header_block_ref *ref;
 
   if (stream == NULL) {
     return NGHTTP3_ERR_QPACK_DECODER_STREAM_ERROR;
   }
 
-  assert(nghttp3_ringbuf_len(&stream->refs));
+  ref = stream->refs_head;
 
-  ref =
-      *(nghttp3_qpack_header_block_ref **)nghttp3_ringbuf_get(&stream->refs, 0);
+  assert(ref);
 
   DEBUGF("qpack::encoder: Header acknowledgement stream=%ld ricnt=%" PRIu64
          " krcnt=%" PRIu64 "\n",
@@ -2328,15 +3185,16 @@ int nghttp3_qpack_encoder_ack_header(nghttp3_qpack_encoder *encoder,
 
   nghttp3_pq_remove(&encoder->min_cnts, &ref->min_cnts_pe);
 
-  nghttp3_qpack_header_block_ref_del(ref, mem);
+  nghttp3_qpack_header_block_ref_del(ref, &encoder->ref_objalloc);
 
-  if (nghttp3_ringbuf_len(&stream->refs)) {
+  if (stream->refs_head) {
     return 0;
   }
 
   qpack_encoder_remove_stream(encoder, stream);
 
-  nghttp3_qpack_stream_del(stream, mem);
+  nghttp3_qpack_stream_del(stream, &encoder->stream_objalloc,
+                           &encoder->ref_objalloc);
 
   return 0;
 }
@@ -2357,8 +3215,7 @@ void nghttp3_qpack_encoder_ack_everything(nghttp3_qpack_encoder *encoder) {
 
   nghttp3_ksl_clear(&encoder->blocked_streams);
   nghttp3_pq_clear(&encoder->min_cnts);
-  nghttp3_map_each_free(&encoder->streams, map_stream_free,
-                        (void *)encoder->ctx.mem);
+  nghttp3_map_each_free(&encoder->streams, map_stream_free, encoder);
   nghttp3_map_clear(&encoder->streams);
 }
 
@@ -2366,7 +3223,6 @@ void nghttp3_qpack_encoder_cancel_stream(nghttp3_qpack_encoder *encoder,
                                          int64_t stream_id) {
   nghttp3_qpack_stream *stream =
       nghttp3_qpack_encoder_find_stream(encoder, stream_id);
-  const nghttp3_mem *mem = encoder->ctx.mem;
 
   if (stream == NULL) {
     return;
@@ -2378,7 +3234,8 @@ void nghttp3_qpack_encoder_cancel_stream(nghttp3_qpack_encoder *encoder,
 
   qpack_encoder_remove_stream(encoder, stream);
 
-  nghttp3_qpack_stream_del(stream, mem);
+  nghttp3_qpack_stream_del(stream, &encoder->stream_objalloc,
+                           &encoder->ref_objalloc);
 }
 
 size_t
@@ -2386,6 +3243,110 @@ nghttp3_qpack_encoder_get_num_blocked_streams(nghttp3_qpack_encoder *encoder) {
   return nghttp3_ksl_len(&encoder->blocked_streams);
 }
 
+/*
+ * qpack_statslen_version returns the effective length of
+ * nghttp3_qpack_stats at the version |stats_version|.
+ */
+static size_t qpack_statslen_version(int stats_version) {
+  nghttp3_qpack_stats stats;
+
+  switch (stats_version) {
+  case NGHTTP3_QPACK_STATS_VERSION:
+    return sizeof(stats);
+  default:
+    nghttp3_unreachable();
+  }
+}
+
+/*
+ * qpack_context_get_stats stores the compression statistics of |ctx|
+ * into |*dest|.  Only the fields which are available in
+ * |stats_version| are written.
+ */
+static void qpack_context_get_stats(const nghttp3_qpack_context *ctx,
+                                    int stats_version,
+                                    nghttp3_qpack_stats *dest) {
+  size_t len = qpack_statslen_version(stats_version);
+#ifdef ENABLE_QPACK_STATS
+  memcpy(dest, &ctx->stats, len);
+#else  /* !ENABLE_QPACK_STATS */
+  (void)ctx;
+
+  memset(dest, 0, len);
+#endif /* !ENABLE_QPACK_STATS */
+}
+
+void nghttp3_qpack_encoder_get_stats_versioned(
+    const nghttp3_qpack_encoder *encoder, int stats_version,
+    nghttp3_qpack_stats *dest) {
+  qpack_context_get_stats(&encoder->ctx, stats_version, dest);
+}
+
+size_t nghttp3_qpack_static_field_section_bound(const nghttp3_nv *nva,
+                                                size_t nvlen) {
+  /* Required Insert Count and Delta Base are both 0. */
+  size_t n = 2;
+  size_t i;
+  const nghttp3_nv *nv;
+
+  for (i = 0; i < nvlen; ++i) {
+    nv = &nva[i];
+    /* The longest representation is Literal Field Line with Literal
+       Name without Huffman encoding. */
+    n += nghttp3_qpack_put_varint_len(nv->namelen, 3) + nv->namelen +
+         nghttp3_qpack_put_varint_len(nv->valuelen, 7) + nv->valuelen;
+  }
+
+  return n;
+}
+
+uint8_t *nghttp3_qpack_write_static_field_section(uint8_t *p,
+                                                  const nghttp3_nv *nva,
+                                                  size_t nvlen) {
+  size_t i;
+  const nghttp3_nv *nv;
+  int32_t token;
+  int never;
+  nghttp3_qpack_lookup_result sres;
+
+  *p++ = 0;
+  *p++ = 0;
+
+  for (i = 0; i < nvlen; ++i) {
+    nv = &nva[i];
+    token = qpack_lookup_token(nv->name, nv->namelen);
+    never = qpack_nv_never_index(nv, token);
+
+    if (token != -1 && (size_t)token < nghttp3_arraylen(token_stable)) {
+      sres = nghttp3_qpack_lookup_stable(
+          nv, token,
+          never ? NGHTTP3_QPACK_INDEXING_MODE_NEVER
+                : NGHTTP3_QPACK_INDEXING_MODE_LITERAL);
+      if (sres.name_value_match) {
+        /* Indexed Field Line */
+        *p = 0xc0;
+        p = nghttp3_qpack_put_varint(p, (uint64_t)sres.index, 6);
+        continue;
+      }
+
+      /* Literal Field Line With Name Reference */
+      *p = (uint8_t)(0x50 | (never ? 0x20 : 0));
+      p = nghttp3_qpack_put_varint(p, (uint64_t)sres.index, 4);
+      *p = 0;
+      p = qpack_put_string(p, nv->value, nv->valuelen, 7, 0);
+      continue;
+    }
+
+    /* Literal Field Line With Literal Name */
+    *p = (uint8_t)(0x20 | (never ? 0x10 : 0));
+    p = qpack_put_string(p, nv->name, nv->namelen, 3, 0);
+    *p = 0;
+    p = qpack_put_string(p, nv->value, nv->valuelen, 7, 0);
+  }
+
+  return p;
+}
+
 int nghttp3_qpack_encoder_write_field_section_prefix(
     nghttp3_qpack_encoder *encoder, nghttp3_buf *pbuf, uint64_t ricnt,
     uint64_t base) {
@@ -2523,6 +3484,8 @@ nghttp3_ssize nghttp3_qpack_encoder_read_decoder(nghttp3_qpack_encoder *encoder,
     return 0;
   }
 
+  NGHTTP3_QPACK_STAT_ADD(&encoder->ctx, decoder_stream_bytes, srclen);
+
   end = src + srclen;
 
   for (; p != end;) {
@@ -2670,23 +3633,49 @@ int nghttp3_qpack_decoder_init(nghttp3_qpack_decoder *decoder,
   decoder->opcode = 0;
   decoder->written_icnt = 0;
   decoder->max_concurrent_streams = 0;
+  decoder->borrow_literals = 0;
+  decoder->value_chunk_size = 0;
 
   nghttp3_qpack_read_state_reset(&decoder->rstate);
   nghttp3_buf_init(&decoder->dbuf);
+  nghttp3_buf_init(&decoder->es_namebuf);
+  nghttp3_buf_init(&decoder->es_valuebuf);
 
   return 0;
 }
 
 void nghttp3_qpack_decoder_free(nghttp3_qpack_decoder *decoder) {
+  nghttp3_buf_free(&decoder->es_valuebuf, decoder->ctx.mem);
+  nghttp3_buf_free(&decoder->es_namebuf, decoder->ctx.mem);
   nghttp3_buf_free(&decoder->dbuf, decoder->ctx.mem);
   nghttp3_qpack_read_state_free(&decoder->rstate);
   qpack_context_free(&decoder->ctx);
 }
 
+void nghttp3_qpack_decoder_reset(nghttp3_qpack_decoder *decoder,
+                                 size_t max_blocked_streams) {
+  qpack_context_reset(&decoder->ctx);
+
+  decoder->ctx.max_blocked_streams = max_blocked_streams;
+  decoder->state = NGHTTP3_QPACK_ES_STATE_OPCODE;
+  decoder->opcode = 0;
+  decoder->written_icnt = 0;
+  decoder->max_concurrent_streams = 0;
+  decoder->borrow_literals = 0;
+  decoder->value_chunk_size = 0;
+
+  nghttp3_qpack_read_state_free(&decoder->rstate);
+  nghttp3_qpack_read_state_reset(&decoder->rstate);
+  nghttp3_buf_reset(&decoder->dbuf);
+  nghttp3_buf_reset(&decoder->es_namebuf);
+  nghttp3_buf_reset(&decoder->es_valuebuf);
+}
+
 /*
  * qpack_read_huffman_string decodes huffman string in buffer [begin,
  * end) and writes the decoded string to |dest|.  This function
- * assumes the buffer pointed by |dest| has enough space.
+ * assumes the buffer pointed by |dest| has enough space.  |ctx| is
+ * the decoder context which records Huffman savings.
  *
  * This function returns 0 if it succeeds, or one of the following
  * negative error codes:
@@ -2694,7 +3683,8 @@ void nghttp3_qpack_decoder_free(nghttp3_qpack_decoder *decoder) {
  * NGHTTP3_ERR_QPACK_FATAL
  *     Could not decode huffman string.
  */
-static nghttp3_ssize qpack_read_huffman_string(nghttp3_qpack_read_state *rstate,
+static nghttp3_ssize qpack_read_huffman_string(nghttp3_qpack_context *ctx,
+                                               nghttp3_qpack_read_state *rstate,
                                                nghttp3_buf *dest,
                                                const uint8_t *begin,
                                                const uint8_t *end) {
@@ -2717,6 +3707,8 @@ static nghttp3_ssize qpack_read_huffman_string(nghttp3_qpack_read_state *rstate,
     return NGHTTP3_ERR_QPACK_FATAL;
   }
 
+  NGHTTP3_QPACK_STAT_ADD(ctx, huffman_saved, (int64_t)nwrite - (int64_t)len);
+
   dest->last += nwrite;
   rstate->left -= len;
   return (nghttp3_ssize)len;
@@ -2771,13 +3763,45 @@ static void qpack_read_state_terminate_value(nghttp3_qpack_read_state *rstate) {
   rstate->value->len = nghttp3_buf_len(&rstate->valuebuf);
 }
 
+/*
+ * qpack_decoder_es_rcbuf_new assigns nghttp3_rcbuf which has |len|
+ * bytes buffer to |*prcbuf| in order to read a string literal on
+ * encoder stream.  If decoder->ctx uses nghttp3_qpack_ring, |buf| is
+ * reused as the buffer, and |rcbuf| is initialized as a borrowed
+ * nghttp3_rcbuf which refers to it.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int qpack_decoder_es_rcbuf_new(nghttp3_qpack_decoder *decoder,
+                                      nghttp3_rcbuf **prcbuf,
+                                      nghttp3_rcbuf *rcbuf, nghttp3_buf *buf,
+                                      size_t len) {
+  int rv;
+
+  if (decoder->ctx.ring.ents == NULL) {
+    return nghttp3_rcbuf_new(prcbuf, len, decoder->ctx.mem);
+  }
+
+  rv = nghttp3_buf_reserve(buf, len, decoder->ctx.mem);
+  if (rv != 0) {
+    return rv;
+  }
+
+  *prcbuf = qpack_rcbuf_view_init(rcbuf, buf->begin, len);
+
+  return 0;
+}
+
 nghttp3_ssize nghttp3_qpack_decoder_read_encoder(nghttp3_qpack_decoder *decoder,
                                                  const uint8_t *src,
                                                  size_t srclen) {
   const uint8_t *p = src, *end;
   int rv;
   int busy = 0;
-  const nghttp3_mem *mem = decoder->ctx.mem;
   nghttp3_ssize nread;
   int rfin;
 
@@ -2789,6 +3813,8 @@ nghttp3_ssize nghttp3_qpack_decoder_read_encoder(nghttp3_qpack_decoder *decoder,
     return 0;
   }
 
+  NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, encoder_stream_bytes, srclen);
+
   end = src + srclen;
 
   for (; p != end || busy;) {
@@ -2907,12 +3933,14 @@ nghttp3_ssize nghttp3_qpack_decoder_read_encoder(nghttp3_qpack_decoder *decoder,
       if (decoder->rstate.huffman_encoded) {
         decoder->state = NGHTTP3_QPACK_ES_STATE_READ_NAME_HUFFMAN;
         nghttp3_qpack_huffman_decode_context_init(&decoder->rstate.huffman_ctx);
-        rv = nghttp3_rcbuf_new(&decoder->rstate.name,
-                               (size_t)decoder->rstate.left * 2 + 1, mem);
+        rv = qpack_decoder_es_rcbuf_new(
+            decoder, &decoder->rstate.name, &decoder->es_name,
+            &decoder->es_namebuf, (size_t)decoder->rstate.left * 2 + 1);
       } else {
         decoder->state = NGHTTP3_QPACK_ES_STATE_READ_NAME;
-        rv = nghttp3_rcbuf_new(&decoder->rstate.name,
-                               (size_t)decoder->rstate.left + 1, mem);
+        rv = qpack_decoder_es_rcbuf_new(
+            decoder, &decoder->rstate.name, &decoder->es_name,
+            &decoder->es_namebuf, (size_t)decoder->rstate.left + 1);
       }
       if (rv != 0) {
         goto fail;
@@ -2923,7 +3951,7 @@ nghttp3_ssize nghttp3_qpack_decoder_read_encoder(nghttp3_qpack_decoder *decoder,
                             decoder->rstate.name->len);
       break;
     case NGHTTP3_QPACK_ES_STATE_READ_NAME_HUFFMAN:
-      nread = qpack_read_huffman_string(&decoder->rstate,
+      nread = qpack_read_huffman_string(&decoder->ctx, &decoder->rstate,
                                         &decoder->rstate.namebuf, p, end);
       if (nread < 0) {
         assert(NGHTTP3_ERR_QPACK_FATAL == nread);
@@ -2989,12 +4017,14 @@ nghttp3_ssize nghttp3_qpack_decoder_read_encoder(nghttp3_qpack_decoder *decoder,
       if (decoder->rstate.huffman_encoded) {
         decoder->state = NGHTTP3_QPACK_ES_STATE_READ_VALUE_HUFFMAN;
         nghttp3_qpack_huffman_decode_context_init(&decoder->rstate.huffman_ctx);
-        rv = nghttp3_rcbuf_new(&decoder->rstate.value,
-                               (size_t)decoder->rstate.left * 2 + 1, mem);
+        rv = qpack_decoder_es_rcbuf_new(
+            decoder, &decoder->rstate.value, &decoder->es_value,
+            &decoder->es_valuebuf, (size_t)decoder->rstate.left * 2 + 1);
       } else {
         decoder->state = NGHTTP3_QPACK_ES_STATE_READ_VALUE;
-        rv = nghttp3_rcbuf_new(&decoder->rstate.value,
-                               (size_t)decoder->rstate.left + 1, mem);
+        rv = qpack_decoder_es_rcbuf_new(
+            decoder, &decoder->rstate.value, &decoder->es_value,
+            &decoder->es_valuebuf, (size_t)decoder->rstate.left + 1);
       }
       if (rv != 0) {
         goto fail;
@@ -3008,7 +4038,7 @@ nghttp3_ssize nghttp3_qpack_decoder_read_encoder(nghttp3_qpack_decoder *decoder,
       busy = 1;
       break;
     case NGHTTP3_QPACK_ES_STATE_READ_VALUE_HUFFMAN:
-      nread = qpack_read_huffman_string(&decoder->rstate,
+      nread = qpack_read_huffman_string(&decoder->ctx, &decoder->rstate,
                                         &decoder->rstate.valuebuf, p, end);
       if (nread < 0) {
         assert(NGHTTP3_ERR_QPACK_FATAL == nread);
@@ -3089,7 +4119,6 @@ int nghttp3_qpack_decoder_set_max_dtable_capacity(
   nghttp3_qpack_entry *ent;
   size_t i;
   nghttp3_qpack_context *ctx = &decoder->ctx;
-  const nghttp3_mem *mem = ctx->mem;
 
   if (max_dtable_capacity > decoder->ctx.hard_max_dtable_capacity) {
     return NGHTTP3_ERR_INVALID_ARGUMENT;
@@ -3105,8 +4134,9 @@ int nghttp3_qpack_decoder_set_max_dtable_capacity(
     ctx->dtable_size -= table_space(ent->nv.name->len, ent->nv.value->len);
 
     nghttp3_ringbuf_pop_back(&ctx->dtable);
-    nghttp3_qpack_entry_free(ent);
-    nghttp3_mem_free(mem, ent);
+    qpack_context_free_entry(ctx, ent);
+
+    NGHTTP3_QPACK_STAT_ADD(ctx, evictions, 1);
   }
 
   return 0;
@@ -3142,7 +4172,7 @@ int nghttp3_qpack_decoder_dtable_static_add(nghttp3_qpack_decoder *decoder) {
   qnv.token = shd->token;
   qnv.flags = NGHTTP3_NV_FLAG_NONE;
 
-  rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0);
+  rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0, 0);
 
   nghttp3_rcbuf_decref(qnv.value);
 
@@ -3168,7 +4198,7 @@ int nghttp3_qpack_decoder_dtable_dynamic_add(nghttp3_qpack_decoder *decoder) {
 
   nghttp3_rcbuf_incref(qnv.name);
 
-  rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0);
+  rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0, 0);
 
   nghttp3_rcbuf_decref(qnv.value);
   nghttp3_rcbuf_decref(qnv.name);
@@ -3195,11 +4225,15 @@ int nghttp3_qpack_decoder_dtable_duplicate_add(nghttp3_qpack_decoder *decoder) {
   nghttp3_rcbuf_incref(qnv.name);
   nghttp3_rcbuf_incref(qnv.value);
 
-  rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0);
+  rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0, 0);
 
   nghttp3_rcbuf_decref(qnv.value);
   nghttp3_rcbuf_decref(qnv.name);
 
+  if (rv == 0) {
+    NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, duplicates, 1);
+  }
+
   return rv;
 }
 
@@ -3221,7 +4255,7 @@ int nghttp3_qpack_decoder_dtable_literal_add(nghttp3_qpack_decoder *decoder) {
   qnv.token = qpack_lookup_token(qnv.name->base, qnv.name->len);
   qnv.flags = NGHTTP3_NV_FLAG_NONE;
 
-  rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0);
+  rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0, 0);
 
   nghttp3_rcbuf_decref(qnv.value);
   nghttp3_rcbuf_decref(qnv.name);
@@ -3248,14 +4282,20 @@ void nghttp3_qpack_stream_context_init(nghttp3_qpack_stream_context *sctx,
   sctx->ricnt = 0;
   sctx->dbase_sign = 0;
   sctx->base = 0;
+  nghttp3_buf_init(&sctx->chunkbuf);
 }
 
 void nghttp3_qpack_stream_context_free(nghttp3_qpack_stream_context *sctx) {
+  nghttp3_buf_free(&sctx->chunkbuf, sctx->mem);
   nghttp3_qpack_read_state_free(&sctx->rstate);
 }
 
 void nghttp3_qpack_stream_context_reset(nghttp3_qpack_stream_context *sctx) {
+  nghttp3_buf chunkbuf = sctx->chunkbuf;
+
   nghttp3_qpack_stream_context_init(sctx, sctx->stream_id, sctx->mem);
+
+  sctx->chunkbuf = chunkbuf;
 }
 
 uint64_t
@@ -3263,11 +4303,82 @@ nghttp3_qpack_stream_context_get_ricnt(nghttp3_qpack_stream_context *sctx) {
   return sctx->ricnt;
 }
 
-nghttp3_ssize
-nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
-                                   nghttp3_qpack_stream_context *sctx,
-                                   nghttp3_qpack_nv *nv, uint8_t *pflags,
-                                   const uint8_t *src, size_t srclen, int fin) {
+/*
+ * qpack_decoder_can_borrow returns nonzero if the string literal
+ * which |rstate| is about to read can be emitted as a view of the
+ * buffer [p, end).
+ */
+static int qpack_decoder_can_borrow(const nghttp3_qpack_decoder *decoder,
+                                    const nghttp3_qpack_read_state *rstate,
+                                    const uint8_t *p, const uint8_t *end) {
+  return decoder->borrow_literals && !rstate->huffman_encoded &&
+         (uint64_t)(end - p) >= rstate->left;
+}
+
+void nghttp3_qpack_decoder_set_borrow_literals(nghttp3_qpack_decoder *decoder,
+                                               int borrow) {
+  decoder->borrow_literals = borrow;
+}
+
+void nghttp3_qpack_decoder_set_value_chunk_size(nghttp3_qpack_decoder *decoder,
+                                                size_t chunk_size) {
+  decoder->value_chunk_size = chunk_size;
+}
+
+/*
+ * qpack_decoder_read_value_chunk reads a fragment of the literal
+ * value, which is emitted incrementally, from the buffer [p, end).
+ * The fragment is at most decoder->value_chunk_size bytes long
+ * before decoding.  It assigns the decoded fragment to
+ * |*pchunk|, which refers to either the input buffer or
+ * sctx->chunkbuf.
+ *
+ * This function returns the number of bytes read, or one of the
+ * following negative error codes:
+ *
+ * NGHTTP3_ERR_QPACK_FATAL
+ *     Could not decode huffman string.
+ */
+static nghttp3_ssize
+qpack_decoder_read_value_chunk(nghttp3_qpack_decoder *decoder,
+                               nghttp3_qpack_stream_context *sctx,
+                               nghttp3_rcbuf **pchunk, const uint8_t *p,
+                               const uint8_t *end) {
+  size_t len = (size_t)nghttp3_min(
+      (uint64_t)nghttp3_min((size_t)(end - p), decoder->value_chunk_size),
+      sctx->rstate.left);
+  nghttp3_ssize nread;
+
+  if (!sctx->rstate.huffman_encoded) {
+    sctx->rstate.left -= len;
+    *pchunk = qpack_rcbuf_view_init(&sctx->value_view, p, len);
+
+    return (nghttp3_ssize)len;
+  }
+
+  nghttp3_buf_reset(&sctx->chunkbuf);
+
+  nread = qpack_read_huffman_string(&decoder->ctx, &sctx->rstate,
+                                    &sctx->chunkbuf, p, p + len);
+  if (nread < 0) {
+    return nread;
+  }
+
+  *pchunk = qpack_rcbuf_view_init(&sctx->value_view, sctx->chunkbuf.pos,
+                                  nghttp3_buf_len(&sctx->chunkbuf));
+
+  return nread;
+}
+
+int nghttp3_qpack_decoder_enable_ring_dtable(nghttp3_qpack_decoder *decoder) {
+  return qpack_context_init_ring(&decoder->ctx);
+}
+
+static nghttp3_ssize
+qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
+                           nghttp3_qpack_stream_context *sctx,
+                           nghttp3_qpack_nv *nv, uint8_t *pflags,
+                           const uint8_t *src, size_t srclen, int fin) {
   const uint8_t *p = src, *end = src ? src + srclen : src;
   int rv;
   int busy = 0;
@@ -3345,6 +4456,7 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
 
       if (sctx->ricnt > decoder->ctx.next_absidx) {
         DEBUGF("qpack::decode: stream blocked\n");
+        NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, blocked_sections, 1);
         sctx->state = NGHTTP3_QPACK_RS_STATE_BLOCKED;
         *pflags |= NGHTTP3_QPACK_DECODE_FLAG_BLOCKED;
         return p - src;
@@ -3476,6 +4588,17 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
         goto fail;
       }
 
+      if (qpack_decoder_can_borrow(decoder, &sctx->rstate, p, end)) {
+        sctx->rstate.name = qpack_rcbuf_view_init(
+            &sctx->name_view, p, (size_t)sctx->rstate.left);
+        p += sctx->rstate.left;
+        sctx->rstate.left = 0;
+
+        sctx->state = NGHTTP3_QPACK_RS_STATE_CHECK_VALUE_HUFFMAN;
+        sctx->rstate.prefix = 7;
+        break;
+      }
+
       if (sctx->rstate.huffman_encoded) {
         sctx->state = NGHTTP3_QPACK_RS_STATE_READ_NAME_HUFFMAN;
         nghttp3_qpack_huffman_decode_context_init(&sctx->rstate.huffman_ctx);
@@ -3494,8 +4617,8 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
                             sctx->rstate.name->len);
       break;
     case NGHTTP3_QPACK_RS_STATE_READ_NAME_HUFFMAN:
-      nread = qpack_read_huffman_string(&sctx->rstate, &sctx->rstate.namebuf, p,
-                                        end);
+      nread = qpack_read_huffman_string(&decoder->ctx, &sctx->rstate,
+                                        &sctx->rstate.namebuf, p, end);
       if (nread < 0) {
         assert(NGHTTP3_ERR_QPACK_FATAL == nread);
         rv = NGHTTP3_ERR_QPACK_DECOMPRESSION_FAILED;
@@ -3556,6 +4679,41 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
         goto fail;
       }
 
+      if (decoder->value_chunk_size &&
+          sctx->rstate.left > decoder->value_chunk_size) {
+        if (sctx->rstate.huffman_encoded) {
+          /* Huffman decoding expands the input at most 8/5 times. */
+          rv = nghttp3_buf_reserve(&sctx->chunkbuf,
+                                   decoder->value_chunk_size * 2, sctx->mem);
+          if (rv != 0) {
+            goto fail;
+          }
+
+          nghttp3_qpack_huffman_decode_context_init(
+              &sctx->rstate.huffman_ctx);
+        }
+
+        sctx->state = NGHTTP3_QPACK_RS_STATE_STREAM_VALUE;
+
+        rv = nghttp3_qpack_decoder_emit_value_begin(decoder, sctx, nv);
+        if (rv != 0) {
+          goto fail;
+        }
+
+        *pflags |= NGHTTP3_QPACK_DECODE_FLAG_VALUE_BEGIN;
+
+        return p - src;
+      }
+
+      if (qpack_decoder_can_borrow(decoder, &sctx->rstate, p, end)) {
+        sctx->rstate.value = qpack_rcbuf_view_init(
+            &sctx->value_view, p, (size_t)sctx->rstate.left);
+        p += sctx->rstate.left;
+        sctx->rstate.left = 0;
+
+        goto emit_value;
+      }
+
       if (sctx->rstate.huffman_encoded) {
         sctx->state = NGHTTP3_QPACK_RS_STATE_READ_VALUE_HUFFMAN;
         nghttp3_qpack_huffman_decode_context_init(&sctx->rstate.huffman_ctx);
@@ -3577,8 +4735,8 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
       busy = 1;
       break;
     case NGHTTP3_QPACK_RS_STATE_READ_VALUE_HUFFMAN:
-      nread = qpack_read_huffman_string(&sctx->rstate, &sctx->rstate.valuebuf,
-                                        p, end);
+      nread = qpack_read_huffman_string(&decoder->ctx, &sctx->rstate,
+                                        &sctx->rstate.valuebuf, p, end);
       if (nread < 0) {
         assert(NGHTTP3_ERR_QPACK_FATAL == nread);
         rv = NGHTTP3_ERR_QPACK_DECOMPRESSION_FAILED;
@@ -3630,6 +4788,8 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
 
       qpack_read_state_terminate_value(&sctx->rstate);
 
+    emit_value:
+
       switch (sctx->opcode) {
       case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME:
       case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME_PB:
@@ -3652,6 +4812,38 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
       nghttp3_qpack_read_state_reset(&sctx->rstate);
 
       return p - src;
+    case NGHTTP3_QPACK_RS_STATE_STREAM_VALUE:
+      nread = qpack_decoder_read_value_chunk(decoder, sctx, &nv->value, p, end);
+      if (nread < 0) {
+        assert(NGHTTP3_ERR_QPACK_FATAL == nread);
+        rv = NGHTTP3_ERR_QPACK_DECOMPRESSION_FAILED;
+        goto fail;
+      }
+
+      p += nread;
+
+      if (nv->value->len) {
+        nv->name = NULL;
+        nv->token = -1;
+        nv->flags = NGHTTP3_NV_FLAG_NONE;
+        *pflags |= NGHTTP3_QPACK_DECODE_FLAG_VALUE_CHUNK;
+
+        NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, raw_bytes, nv->value->len);
+      }
+
+      if (sctx->rstate.left == 0) {
+        *pflags |= NGHTTP3_QPACK_DECODE_FLAG_VALUE_END;
+
+        sctx->state = NGHTTP3_QPACK_RS_STATE_OPCODE;
+        nghttp3_qpack_read_state_reset(&sctx->rstate);
+      }
+
+      if (*pflags) {
+        return p - src;
+      }
+
+      /* Huffman decoder has not produced any octet yet. */
+      break;
     case NGHTTP3_QPACK_RS_STATE_BLOCKED:
       if (sctx->ricnt > decoder->ctx.next_absidx) {
         DEBUGF("qpack::decode: stream still blocked\n");
@@ -3665,6 +4857,16 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
   }
 
 almost_ok:
+  if (sctx->rstate.name == &sctx->name_view) {
+    /* The literal name is complete, but the value is not.  The input
+       buffer might be gone by the next call, so copy the name. */
+    rv = nghttp3_rcbuf_new2(&sctx->rstate.name, sctx->name_view.base,
+                            sctx->name_view.len, mem);
+    if (rv != 0) {
+      goto fail;
+    }
+  }
+
   if (fin) {
     if (sctx->state != NGHTTP3_QPACK_RS_STATE_OPCODE) {
       rv = NGHTTP3_ERR_QPACK_DECOMPRESSION_FAILED;
@@ -3688,6 +4890,21 @@ fail:
   return rv;
 }
 
+nghttp3_ssize
+nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
+                                   nghttp3_qpack_stream_context *sctx,
+                                   nghttp3_qpack_nv *nv, uint8_t *pflags,
+                                   const uint8_t *src, size_t srclen, int fin) {
+  nghttp3_ssize nread = qpack_decoder_read_request(decoder, sctx, nv, pflags,
+                                                   src, srclen, fin);
+
+  if (nread > 0) {
+    NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, encoded_bytes, (uint64_t)nread);
+  }
+
+  return nread;
+}
+
 static int qpack_decoder_dbuf_overflow(nghttp3_qpack_decoder *decoder) {
   size_t limit = nghttp3_max(decoder->max_concurrent_streams, 100);
   /* 10 = nghttp3_qpack_put_varint_len((1ULL << 62) - 1, 2)) */
@@ -3749,6 +4966,9 @@ void nghttp3_qpack_decoder_write_decoder(nghttp3_qpack_decoder *decoder,
 
   assert(nghttp3_buf_left(dbuf) >= nghttp3_buf_len(&decoder->dbuf) + len);
 
+  NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, decoder_stream_bytes,
+                         nghttp3_buf_len(&decoder->dbuf) + len);
+
   if (nghttp3_buf_len(&decoder->dbuf)) {
     dbuf->last = nghttp3_cpymem(dbuf->last, decoder->dbuf.pos,
                                 nghttp3_buf_len(&decoder->dbuf));
@@ -3926,9 +5146,14 @@ void nghttp3_qpack_decoder_emit_indexed(nghttp3_qpack_decoder *decoder,
 
   if (sctx->rstate.dynamic) {
     qpack_decoder_emit_dynamic_indexed(decoder, sctx, nv);
+    NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, dynamic_indexed, 1);
   } else {
     qpack_decoder_emit_static_indexed(decoder, sctx, nv);
+    NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, static_indexed, 1);
   }
+
+  NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, raw_bytes,
+                         nv->name->len + nv->value->len);
 }
 
 static void
@@ -3977,17 +5202,71 @@ qpack_decoder_emit_dynamic_indexed_name(nghttp3_qpack_decoder *decoder,
 int nghttp3_qpack_decoder_emit_indexed_name(nghttp3_qpack_decoder *decoder,
                                             nghttp3_qpack_stream_context *sctx,
                                             nghttp3_qpack_nv *nv) {
-  (void)decoder;
+  int rv;
 
   DEBUGF("qpack::decode: Indexed name (%s) absidx=%" PRIu64 " value=%*s\n",
          sctx->rstate.dynamic ? "dynamic" : "static", sctx->rstate.absidx,
          (int)sctx->rstate.value->len, sctx->rstate.value->base);
 
   if (sctx->rstate.dynamic) {
-    return qpack_decoder_emit_dynamic_indexed_name(decoder, sctx, nv);
+    rv = qpack_decoder_emit_dynamic_indexed_name(decoder, sctx, nv);
+    if (rv != 0) {
+      return rv;
+    }
+
+    NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, dynamic_name, 1);
+  } else {
+    qpack_decoder_emit_static_indexed_name(decoder, sctx, nv);
+    NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, static_name, 1);
+  }
+
+  NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, raw_bytes,
+                         nv->name->len + nv->value->len);
+
+  return 0;
+}
+
+int nghttp3_qpack_decoder_emit_value_begin(nghttp3_qpack_decoder *decoder,
+                                           nghttp3_qpack_stream_context *sctx,
+                                           nghttp3_qpack_nv *nv) {
+  int rv;
+
+  DEBUGF("qpack::decode: Begin value of %" PRIu64 " bytes\n",
+         sctx->rstate.left);
+
+  switch (sctx->opcode) {
+  case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME:
+  case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME_PB:
+    if (sctx->rstate.dynamic) {
+      rv = qpack_decoder_emit_dynamic_indexed_name(decoder, sctx, nv);
+      if (rv != 0) {
+        return rv;
+      }
+
+      NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, dynamic_name, 1);
+    } else {
+      qpack_decoder_emit_static_indexed_name(decoder, sctx, nv);
+      NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, static_name, 1);
+    }
+
+    break;
+  case NGHTTP3_QPACK_RS_OPCODE_LITERAL:
+    nv->name = sctx->rstate.name;
+    nv->value = NULL;
+    nv->token = qpack_lookup_token(nv->name->base, nv->name->len);
+    nv->flags =
+        sctx->rstate.never ? NGHTTP3_NV_FLAG_NEVER_INDEX : NGHTTP3_NV_FLAG_NONE;
+
+    sctx->rstate.name = NULL;
+
+    NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, literal, 1);
+
+    break;
+  default:
+    nghttp3_unreachable();
   }
 
-  qpack_decoder_emit_static_indexed_name(decoder, sctx, nv);
+  NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, raw_bytes, nv->name->len);
 
   return 0;
 }
@@ -4009,6 +5288,10 @@ void nghttp3_qpack_decoder_emit_literal(nghttp3_qpack_decoder *decoder,
 
   sctx->rstate.name = NULL;
   sctx->rstate.value = NULL;
+
+  NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, literal, 1);
+  NGHTTP3_QPACK_STAT_ADD(&decoder->ctx, raw_bytes,
+                         nv->name->len + nv->value->len);
 }
 
 int nghttp3_qpack_encoder_new(nghttp3_qpack_encoder **pencoder,
@@ -4114,3 +5397,9 @@ void nghttp3_qpack_decoder_del(nghttp3_qpack_decoder *decoder) {
 uint64_t nghttp3_qpack_decoder_get_icnt(const nghttp3_qpack_decoder *decoder) {
   return decoder->ctx.next_absidx;
 }
+
+void nghttp3_qpack_decoder_get_stats_versioned(
+    const nghttp3_qpack_decoder *decoder, int stats_version,
+    nghttp3_qpack_stats *dest) {
+  qpack_context_get_stats(&decoder->ctx, stats_version, dest);
+}
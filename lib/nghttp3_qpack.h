@@ -38,6 +38,7 @@
 #include "nghttp3_ringbuf.h"
 #include "nghttp3_buf.h"
 #include "nghttp3_ksl.h"
+#include "nghttp3_objalloc.h"
 #include "nghttp3_qpack_huffman.h"
 
 #define NGHTTP3_QPACK_INT_MAX ((1ull << 62) - 1)
@@ -68,9 +69,12 @@ typedef struct nghttp3_qpack_entry nghttp3_qpack_entry;
 struct nghttp3_qpack_entry {
   /* The header field name/value pair */
   nghttp3_qpack_nv nv;
-  /* map_next points to the entry which shares same bucket in hash
-     table. */
-  nghttp3_qpack_entry *map_next;
+  /* name_prev points to the entry which has the same name and was
+     inserted just before this entry.  It is only used by encoder. */
+  nghttp3_qpack_entry *name_prev;
+  /* name_next points to the entry which has the same name and was
+     inserted just after this entry.  It is only used by encoder. */
+  nghttp3_qpack_entry *name_next;
   /* sum is the sum of all entries inserted up to this entry.  This
      value does not contain the space required for this entry. */
   size_t sum;
@@ -78,6 +82,9 @@ struct nghttp3_qpack_entry {
   uint64_t absidx;
   /* The hash value for header name (nv.name). */
   uint32_t hash;
+  /* The hash value for header name and value (nv.name and
+     nv.value). */
+  uint32_t nvhash;
 };
 
 /* The entry used for static table. */
@@ -93,57 +100,156 @@ typedef struct nghttp3_qpack_static_header {
   int32_t token;
 } nghttp3_qpack_static_header;
 
+typedef struct nghttp3_qpack_header_block_ref nghttp3_qpack_header_block_ref;
+
 /*
  * nghttp3_qpack_header_block_ref is created per encoded header block
  * and includes the required insert count and the minimum insert count
  * of dynamic table entry it refers to.
  */
-typedef struct nghttp3_qpack_header_block_ref {
-  nghttp3_pq_entry max_cnts_pe;
-  nghttp3_pq_entry min_cnts_pe;
-  /* max_cnt is the required insert count. */
-  uint64_t max_cnt;
-  /* min_cnt is the minimum insert count of dynamic table entry it
-     refers to.  In other words, this is the minimum absolute index of
-     dynamic header table entry this encoded block refers to plus
-     1. */
-  uint64_t min_cnt;
-} nghttp3_qpack_header_block_ref;
+struct nghttp3_qpack_header_block_ref {
+  union {
+    struct {
+      nghttp3_pq_entry min_cnts_pe;
+      /* next is the header block which is encoded after this one on
+         the same stream. */
+      nghttp3_qpack_header_block_ref *next;
+      /* max_cnt is the required insert count. */
+      uint64_t max_cnt;
+      /* min_cnt is the minimum insert count of dynamic table entry it
+         refers to.  In other words, this is the minimum absolute
+         index of dynamic header table entry this encoded block refers
+         to plus 1. */
+      uint64_t min_cnt;
+    };
+
+    nghttp3_opl_entry oplent;
+  };
+};
 
+nghttp3_objalloc_decl(qpack_header_block_ref, nghttp3_qpack_header_block_ref,
+                      oplent);
+
+/*
+ * nghttp3_qpack_header_block_ref_new allocates
+ * nghttp3_qpack_header_block_ref from |objalloc|, and assigns it to
+ * |*pref|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
 int nghttp3_qpack_header_block_ref_new(nghttp3_qpack_header_block_ref **pref,
                                        uint64_t max_cnt, uint64_t min_cnt,
-                                       const nghttp3_mem *mem);
+                                       nghttp3_objalloc *objalloc);
 
+/*
+ * nghttp3_qpack_header_block_ref_del returns |ref| to |objalloc|.
+ */
 void nghttp3_qpack_header_block_ref_del(nghttp3_qpack_header_block_ref *ref,
-                                        const nghttp3_mem *mem);
+                                        nghttp3_objalloc *objalloc);
 
 typedef struct nghttp3_qpack_stream {
-  int64_t stream_id;
-  /* refs is an array of pointer to nghttp3_qpack_header_block_ref in
-     the order of the time they are encoded.  HTTP/3 allows multiple
-     header blocks (e.g., non-final response headers, final response
-     headers, trailers, and push promises) per stream. */
-  nghttp3_ringbuf refs;
-  /* max_cnts is a priority queue sorted by descending order of
-     max_cnt of nghttp3_qpack_header_block_ref. */
-  nghttp3_pq max_cnts;
+  union {
+    struct {
+      int64_t stream_id;
+      /* refs_head and refs_tail are the first and the last
+         nghttp3_qpack_header_block_ref in the list linked by their
+         next field, in the order of the time they are encoded.
+         HTTP/3 allows multiple header blocks (e.g., non-final
+         response headers, final response headers, trailers, and push
+         promises) per stream, but a stream usually has one or two,
+         so that the list does not need any storage of its own. */
+      nghttp3_qpack_header_block_ref *refs_head;
+      nghttp3_qpack_header_block_ref *refs_tail;
+      /* max_cnt is the largest max_cnt of the header blocks in the
+         list. */
+      uint64_t max_cnt;
+    };
+
+    nghttp3_opl_entry oplent;
+  };
 } nghttp3_qpack_stream;
 
+nghttp3_objalloc_decl(qpack_stream, nghttp3_qpack_stream, oplent);
+
+/*
+ * nghttp3_qpack_stream_new allocates nghttp3_qpack_stream from
+ * |objalloc|, and assigns it to |*pstream|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
 int nghttp3_qpack_stream_new(nghttp3_qpack_stream **pstream, int64_t stream_id,
-                             const nghttp3_mem *mem);
+                             nghttp3_objalloc *objalloc);
 
+/*
+ * nghttp3_qpack_stream_del returns the header blocks of |stream| to
+ * |ref_objalloc|, and |stream| to |objalloc|.
+ */
 void nghttp3_qpack_stream_del(nghttp3_qpack_stream *stream,
-                              const nghttp3_mem *mem);
+                              nghttp3_objalloc *objalloc,
+                              nghttp3_objalloc *ref_objalloc);
 
 uint64_t nghttp3_qpack_stream_get_max_cnt(const nghttp3_qpack_stream *stream);
 
-int nghttp3_qpack_stream_add_ref(nghttp3_qpack_stream *stream,
-                                 nghttp3_qpack_header_block_ref *ref);
+void nghttp3_qpack_stream_add_ref(nghttp3_qpack_stream *stream,
+                                  nghttp3_qpack_header_block_ref *ref);
 
 void nghttp3_qpack_stream_pop_ref(nghttp3_qpack_stream *stream);
 
 #define NGHTTP3_QPACK_ENTRY_OVERHEAD 32
 
+/*
+ * nghttp3_qpack_ring_entry is a dynamic table entry which lives in
+ * nghttp3_qpack_ring.
+ */
+typedef struct nghttp3_qpack_ring_entry {
+  nghttp3_qpack_entry ent;
+  /* name and value are borrowed nghttp3_rcbuf which refer to the
+     name and value stored in nghttp3_qpack_ring.buf.  ent.nv.name
+     points to the static table instead of name if the name was
+     taken from there. */
+  nghttp3_rcbuf name;
+  nghttp3_rcbuf value;
+  /* offset is the offset in nghttp3_qpack_ring.buf where the name
+     and value of this entry are stored contiguously. */
+  size_t offset;
+} nghttp3_qpack_ring_entry;
+
+/*
+ * nghttp3_qpack_ring is the preallocated storage of dynamic table.
+ * Inserting and evicting an entry never allocate or free memory.
+ */
+typedef struct nghttp3_qpack_ring {
+  /* ents is the fixed size array of entries.  The entry of absolute
+     index absidx is ents[absidx & (entslen - 1)].  It is NULL if
+     dynamic table does not use nghttp3_qpack_ring. */
+  nghttp3_qpack_ring_entry *ents;
+  /* entslen is the number of elements in ents.  It is a power of 2
+     which is not less than the maximum number of entries which
+     dynamic table can hold. */
+  size_t entslen;
+  /* buf is the circular buffer which stores the name and value of
+     entries.  Its length is twice the hard_max_dtable_capacity so
+     that an entry always fits in contiguous space. */
+  uint8_t *buf;
+  /* buflen is the length of buf. */
+  size_t buflen;
+  /* head is the offset in buf where the next entry is written. */
+  size_t head;
+  /* stage is the scratch space of hard_max_dtable_capacity bytes.
+     An entry which is made from the name or value of the existing
+     entry is copied here first because eviction might overwrite
+     them. */
+  uint8_t *stage;
+} nghttp3_qpack_ring;
+
 typedef struct nghttp3_qpack_context {
   /* dtable is a dynamic table */
   nghttp3_ringbuf dtable;
@@ -166,12 +272,31 @@ typedef struct nghttp3_qpack_context {
   /* next_absidx is the next absolute index for nghttp3_qpack_entry.
      It is equivalent to insert count. */
   uint64_t next_absidx;
+  /* ring is the storage of dynamic table entries if ring.ents is not
+     NULL.  Otherwise, each entry is allocated separately. */
+  nghttp3_qpack_ring ring;
+#ifdef ENABLE_QPACK_STATS
+  /* stats is the compression statistics of the encoder or decoder
+     which owns this context. */
+  nghttp3_qpack_stats stats;
+#endif /* ENABLE_QPACK_STATS */
   /* If inflate/deflate error occurred, this value is set to 1 and
      further invocation of inflate/deflate will fail with
      NGHTTP3_ERR_QPACK_FATAL. */
   uint8_t bad;
 } nghttp3_qpack_context;
 
+/*
+ * NGHTTP3_QPACK_STAT_ADD adds |N| to the counter |FIELD| of
+ * nghttp3_qpack_stats in |CTX|.  If ENABLE_QPACK_STATS is not
+ * defined, only |CTX| is evaluated, and |N| is not.
+ */
+#ifdef ENABLE_QPACK_STATS
+#  define NGHTTP3_QPACK_STAT_ADD(CTX, FIELD, N) ((CTX)->stats.FIELD += (N))
+#else /* !ENABLE_QPACK_STATS */
+#  define NGHTTP3_QPACK_STAT_ADD(CTX, FIELD, N) ((void)(CTX))
+#endif /* !ENABLE_QPACK_STATS */
+
 typedef struct nghttp3_qpack_read_state {
   nghttp3_qpack_huffman_decode_context huffman_ctx;
   nghttp3_buf namebuf;
@@ -191,10 +316,46 @@ void nghttp3_qpack_read_state_free(nghttp3_qpack_read_state *rstate);
 
 void nghttp3_qpack_read_state_reset(nghttp3_qpack_read_state *rstate);
 
-#define NGHTTP3_QPACK_MAP_SIZE 64
+/*
+ * nghttp3_qpack_map_bucket is a slot of nghttp3_qpack_map_table.  The
+ * hash and the absolute index are stored inline so that probing does
+ * not have to touch nghttp3_qpack_entry unless the hash matches.
+ */
+typedef struct nghttp3_qpack_map_bucket {
+  /* ent is the dynamic table entry.  NULL if this bucket is empty. */
+  nghttp3_qpack_entry *ent;
+  /* absidx is the absolute index of ent. */
+  uint64_t absidx;
+  /* hash is the hash value of ent which is used as a key. */
+  uint32_t hash;
+} nghttp3_qpack_map_bucket;
 
+/*
+ * nghttp3_qpack_map_table is an open addressing hash table (Robin
+ * Hood hashing) of nghttp3_qpack_map_bucket.  It grows as the number
+ * of entries grows.
+ */
+typedef struct nghttp3_qpack_map_table {
+  nghttp3_qpack_map_bucket *table;
+  /* size is the number of buckets in use. */
+  size_t size;
+  uint32_t tablelen;
+  uint32_t tablelenbits;
+} nghttp3_qpack_map_table;
+
+/*
+ * nghttp3_qpack_map is an index of dynamic table entries used by
+ * encoder.
+ */
 typedef struct nghttp3_qpack_map {
-  nghttp3_qpack_entry *table[NGHTTP3_QPACK_MAP_SIZE];
+  /* nv_table contains all entries in dynamic table keyed by the hash
+     of name and value. */
+  nghttp3_qpack_map_table nv_table;
+  /* name_table contains the most recently inserted entry for each
+     name keyed by the hash of name.  Older entries which share the
+     same name are reachable via nghttp3_qpack_entry.name_prev. */
+  nghttp3_qpack_map_table name_table;
+  const nghttp3_mem *mem;
 } nghttp3_qpack_map;
 
 /* nghttp3_qpack_decoder_stream_state is a set of states when decoding
@@ -220,10 +381,24 @@ typedef enum nghttp3_qpack_decoder_stream_opcode {
    Set Dynamic Table Capacity is required. */
 #define NGHTTP3_QPACK_ENCODER_FLAG_PENDING_SET_DTABLE_CAP 0x01u
 
+/* NGHTTP3_QPACK_FREQ_DEPTH is the number of rows in the count-min
+   sketch used by NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY. */
+#define NGHTTP3_QPACK_FREQ_DEPTH 4
+/* NGHTTP3_QPACK_FREQ_WIDTHBITS is the number of bits to represent
+   the number of counters in a single row of the sketch. */
+#define NGHTTP3_QPACK_FREQ_WIDTHBITS 9
+/* NGHTTP3_QPACK_FREQ_WIDTH is the number of counters in a single row
+   of the sketch. */
+#define NGHTTP3_QPACK_FREQ_WIDTH (1u << NGHTTP3_QPACK_FREQ_WIDTHBITS)
+/* NGHTTP3_QPACK_FREQ_AGING_PERIOD is the number of increments after
+   which all counters in the sketch are halved so that the counts
+   follow the recent traffic. */
+#define NGHTTP3_QPACK_FREQ_AGING_PERIOD (8 * NGHTTP3_QPACK_FREQ_WIDTH)
+
 struct nghttp3_qpack_encoder {
   nghttp3_qpack_context ctx;
-  /* dtable_map is a map of hash to nghttp3_qpack_entry to provide
-     fast access to an entry in dynamic table. */
+  /* dtable_map is an index of nghttp3_qpack_entry to provide fast
+     access to an entry in dynamic table. */
   nghttp3_qpack_map dtable_map;
   /* streams is a map of stream ID to nghttp3_qpack_stream to keep
      track of unacknowledged streams. */
@@ -236,6 +411,11 @@ struct nghttp3_qpack_encoder {
      sorted by ascending order of min_cnt to know that an entry can be
      evicted from dynamic table.  */
   nghttp3_pq min_cnts;
+  /* ref_objalloc and stream_objalloc are the pools of
+     nghttp3_qpack_header_block_ref and nghttp3_qpack_stream
+     respectively. */
+  nghttp3_objalloc ref_objalloc;
+  nghttp3_objalloc stream_objalloc;
   /* krcnt is Known Received Count. */
   uint64_t krcnt;
   /* state is a current state of reading decoder stream. */
@@ -250,9 +430,20 @@ struct nghttp3_qpack_encoder {
   /* last_max_dtable_update is the dynamic table size last
      requested. */
   size_t last_max_dtable_update;
+  /* freq is a count-min sketch of NGHTTP3_QPACK_FREQ_DEPTH rows, each
+     of which has NGHTTP3_QPACK_FREQ_WIDTH counters, keyed by the hash
+     of header field name and value.  It is allocated on first use if
+     indexing_policy is NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY. */
+  uint8_t *freq;
+  /* freq_nincr is the number of increments made to freq since it was
+     aged last time. */
+  size_t freq_nincr;
   /* flags is bitwise OR of zero or more of
      NGHTTP3_QPACK_ENCODER_FLAG_*. */
   uint8_t flags;
+  /* indexing_policy is one of NGHTTP3_QPACK_INDEXING_POLICY_*, and
+     decides which header fields are inserted into dynamic table. */
+  uint8_t indexing_policy;
 };
 
 /*
@@ -276,6 +467,14 @@ int nghttp3_qpack_encoder_init(nghttp3_qpack_encoder *encoder,
  */
 void nghttp3_qpack_encoder_free(nghttp3_qpack_encoder *encoder);
 
+/*
+ * nghttp3_qpack_encoder_reset makes |encoder| the state right after
+ * nghttp3_qpack_encoder_init with the same hard_max_dtable_capacity.
+ * Dynamic table, nghttp3_qpack_ring if enabled, and the other
+ * memory which |encoder| has allocated are kept for reuse.
+ */
+void nghttp3_qpack_encoder_reset(nghttp3_qpack_encoder *encoder);
+
 /*
  * nghttp3_qpack_encoder_encode_nv encodes |nv|.  It writes request
  * stream into |rbuf| and writes encoder stream into |ebuf|.  |nv| is
@@ -320,14 +519,15 @@ nghttp3_qpack_lookup_stable(const nghttp3_nv *nv, int32_t token,
  * nghttp3_qpack_encoder_lookup_dtable searches |nv| in dynamic table.
  * |token| is a token of nv->name and it is -1 if there is no
  * corresponding token defined.  |hash| is a hash of nv->name.
- * |indexing_mode| provides indexing strategy.  |krcnt| is Known
- * Received Count.  |allow_blocking| is nonzero if this stream can be
- * blocked (or it has been blocked already).
+ * |nvhash| is a hash of nv->name and nv->value.  |indexing_mode|
+ * provides indexing strategy.  |krcnt| is Known Received Count.
+ * |allow_blocking| is nonzero if this stream can be blocked (or it
+ * has been blocked already).
  */
 nghttp3_qpack_lookup_result nghttp3_qpack_encoder_lookup_dtable(
     nghttp3_qpack_encoder *encoder, const nghttp3_nv *nv, int32_t token,
-    uint32_t hash, nghttp3_qpack_indexing_mode indexing_mode, uint64_t krcnt,
-    int allow_blocking);
+    uint32_t hash, uint32_t nvhash, nghttp3_qpack_indexing_mode indexing_mode,
+    uint64_t krcnt, int allow_blocking);
 
 /*
  * nghttp3_qpack_encoder_write_field_section_prefix writes Encoded
@@ -344,6 +544,28 @@ int nghttp3_qpack_encoder_write_field_section_prefix(
     nghttp3_qpack_encoder *encoder, nghttp3_buf *pbuf, uint64_t ricnt,
     uint64_t base);
 
+/*
+ * nghttp3_qpack_static_field_section_bound returns the maximum number
+ * of bytes which nghttp3_qpack_write_static_field_section writes for
+ * |nva| of length |nvlen|.
+ */
+size_t nghttp3_qpack_static_field_section_bound(const nghttp3_nv *nva,
+                                                size_t nvlen);
+
+/*
+ * nghttp3_qpack_write_static_field_section writes an encoded field
+ * section of |nva| of length |nvlen| to |p|, which only uses static
+ * table and literal representations so that any decoder can decode
+ * it without dynamic table.  The buffer pointed by |p| must have at
+ * least nghttp3_qpack_static_field_section_bound(nva, nvlen) bytes.
+ *
+ * This function returns the pointer to the one beyond the last byte
+ * written.
+ */
+uint8_t *nghttp3_qpack_write_static_field_section(uint8_t *p,
+                                                  const nghttp3_nv *nva,
+                                                  size_t nvlen);
+
 /*
  * nghttp3_qpack_encoder_write_static_indexed writes Indexed Header
  * Field to |rbuf|.  |absidx| is an absolute index into static table.
@@ -555,7 +777,7 @@ int nghttp3_qpack_encoder_write_set_dtable_cap(nghttp3_qpack_encoder *encoder,
 /*
  * nghttp3_qpack_context_dtable_add adds |qnv| to dynamic table.  If
  * |ctx| is a part of encoder, |dtable_map| is not NULL.  |hash| is a
- * hash value of name.
+ * hash value of name.  |nvhash| is a hash value of name and value.
  *
  * This function returns 0 if it succeeds, or one of the following
  * negative error codes:
@@ -566,12 +788,13 @@ int nghttp3_qpack_encoder_write_set_dtable_cap(nghttp3_qpack_encoder *encoder,
 int nghttp3_qpack_context_dtable_add(nghttp3_qpack_context *ctx,
                                      nghttp3_qpack_nv *qnv,
                                      nghttp3_qpack_map *dtable_map,
-                                     uint32_t hash);
+                                     uint32_t hash, uint32_t nvhash);
 
 /*
  * nghttp3_qpack_encoder_dtable_static_add adds |nv| to dynamic table
  * by referencing static table entry at an absolute index |absidx|.
- * The hash of name is given as |hash|.
+ * The hash of name is given as |hash|.  The hash of name and value is
+ * given as |nvhash|.
  *
  * This function returns 0 if it succeeds, or one of the following
  * negative error codes:
@@ -582,12 +805,13 @@ int nghttp3_qpack_context_dtable_add(nghttp3_qpack_context *ctx,
 int nghttp3_qpack_encoder_dtable_static_add(nghttp3_qpack_encoder *encoder,
                                             uint64_t absidx,
                                             const nghttp3_nv *nv,
-                                            uint32_t hash);
+                                            uint32_t hash, uint32_t nvhash);
 
 /*
  * nghttp3_qpack_encoder_dtable_dynamic_add adds |nv| to dynamic table
  * by referencing dynamic table entry at an absolute index |absidx|.
- * The hash of name is given as |hash|.
+ * The hash of name is given as |hash|.  The hash of name and value is
+ * given as |nvhash|.
  *
  * This function returns 0 if it succeeds, or one of the following
  * negative error codes:
@@ -598,7 +822,7 @@ int nghttp3_qpack_encoder_dtable_static_add(nghttp3_qpack_encoder *encoder,
 int nghttp3_qpack_encoder_dtable_dynamic_add(nghttp3_qpack_encoder *encoder,
                                              uint64_t absidx,
                                              const nghttp3_nv *nv,
-                                             uint32_t hash);
+                                             uint32_t hash, uint32_t nvhash);
 
 /*
  * nghttp3_qpack_encoder_dtable_duplicate_add duplicates dynamic table
@@ -616,13 +840,15 @@ int nghttp3_qpack_encoder_dtable_duplicate_add(nghttp3_qpack_encoder *encoder,
 /*
  * nghttp3_qpack_encoder_dtable_literal_add adds |nv| to dynamic
  * table.  |token| is a token of name and is -1 if it has no token
- * value defined.  |hash| is a hash of name.
+ * value defined.  |hash| is a hash of name.  |nvhash| is a hash of
+ * name and value.
  *
  * NGHTTP3_ERR_NOMEM Out of memory.
  */
 int nghttp3_qpack_encoder_dtable_literal_add(nghttp3_qpack_encoder *encoder,
                                              const nghttp3_nv *nv,
-                                             int32_t token, uint32_t hash);
+                                             int32_t token, uint32_t hash,
+                                             uint32_t nvhash);
 
 /*
  * `nghttp3_qpack_encoder_ack_header` tells |encoder| that header
@@ -682,11 +908,13 @@ nghttp3_qpack_context_dtable_top(nghttp3_qpack_context *ctx);
  * field.  |sum| is the sum of table space occupied by all entries
  * inserted so far.  It does not include this entry.  |absidx| is an
  * absolute index of this entry.  |hash| is a hash of header field
- * name.  This function increases reference count of qnv->nv.name and
+ * name.  |nvhash| is a hash of header field name and value.  This
+ * function increases reference count of qnv->nv.name and
  * qnv->nv.value.
  */
 void nghttp3_qpack_entry_init(nghttp3_qpack_entry *ent, nghttp3_qpack_nv *qnv,
-                              size_t sum, uint64_t absidx, uint32_t hash);
+                              size_t sum, uint64_t absidx, uint32_t hash,
+                              uint32_t nvhash);
 
 /*
  * nghttp3_qpack_entry_free frees memory allocated for |ent|.
@@ -748,6 +976,7 @@ typedef enum nghttp3_qpack_request_stream_state {
   NGHTTP3_QPACK_RS_STATE_READ_VALUELEN,
   NGHTTP3_QPACK_RS_STATE_READ_VALUE_HUFFMAN,
   NGHTTP3_QPACK_RS_STATE_READ_VALUE,
+  NGHTTP3_QPACK_RS_STATE_STREAM_VALUE,
   NGHTTP3_QPACK_RS_STATE_BLOCKED,
 } nghttp3_qpack_request_stream_state;
 
@@ -779,6 +1008,26 @@ struct nghttp3_qpack_decoder {
      unidirectional streams which potentially receives QPACK encoded
      HEADER frame. */
   size_t max_concurrent_streams;
+  /* borrow_literals, if nonzero, allows decoder to emit a string
+     literal which is not Huffman encoded as a view of the input
+     buffer rather than a copy of it.  See
+     nghttp3_qpack_decoder_set_borrow_literals. */
+  int borrow_literals;
+  /* value_chunk_size, if nonzero, is the maximum number of encoded
+     bytes in a fragment of a literal value which is emitted
+     incrementally.  Only the literal values which are longer than
+     this are emitted in fragments.  See
+     nghttp3_qpack_decoder_set_value_chunk_size. */
+  size_t value_chunk_size;
+  /* es_namebuf and es_valuebuf are the reusable buffers which store
+     a literal name and value on encoder stream respectively.  They
+     are only used if ctx.ring is not NULL. */
+  nghttp3_buf es_namebuf;
+  nghttp3_buf es_valuebuf;
+  /* es_name and es_value are borrowed nghttp3_rcbuf which refer to
+     es_namebuf and es_valuebuf respectively. */
+  nghttp3_rcbuf es_name;
+  nghttp3_rcbuf es_value;
 };
 
 /*
@@ -804,6 +1053,15 @@ int nghttp3_qpack_decoder_init(nghttp3_qpack_decoder *decoder,
  */
 void nghttp3_qpack_decoder_free(nghttp3_qpack_decoder *decoder);
 
+/*
+ * nghttp3_qpack_decoder_reset makes |decoder| the state right after
+ * nghttp3_qpack_decoder_init with the same hard_max_dtable_capacity
+ * and |max_blocked_streams|.  Like nghttp3_qpack_encoder_reset, the
+ * memory which |decoder| has allocated is kept for reuse.
+ */
+void nghttp3_qpack_decoder_reset(nghttp3_qpack_decoder *decoder,
+                                 size_t max_blocked_streams);
+
 /*
  * nghttp3_qpack_decoder_dtable_indexed_add adds entry received in
  * Insert With Name Reference to dynamic table.
@@ -895,6 +1153,15 @@ struct nghttp3_qpack_stream_context {
   uint64_t base;
   /* dbase_sign is the delta base sign in Header Block Prefix. */
   int dbase_sign;
+  /* name_view and value_view are borrowed nghttp3_rcbuf which refer to
+     a literal name and value in the input buffer respectively.  They
+     are used if decoder->borrow_literals is nonzero. */
+  nghttp3_rcbuf name_view;
+  nghttp3_rcbuf value_view;
+  /* chunkbuf stores a Huffman decoded fragment of a literal value
+     which is emitted incrementally.  It is kept across
+     nghttp3_qpack_stream_context_reset so that it can be reused. */
+  nghttp3_buf chunkbuf;
 };
 
 /*
@@ -978,6 +1245,21 @@ void nghttp3_qpack_decoder_emit_literal(nghttp3_qpack_decoder *decoder,
                                         nghttp3_qpack_stream_context *sctx,
                                         nghttp3_qpack_nv *nv);
 
+/*
+ * nghttp3_qpack_decoder_emit_value_begin assigns the name of the
+ * field, whose literal value is about to be emitted in fragments, to
+ * |nv|.  nv->value is set to NULL.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_QPACK_DECOMPRESSION_FAILED
+ *     The index of dynamic table entry is invalid.
+ */
+int nghttp3_qpack_decoder_emit_value_begin(nghttp3_qpack_decoder *decoder,
+                                           nghttp3_qpack_stream_context *sctx,
+                                           nghttp3_qpack_nv *nv);
+
 /*
  * nghttp3_qpack_decoder_write_section_ack writes Section
  * Acknowledgement to decoder stream.
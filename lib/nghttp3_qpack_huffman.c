@@ -30,17 +30,7 @@
 #include <stdio.h>
 
 #include "nghttp3_conv.h"
-
-size_t nghttp3_qpack_huffman_encode_count(const uint8_t *src, size_t len) {
-  size_t i;
-  size_t nbits = 0;
-
-  for (i = 0; i < len; ++i) {
-    nbits += huffman_sym_table[src[i]].nbits;
-  }
-  /* pad the prefix of EOS (256) */
-  return (nbits + 7) / 8;
-}
+#include "nghttp3_macro.h"
 
 uint8_t *nghttp3_qpack_huffman_encode(uint8_t *dest, const uint8_t *src,
                                       size_t srclen) {
@@ -77,9 +67,91 @@ uint8_t *nghttp3_qpack_huffman_encode(uint8_t *dest, const uint8_t *src,
   return dest;
 }
 
+uint8_t *nghttp3_qpack_huffman_encode_bounded(uint8_t *dest, size_t destlen,
+                                              const uint8_t *src, size_t srclen,
+                                              int early_abort) {
+  const nghttp3_qpack_huffman_sym *sym;
+  const uint8_t *begin = src, *end = src + srclen;
+  uint8_t *p = dest, *dend = dest + destlen;
+  uint64_t code = 0, x;
+  size_t nbits = 0;
+
+  for (; src != end;) {
+    sym = &huffman_sym_table[*src++];
+    code |= ((uint64_t)sym->code << 32) >> nbits;
+    if (nbits + sym->nbits < 64) {
+      nbits += sym->nbits;
+      continue;
+    }
+
+    if (dend - p < 8) {
+      return NULL;
+    }
+
+    x = nghttp3_htonl64(code);
+    memcpy(p, &x, 8);
+    p += 8;
+
+    /* nbits + sym->nbits >= 64 implies nbits > 0. */
+    code = ((uint64_t)sym->code << 32) << (64 - nbits);
+    nbits = nbits + sym->nbits - 64;
+
+    if (early_abort &&
+        (size_t)(p - dest) * 8 + nbits > (size_t)(src - begin) * 8) {
+      return NULL;
+    }
+  }
+
+  if ((size_t)(dend - p) < (nbits + 7) / 8) {
+    return NULL;
+  }
+
+  /* pad the prefix of EOS (256) */
+  code |= UINT64_MAX >> nbits;
+
+  for (; nbits >= 8; nbits -= 8) {
+    *p++ = (uint8_t)(code >> 56);
+    code <<= 8;
+  }
+
+  if (nbits) {
+    *p++ = (uint8_t)(code >> 56);
+  }
+
+  return p;
+}
+
 void nghttp3_qpack_huffman_decode_context_init(
     nghttp3_qpack_huffman_decode_context *ctx) {
-  ctx->fstate = NGHTTP3_QPACK_HUFFMAN_ACCEPTED;
+  ctx->bits = 0;
+  ctx->nbits = 0;
+  ctx->failed = 0;
+}
+
+/*
+ * huffman_decode_long decodes a code which is longer than
+ * NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS bits at the MSB of |bits|.
+ * |nbits| is the number of valid bits in |bits|.  It assigns the
+ * length of the code to |*plen|, and returns the decoded symbol,
+ * which might be EOS (256).  If |bits| does not contain a complete
+ * code, it returns -1.
+ */
+static int32_t huffman_decode_long(size_t *plen, uint64_t bits,
+                                   size_t nbits) {
+  const nghttp3_qpack_huffman_decode_length *l;
+  size_t len, maxlen = nghttp3_min(nbits, NGHTTP3_QPACK_HUFFMAN_MAX_NBITS);
+  uint32_t code;
+
+  for (len = NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS + 1; len <= maxlen; ++len) {
+    code = (uint32_t)(bits >> (64 - len));
+    l = &qpack_huffman_decode_lengths[len];
+    if (code < l->limit) {
+      *plen = len;
+      return qpack_huffman_decode_syms[l->offset + code - l->first];
+    }
+  }
+
+  return -1;
 }
 
 nghttp3_ssize
@@ -88,28 +160,100 @@ nghttp3_qpack_huffman_decode(nghttp3_qpack_huffman_decode_context *ctx,
                              int fin) {
   uint8_t *p = dest;
   const uint8_t *end = src + srclen;
-  nghttp3_qpack_huffman_decode_node node = {ctx->fstate, 0};
-  const nghttp3_qpack_huffman_decode_node *t = &node;
-  uint8_t c;
+  const nghttp3_qpack_huffman_decode_entry *ent;
+  uint64_t bits = ctx->bits, x;
+  size_t nbits = ctx->nbits;
+  size_t len;
+  int32_t sym;
 
-  /* We use the decoding algorithm described in
-     http://graphics.ics.uci.edu/pub/Prefix.pdf */
-  for (; src != end;) {
-    c = *src++;
-    t = &qpack_huffman_decode_table[t->fstate & 0x1ff][c >> 4];
-    if (t->fstate & NGHTTP3_QPACK_HUFFMAN_SYM) {
-      *p++ = t->sym;
+  if (ctx->failed) {
+    goto fail;
+  }
+
+  for (;;) {
+    if (end - src >= 8) {
+      /* The bits past nbits are filled with the next input, and they
+         are filled with the same bits again by the next refill. */
+      memcpy(&x, src, sizeof(x));
+      bits |= nghttp3_ntohl64(x) >> nbits;
+      src += (63 - nbits) >> 3;
+      nbits |= 56;
+    } else {
+      for (; nbits <= 56 && src != end; nbits += 8) {
+        bits |= (uint64_t)*src++ << (56 - nbits);
+      }
+
+      if (nbits < NGHTTP3_QPACK_HUFFMAN_MAX_NBITS) {
+        break;
+      }
     }
 
-    t = &qpack_huffman_decode_table[t->fstate & 0x1ff][c & 0xf];
-    if (t->fstate & NGHTTP3_QPACK_HUFFMAN_SYM) {
-      *p++ = t->sym;
+    /* bits contains at least one complete code. */
+    do {
+      ent =
+          &qpack_huffman_decode_table[bits >>
+                                      (64 - NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS)];
+      if (ent->nbits0) {
+        *p++ = ent->sym[0];
+        if (ent->nbits != ent->nbits0) {
+          *p++ = ent->sym[1];
+        }
+        len = ent->nbits;
+      } else {
+        sym = huffman_decode_long(&len, bits, nbits);
+        assert(sym != -1);
+        if (sym == 256) {
+          goto fail;
+        }
+        *p++ = (uint8_t)sym;
+      }
+
+      bits <<= len;
+      nbits -= len;
+    } while (nbits >= NGHTTP3_QPACK_HUFFMAN_MAX_NBITS);
+  }
+
+  /* All input has been consumed.  Decode the complete codes left in
+     bits. */
+  for (; nbits;) {
+    ent = &qpack_huffman_decode_table[bits >>
+                                      (64 - NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS)];
+    if (ent->nbits0) {
+      if (ent->nbits0 > nbits) {
+        break;
+      }
+      *p++ = ent->sym[0];
+      len = ent->nbits0;
+    } else {
+      sym = huffman_decode_long(&len, bits, nbits);
+      if (sym == -1) {
+        break;
+      }
+      if (sym == 256) {
+        goto fail;
+      }
+      *p++ = (uint8_t)sym;
     }
+
+    bits <<= len;
+    nbits -= len;
   }
 
-  ctx->fstate = t->fstate;
+  ctx->bits = bits;
+  ctx->nbits = (uint8_t)nbits;
+
+  /* The padding must be the most significant bits of EOS, and
+     strictly shorter than 8 bits. */
+  if (fin && (nbits > 7 || bits != ~(UINT64_MAX >> nbits))) {
+    return NGHTTP3_ERR_QPACK_FATAL;
+  }
+
+  return p - dest;
+
+fail:
+  ctx->failed = 1;
 
-  if (fin && !(ctx->fstate & NGHTTP3_QPACK_HUFFMAN_ACCEPTED)) {
+  if (fin) {
     return NGHTTP3_ERR_QPACK_FATAL;
   }
 
@@ -118,5 +262,5 @@ nghttp3_qpack_huffman_decode(nghttp3_qpack_huffman_decode_context *ctx,
 
 int nghttp3_qpack_huffman_decode_failure_state(
     nghttp3_qpack_huffman_decode_context *ctx) {
-  return ctx->fstate == 0x100;
+  return ctx->failed;
 }
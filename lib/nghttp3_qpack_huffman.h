@@ -41,38 +41,79 @@ typedef struct nghttp3_qpack_huffman_sym {
 
 extern const nghttp3_qpack_huffman_sym huffman_sym_table[];
 
-size_t nghttp3_qpack_huffman_encode_count(const uint8_t *src, size_t len);
-
 uint8_t *nghttp3_qpack_huffman_encode(uint8_t *dest, const uint8_t *src,
                                       size_t srclen);
 
-typedef enum nghttp3_qpack_huffman_decode_flag {
-  /* FSA accepts this state as the end of huffman encoding
-     sequence. */
-  NGHTTP3_QPACK_HUFFMAN_ACCEPTED = 1 << 14,
-  /* This state emits symbol */
-  NGHTTP3_QPACK_HUFFMAN_SYM = 1 << 15,
-} nghttp3_qpack_huffman_decode_flag;
-
-typedef struct nghttp3_qpack_huffman_decode_node {
-  /* fstate is the current huffman decoding state, which is actually
-     the node ID of internal huffman tree with
-     nghttp3_qpack_huffman_decode_flag OR-ed.  We have 257 leaf nodes,
-     but they are identical to root node other than emitting a symbol,
-     so we have 256 internal nodes [1..256], inclusive.  The node ID
-     256 is a special node and it is a terminal state that means
-     decoding failed. */
-  uint16_t fstate;
-  /* symbol if NGHTTP3_QPACK_HUFFMAN_SYM flag set */
-  uint8_t sym;
-} nghttp3_qpack_huffman_decode_node;
+/*
+ * nghttp3_qpack_huffman_encode_bounded huffman encodes |src| of
+ * length |srclen|, and writes the result to |dest|, which has
+ * |destlen| bytes available.  Unlike nghttp3_qpack_huffman_encode,
+ * the encoded length need not be known in advance; it gives up as
+ * soon as the result does not fit in |destlen| bytes.  If
+ * |early_abort| is nonzero, it also gives up once the encoded bits
+ * exceed the number of input bits consumed so far, which is the case
+ * for random looking tokens.  The check happens each time 64 bits are
+ * written, so the string is at least 8 bytes long when it fires.
+ *
+ * This function returns the pointer to the one beyond the last byte
+ * written, or NULL if it gives up.  The content of |dest| is
+ * undefined in the latter case.
+ */
+uint8_t *nghttp3_qpack_huffman_encode_bounded(uint8_t *dest, size_t destlen,
+                                              const uint8_t *src, size_t srclen,
+                                              int early_abort);
+
+/* NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS is the number of input bits which
+   are looked up in qpack_huffman_decode_table at once. */
+#define NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS 12
+/* NGHTTP3_QPACK_HUFFMAN_MAX_NBITS is the length of the longest
+   Huffman code. */
+#define NGHTTP3_QPACK_HUFFMAN_MAX_NBITS 30
+
+typedef struct nghttp3_qpack_huffman_decode_entry {
+  /* sym contains the decoded symbols.  sym[1] is valid only if nbits
+     != nbits0. */
+  uint8_t sym[2];
+  /* nbits0 is the length of the code of sym[0].  It is 0 if the code
+     is longer than NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS. */
+  uint8_t nbits0;
+  /* nbits is the number of bits consumed by all decoded symbols. */
+  uint8_t nbits;
+} nghttp3_qpack_huffman_decode_entry;
+
+typedef struct nghttp3_qpack_huffman_decode_length {
+  /* first is the first code of this length. */
+  uint32_t first;
+  /* limit is the last code of this length plus 1. */
+  uint32_t limit;
+  /* offset is the index of qpack_huffman_decode_syms which
+     corresponds to first. */
+  uint16_t offset;
+} nghttp3_qpack_huffman_decode_length;
 
 typedef struct nghttp3_qpack_huffman_decode_context {
-  /* fstate is the current huffman decoding state. */
-  uint16_t fstate;
+  /* bits contains the input bits which have not been decoded yet.
+     They are aligned to MSB, and the unused bits are 0. */
+  uint64_t bits;
+  /* nbits is the number of bits in bits. */
+  uint8_t nbits;
+  /* failed is nonzero if EOS has been decoded. */
+  uint8_t failed;
 } nghttp3_qpack_huffman_decode_context;
 
-extern const nghttp3_qpack_huffman_decode_node qpack_huffman_decode_table[][16];
+/* qpack_huffman_decode_table is indexed by the next
+   NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS bits of input. */
+extern const nghttp3_qpack_huffman_decode_entry qpack_huffman_decode_table[];
+
+/* qpack_huffman_decode_lengths is indexed by the length of code, and
+   used to decode the code which is longer than
+   NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS. */
+extern const nghttp3_qpack_huffman_decode_length
+    qpack_huffman_decode_lengths[];
+
+/* qpack_huffman_decode_syms contains all symbols including EOS in
+   ascending order of their codes. */
+extern const uint16_t qpack_huffman_decode_syms[];
 
 void nghttp3_qpack_huffman_decode_context_init(
     nghttp3_qpack_huffman_decode_context *ctx);
@@ -85,7 +126,9 @@ void nghttp3_qpack_huffman_decode_context_init(
  * substring.  |fin| must be nonzero if |src| contains the last chunk
  * of huffman string.  The decoded string is written to the buffer
  * pointed by |dest|.  This function assumes that the buffer pointed
- * by |dest| contains enough memory to store decoded byte string.
+ * by |dest| contains enough memory to store decoded byte string.  A
+ * code which spans chunks is kept in |ctx|, and the symbol is
+ * written when the rest of the code is fed.
  *
  * This function returns the number of bytes written to |dest|, or one
  * of the following negative error codes:
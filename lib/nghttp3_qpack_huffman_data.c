@@ -36,29 +36,29 @@ const nghttp3_qpack_huffman_sym huffman_sym_table[] = {
     {28, 0xffffff10u}, {28, 0xffffff20u}, {30, 0xfffffff8u}, {28, 0xffffff30u},
     {28, 0xffffff40u}, {28, 0xffffff50u}, {28, 0xffffff60u}, {28, 0xffffff70u},
     {28, 0xffffff80u}, {28, 0xffffff90u}, {28, 0xffffffa0u}, {28, 0xffffffb0u},
-    {6, 0x50000000u},  {10, 0xfe000000u}, {10, 0xfe400000u}, {12, 0xffa00000u},
-    {13, 0xffc80000u}, {6, 0x54000000u},  {8, 0xf8000000u},  {11, 0xff400000u},
-    {10, 0xfe800000u}, {10, 0xfec00000u}, {8, 0xf9000000u},  {11, 0xff600000u},
-    {8, 0xfa000000u},  {6, 0x58000000u},  {6, 0x5c000000u},  {6, 0x60000000u},
-    {5, 0x0u},         {5, 0x8000000u},   {5, 0x10000000u},  {6, 0x64000000u},
-    {6, 0x68000000u},  {6, 0x6c000000u},  {6, 0x70000000u},  {6, 0x74000000u},
-    {6, 0x78000000u},  {6, 0x7c000000u},  {7, 0xb8000000u},  {8, 0xfb000000u},
-    {15, 0xfff80000u}, {6, 0x80000000u},  {12, 0xffb00000u}, {10, 0xff000000u},
-    {13, 0xffd00000u}, {6, 0x84000000u},  {7, 0xba000000u},  {7, 0xbc000000u},
-    {7, 0xbe000000u},  {7, 0xc0000000u},  {7, 0xc2000000u},  {7, 0xc4000000u},
-    {7, 0xc6000000u},  {7, 0xc8000000u},  {7, 0xca000000u},  {7, 0xcc000000u},
-    {7, 0xce000000u},  {7, 0xd0000000u},  {7, 0xd2000000u},  {7, 0xd4000000u},
-    {7, 0xd6000000u},  {7, 0xd8000000u},  {7, 0xda000000u},  {7, 0xdc000000u},
-    {7, 0xde000000u},  {7, 0xe0000000u},  {7, 0xe2000000u},  {7, 0xe4000000u},
-    {8, 0xfc000000u},  {7, 0xe6000000u},  {8, 0xfd000000u},  {13, 0xffd80000u},
+    {6, 0x50000000u}, {10, 0xfe000000u}, {10, 0xfe400000u}, {12, 0xffa00000u},
+    {13, 0xffc80000u}, {6, 0x54000000u}, {8, 0xf8000000u}, {11, 0xff400000u},
+    {10, 0xfe800000u}, {10, 0xfec00000u}, {8, 0xf9000000u}, {11, 0xff600000u},
+    {8, 0xfa000000u}, {6, 0x58000000u}, {6, 0x5c000000u}, {6, 0x60000000u},
+    {5, 0x0u}, {5, 0x8000000u}, {5, 0x10000000u}, {6, 0x64000000u},
+    {6, 0x68000000u}, {6, 0x6c000000u}, {6, 0x70000000u}, {6, 0x74000000u},
+    {6, 0x78000000u}, {6, 0x7c000000u}, {7, 0xb8000000u}, {8, 0xfb000000u},
+    {15, 0xfff80000u}, {6, 0x80000000u}, {12, 0xffb00000u}, {10, 0xff000000u},
+    {13, 0xffd00000u}, {6, 0x84000000u}, {7, 0xba000000u}, {7, 0xbc000000u},
+    {7, 0xbe000000u}, {7, 0xc0000000u}, {7, 0xc2000000u}, {7, 0xc4000000u},
+    {7, 0xc6000000u}, {7, 0xc8000000u}, {7, 0xca000000u}, {7, 0xcc000000u},
+    {7, 0xce000000u}, {7, 0xd0000000u}, {7, 0xd2000000u}, {7, 0xd4000000u},
+    {7, 0xd6000000u}, {7, 0xd8000000u}, {7, 0xda000000u}, {7, 0xdc000000u},
+    {7, 0xde000000u}, {7, 0xe0000000u}, {7, 0xe2000000u}, {7, 0xe4000000u},
+    {8, 0xfc000000u}, {7, 0xe6000000u}, {8, 0xfd000000u}, {13, 0xffd80000u},
     {19, 0xfffe0000u}, {13, 0xffe00000u}, {14, 0xfff00000u}, {6, 0x88000000u},
-    {15, 0xfffa0000u}, {5, 0x18000000u},  {6, 0x8c000000u},  {5, 0x20000000u},
-    {6, 0x90000000u},  {5, 0x28000000u},  {6, 0x94000000u},  {6, 0x98000000u},
-    {6, 0x9c000000u},  {5, 0x30000000u},  {7, 0xe8000000u},  {7, 0xea000000u},
-    {6, 0xa0000000u},  {6, 0xa4000000u},  {6, 0xa8000000u},  {5, 0x38000000u},
-    {6, 0xac000000u},  {7, 0xec000000u},  {6, 0xb0000000u},  {5, 0x40000000u},
-    {5, 0x48000000u},  {6, 0xb4000000u},  {7, 0xee000000u},  {7, 0xf0000000u},
-    {7, 0xf2000000u},  {7, 0xf4000000u},  {7, 0xf6000000u},  {15, 0xfffc0000u},
+    {15, 0xfffa0000u}, {5, 0x18000000u}, {6, 0x8c000000u}, {5, 0x20000000u},
+    {6, 0x90000000u}, {5, 0x28000000u}, {6, 0x94000000u}, {6, 0x98000000u},
+    {6, 0x9c000000u}, {5, 0x30000000u}, {7, 0xe8000000u}, {7, 0xea000000u},
+    {6, 0xa0000000u}, {6, 0xa4000000u}, {6, 0xa8000000u}, {5, 0x38000000u},
+    {6, 0xac000000u}, {7, 0xec000000u}, {6, 0xb0000000u}, {5, 0x40000000u},
+    {5, 0x48000000u}, {6, 0xb4000000u}, {7, 0xee000000u}, {7, 0xf0000000u},
+    {7, 0xf2000000u}, {7, 0xf4000000u}, {7, 0xf6000000u}, {15, 0xfffc0000u},
     {11, 0xff800000u}, {14, 0xfff40000u}, {13, 0xffe80000u}, {28, 0xffffffc0u},
     {20, 0xfffe6000u}, {22, 0xffff4800u}, {20, 0xfffe7000u}, {20, 0xfffe8000u},
     {22, 0xffff4c00u}, {22, 0xffff5000u}, {22, 0xffff5400u}, {23, 0xffffb200u},
@@ -92,4890 +92,1216 @@ const nghttp3_qpack_huffman_sym huffman_sym_table[] = {
     {27, 0xfffffce0u}, {27, 0xfffffd00u}, {27, 0xfffffd20u}, {27, 0xfffffd40u},
     {27, 0xfffffd60u}, {28, 0xffffffe0u}, {27, 0xfffffd80u}, {27, 0xfffffda0u},
     {27, 0xfffffdc0u}, {27, 0xfffffde0u}, {27, 0xfffffe00u}, {26, 0xfffffb80u},
-    {30, 0xfffffffcu}};
+    {30, 0xfffffffcu}
+};
+
+const nghttp3_qpack_huffman_decode_entry qpack_huffman_decode_table[] = {
+    {{48, 48}, 5, 10}, {{48, 48}, 5, 10}, {{48, 48}, 5, 10}, {{48, 48}, 5, 10},
+    {{48, 49}, 5, 10}, {{48, 49}, 5, 10}, {{48, 49}, 5, 10}, {{48, 49}, 5, 10},
+    {{48, 50}, 5, 10}, {{48, 50}, 5, 10}, {{48, 50}, 5, 10}, {{48, 50}, 5, 10},
+    {{48, 97}, 5, 10}, {{48, 97}, 5, 10}, {{48, 97}, 5, 10}, {{48, 97}, 5, 10},
+    {{48, 99}, 5, 10}, {{48, 99}, 5, 10}, {{48, 99}, 5, 10}, {{48, 99}, 5, 10},
+    {{48, 101}, 5, 10}, {{48, 101}, 5, 10}, {{48, 101}, 5, 10},
+    {{48, 101}, 5, 10}, {{48, 105}, 5, 10}, {{48, 105}, 5, 10},
+    {{48, 105}, 5, 10}, {{48, 105}, 5, 10}, {{48, 111}, 5, 10},
+    {{48, 111}, 5, 10}, {{48, 111}, 5, 10}, {{48, 111}, 5, 10},
+    {{48, 115}, 5, 10}, {{48, 115}, 5, 10}, {{48, 115}, 5, 10},
+    {{48, 115}, 5, 10}, {{48, 116}, 5, 10}, {{48, 116}, 5, 10},
+    {{48, 116}, 5, 10}, {{48, 116}, 5, 10}, {{48, 32}, 5, 11},
+    {{48, 32}, 5, 11}, {{48, 37}, 5, 11}, {{48, 37}, 5, 11}, {{48, 45}, 5, 11},
+    {{48, 45}, 5, 11}, {{48, 46}, 5, 11}, {{48, 46}, 5, 11}, {{48, 47}, 5, 11},
+    {{48, 47}, 5, 11}, {{48, 51}, 5, 11}, {{48, 51}, 5, 11}, {{48, 52}, 5, 11},
+    {{48, 52}, 5, 11}, {{48, 53}, 5, 11}, {{48, 53}, 5, 11}, {{48, 54}, 5, 11},
+    {{48, 54}, 5, 11}, {{48, 55}, 5, 11}, {{48, 55}, 5, 11}, {{48, 56}, 5, 11},
+    {{48, 56}, 5, 11}, {{48, 57}, 5, 11}, {{48, 57}, 5, 11}, {{48, 61}, 5, 11},
+    {{48, 61}, 5, 11}, {{48, 65}, 5, 11}, {{48, 65}, 5, 11}, {{48, 95}, 5, 11},
+    {{48, 95}, 5, 11}, {{48, 98}, 5, 11}, {{48, 98}, 5, 11}, {{48, 100}, 5, 11},
+    {{48, 100}, 5, 11}, {{48, 102}, 5, 11}, {{48, 102}, 5, 11},
+    {{48, 103}, 5, 11}, {{48, 103}, 5, 11}, {{48, 104}, 5, 11},
+    {{48, 104}, 5, 11}, {{48, 108}, 5, 11}, {{48, 108}, 5, 11},
+    {{48, 109}, 5, 11}, {{48, 109}, 5, 11}, {{48, 110}, 5, 11},
+    {{48, 110}, 5, 11}, {{48, 112}, 5, 11}, {{48, 112}, 5, 11},
+    {{48, 114}, 5, 11}, {{48, 114}, 5, 11}, {{48, 117}, 5, 11},
+    {{48, 117}, 5, 11}, {{48, 58}, 5, 12}, {{48, 66}, 5, 12}, {{48, 67}, 5, 12},
+    {{48, 68}, 5, 12}, {{48, 69}, 5, 12}, {{48, 70}, 5, 12}, {{48, 71}, 5, 12},
+    {{48, 72}, 5, 12}, {{48, 73}, 5, 12}, {{48, 74}, 5, 12}, {{48, 75}, 5, 12},
+    {{48, 76}, 5, 12}, {{48, 77}, 5, 12}, {{48, 78}, 5, 12}, {{48, 79}, 5, 12},
+    {{48, 80}, 5, 12}, {{48, 81}, 5, 12}, {{48, 82}, 5, 12}, {{48, 83}, 5, 12},
+    {{48, 84}, 5, 12}, {{48, 85}, 5, 12}, {{48, 86}, 5, 12}, {{48, 87}, 5, 12},
+    {{48, 89}, 5, 12}, {{48, 106}, 5, 12}, {{48, 107}, 5, 12},
+    {{48, 113}, 5, 12}, {{48, 118}, 5, 12}, {{48, 119}, 5, 12},
+    {{48, 120}, 5, 12}, {{48, 121}, 5, 12}, {{48, 122}, 5, 12}, {{48, 0}, 5, 5},
+    {{48, 0}, 5, 5}, {{48, 0}, 5, 5}, {{48, 0}, 5, 5}, {{49, 48}, 5, 10},
+    {{49, 48}, 5, 10}, {{49, 48}, 5, 10}, {{49, 48}, 5, 10}, {{49, 49}, 5, 10},
+    {{49, 49}, 5, 10}, {{49, 49}, 5, 10}, {{49, 49}, 5, 10}, {{49, 50}, 5, 10},
+    {{49, 50}, 5, 10}, {{49, 50}, 5, 10}, {{49, 50}, 5, 10}, {{49, 97}, 5, 10},
+    {{49, 97}, 5, 10}, {{49, 97}, 5, 10}, {{49, 97}, 5, 10}, {{49, 99}, 5, 10},
+    {{49, 99}, 5, 10}, {{49, 99}, 5, 10}, {{49, 99}, 5, 10}, {{49, 101}, 5, 10},
+    {{49, 101}, 5, 10}, {{49, 101}, 5, 10}, {{49, 101}, 5, 10},
+    {{49, 105}, 5, 10}, {{49, 105}, 5, 10}, {{49, 105}, 5, 10},
+    {{49, 105}, 5, 10}, {{49, 111}, 5, 10}, {{49, 111}, 5, 10},
+    {{49, 111}, 5, 10}, {{49, 111}, 5, 10}, {{49, 115}, 5, 10},
+    {{49, 115}, 5, 10}, {{49, 115}, 5, 10}, {{49, 115}, 5, 10},
+    {{49, 116}, 5, 10}, {{49, 116}, 5, 10}, {{49, 116}, 5, 10},
+    {{49, 116}, 5, 10}, {{49, 32}, 5, 11}, {{49, 32}, 5, 11}, {{49, 37}, 5, 11},
+    {{49, 37}, 5, 11}, {{49, 45}, 5, 11}, {{49, 45}, 5, 11}, {{49, 46}, 5, 11},
+    {{49, 46}, 5, 11}, {{49, 47}, 5, 11}, {{49, 47}, 5, 11}, {{49, 51}, 5, 11},
+    {{49, 51}, 5, 11}, {{49, 52}, 5, 11}, {{49, 52}, 5, 11}, {{49, 53}, 5, 11},
+    {{49, 53}, 5, 11}, {{49, 54}, 5, 11}, {{49, 54}, 5, 11}, {{49, 55}, 5, 11},
+    {{49, 55}, 5, 11}, {{49, 56}, 5, 11}, {{49, 56}, 5, 11}, {{49, 57}, 5, 11},
+    {{49, 57}, 5, 11}, {{49, 61}, 5, 11}, {{49, 61}, 5, 11}, {{49, 65}, 5, 11},
+    {{49, 65}, 5, 11}, {{49, 95}, 5, 11}, {{49, 95}, 5, 11}, {{49, 98}, 5, 11},
+    {{49, 98}, 5, 11}, {{49, 100}, 5, 11}, {{49, 100}, 5, 11},
+    {{49, 102}, 5, 11}, {{49, 102}, 5, 11}, {{49, 103}, 5, 11},
+    {{49, 103}, 5, 11}, {{49, 104}, 5, 11}, {{49, 104}, 5, 11},
+    {{49, 108}, 5, 11}, {{49, 108}, 5, 11}, {{49, 109}, 5, 11},
+    {{49, 109}, 5, 11}, {{49, 110}, 5, 11}, {{49, 110}, 5, 11},
+    {{49, 112}, 5, 11}, {{49, 112}, 5, 11}, {{49, 114}, 5, 11},
+    {{49, 114}, 5, 11}, {{49, 117}, 5, 11}, {{49, 117}, 5, 11},
+    {{49, 58}, 5, 12}, {{49, 66}, 5, 12}, {{49, 67}, 5, 12}, {{49, 68}, 5, 12},
+    {{49, 69}, 5, 12}, {{49, 70}, 5, 12}, {{49, 71}, 5, 12}, {{49, 72}, 5, 12},
+    {{49, 73}, 5, 12}, {{49, 74}, 5, 12}, {{49, 75}, 5, 12}, {{49, 76}, 5, 12},
+    {{49, 77}, 5, 12}, {{49, 78}, 5, 12}, {{49, 79}, 5, 12}, {{49, 80}, 5, 12},
+    {{49, 81}, 5, 12}, {{49, 82}, 5, 12}, {{49, 83}, 5, 12}, {{49, 84}, 5, 12},
+    {{49, 85}, 5, 12}, {{49, 86}, 5, 12}, {{49, 87}, 5, 12}, {{49, 89}, 5, 12},
+    {{49, 106}, 5, 12}, {{49, 107}, 5, 12}, {{49, 113}, 5, 12},
+    {{49, 118}, 5, 12}, {{49, 119}, 5, 12}, {{49, 120}, 5, 12},
+    {{49, 121}, 5, 12}, {{49, 122}, 5, 12}, {{49, 0}, 5, 5}, {{49, 0}, 5, 5},
+    {{49, 0}, 5, 5}, {{49, 0}, 5, 5}, {{50, 48}, 5, 10}, {{50, 48}, 5, 10},
+    {{50, 48}, 5, 10}, {{50, 48}, 5, 10}, {{50, 49}, 5, 10}, {{50, 49}, 5, 10},
+    {{50, 49}, 5, 10}, {{50, 49}, 5, 10}, {{50, 50}, 5, 10}, {{50, 50}, 5, 10},
+    {{50, 50}, 5, 10}, {{50, 50}, 5, 10}, {{50, 97}, 5, 10}, {{50, 97}, 5, 10},
+    {{50, 97}, 5, 10}, {{50, 97}, 5, 10}, {{50, 99}, 5, 10}, {{50, 99}, 5, 10},
+    {{50, 99}, 5, 10}, {{50, 99}, 5, 10}, {{50, 101}, 5, 10},
+    {{50, 101}, 5, 10}, {{50, 101}, 5, 10}, {{50, 101}, 5, 10},
+    {{50, 105}, 5, 10}, {{50, 105}, 5, 10}, {{50, 105}, 5, 10},
+    {{50, 105}, 5, 10}, {{50, 111}, 5, 10}, {{50, 111}, 5, 10},
+    {{50, 111}, 5, 10}, {{50, 111}, 5, 10}, {{50, 115}, 5, 10},
+    {{50, 115}, 5, 10}, {{50, 115}, 5, 10}, {{50, 115}, 5, 10},
+    {{50, 116}, 5, 10}, {{50, 116}, 5, 10}, {{50, 116}, 5, 10},
+    {{50, 116}, 5, 10}, {{50, 32}, 5, 11}, {{50, 32}, 5, 11}, {{50, 37}, 5, 11},
+    {{50, 37}, 5, 11}, {{50, 45}, 5, 11}, {{50, 45}, 5, 11}, {{50, 46}, 5, 11},
+    {{50, 46}, 5, 11}, {{50, 47}, 5, 11}, {{50, 47}, 5, 11}, {{50, 51}, 5, 11},
+    {{50, 51}, 5, 11}, {{50, 52}, 5, 11}, {{50, 52}, 5, 11}, {{50, 53}, 5, 11},
+    {{50, 53}, 5, 11}, {{50, 54}, 5, 11}, {{50, 54}, 5, 11}, {{50, 55}, 5, 11},
+    {{50, 55}, 5, 11}, {{50, 56}, 5, 11}, {{50, 56}, 5, 11}, {{50, 57}, 5, 11},
+    {{50, 57}, 5, 11}, {{50, 61}, 5, 11}, {{50, 61}, 5, 11}, {{50, 65}, 5, 11},
+    {{50, 65}, 5, 11}, {{50, 95}, 5, 11}, {{50, 95}, 5, 11}, {{50, 98}, 5, 11},
+    {{50, 98}, 5, 11}, {{50, 100}, 5, 11}, {{50, 100}, 5, 11},
+    {{50, 102}, 5, 11}, {{50, 102}, 5, 11}, {{50, 103}, 5, 11},
+    {{50, 103}, 5, 11}, {{50, 104}, 5, 11}, {{50, 104}, 5, 11},
+    {{50, 108}, 5, 11}, {{50, 108}, 5, 11}, {{50, 109}, 5, 11},
+    {{50, 109}, 5, 11}, {{50, 110}, 5, 11}, {{50, 110}, 5, 11},
+    {{50, 112}, 5, 11}, {{50, 112}, 5, 11}, {{50, 114}, 5, 11},
+    {{50, 114}, 5, 11}, {{50, 117}, 5, 11}, {{50, 117}, 5, 11},
+    {{50, 58}, 5, 12}, {{50, 66}, 5, 12}, {{50, 67}, 5, 12}, {{50, 68}, 5, 12},
+    {{50, 69}, 5, 12}, {{50, 70}, 5, 12}, {{50, 71}, 5, 12}, {{50, 72}, 5, 12},
+    {{50, 73}, 5, 12}, {{50, 74}, 5, 12}, {{50, 75}, 5, 12}, {{50, 76}, 5, 12},
+    {{50, 77}, 5, 12}, {{50, 78}, 5, 12}, {{50, 79}, 5, 12}, {{50, 80}, 5, 12},
+    {{50, 81}, 5, 12}, {{50, 82}, 5, 12}, {{50, 83}, 5, 12}, {{50, 84}, 5, 12},
+    {{50, 85}, 5, 12}, {{50, 86}, 5, 12}, {{50, 87}, 5, 12}, {{50, 89}, 5, 12},
+    {{50, 106}, 5, 12}, {{50, 107}, 5, 12}, {{50, 113}, 5, 12},
+    {{50, 118}, 5, 12}, {{50, 119}, 5, 12}, {{50, 120}, 5, 12},
+    {{50, 121}, 5, 12}, {{50, 122}, 5, 12}, {{50, 0}, 5, 5}, {{50, 0}, 5, 5},
+    {{50, 0}, 5, 5}, {{50, 0}, 5, 5}, {{97, 48}, 5, 10}, {{97, 48}, 5, 10},
+    {{97, 48}, 5, 10}, {{97, 48}, 5, 10}, {{97, 49}, 5, 10}, {{97, 49}, 5, 10},
+    {{97, 49}, 5, 10}, {{97, 49}, 5, 10}, {{97, 50}, 5, 10}, {{97, 50}, 5, 10},
+    {{97, 50}, 5, 10}, {{97, 50}, 5, 10}, {{97, 97}, 5, 10}, {{97, 97}, 5, 10},
+    {{97, 97}, 5, 10}, {{97, 97}, 5, 10}, {{97, 99}, 5, 10}, {{97, 99}, 5, 10},
+    {{97, 99}, 5, 10}, {{97, 99}, 5, 10}, {{97, 101}, 5, 10},
+    {{97, 101}, 5, 10}, {{97, 101}, 5, 10}, {{97, 101}, 5, 10},
+    {{97, 105}, 5, 10}, {{97, 105}, 5, 10}, {{97, 105}, 5, 10},
+    {{97, 105}, 5, 10}, {{97, 111}, 5, 10}, {{97, 111}, 5, 10},
+    {{97, 111}, 5, 10}, {{97, 111}, 5, 10}, {{97, 115}, 5, 10},
+    {{97, 115}, 5, 10}, {{97, 115}, 5, 10}, {{97, 115}, 5, 10},
+    {{97, 116}, 5, 10}, {{97, 116}, 5, 10}, {{97, 116}, 5, 10},
+    {{97, 116}, 5, 10}, {{97, 32}, 5, 11}, {{97, 32}, 5, 11}, {{97, 37}, 5, 11},
+    {{97, 37}, 5, 11}, {{97, 45}, 5, 11}, {{97, 45}, 5, 11}, {{97, 46}, 5, 11},
+    {{97, 46}, 5, 11}, {{97, 47}, 5, 11}, {{97, 47}, 5, 11}, {{97, 51}, 5, 11},
+    {{97, 51}, 5, 11}, {{97, 52}, 5, 11}, {{97, 52}, 5, 11}, {{97, 53}, 5, 11},
+    {{97, 53}, 5, 11}, {{97, 54}, 5, 11}, {{97, 54}, 5, 11}, {{97, 55}, 5, 11},
+    {{97, 55}, 5, 11}, {{97, 56}, 5, 11}, {{97, 56}, 5, 11}, {{97, 57}, 5, 11},
+    {{97, 57}, 5, 11}, {{97, 61}, 5, 11}, {{97, 61}, 5, 11}, {{97, 65}, 5, 11},
+    {{97, 65}, 5, 11}, {{97, 95}, 5, 11}, {{97, 95}, 5, 11}, {{97, 98}, 5, 11},
+    {{97, 98}, 5, 11}, {{97, 100}, 5, 11}, {{97, 100}, 5, 11},
+    {{97, 102}, 5, 11}, {{97, 102}, 5, 11}, {{97, 103}, 5, 11},
+    {{97, 103}, 5, 11}, {{97, 104}, 5, 11}, {{97, 104}, 5, 11},
+    {{97, 108}, 5, 11}, {{97, 108}, 5, 11}, {{97, 109}, 5, 11},
+    {{97, 109}, 5, 11}, {{97, 110}, 5, 11}, {{97, 110}, 5, 11},
+    {{97, 112}, 5, 11}, {{97, 112}, 5, 11}, {{97, 114}, 5, 11},
+    {{97, 114}, 5, 11}, {{97, 117}, 5, 11}, {{97, 117}, 5, 11},
+    {{97, 58}, 5, 12}, {{97, 66}, 5, 12}, {{97, 67}, 5, 12}, {{97, 68}, 5, 12},
+    {{97, 69}, 5, 12}, {{97, 70}, 5, 12}, {{97, 71}, 5, 12}, {{97, 72}, 5, 12},
+    {{97, 73}, 5, 12}, {{97, 74}, 5, 12}, {{97, 75}, 5, 12}, {{97, 76}, 5, 12},
+    {{97, 77}, 5, 12}, {{97, 78}, 5, 12}, {{97, 79}, 5, 12}, {{97, 80}, 5, 12},
+    {{97, 81}, 5, 12}, {{97, 82}, 5, 12}, {{97, 83}, 5, 12}, {{97, 84}, 5, 12},
+    {{97, 85}, 5, 12}, {{97, 86}, 5, 12}, {{97, 87}, 5, 12}, {{97, 89}, 5, 12},
+    {{97, 106}, 5, 12}, {{97, 107}, 5, 12}, {{97, 113}, 5, 12},
+    {{97, 118}, 5, 12}, {{97, 119}, 5, 12}, {{97, 120}, 5, 12},
+    {{97, 121}, 5, 12}, {{97, 122}, 5, 12}, {{97, 0}, 5, 5}, {{97, 0}, 5, 5},
+    {{97, 0}, 5, 5}, {{97, 0}, 5, 5}, {{99, 48}, 5, 10}, {{99, 48}, 5, 10},
+    {{99, 48}, 5, 10}, {{99, 48}, 5, 10}, {{99, 49}, 5, 10}, {{99, 49}, 5, 10},
+    {{99, 49}, 5, 10}, {{99, 49}, 5, 10}, {{99, 50}, 5, 10}, {{99, 50}, 5, 10},
+    {{99, 50}, 5, 10}, {{99, 50}, 5, 10}, {{99, 97}, 5, 10}, {{99, 97}, 5, 10},
+    {{99, 97}, 5, 10}, {{99, 97}, 5, 10}, {{99, 99}, 5, 10}, {{99, 99}, 5, 10},
+    {{99, 99}, 5, 10}, {{99, 99}, 5, 10}, {{99, 101}, 5, 10},
+    {{99, 101}, 5, 10}, {{99, 101}, 5, 10}, {{99, 101}, 5, 10},
+    {{99, 105}, 5, 10}, {{99, 105}, 5, 10}, {{99, 105}, 5, 10},
+    {{99, 105}, 5, 10}, {{99, 111}, 5, 10}, {{99, 111}, 5, 10},
+    {{99, 111}, 5, 10}, {{99, 111}, 5, 10}, {{99, 115}, 5, 10},
+    {{99, 115}, 5, 10}, {{99, 115}, 5, 10}, {{99, 115}, 5, 10},
+    {{99, 116}, 5, 10}, {{99, 116}, 5, 10}, {{99, 116}, 5, 10},
+    {{99, 116}, 5, 10}, {{99, 32}, 5, 11}, {{99, 32}, 5, 11}, {{99, 37}, 5, 11},
+    {{99, 37}, 5, 11}, {{99, 45}, 5, 11}, {{99, 45}, 5, 11}, {{99, 46}, 5, 11},
+    {{99, 46}, 5, 11}, {{99, 47}, 5, 11}, {{99, 47}, 5, 11}, {{99, 51}, 5, 11},
+    {{99, 51}, 5, 11}, {{99, 52}, 5, 11}, {{99, 52}, 5, 11}, {{99, 53}, 5, 11},
+    {{99, 53}, 5, 11}, {{99, 54}, 5, 11}, {{99, 54}, 5, 11}, {{99, 55}, 5, 11},
+    {{99, 55}, 5, 11}, {{99, 56}, 5, 11}, {{99, 56}, 5, 11}, {{99, 57}, 5, 11},
+    {{99, 57}, 5, 11}, {{99, 61}, 5, 11}, {{99, 61}, 5, 11}, {{99, 65}, 5, 11},
+    {{99, 65}, 5, 11}, {{99, 95}, 5, 11}, {{99, 95}, 5, 11}, {{99, 98}, 5, 11},
+    {{99, 98}, 5, 11}, {{99, 100}, 5, 11}, {{99, 100}, 5, 11},
+    {{99, 102}, 5, 11}, {{99, 102}, 5, 11}, {{99, 103}, 5, 11},
+    {{99, 103}, 5, 11}, {{99, 104}, 5, 11}, {{99, 104}, 5, 11},
+    {{99, 108}, 5, 11}, {{99, 108}, 5, 11}, {{99, 109}, 5, 11},
+    {{99, 109}, 5, 11}, {{99, 110}, 5, 11}, {{99, 110}, 5, 11},
+    {{99, 112}, 5, 11}, {{99, 112}, 5, 11}, {{99, 114}, 5, 11},
+    {{99, 114}, 5, 11}, {{99, 117}, 5, 11}, {{99, 117}, 5, 11},
+    {{99, 58}, 5, 12}, {{99, 66}, 5, 12}, {{99, 67}, 5, 12}, {{99, 68}, 5, 12},
+    {{99, 69}, 5, 12}, {{99, 70}, 5, 12}, {{99, 71}, 5, 12}, {{99, 72}, 5, 12},
+    {{99, 73}, 5, 12}, {{99, 74}, 5, 12}, {{99, 75}, 5, 12}, {{99, 76}, 5, 12},
+    {{99, 77}, 5, 12}, {{99, 78}, 5, 12}, {{99, 79}, 5, 12}, {{99, 80}, 5, 12},
+    {{99, 81}, 5, 12}, {{99, 82}, 5, 12}, {{99, 83}, 5, 12}, {{99, 84}, 5, 12},
+    {{99, 85}, 5, 12}, {{99, 86}, 5, 12}, {{99, 87}, 5, 12}, {{99, 89}, 5, 12},
+    {{99, 106}, 5, 12}, {{99, 107}, 5, 12}, {{99, 113}, 5, 12},
+    {{99, 118}, 5, 12}, {{99, 119}, 5, 12}, {{99, 120}, 5, 12},
+    {{99, 121}, 5, 12}, {{99, 122}, 5, 12}, {{99, 0}, 5, 5}, {{99, 0}, 5, 5},
+    {{99, 0}, 5, 5}, {{99, 0}, 5, 5}, {{101, 48}, 5, 10}, {{101, 48}, 5, 10},
+    {{101, 48}, 5, 10}, {{101, 48}, 5, 10}, {{101, 49}, 5, 10},
+    {{101, 49}, 5, 10}, {{101, 49}, 5, 10}, {{101, 49}, 5, 10},
+    {{101, 50}, 5, 10}, {{101, 50}, 5, 10}, {{101, 50}, 5, 10},
+    {{101, 50}, 5, 10}, {{101, 97}, 5, 10}, {{101, 97}, 5, 10},
+    {{101, 97}, 5, 10}, {{101, 97}, 5, 10}, {{101, 99}, 5, 10},
+    {{101, 99}, 5, 10}, {{101, 99}, 5, 10}, {{101, 99}, 5, 10},
+    {{101, 101}, 5, 10}, {{101, 101}, 5, 10}, {{101, 101}, 5, 10},
+    {{101, 101}, 5, 10}, {{101, 105}, 5, 10}, {{101, 105}, 5, 10},
+    {{101, 105}, 5, 10}, {{101, 105}, 5, 10}, {{101, 111}, 5, 10},
+    {{101, 111}, 5, 10}, {{101, 111}, 5, 10}, {{101, 111}, 5, 10},
+    {{101, 115}, 5, 10}, {{101, 115}, 5, 10}, {{101, 115}, 5, 10},
+    {{101, 115}, 5, 10}, {{101, 116}, 5, 10}, {{101, 116}, 5, 10},
+    {{101, 116}, 5, 10}, {{101, 116}, 5, 10}, {{101, 32}, 5, 11},
+    {{101, 32}, 5, 11}, {{101, 37}, 5, 11}, {{101, 37}, 5, 11},
+    {{101, 45}, 5, 11}, {{101, 45}, 5, 11}, {{101, 46}, 5, 11},
+    {{101, 46}, 5, 11}, {{101, 47}, 5, 11}, {{101, 47}, 5, 11},
+    {{101, 51}, 5, 11}, {{101, 51}, 5, 11}, {{101, 52}, 5, 11},
+    {{101, 52}, 5, 11}, {{101, 53}, 5, 11}, {{101, 53}, 5, 11},
+    {{101, 54}, 5, 11}, {{101, 54}, 5, 11}, {{101, 55}, 5, 11},
+    {{101, 55}, 5, 11}, {{101, 56}, 5, 11}, {{101, 56}, 5, 11},
+    {{101, 57}, 5, 11}, {{101, 57}, 5, 11}, {{101, 61}, 5, 11},
+    {{101, 61}, 5, 11}, {{101, 65}, 5, 11}, {{101, 65}, 5, 11},
+    {{101, 95}, 5, 11}, {{101, 95}, 5, 11}, {{101, 98}, 5, 11},
+    {{101, 98}, 5, 11}, {{101, 100}, 5, 11}, {{101, 100}, 5, 11},
+    {{101, 102}, 5, 11}, {{101, 102}, 5, 11}, {{101, 103}, 5, 11},
+    {{101, 103}, 5, 11}, {{101, 104}, 5, 11}, {{101, 104}, 5, 11},
+    {{101, 108}, 5, 11}, {{101, 108}, 5, 11}, {{101, 109}, 5, 11},
+    {{101, 109}, 5, 11}, {{101, 110}, 5, 11}, {{101, 110}, 5, 11},
+    {{101, 112}, 5, 11}, {{101, 112}, 5, 11}, {{101, 114}, 5, 11},
+    {{101, 114}, 5, 11}, {{101, 117}, 5, 11}, {{101, 117}, 5, 11},
+    {{101, 58}, 5, 12}, {{101, 66}, 5, 12}, {{101, 67}, 5, 12},
+    {{101, 68}, 5, 12}, {{101, 69}, 5, 12}, {{101, 70}, 5, 12},
+    {{101, 71}, 5, 12}, {{101, 72}, 5, 12}, {{101, 73}, 5, 12},
+    {{101, 74}, 5, 12}, {{101, 75}, 5, 12}, {{101, 76}, 5, 12},
+    {{101, 77}, 5, 12}, {{101, 78}, 5, 12}, {{101, 79}, 5, 12},
+    {{101, 80}, 5, 12}, {{101, 81}, 5, 12}, {{101, 82}, 5, 12},
+    {{101, 83}, 5, 12}, {{101, 84}, 5, 12}, {{101, 85}, 5, 12},
+    {{101, 86}, 5, 12}, {{101, 87}, 5, 12}, {{101, 89}, 5, 12},
+    {{101, 106}, 5, 12}, {{101, 107}, 5, 12}, {{101, 113}, 5, 12},
+    {{101, 118}, 5, 12}, {{101, 119}, 5, 12}, {{101, 120}, 5, 12},
+    {{101, 121}, 5, 12}, {{101, 122}, 5, 12}, {{101, 0}, 5, 5},
+    {{101, 0}, 5, 5}, {{101, 0}, 5, 5}, {{101, 0}, 5, 5}, {{105, 48}, 5, 10},
+    {{105, 48}, 5, 10}, {{105, 48}, 5, 10}, {{105, 48}, 5, 10},
+    {{105, 49}, 5, 10}, {{105, 49}, 5, 10}, {{105, 49}, 5, 10},
+    {{105, 49}, 5, 10}, {{105, 50}, 5, 10}, {{105, 50}, 5, 10},
+    {{105, 50}, 5, 10}, {{105, 50}, 5, 10}, {{105, 97}, 5, 10},
+    {{105, 97}, 5, 10}, {{105, 97}, 5, 10}, {{105, 97}, 5, 10},
+    {{105, 99}, 5, 10}, {{105, 99}, 5, 10}, {{105, 99}, 5, 10},
+    {{105, 99}, 5, 10}, {{105, 101}, 5, 10}, {{105, 101}, 5, 10},
+    {{105, 101}, 5, 10}, {{105, 101}, 5, 10}, {{105, 105}, 5, 10},
+    {{105, 105}, 5, 10}, {{105, 105}, 5, 10}, {{105, 105}, 5, 10},
+    {{105, 111}, 5, 10}, {{105, 111}, 5, 10}, {{105, 111}, 5, 10},
+    {{105, 111}, 5, 10}, {{105, 115}, 5, 10}, {{105, 115}, 5, 10},
+    {{105, 115}, 5, 10}, {{105, 115}, 5, 10}, {{105, 116}, 5, 10},
+    {{105, 116}, 5, 10}, {{105, 116}, 5, 10}, {{105, 116}, 5, 10},
+    {{105, 32}, 5, 11}, {{105, 32}, 5, 11}, {{105, 37}, 5, 11},
+    {{105, 37}, 5, 11}, {{105, 45}, 5, 11}, {{105, 45}, 5, 11},
+    {{105, 46}, 5, 11}, {{105, 46}, 5, 11}, {{105, 47}, 5, 11},
+    {{105, 47}, 5, 11}, {{105, 51}, 5, 11}, {{105, 51}, 5, 11},
+    {{105, 52}, 5, 11}, {{105, 52}, 5, 11}, {{105, 53}, 5, 11},
+    {{105, 53}, 5, 11}, {{105, 54}, 5, 11}, {{105, 54}, 5, 11},
+    {{105, 55}, 5, 11}, {{105, 55}, 5, 11}, {{105, 56}, 5, 11},
+    {{105, 56}, 5, 11}, {{105, 57}, 5, 11}, {{105, 57}, 5, 11},
+    {{105, 61}, 5, 11}, {{105, 61}, 5, 11}, {{105, 65}, 5, 11},
+    {{105, 65}, 5, 11}, {{105, 95}, 5, 11}, {{105, 95}, 5, 11},
+    {{105, 98}, 5, 11}, {{105, 98}, 5, 11}, {{105, 100}, 5, 11},
+    {{105, 100}, 5, 11}, {{105, 102}, 5, 11}, {{105, 102}, 5, 11},
+    {{105, 103}, 5, 11}, {{105, 103}, 5, 11}, {{105, 104}, 5, 11},
+    {{105, 104}, 5, 11}, {{105, 108}, 5, 11}, {{105, 108}, 5, 11},
+    {{105, 109}, 5, 11}, {{105, 109}, 5, 11}, {{105, 110}, 5, 11},
+    {{105, 110}, 5, 11}, {{105, 112}, 5, 11}, {{105, 112}, 5, 11},
+    {{105, 114}, 5, 11}, {{105, 114}, 5, 11}, {{105, 117}, 5, 11},
+    {{105, 117}, 5, 11}, {{105, 58}, 5, 12}, {{105, 66}, 5, 12},
+    {{105, 67}, 5, 12}, {{105, 68}, 5, 12}, {{105, 69}, 5, 12},
+    {{105, 70}, 5, 12}, {{105, 71}, 5, 12}, {{105, 72}, 5, 12},
+    {{105, 73}, 5, 12}, {{105, 74}, 5, 12}, {{105, 75}, 5, 12},
+    {{105, 76}, 5, 12}, {{105, 77}, 5, 12}, {{105, 78}, 5, 12},
+    {{105, 79}, 5, 12}, {{105, 80}, 5, 12}, {{105, 81}, 5, 12},
+    {{105, 82}, 5, 12}, {{105, 83}, 5, 12}, {{105, 84}, 5, 12},
+    {{105, 85}, 5, 12}, {{105, 86}, 5, 12}, {{105, 87}, 5, 12},
+    {{105, 89}, 5, 12}, {{105, 106}, 5, 12}, {{105, 107}, 5, 12},
+    {{105, 113}, 5, 12}, {{105, 118}, 5, 12}, {{105, 119}, 5, 12},
+    {{105, 120}, 5, 12}, {{105, 121}, 5, 12}, {{105, 122}, 5, 12},
+    {{105, 0}, 5, 5}, {{105, 0}, 5, 5}, {{105, 0}, 5, 5}, {{105, 0}, 5, 5},
+    {{111, 48}, 5, 10}, {{111, 48}, 5, 10}, {{111, 48}, 5, 10},
+    {{111, 48}, 5, 10}, {{111, 49}, 5, 10}, {{111, 49}, 5, 10},
+    {{111, 49}, 5, 10}, {{111, 49}, 5, 10}, {{111, 50}, 5, 10},
+    {{111, 50}, 5, 10}, {{111, 50}, 5, 10}, {{111, 50}, 5, 10},
+    {{111, 97}, 5, 10}, {{111, 97}, 5, 10}, {{111, 97}, 5, 10},
+    {{111, 97}, 5, 10}, {{111, 99}, 5, 10}, {{111, 99}, 5, 10},
+    {{111, 99}, 5, 10}, {{111, 99}, 5, 10}, {{111, 101}, 5, 10},
+    {{111, 101}, 5, 10}, {{111, 101}, 5, 10}, {{111, 101}, 5, 10},
+    {{111, 105}, 5, 10}, {{111, 105}, 5, 10}, {{111, 105}, 5, 10},
+    {{111, 105}, 5, 10}, {{111, 111}, 5, 10}, {{111, 111}, 5, 10},
+    {{111, 111}, 5, 10}, {{111, 111}, 5, 10}, {{111, 115}, 5, 10},
+    {{111, 115}, 5, 10}, {{111, 115}, 5, 10}, {{111, 115}, 5, 10},
+    {{111, 116}, 5, 10}, {{111, 116}, 5, 10}, {{111, 116}, 5, 10},
+    {{111, 116}, 5, 10}, {{111, 32}, 5, 11}, {{111, 32}, 5, 11},
+    {{111, 37}, 5, 11}, {{111, 37}, 5, 11}, {{111, 45}, 5, 11},
+    {{111, 45}, 5, 11}, {{111, 46}, 5, 11}, {{111, 46}, 5, 11},
+    {{111, 47}, 5, 11}, {{111, 47}, 5, 11}, {{111, 51}, 5, 11},
+    {{111, 51}, 5, 11}, {{111, 52}, 5, 11}, {{111, 52}, 5, 11},
+    {{111, 53}, 5, 11}, {{111, 53}, 5, 11}, {{111, 54}, 5, 11},
+    {{111, 54}, 5, 11}, {{111, 55}, 5, 11}, {{111, 55}, 5, 11},
+    {{111, 56}, 5, 11}, {{111, 56}, 5, 11}, {{111, 57}, 5, 11},
+    {{111, 57}, 5, 11}, {{111, 61}, 5, 11}, {{111, 61}, 5, 11},
+    {{111, 65}, 5, 11}, {{111, 65}, 5, 11}, {{111, 95}, 5, 11},
+    {{111, 95}, 5, 11}, {{111, 98}, 5, 11}, {{111, 98}, 5, 11},
+    {{111, 100}, 5, 11}, {{111, 100}, 5, 11}, {{111, 102}, 5, 11},
+    {{111, 102}, 5, 11}, {{111, 103}, 5, 11}, {{111, 103}, 5, 11},
+    {{111, 104}, 5, 11}, {{111, 104}, 5, 11}, {{111, 108}, 5, 11},
+    {{111, 108}, 5, 11}, {{111, 109}, 5, 11}, {{111, 109}, 5, 11},
+    {{111, 110}, 5, 11}, {{111, 110}, 5, 11}, {{111, 112}, 5, 11},
+    {{111, 112}, 5, 11}, {{111, 114}, 5, 11}, {{111, 114}, 5, 11},
+    {{111, 117}, 5, 11}, {{111, 117}, 5, 11}, {{111, 58}, 5, 12},
+    {{111, 66}, 5, 12}, {{111, 67}, 5, 12}, {{111, 68}, 5, 12},
+    {{111, 69}, 5, 12}, {{111, 70}, 5, 12}, {{111, 71}, 5, 12},
+    {{111, 72}, 5, 12}, {{111, 73}, 5, 12}, {{111, 74}, 5, 12},
+    {{111, 75}, 5, 12}, {{111, 76}, 5, 12}, {{111, 77}, 5, 12},
+    {{111, 78}, 5, 12}, {{111, 79}, 5, 12}, {{111, 80}, 5, 12},
+    {{111, 81}, 5, 12}, {{111, 82}, 5, 12}, {{111, 83}, 5, 12},
+    {{111, 84}, 5, 12}, {{111, 85}, 5, 12}, {{111, 86}, 5, 12},
+    {{111, 87}, 5, 12}, {{111, 89}, 5, 12}, {{111, 106}, 5, 12},
+    {{111, 107}, 5, 12}, {{111, 113}, 5, 12}, {{111, 118}, 5, 12},
+    {{111, 119}, 5, 12}, {{111, 120}, 5, 12}, {{111, 121}, 5, 12},
+    {{111, 122}, 5, 12}, {{111, 0}, 5, 5}, {{111, 0}, 5, 5}, {{111, 0}, 5, 5},
+    {{111, 0}, 5, 5}, {{115, 48}, 5, 10}, {{115, 48}, 5, 10},
+    {{115, 48}, 5, 10}, {{115, 48}, 5, 10}, {{115, 49}, 5, 10},
+    {{115, 49}, 5, 10}, {{115, 49}, 5, 10}, {{115, 49}, 5, 10},
+    {{115, 50}, 5, 10}, {{115, 50}, 5, 10}, {{115, 50}, 5, 10},
+    {{115, 50}, 5, 10}, {{115, 97}, 5, 10}, {{115, 97}, 5, 10},
+    {{115, 97}, 5, 10}, {{115, 97}, 5, 10}, {{115, 99}, 5, 10},
+    {{115, 99}, 5, 10}, {{115, 99}, 5, 10}, {{115, 99}, 5, 10},
+    {{115, 101}, 5, 10}, {{115, 101}, 5, 10}, {{115, 101}, 5, 10},
+    {{115, 101}, 5, 10}, {{115, 105}, 5, 10}, {{115, 105}, 5, 10},
+    {{115, 105}, 5, 10}, {{115, 105}, 5, 10}, {{115, 111}, 5, 10},
+    {{115, 111}, 5, 10}, {{115, 111}, 5, 10}, {{115, 111}, 5, 10},
+    {{115, 115}, 5, 10}, {{115, 115}, 5, 10}, {{115, 115}, 5, 10},
+    {{115, 115}, 5, 10}, {{115, 116}, 5, 10}, {{115, 116}, 5, 10},
+    {{115, 116}, 5, 10}, {{115, 116}, 5, 10}, {{115, 32}, 5, 11},
+    {{115, 32}, 5, 11}, {{115, 37}, 5, 11}, {{115, 37}, 5, 11},
+    {{115, 45}, 5, 11}, {{115, 45}, 5, 11}, {{115, 46}, 5, 11},
+    {{115, 46}, 5, 11}, {{115, 47}, 5, 11}, {{115, 47}, 5, 11},
+    {{115, 51}, 5, 11}, {{115, 51}, 5, 11}, {{115, 52}, 5, 11},
+    {{115, 52}, 5, 11}, {{115, 53}, 5, 11}, {{115, 53}, 5, 11},
+    {{115, 54}, 5, 11}, {{115, 54}, 5, 11}, {{115, 55}, 5, 11},
+    {{115, 55}, 5, 11}, {{115, 56}, 5, 11}, {{115, 56}, 5, 11},
+    {{115, 57}, 5, 11}, {{115, 57}, 5, 11}, {{115, 61}, 5, 11},
+    {{115, 61}, 5, 11}, {{115, 65}, 5, 11}, {{115, 65}, 5, 11},
+    {{115, 95}, 5, 11}, {{115, 95}, 5, 11}, {{115, 98}, 5, 11},
+    {{115, 98}, 5, 11}, {{115, 100}, 5, 11}, {{115, 100}, 5, 11},
+    {{115, 102}, 5, 11}, {{115, 102}, 5, 11}, {{115, 103}, 5, 11},
+    {{115, 103}, 5, 11}, {{115, 104}, 5, 11}, {{115, 104}, 5, 11},
+    {{115, 108}, 5, 11}, {{115, 108}, 5, 11}, {{115, 109}, 5, 11},
+    {{115, 109}, 5, 11}, {{115, 110}, 5, 11}, {{115, 110}, 5, 11},
+    {{115, 112}, 5, 11}, {{115, 112}, 5, 11}, {{115, 114}, 5, 11},
+    {{115, 114}, 5, 11}, {{115, 117}, 5, 11}, {{115, 117}, 5, 11},
+    {{115, 58}, 5, 12}, {{115, 66}, 5, 12}, {{115, 67}, 5, 12},
+    {{115, 68}, 5, 12}, {{115, 69}, 5, 12}, {{115, 70}, 5, 12},
+    {{115, 71}, 5, 12}, {{115, 72}, 5, 12}, {{115, 73}, 5, 12},
+    {{115, 74}, 5, 12}, {{115, 75}, 5, 12}, {{115, 76}, 5, 12},
+    {{115, 77}, 5, 12}, {{115, 78}, 5, 12}, {{115, 79}, 5, 12},
+    {{115, 80}, 5, 12}, {{115, 81}, 5, 12}, {{115, 82}, 5, 12},
+    {{115, 83}, 5, 12}, {{115, 84}, 5, 12}, {{115, 85}, 5, 12},
+    {{115, 86}, 5, 12}, {{115, 87}, 5, 12}, {{115, 89}, 5, 12},
+    {{115, 106}, 5, 12}, {{115, 107}, 5, 12}, {{115, 113}, 5, 12},
+    {{115, 118}, 5, 12}, {{115, 119}, 5, 12}, {{115, 120}, 5, 12},
+    {{115, 121}, 5, 12}, {{115, 122}, 5, 12}, {{115, 0}, 5, 5},
+    {{115, 0}, 5, 5}, {{115, 0}, 5, 5}, {{115, 0}, 5, 5}, {{116, 48}, 5, 10},
+    {{116, 48}, 5, 10}, {{116, 48}, 5, 10}, {{116, 48}, 5, 10},
+    {{116, 49}, 5, 10}, {{116, 49}, 5, 10}, {{116, 49}, 5, 10},
+    {{116, 49}, 5, 10}, {{116, 50}, 5, 10}, {{116, 50}, 5, 10},
+    {{116, 50}, 5, 10}, {{116, 50}, 5, 10}, {{116, 97}, 5, 10},
+    {{116, 97}, 5, 10}, {{116, 97}, 5, 10}, {{116, 97}, 5, 10},
+    {{116, 99}, 5, 10}, {{116, 99}, 5, 10}, {{116, 99}, 5, 10},
+    {{116, 99}, 5, 10}, {{116, 101}, 5, 10}, {{116, 101}, 5, 10},
+    {{116, 101}, 5, 10}, {{116, 101}, 5, 10}, {{116, 105}, 5, 10},
+    {{116, 105}, 5, 10}, {{116, 105}, 5, 10}, {{116, 105}, 5, 10},
+    {{116, 111}, 5, 10}, {{116, 111}, 5, 10}, {{116, 111}, 5, 10},
+    {{116, 111}, 5, 10}, {{116, 115}, 5, 10}, {{116, 115}, 5, 10},
+    {{116, 115}, 5, 10}, {{116, 115}, 5, 10}, {{116, 116}, 5, 10},
+    {{116, 116}, 5, 10}, {{116, 116}, 5, 10}, {{116, 116}, 5, 10},
+    {{116, 32}, 5, 11}, {{116, 32}, 5, 11}, {{116, 37}, 5, 11},
+    {{116, 37}, 5, 11}, {{116, 45}, 5, 11}, {{116, 45}, 5, 11},
+    {{116, 46}, 5, 11}, {{116, 46}, 5, 11}, {{116, 47}, 5, 11},
+    {{116, 47}, 5, 11}, {{116, 51}, 5, 11}, {{116, 51}, 5, 11},
+    {{116, 52}, 5, 11}, {{116, 52}, 5, 11}, {{116, 53}, 5, 11},
+    {{116, 53}, 5, 11}, {{116, 54}, 5, 11}, {{116, 54}, 5, 11},
+    {{116, 55}, 5, 11}, {{116, 55}, 5, 11}, {{116, 56}, 5, 11},
+    {{116, 56}, 5, 11}, {{116, 57}, 5, 11}, {{116, 57}, 5, 11},
+    {{116, 61}, 5, 11}, {{116, 61}, 5, 11}, {{116, 65}, 5, 11},
+    {{116, 65}, 5, 11}, {{116, 95}, 5, 11}, {{116, 95}, 5, 11},
+    {{116, 98}, 5, 11}, {{116, 98}, 5, 11}, {{116, 100}, 5, 11},
+    {{116, 100}, 5, 11}, {{116, 102}, 5, 11}, {{116, 102}, 5, 11},
+    {{116, 103}, 5, 11}, {{116, 103}, 5, 11}, {{116, 104}, 5, 11},
+    {{116, 104}, 5, 11}, {{116, 108}, 5, 11}, {{116, 108}, 5, 11},
+    {{116, 109}, 5, 11}, {{116, 109}, 5, 11}, {{116, 110}, 5, 11},
+    {{116, 110}, 5, 11}, {{116, 112}, 5, 11}, {{116, 112}, 5, 11},
+    {{116, 114}, 5, 11}, {{116, 114}, 5, 11}, {{116, 117}, 5, 11},
+    {{116, 117}, 5, 11}, {{116, 58}, 5, 12}, {{116, 66}, 5, 12},
+    {{116, 67}, 5, 12}, {{116, 68}, 5, 12}, {{116, 69}, 5, 12},
+    {{116, 70}, 5, 12}, {{116, 71}, 5, 12}, {{116, 72}, 5, 12},
+    {{116, 73}, 5, 12}, {{116, 74}, 5, 12}, {{116, 75}, 5, 12},
+    {{116, 76}, 5, 12}, {{116, 77}, 5, 12}, {{116, 78}, 5, 12},
+    {{116, 79}, 5, 12}, {{116, 80}, 5, 12}, {{116, 81}, 5, 12},
+    {{116, 82}, 5, 12}, {{116, 83}, 5, 12}, {{116, 84}, 5, 12},
+    {{116, 85}, 5, 12}, {{116, 86}, 5, 12}, {{116, 87}, 5, 12},
+    {{116, 89}, 5, 12}, {{116, 106}, 5, 12}, {{116, 107}, 5, 12},
+    {{116, 113}, 5, 12}, {{116, 118}, 5, 12}, {{116, 119}, 5, 12},
+    {{116, 120}, 5, 12}, {{116, 121}, 5, 12}, {{116, 122}, 5, 12},
+    {{116, 0}, 5, 5}, {{116, 0}, 5, 5}, {{116, 0}, 5, 5}, {{116, 0}, 5, 5},
+    {{32, 48}, 6, 11}, {{32, 48}, 6, 11}, {{32, 49}, 6, 11}, {{32, 49}, 6, 11},
+    {{32, 50}, 6, 11}, {{32, 50}, 6, 11}, {{32, 97}, 6, 11}, {{32, 97}, 6, 11},
+    {{32, 99}, 6, 11}, {{32, 99}, 6, 11}, {{32, 101}, 6, 11},
+    {{32, 101}, 6, 11}, {{32, 105}, 6, 11}, {{32, 105}, 6, 11},
+    {{32, 111}, 6, 11}, {{32, 111}, 6, 11}, {{32, 115}, 6, 11},
+    {{32, 115}, 6, 11}, {{32, 116}, 6, 11}, {{32, 116}, 6, 11},
+    {{32, 32}, 6, 12}, {{32, 37}, 6, 12}, {{32, 45}, 6, 12}, {{32, 46}, 6, 12},
+    {{32, 47}, 6, 12}, {{32, 51}, 6, 12}, {{32, 52}, 6, 12}, {{32, 53}, 6, 12},
+    {{32, 54}, 6, 12}, {{32, 55}, 6, 12}, {{32, 56}, 6, 12}, {{32, 57}, 6, 12},
+    {{32, 61}, 6, 12}, {{32, 65}, 6, 12}, {{32, 95}, 6, 12}, {{32, 98}, 6, 12},
+    {{32, 100}, 6, 12}, {{32, 102}, 6, 12}, {{32, 103}, 6, 12},
+    {{32, 104}, 6, 12}, {{32, 108}, 6, 12}, {{32, 109}, 6, 12},
+    {{32, 110}, 6, 12}, {{32, 112}, 6, 12}, {{32, 114}, 6, 12},
+    {{32, 117}, 6, 12}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6},
+    {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6},
+    {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6},
+    {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6},
+    {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{32, 0}, 6, 6}, {{37, 48}, 6, 11},
+    {{37, 48}, 6, 11}, {{37, 49}, 6, 11}, {{37, 49}, 6, 11}, {{37, 50}, 6, 11},
+    {{37, 50}, 6, 11}, {{37, 97}, 6, 11}, {{37, 97}, 6, 11}, {{37, 99}, 6, 11},
+    {{37, 99}, 6, 11}, {{37, 101}, 6, 11}, {{37, 101}, 6, 11},
+    {{37, 105}, 6, 11}, {{37, 105}, 6, 11}, {{37, 111}, 6, 11},
+    {{37, 111}, 6, 11}, {{37, 115}, 6, 11}, {{37, 115}, 6, 11},
+    {{37, 116}, 6, 11}, {{37, 116}, 6, 11}, {{37, 32}, 6, 12},
+    {{37, 37}, 6, 12}, {{37, 45}, 6, 12}, {{37, 46}, 6, 12}, {{37, 47}, 6, 12},
+    {{37, 51}, 6, 12}, {{37, 52}, 6, 12}, {{37, 53}, 6, 12}, {{37, 54}, 6, 12},
+    {{37, 55}, 6, 12}, {{37, 56}, 6, 12}, {{37, 57}, 6, 12}, {{37, 61}, 6, 12},
+    {{37, 65}, 6, 12}, {{37, 95}, 6, 12}, {{37, 98}, 6, 12}, {{37, 100}, 6, 12},
+    {{37, 102}, 6, 12}, {{37, 103}, 6, 12}, {{37, 104}, 6, 12},
+    {{37, 108}, 6, 12}, {{37, 109}, 6, 12}, {{37, 110}, 6, 12},
+    {{37, 112}, 6, 12}, {{37, 114}, 6, 12}, {{37, 117}, 6, 12}, {{37, 0}, 6, 6},
+    {{37, 0}, 6, 6}, {{37, 0}, 6, 6}, {{37, 0}, 6, 6}, {{37, 0}, 6, 6},
+    {{37, 0}, 6, 6}, {{37, 0}, 6, 6}, {{37, 0}, 6, 6}, {{37, 0}, 6, 6},
+    {{37, 0}, 6, 6}, {{37, 0}, 6, 6}, {{37, 0}, 6, 6}, {{37, 0}, 6, 6},
+    {{37, 0}, 6, 6}, {{37, 0}, 6, 6}, {{37, 0}, 6, 6}, {{37, 0}, 6, 6},
+    {{37, 0}, 6, 6}, {{45, 48}, 6, 11}, {{45, 48}, 6, 11}, {{45, 49}, 6, 11},
+    {{45, 49}, 6, 11}, {{45, 50}, 6, 11}, {{45, 50}, 6, 11}, {{45, 97}, 6, 11},
+    {{45, 97}, 6, 11}, {{45, 99}, 6, 11}, {{45, 99}, 6, 11}, {{45, 101}, 6, 11},
+    {{45, 101}, 6, 11}, {{45, 105}, 6, 11}, {{45, 105}, 6, 11},
+    {{45, 111}, 6, 11}, {{45, 111}, 6, 11}, {{45, 115}, 6, 11},
+    {{45, 115}, 6, 11}, {{45, 116}, 6, 11}, {{45, 116}, 6, 11},
+    {{45, 32}, 6, 12}, {{45, 37}, 6, 12}, {{45, 45}, 6, 12}, {{45, 46}, 6, 12},
+    {{45, 47}, 6, 12}, {{45, 51}, 6, 12}, {{45, 52}, 6, 12}, {{45, 53}, 6, 12},
+    {{45, 54}, 6, 12}, {{45, 55}, 6, 12}, {{45, 56}, 6, 12}, {{45, 57}, 6, 12},
+    {{45, 61}, 6, 12}, {{45, 65}, 6, 12}, {{45, 95}, 6, 12}, {{45, 98}, 6, 12},
+    {{45, 100}, 6, 12}, {{45, 102}, 6, 12}, {{45, 103}, 6, 12},
+    {{45, 104}, 6, 12}, {{45, 108}, 6, 12}, {{45, 109}, 6, 12},
+    {{45, 110}, 6, 12}, {{45, 112}, 6, 12}, {{45, 114}, 6, 12},
+    {{45, 117}, 6, 12}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6},
+    {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6},
+    {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6},
+    {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6},
+    {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{45, 0}, 6, 6}, {{46, 48}, 6, 11},
+    {{46, 48}, 6, 11}, {{46, 49}, 6, 11}, {{46, 49}, 6, 11}, {{46, 50}, 6, 11},
+    {{46, 50}, 6, 11}, {{46, 97}, 6, 11}, {{46, 97}, 6, 11}, {{46, 99}, 6, 11},
+    {{46, 99}, 6, 11}, {{46, 101}, 6, 11}, {{46, 101}, 6, 11},
+    {{46, 105}, 6, 11}, {{46, 105}, 6, 11}, {{46, 111}, 6, 11},
+    {{46, 111}, 6, 11}, {{46, 115}, 6, 11}, {{46, 115}, 6, 11},
+    {{46, 116}, 6, 11}, {{46, 116}, 6, 11}, {{46, 32}, 6, 12},
+    {{46, 37}, 6, 12}, {{46, 45}, 6, 12}, {{46, 46}, 6, 12}, {{46, 47}, 6, 12},
+    {{46, 51}, 6, 12}, {{46, 52}, 6, 12}, {{46, 53}, 6, 12}, {{46, 54}, 6, 12},
+    {{46, 55}, 6, 12}, {{46, 56}, 6, 12}, {{46, 57}, 6, 12}, {{46, 61}, 6, 12},
+    {{46, 65}, 6, 12}, {{46, 95}, 6, 12}, {{46, 98}, 6, 12}, {{46, 100}, 6, 12},
+    {{46, 102}, 6, 12}, {{46, 103}, 6, 12}, {{46, 104}, 6, 12},
+    {{46, 108}, 6, 12}, {{46, 109}, 6, 12}, {{46, 110}, 6, 12},
+    {{46, 112}, 6, 12}, {{46, 114}, 6, 12}, {{46, 117}, 6, 12}, {{46, 0}, 6, 6},
+    {{46, 0}, 6, 6}, {{46, 0}, 6, 6}, {{46, 0}, 6, 6}, {{46, 0}, 6, 6},
+    {{46, 0}, 6, 6}, {{46, 0}, 6, 6}, {{46, 0}, 6, 6}, {{46, 0}, 6, 6},
+    {{46, 0}, 6, 6}, {{46, 0}, 6, 6}, {{46, 0}, 6, 6}, {{46, 0}, 6, 6},
+    {{46, 0}, 6, 6}, {{46, 0}, 6, 6}, {{46, 0}, 6, 6}, {{46, 0}, 6, 6},
+    {{46, 0}, 6, 6}, {{47, 48}, 6, 11}, {{47, 48}, 6, 11}, {{47, 49}, 6, 11},
+    {{47, 49}, 6, 11}, {{47, 50}, 6, 11}, {{47, 50}, 6, 11}, {{47, 97}, 6, 11},
+    {{47, 97}, 6, 11}, {{47, 99}, 6, 11}, {{47, 99}, 6, 11}, {{47, 101}, 6, 11},
+    {{47, 101}, 6, 11}, {{47, 105}, 6, 11}, {{47, 105}, 6, 11},
+    {{47, 111}, 6, 11}, {{47, 111}, 6, 11}, {{47, 115}, 6, 11},
+    {{47, 115}, 6, 11}, {{47, 116}, 6, 11}, {{47, 116}, 6, 11},
+    {{47, 32}, 6, 12}, {{47, 37}, 6, 12}, {{47, 45}, 6, 12}, {{47, 46}, 6, 12},
+    {{47, 47}, 6, 12}, {{47, 51}, 6, 12}, {{47, 52}, 6, 12}, {{47, 53}, 6, 12},
+    {{47, 54}, 6, 12}, {{47, 55}, 6, 12}, {{47, 56}, 6, 12}, {{47, 57}, 6, 12},
+    {{47, 61}, 6, 12}, {{47, 65}, 6, 12}, {{47, 95}, 6, 12}, {{47, 98}, 6, 12},
+    {{47, 100}, 6, 12}, {{47, 102}, 6, 12}, {{47, 103}, 6, 12},
+    {{47, 104}, 6, 12}, {{47, 108}, 6, 12}, {{47, 109}, 6, 12},
+    {{47, 110}, 6, 12}, {{47, 112}, 6, 12}, {{47, 114}, 6, 12},
+    {{47, 117}, 6, 12}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6},
+    {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6},
+    {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6},
+    {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6},
+    {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{47, 0}, 6, 6}, {{51, 48}, 6, 11},
+    {{51, 48}, 6, 11}, {{51, 49}, 6, 11}, {{51, 49}, 6, 11}, {{51, 50}, 6, 11},
+    {{51, 50}, 6, 11}, {{51, 97}, 6, 11}, {{51, 97}, 6, 11}, {{51, 99}, 6, 11},
+    {{51, 99}, 6, 11}, {{51, 101}, 6, 11}, {{51, 101}, 6, 11},
+    {{51, 105}, 6, 11}, {{51, 105}, 6, 11}, {{51, 111}, 6, 11},
+    {{51, 111}, 6, 11}, {{51, 115}, 6, 11}, {{51, 115}, 6, 11},
+    {{51, 116}, 6, 11}, {{51, 116}, 6, 11}, {{51, 32}, 6, 12},
+    {{51, 37}, 6, 12}, {{51, 45}, 6, 12}, {{51, 46}, 6, 12}, {{51, 47}, 6, 12},
+    {{51, 51}, 6, 12}, {{51, 52}, 6, 12}, {{51, 53}, 6, 12}, {{51, 54}, 6, 12},
+    {{51, 55}, 6, 12}, {{51, 56}, 6, 12}, {{51, 57}, 6, 12}, {{51, 61}, 6, 12},
+    {{51, 65}, 6, 12}, {{51, 95}, 6, 12}, {{51, 98}, 6, 12}, {{51, 100}, 6, 12},
+    {{51, 102}, 6, 12}, {{51, 103}, 6, 12}, {{51, 104}, 6, 12},
+    {{51, 108}, 6, 12}, {{51, 109}, 6, 12}, {{51, 110}, 6, 12},
+    {{51, 112}, 6, 12}, {{51, 114}, 6, 12}, {{51, 117}, 6, 12}, {{51, 0}, 6, 6},
+    {{51, 0}, 6, 6}, {{51, 0}, 6, 6}, {{51, 0}, 6, 6}, {{51, 0}, 6, 6},
+    {{51, 0}, 6, 6}, {{51, 0}, 6, 6}, {{51, 0}, 6, 6}, {{51, 0}, 6, 6},
+    {{51, 0}, 6, 6}, {{51, 0}, 6, 6}, {{51, 0}, 6, 6}, {{51, 0}, 6, 6},
+    {{51, 0}, 6, 6}, {{51, 0}, 6, 6}, {{51, 0}, 6, 6}, {{51, 0}, 6, 6},
+    {{51, 0}, 6, 6}, {{52, 48}, 6, 11}, {{52, 48}, 6, 11}, {{52, 49}, 6, 11},
+    {{52, 49}, 6, 11}, {{52, 50}, 6, 11}, {{52, 50}, 6, 11}, {{52, 97}, 6, 11},
+    {{52, 97}, 6, 11}, {{52, 99}, 6, 11}, {{52, 99}, 6, 11}, {{52, 101}, 6, 11},
+    {{52, 101}, 6, 11}, {{52, 105}, 6, 11}, {{52, 105}, 6, 11},
+    {{52, 111}, 6, 11}, {{52, 111}, 6, 11}, {{52, 115}, 6, 11},
+    {{52, 115}, 6, 11}, {{52, 116}, 6, 11}, {{52, 116}, 6, 11},
+    {{52, 32}, 6, 12}, {{52, 37}, 6, 12}, {{52, 45}, 6, 12}, {{52, 46}, 6, 12},
+    {{52, 47}, 6, 12}, {{52, 51}, 6, 12}, {{52, 52}, 6, 12}, {{52, 53}, 6, 12},
+    {{52, 54}, 6, 12}, {{52, 55}, 6, 12}, {{52, 56}, 6, 12}, {{52, 57}, 6, 12},
+    {{52, 61}, 6, 12}, {{52, 65}, 6, 12}, {{52, 95}, 6, 12}, {{52, 98}, 6, 12},
+    {{52, 100}, 6, 12}, {{52, 102}, 6, 12}, {{52, 103}, 6, 12},
+    {{52, 104}, 6, 12}, {{52, 108}, 6, 12}, {{52, 109}, 6, 12},
+    {{52, 110}, 6, 12}, {{52, 112}, 6, 12}, {{52, 114}, 6, 12},
+    {{52, 117}, 6, 12}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6},
+    {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6},
+    {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6},
+    {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6},
+    {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{52, 0}, 6, 6}, {{53, 48}, 6, 11},
+    {{53, 48}, 6, 11}, {{53, 49}, 6, 11}, {{53, 49}, 6, 11}, {{53, 50}, 6, 11},
+    {{53, 50}, 6, 11}, {{53, 97}, 6, 11}, {{53, 97}, 6, 11}, {{53, 99}, 6, 11},
+    {{53, 99}, 6, 11}, {{53, 101}, 6, 11}, {{53, 101}, 6, 11},
+    {{53, 105}, 6, 11}, {{53, 105}, 6, 11}, {{53, 111}, 6, 11},
+    {{53, 111}, 6, 11}, {{53, 115}, 6, 11}, {{53, 115}, 6, 11},
+    {{53, 116}, 6, 11}, {{53, 116}, 6, 11}, {{53, 32}, 6, 12},
+    {{53, 37}, 6, 12}, {{53, 45}, 6, 12}, {{53, 46}, 6, 12}, {{53, 47}, 6, 12},
+    {{53, 51}, 6, 12}, {{53, 52}, 6, 12}, {{53, 53}, 6, 12}, {{53, 54}, 6, 12},
+    {{53, 55}, 6, 12}, {{53, 56}, 6, 12}, {{53, 57}, 6, 12}, {{53, 61}, 6, 12},
+    {{53, 65}, 6, 12}, {{53, 95}, 6, 12}, {{53, 98}, 6, 12}, {{53, 100}, 6, 12},
+    {{53, 102}, 6, 12}, {{53, 103}, 6, 12}, {{53, 104}, 6, 12},
+    {{53, 108}, 6, 12}, {{53, 109}, 6, 12}, {{53, 110}, 6, 12},
+    {{53, 112}, 6, 12}, {{53, 114}, 6, 12}, {{53, 117}, 6, 12}, {{53, 0}, 6, 6},
+    {{53, 0}, 6, 6}, {{53, 0}, 6, 6}, {{53, 0}, 6, 6}, {{53, 0}, 6, 6},
+    {{53, 0}, 6, 6}, {{53, 0}, 6, 6}, {{53, 0}, 6, 6}, {{53, 0}, 6, 6},
+    {{53, 0}, 6, 6}, {{53, 0}, 6, 6}, {{53, 0}, 6, 6}, {{53, 0}, 6, 6},
+    {{53, 0}, 6, 6}, {{53, 0}, 6, 6}, {{53, 0}, 6, 6}, {{53, 0}, 6, 6},
+    {{53, 0}, 6, 6}, {{54, 48}, 6, 11}, {{54, 48}, 6, 11}, {{54, 49}, 6, 11},
+    {{54, 49}, 6, 11}, {{54, 50}, 6, 11}, {{54, 50}, 6, 11}, {{54, 97}, 6, 11},
+    {{54, 97}, 6, 11}, {{54, 99}, 6, 11}, {{54, 99}, 6, 11}, {{54, 101}, 6, 11},
+    {{54, 101}, 6, 11}, {{54, 105}, 6, 11}, {{54, 105}, 6, 11},
+    {{54, 111}, 6, 11}, {{54, 111}, 6, 11}, {{54, 115}, 6, 11},
+    {{54, 115}, 6, 11}, {{54, 116}, 6, 11}, {{54, 116}, 6, 11},
+    {{54, 32}, 6, 12}, {{54, 37}, 6, 12}, {{54, 45}, 6, 12}, {{54, 46}, 6, 12},
+    {{54, 47}, 6, 12}, {{54, 51}, 6, 12}, {{54, 52}, 6, 12}, {{54, 53}, 6, 12},
+    {{54, 54}, 6, 12}, {{54, 55}, 6, 12}, {{54, 56}, 6, 12}, {{54, 57}, 6, 12},
+    {{54, 61}, 6, 12}, {{54, 65}, 6, 12}, {{54, 95}, 6, 12}, {{54, 98}, 6, 12},
+    {{54, 100}, 6, 12}, {{54, 102}, 6, 12}, {{54, 103}, 6, 12},
+    {{54, 104}, 6, 12}, {{54, 108}, 6, 12}, {{54, 109}, 6, 12},
+    {{54, 110}, 6, 12}, {{54, 112}, 6, 12}, {{54, 114}, 6, 12},
+    {{54, 117}, 6, 12}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6},
+    {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6},
+    {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6},
+    {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6},
+    {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{54, 0}, 6, 6}, {{55, 48}, 6, 11},
+    {{55, 48}, 6, 11}, {{55, 49}, 6, 11}, {{55, 49}, 6, 11}, {{55, 50}, 6, 11},
+    {{55, 50}, 6, 11}, {{55, 97}, 6, 11}, {{55, 97}, 6, 11}, {{55, 99}, 6, 11},
+    {{55, 99}, 6, 11}, {{55, 101}, 6, 11}, {{55, 101}, 6, 11},
+    {{55, 105}, 6, 11}, {{55, 105}, 6, 11}, {{55, 111}, 6, 11},
+    {{55, 111}, 6, 11}, {{55, 115}, 6, 11}, {{55, 115}, 6, 11},
+    {{55, 116}, 6, 11}, {{55, 116}, 6, 11}, {{55, 32}, 6, 12},
+    {{55, 37}, 6, 12}, {{55, 45}, 6, 12}, {{55, 46}, 6, 12}, {{55, 47}, 6, 12},
+    {{55, 51}, 6, 12}, {{55, 52}, 6, 12}, {{55, 53}, 6, 12}, {{55, 54}, 6, 12},
+    {{55, 55}, 6, 12}, {{55, 56}, 6, 12}, {{55, 57}, 6, 12}, {{55, 61}, 6, 12},
+    {{55, 65}, 6, 12}, {{55, 95}, 6, 12}, {{55, 98}, 6, 12}, {{55, 100}, 6, 12},
+    {{55, 102}, 6, 12}, {{55, 103}, 6, 12}, {{55, 104}, 6, 12},
+    {{55, 108}, 6, 12}, {{55, 109}, 6, 12}, {{55, 110}, 6, 12},
+    {{55, 112}, 6, 12}, {{55, 114}, 6, 12}, {{55, 117}, 6, 12}, {{55, 0}, 6, 6},
+    {{55, 0}, 6, 6}, {{55, 0}, 6, 6}, {{55, 0}, 6, 6}, {{55, 0}, 6, 6},
+    {{55, 0}, 6, 6}, {{55, 0}, 6, 6}, {{55, 0}, 6, 6}, {{55, 0}, 6, 6},
+    {{55, 0}, 6, 6}, {{55, 0}, 6, 6}, {{55, 0}, 6, 6}, {{55, 0}, 6, 6},
+    {{55, 0}, 6, 6}, {{55, 0}, 6, 6}, {{55, 0}, 6, 6}, {{55, 0}, 6, 6},
+    {{55, 0}, 6, 6}, {{56, 48}, 6, 11}, {{56, 48}, 6, 11}, {{56, 49}, 6, 11},
+    {{56, 49}, 6, 11}, {{56, 50}, 6, 11}, {{56, 50}, 6, 11}, {{56, 97}, 6, 11},
+    {{56, 97}, 6, 11}, {{56, 99}, 6, 11}, {{56, 99}, 6, 11}, {{56, 101}, 6, 11},
+    {{56, 101}, 6, 11}, {{56, 105}, 6, 11}, {{56, 105}, 6, 11},
+    {{56, 111}, 6, 11}, {{56, 111}, 6, 11}, {{56, 115}, 6, 11},
+    {{56, 115}, 6, 11}, {{56, 116}, 6, 11}, {{56, 116}, 6, 11},
+    {{56, 32}, 6, 12}, {{56, 37}, 6, 12}, {{56, 45}, 6, 12}, {{56, 46}, 6, 12},
+    {{56, 47}, 6, 12}, {{56, 51}, 6, 12}, {{56, 52}, 6, 12}, {{56, 53}, 6, 12},
+    {{56, 54}, 6, 12}, {{56, 55}, 6, 12}, {{56, 56}, 6, 12}, {{56, 57}, 6, 12},
+    {{56, 61}, 6, 12}, {{56, 65}, 6, 12}, {{56, 95}, 6, 12}, {{56, 98}, 6, 12},
+    {{56, 100}, 6, 12}, {{56, 102}, 6, 12}, {{56, 103}, 6, 12},
+    {{56, 104}, 6, 12}, {{56, 108}, 6, 12}, {{56, 109}, 6, 12},
+    {{56, 110}, 6, 12}, {{56, 112}, 6, 12}, {{56, 114}, 6, 12},
+    {{56, 117}, 6, 12}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6},
+    {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6},
+    {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6},
+    {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6},
+    {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{56, 0}, 6, 6}, {{57, 48}, 6, 11},
+    {{57, 48}, 6, 11}, {{57, 49}, 6, 11}, {{57, 49}, 6, 11}, {{57, 50}, 6, 11},
+    {{57, 50}, 6, 11}, {{57, 97}, 6, 11}, {{57, 97}, 6, 11}, {{57, 99}, 6, 11},
+    {{57, 99}, 6, 11}, {{57, 101}, 6, 11}, {{57, 101}, 6, 11},
+    {{57, 105}, 6, 11}, {{57, 105}, 6, 11}, {{57, 111}, 6, 11},
+    {{57, 111}, 6, 11}, {{57, 115}, 6, 11}, {{57, 115}, 6, 11},
+    {{57, 116}, 6, 11}, {{57, 116}, 6, 11}, {{57, 32}, 6, 12},
+    {{57, 37}, 6, 12}, {{57, 45}, 6, 12}, {{57, 46}, 6, 12}, {{57, 47}, 6, 12},
+    {{57, 51}, 6, 12}, {{57, 52}, 6, 12}, {{57, 53}, 6, 12}, {{57, 54}, 6, 12},
+    {{57, 55}, 6, 12}, {{57, 56}, 6, 12}, {{57, 57}, 6, 12}, {{57, 61}, 6, 12},
+    {{57, 65}, 6, 12}, {{57, 95}, 6, 12}, {{57, 98}, 6, 12}, {{57, 100}, 6, 12},
+    {{57, 102}, 6, 12}, {{57, 103}, 6, 12}, {{57, 104}, 6, 12},
+    {{57, 108}, 6, 12}, {{57, 109}, 6, 12}, {{57, 110}, 6, 12},
+    {{57, 112}, 6, 12}, {{57, 114}, 6, 12}, {{57, 117}, 6, 12}, {{57, 0}, 6, 6},
+    {{57, 0}, 6, 6}, {{57, 0}, 6, 6}, {{57, 0}, 6, 6}, {{57, 0}, 6, 6},
+    {{57, 0}, 6, 6}, {{57, 0}, 6, 6}, {{57, 0}, 6, 6}, {{57, 0}, 6, 6},
+    {{57, 0}, 6, 6}, {{57, 0}, 6, 6}, {{57, 0}, 6, 6}, {{57, 0}, 6, 6},
+    {{57, 0}, 6, 6}, {{57, 0}, 6, 6}, {{57, 0}, 6, 6}, {{57, 0}, 6, 6},
+    {{57, 0}, 6, 6}, {{61, 48}, 6, 11}, {{61, 48}, 6, 11}, {{61, 49}, 6, 11},
+    {{61, 49}, 6, 11}, {{61, 50}, 6, 11}, {{61, 50}, 6, 11}, {{61, 97}, 6, 11},
+    {{61, 97}, 6, 11}, {{61, 99}, 6, 11}, {{61, 99}, 6, 11}, {{61, 101}, 6, 11},
+    {{61, 101}, 6, 11}, {{61, 105}, 6, 11}, {{61, 105}, 6, 11},
+    {{61, 111}, 6, 11}, {{61, 111}, 6, 11}, {{61, 115}, 6, 11},
+    {{61, 115}, 6, 11}, {{61, 116}, 6, 11}, {{61, 116}, 6, 11},
+    {{61, 32}, 6, 12}, {{61, 37}, 6, 12}, {{61, 45}, 6, 12}, {{61, 46}, 6, 12},
+    {{61, 47}, 6, 12}, {{61, 51}, 6, 12}, {{61, 52}, 6, 12}, {{61, 53}, 6, 12},
+    {{61, 54}, 6, 12}, {{61, 55}, 6, 12}, {{61, 56}, 6, 12}, {{61, 57}, 6, 12},
+    {{61, 61}, 6, 12}, {{61, 65}, 6, 12}, {{61, 95}, 6, 12}, {{61, 98}, 6, 12},
+    {{61, 100}, 6, 12}, {{61, 102}, 6, 12}, {{61, 103}, 6, 12},
+    {{61, 104}, 6, 12}, {{61, 108}, 6, 12}, {{61, 109}, 6, 12},
+    {{61, 110}, 6, 12}, {{61, 112}, 6, 12}, {{61, 114}, 6, 12},
+    {{61, 117}, 6, 12}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6},
+    {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6},
+    {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6},
+    {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6},
+    {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{61, 0}, 6, 6}, {{65, 48}, 6, 11},
+    {{65, 48}, 6, 11}, {{65, 49}, 6, 11}, {{65, 49}, 6, 11}, {{65, 50}, 6, 11},
+    {{65, 50}, 6, 11}, {{65, 97}, 6, 11}, {{65, 97}, 6, 11}, {{65, 99}, 6, 11},
+    {{65, 99}, 6, 11}, {{65, 101}, 6, 11}, {{65, 101}, 6, 11},
+    {{65, 105}, 6, 11}, {{65, 105}, 6, 11}, {{65, 111}, 6, 11},
+    {{65, 111}, 6, 11}, {{65, 115}, 6, 11}, {{65, 115}, 6, 11},
+    {{65, 116}, 6, 11}, {{65, 116}, 6, 11}, {{65, 32}, 6, 12},
+    {{65, 37}, 6, 12}, {{65, 45}, 6, 12}, {{65, 46}, 6, 12}, {{65, 47}, 6, 12},
+    {{65, 51}, 6, 12}, {{65, 52}, 6, 12}, {{65, 53}, 6, 12}, {{65, 54}, 6, 12},
+    {{65, 55}, 6, 12}, {{65, 56}, 6, 12}, {{65, 57}, 6, 12}, {{65, 61}, 6, 12},
+    {{65, 65}, 6, 12}, {{65, 95}, 6, 12}, {{65, 98}, 6, 12}, {{65, 100}, 6, 12},
+    {{65, 102}, 6, 12}, {{65, 103}, 6, 12}, {{65, 104}, 6, 12},
+    {{65, 108}, 6, 12}, {{65, 109}, 6, 12}, {{65, 110}, 6, 12},
+    {{65, 112}, 6, 12}, {{65, 114}, 6, 12}, {{65, 117}, 6, 12}, {{65, 0}, 6, 6},
+    {{65, 0}, 6, 6}, {{65, 0}, 6, 6}, {{65, 0}, 6, 6}, {{65, 0}, 6, 6},
+    {{65, 0}, 6, 6}, {{65, 0}, 6, 6}, {{65, 0}, 6, 6}, {{65, 0}, 6, 6},
+    {{65, 0}, 6, 6}, {{65, 0}, 6, 6}, {{65, 0}, 6, 6}, {{65, 0}, 6, 6},
+    {{65, 0}, 6, 6}, {{65, 0}, 6, 6}, {{65, 0}, 6, 6}, {{65, 0}, 6, 6},
+    {{65, 0}, 6, 6}, {{95, 48}, 6, 11}, {{95, 48}, 6, 11}, {{95, 49}, 6, 11},
+    {{95, 49}, 6, 11}, {{95, 50}, 6, 11}, {{95, 50}, 6, 11}, {{95, 97}, 6, 11},
+    {{95, 97}, 6, 11}, {{95, 99}, 6, 11}, {{95, 99}, 6, 11}, {{95, 101}, 6, 11},
+    {{95, 101}, 6, 11}, {{95, 105}, 6, 11}, {{95, 105}, 6, 11},
+    {{95, 111}, 6, 11}, {{95, 111}, 6, 11}, {{95, 115}, 6, 11},
+    {{95, 115}, 6, 11}, {{95, 116}, 6, 11}, {{95, 116}, 6, 11},
+    {{95, 32}, 6, 12}, {{95, 37}, 6, 12}, {{95, 45}, 6, 12}, {{95, 46}, 6, 12},
+    {{95, 47}, 6, 12}, {{95, 51}, 6, 12}, {{95, 52}, 6, 12}, {{95, 53}, 6, 12},
+    {{95, 54}, 6, 12}, {{95, 55}, 6, 12}, {{95, 56}, 6, 12}, {{95, 57}, 6, 12},
+    {{95, 61}, 6, 12}, {{95, 65}, 6, 12}, {{95, 95}, 6, 12}, {{95, 98}, 6, 12},
+    {{95, 100}, 6, 12}, {{95, 102}, 6, 12}, {{95, 103}, 6, 12},
+    {{95, 104}, 6, 12}, {{95, 108}, 6, 12}, {{95, 109}, 6, 12},
+    {{95, 110}, 6, 12}, {{95, 112}, 6, 12}, {{95, 114}, 6, 12},
+    {{95, 117}, 6, 12}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6},
+    {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6},
+    {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6},
+    {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6},
+    {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{95, 0}, 6, 6}, {{98, 48}, 6, 11},
+    {{98, 48}, 6, 11}, {{98, 49}, 6, 11}, {{98, 49}, 6, 11}, {{98, 50}, 6, 11},
+    {{98, 50}, 6, 11}, {{98, 97}, 6, 11}, {{98, 97}, 6, 11}, {{98, 99}, 6, 11},
+    {{98, 99}, 6, 11}, {{98, 101}, 6, 11}, {{98, 101}, 6, 11},
+    {{98, 105}, 6, 11}, {{98, 105}, 6, 11}, {{98, 111}, 6, 11},
+    {{98, 111}, 6, 11}, {{98, 115}, 6, 11}, {{98, 115}, 6, 11},
+    {{98, 116}, 6, 11}, {{98, 116}, 6, 11}, {{98, 32}, 6, 12},
+    {{98, 37}, 6, 12}, {{98, 45}, 6, 12}, {{98, 46}, 6, 12}, {{98, 47}, 6, 12},
+    {{98, 51}, 6, 12}, {{98, 52}, 6, 12}, {{98, 53}, 6, 12}, {{98, 54}, 6, 12},
+    {{98, 55}, 6, 12}, {{98, 56}, 6, 12}, {{98, 57}, 6, 12}, {{98, 61}, 6, 12},
+    {{98, 65}, 6, 12}, {{98, 95}, 6, 12}, {{98, 98}, 6, 12}, {{98, 100}, 6, 12},
+    {{98, 102}, 6, 12}, {{98, 103}, 6, 12}, {{98, 104}, 6, 12},
+    {{98, 108}, 6, 12}, {{98, 109}, 6, 12}, {{98, 110}, 6, 12},
+    {{98, 112}, 6, 12}, {{98, 114}, 6, 12}, {{98, 117}, 6, 12}, {{98, 0}, 6, 6},
+    {{98, 0}, 6, 6}, {{98, 0}, 6, 6}, {{98, 0}, 6, 6}, {{98, 0}, 6, 6},
+    {{98, 0}, 6, 6}, {{98, 0}, 6, 6}, {{98, 0}, 6, 6}, {{98, 0}, 6, 6},
+    {{98, 0}, 6, 6}, {{98, 0}, 6, 6}, {{98, 0}, 6, 6}, {{98, 0}, 6, 6},
+    {{98, 0}, 6, 6}, {{98, 0}, 6, 6}, {{98, 0}, 6, 6}, {{98, 0}, 6, 6},
+    {{98, 0}, 6, 6}, {{100, 48}, 6, 11}, {{100, 48}, 6, 11}, {{100, 49}, 6, 11},
+    {{100, 49}, 6, 11}, {{100, 50}, 6, 11}, {{100, 50}, 6, 11},
+    {{100, 97}, 6, 11}, {{100, 97}, 6, 11}, {{100, 99}, 6, 11},
+    {{100, 99}, 6, 11}, {{100, 101}, 6, 11}, {{100, 101}, 6, 11},
+    {{100, 105}, 6, 11}, {{100, 105}, 6, 11}, {{100, 111}, 6, 11},
+    {{100, 111}, 6, 11}, {{100, 115}, 6, 11}, {{100, 115}, 6, 11},
+    {{100, 116}, 6, 11}, {{100, 116}, 6, 11}, {{100, 32}, 6, 12},
+    {{100, 37}, 6, 12}, {{100, 45}, 6, 12}, {{100, 46}, 6, 12},
+    {{100, 47}, 6, 12}, {{100, 51}, 6, 12}, {{100, 52}, 6, 12},
+    {{100, 53}, 6, 12}, {{100, 54}, 6, 12}, {{100, 55}, 6, 12},
+    {{100, 56}, 6, 12}, {{100, 57}, 6, 12}, {{100, 61}, 6, 12},
+    {{100, 65}, 6, 12}, {{100, 95}, 6, 12}, {{100, 98}, 6, 12},
+    {{100, 100}, 6, 12}, {{100, 102}, 6, 12}, {{100, 103}, 6, 12},
+    {{100, 104}, 6, 12}, {{100, 108}, 6, 12}, {{100, 109}, 6, 12},
+    {{100, 110}, 6, 12}, {{100, 112}, 6, 12}, {{100, 114}, 6, 12},
+    {{100, 117}, 6, 12}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6},
+    {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6},
+    {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6},
+    {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6},
+    {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{100, 0}, 6, 6}, {{102, 48}, 6, 11},
+    {{102, 48}, 6, 11}, {{102, 49}, 6, 11}, {{102, 49}, 6, 11},
+    {{102, 50}, 6, 11}, {{102, 50}, 6, 11}, {{102, 97}, 6, 11},
+    {{102, 97}, 6, 11}, {{102, 99}, 6, 11}, {{102, 99}, 6, 11},
+    {{102, 101}, 6, 11}, {{102, 101}, 6, 11}, {{102, 105}, 6, 11},
+    {{102, 105}, 6, 11}, {{102, 111}, 6, 11}, {{102, 111}, 6, 11},
+    {{102, 115}, 6, 11}, {{102, 115}, 6, 11}, {{102, 116}, 6, 11},
+    {{102, 116}, 6, 11}, {{102, 32}, 6, 12}, {{102, 37}, 6, 12},
+    {{102, 45}, 6, 12}, {{102, 46}, 6, 12}, {{102, 47}, 6, 12},
+    {{102, 51}, 6, 12}, {{102, 52}, 6, 12}, {{102, 53}, 6, 12},
+    {{102, 54}, 6, 12}, {{102, 55}, 6, 12}, {{102, 56}, 6, 12},
+    {{102, 57}, 6, 12}, {{102, 61}, 6, 12}, {{102, 65}, 6, 12},
+    {{102, 95}, 6, 12}, {{102, 98}, 6, 12}, {{102, 100}, 6, 12},
+    {{102, 102}, 6, 12}, {{102, 103}, 6, 12}, {{102, 104}, 6, 12},
+    {{102, 108}, 6, 12}, {{102, 109}, 6, 12}, {{102, 110}, 6, 12},
+    {{102, 112}, 6, 12}, {{102, 114}, 6, 12}, {{102, 117}, 6, 12},
+    {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{102, 0}, 6, 6},
+    {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{102, 0}, 6, 6},
+    {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{102, 0}, 6, 6},
+    {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{102, 0}, 6, 6},
+    {{102, 0}, 6, 6}, {{102, 0}, 6, 6}, {{103, 48}, 6, 11}, {{103, 48}, 6, 11},
+    {{103, 49}, 6, 11}, {{103, 49}, 6, 11}, {{103, 50}, 6, 11},
+    {{103, 50}, 6, 11}, {{103, 97}, 6, 11}, {{103, 97}, 6, 11},
+    {{103, 99}, 6, 11}, {{103, 99}, 6, 11}, {{103, 101}, 6, 11},
+    {{103, 101}, 6, 11}, {{103, 105}, 6, 11}, {{103, 105}, 6, 11},
+    {{103, 111}, 6, 11}, {{103, 111}, 6, 11}, {{103, 115}, 6, 11},
+    {{103, 115}, 6, 11}, {{103, 116}, 6, 11}, {{103, 116}, 6, 11},
+    {{103, 32}, 6, 12}, {{103, 37}, 6, 12}, {{103, 45}, 6, 12},
+    {{103, 46}, 6, 12}, {{103, 47}, 6, 12}, {{103, 51}, 6, 12},
+    {{103, 52}, 6, 12}, {{103, 53}, 6, 12}, {{103, 54}, 6, 12},
+    {{103, 55}, 6, 12}, {{103, 56}, 6, 12}, {{103, 57}, 6, 12},
+    {{103, 61}, 6, 12}, {{103, 65}, 6, 12}, {{103, 95}, 6, 12},
+    {{103, 98}, 6, 12}, {{103, 100}, 6, 12}, {{103, 102}, 6, 12},
+    {{103, 103}, 6, 12}, {{103, 104}, 6, 12}, {{103, 108}, 6, 12},
+    {{103, 109}, 6, 12}, {{103, 110}, 6, 12}, {{103, 112}, 6, 12},
+    {{103, 114}, 6, 12}, {{103, 117}, 6, 12}, {{103, 0}, 6, 6},
+    {{103, 0}, 6, 6}, {{103, 0}, 6, 6}, {{103, 0}, 6, 6}, {{103, 0}, 6, 6},
+    {{103, 0}, 6, 6}, {{103, 0}, 6, 6}, {{103, 0}, 6, 6}, {{103, 0}, 6, 6},
+    {{103, 0}, 6, 6}, {{103, 0}, 6, 6}, {{103, 0}, 6, 6}, {{103, 0}, 6, 6},
+    {{103, 0}, 6, 6}, {{103, 0}, 6, 6}, {{103, 0}, 6, 6}, {{103, 0}, 6, 6},
+    {{103, 0}, 6, 6}, {{104, 48}, 6, 11}, {{104, 48}, 6, 11},
+    {{104, 49}, 6, 11}, {{104, 49}, 6, 11}, {{104, 50}, 6, 11},
+    {{104, 50}, 6, 11}, {{104, 97}, 6, 11}, {{104, 97}, 6, 11},
+    {{104, 99}, 6, 11}, {{104, 99}, 6, 11}, {{104, 101}, 6, 11},
+    {{104, 101}, 6, 11}, {{104, 105}, 6, 11}, {{104, 105}, 6, 11},
+    {{104, 111}, 6, 11}, {{104, 111}, 6, 11}, {{104, 115}, 6, 11},
+    {{104, 115}, 6, 11}, {{104, 116}, 6, 11}, {{104, 116}, 6, 11},
+    {{104, 32}, 6, 12}, {{104, 37}, 6, 12}, {{104, 45}, 6, 12},
+    {{104, 46}, 6, 12}, {{104, 47}, 6, 12}, {{104, 51}, 6, 12},
+    {{104, 52}, 6, 12}, {{104, 53}, 6, 12}, {{104, 54}, 6, 12},
+    {{104, 55}, 6, 12}, {{104, 56}, 6, 12}, {{104, 57}, 6, 12},
+    {{104, 61}, 6, 12}, {{104, 65}, 6, 12}, {{104, 95}, 6, 12},
+    {{104, 98}, 6, 12}, {{104, 100}, 6, 12}, {{104, 102}, 6, 12},
+    {{104, 103}, 6, 12}, {{104, 104}, 6, 12}, {{104, 108}, 6, 12},
+    {{104, 109}, 6, 12}, {{104, 110}, 6, 12}, {{104, 112}, 6, 12},
+    {{104, 114}, 6, 12}, {{104, 117}, 6, 12}, {{104, 0}, 6, 6},
+    {{104, 0}, 6, 6}, {{104, 0}, 6, 6}, {{104, 0}, 6, 6}, {{104, 0}, 6, 6},
+    {{104, 0}, 6, 6}, {{104, 0}, 6, 6}, {{104, 0}, 6, 6}, {{104, 0}, 6, 6},
+    {{104, 0}, 6, 6}, {{104, 0}, 6, 6}, {{104, 0}, 6, 6}, {{104, 0}, 6, 6},
+    {{104, 0}, 6, 6}, {{104, 0}, 6, 6}, {{104, 0}, 6, 6}, {{104, 0}, 6, 6},
+    {{104, 0}, 6, 6}, {{108, 48}, 6, 11}, {{108, 48}, 6, 11},
+    {{108, 49}, 6, 11}, {{108, 49}, 6, 11}, {{108, 50}, 6, 11},
+    {{108, 50}, 6, 11}, {{108, 97}, 6, 11}, {{108, 97}, 6, 11},
+    {{108, 99}, 6, 11}, {{108, 99}, 6, 11}, {{108, 101}, 6, 11},
+    {{108, 101}, 6, 11}, {{108, 105}, 6, 11}, {{108, 105}, 6, 11},
+    {{108, 111}, 6, 11}, {{108, 111}, 6, 11}, {{108, 115}, 6, 11},
+    {{108, 115}, 6, 11}, {{108, 116}, 6, 11}, {{108, 116}, 6, 11},
+    {{108, 32}, 6, 12}, {{108, 37}, 6, 12}, {{108, 45}, 6, 12},
+    {{108, 46}, 6, 12}, {{108, 47}, 6, 12}, {{108, 51}, 6, 12},
+    {{108, 52}, 6, 12}, {{108, 53}, 6, 12}, {{108, 54}, 6, 12},
+    {{108, 55}, 6, 12}, {{108, 56}, 6, 12}, {{108, 57}, 6, 12},
+    {{108, 61}, 6, 12}, {{108, 65}, 6, 12}, {{108, 95}, 6, 12},
+    {{108, 98}, 6, 12}, {{108, 100}, 6, 12}, {{108, 102}, 6, 12},
+    {{108, 103}, 6, 12}, {{108, 104}, 6, 12}, {{108, 108}, 6, 12},
+    {{108, 109}, 6, 12}, {{108, 110}, 6, 12}, {{108, 112}, 6, 12},
+    {{108, 114}, 6, 12}, {{108, 117}, 6, 12}, {{108, 0}, 6, 6},
+    {{108, 0}, 6, 6}, {{108, 0}, 6, 6}, {{108, 0}, 6, 6}, {{108, 0}, 6, 6},
+    {{108, 0}, 6, 6}, {{108, 0}, 6, 6}, {{108, 0}, 6, 6}, {{108, 0}, 6, 6},
+    {{108, 0}, 6, 6}, {{108, 0}, 6, 6}, {{108, 0}, 6, 6}, {{108, 0}, 6, 6},
+    {{108, 0}, 6, 6}, {{108, 0}, 6, 6}, {{108, 0}, 6, 6}, {{108, 0}, 6, 6},
+    {{108, 0}, 6, 6}, {{109, 48}, 6, 11}, {{109, 48}, 6, 11},
+    {{109, 49}, 6, 11}, {{109, 49}, 6, 11}, {{109, 50}, 6, 11},
+    {{109, 50}, 6, 11}, {{109, 97}, 6, 11}, {{109, 97}, 6, 11},
+    {{109, 99}, 6, 11}, {{109, 99}, 6, 11}, {{109, 101}, 6, 11},
+    {{109, 101}, 6, 11}, {{109, 105}, 6, 11}, {{109, 105}, 6, 11},
+    {{109, 111}, 6, 11}, {{109, 111}, 6, 11}, {{109, 115}, 6, 11},
+    {{109, 115}, 6, 11}, {{109, 116}, 6, 11}, {{109, 116}, 6, 11},
+    {{109, 32}, 6, 12}, {{109, 37}, 6, 12}, {{109, 45}, 6, 12},
+    {{109, 46}, 6, 12}, {{109, 47}, 6, 12}, {{109, 51}, 6, 12},
+    {{109, 52}, 6, 12}, {{109, 53}, 6, 12}, {{109, 54}, 6, 12},
+    {{109, 55}, 6, 12}, {{109, 56}, 6, 12}, {{109, 57}, 6, 12},
+    {{109, 61}, 6, 12}, {{109, 65}, 6, 12}, {{109, 95}, 6, 12},
+    {{109, 98}, 6, 12}, {{109, 100}, 6, 12}, {{109, 102}, 6, 12},
+    {{109, 103}, 6, 12}, {{109, 104}, 6, 12}, {{109, 108}, 6, 12},
+    {{109, 109}, 6, 12}, {{109, 110}, 6, 12}, {{109, 112}, 6, 12},
+    {{109, 114}, 6, 12}, {{109, 117}, 6, 12}, {{109, 0}, 6, 6},
+    {{109, 0}, 6, 6}, {{109, 0}, 6, 6}, {{109, 0}, 6, 6}, {{109, 0}, 6, 6},
+    {{109, 0}, 6, 6}, {{109, 0}, 6, 6}, {{109, 0}, 6, 6}, {{109, 0}, 6, 6},
+    {{109, 0}, 6, 6}, {{109, 0}, 6, 6}, {{109, 0}, 6, 6}, {{109, 0}, 6, 6},
+    {{109, 0}, 6, 6}, {{109, 0}, 6, 6}, {{109, 0}, 6, 6}, {{109, 0}, 6, 6},
+    {{109, 0}, 6, 6}, {{110, 48}, 6, 11}, {{110, 48}, 6, 11},
+    {{110, 49}, 6, 11}, {{110, 49}, 6, 11}, {{110, 50}, 6, 11},
+    {{110, 50}, 6, 11}, {{110, 97}, 6, 11}, {{110, 97}, 6, 11},
+    {{110, 99}, 6, 11}, {{110, 99}, 6, 11}, {{110, 101}, 6, 11},
+    {{110, 101}, 6, 11}, {{110, 105}, 6, 11}, {{110, 105}, 6, 11},
+    {{110, 111}, 6, 11}, {{110, 111}, 6, 11}, {{110, 115}, 6, 11},
+    {{110, 115}, 6, 11}, {{110, 116}, 6, 11}, {{110, 116}, 6, 11},
+    {{110, 32}, 6, 12}, {{110, 37}, 6, 12}, {{110, 45}, 6, 12},
+    {{110, 46}, 6, 12}, {{110, 47}, 6, 12}, {{110, 51}, 6, 12},
+    {{110, 52}, 6, 12}, {{110, 53}, 6, 12}, {{110, 54}, 6, 12},
+    {{110, 55}, 6, 12}, {{110, 56}, 6, 12}, {{110, 57}, 6, 12},
+    {{110, 61}, 6, 12}, {{110, 65}, 6, 12}, {{110, 95}, 6, 12},
+    {{110, 98}, 6, 12}, {{110, 100}, 6, 12}, {{110, 102}, 6, 12},
+    {{110, 103}, 6, 12}, {{110, 104}, 6, 12}, {{110, 108}, 6, 12},
+    {{110, 109}, 6, 12}, {{110, 110}, 6, 12}, {{110, 112}, 6, 12},
+    {{110, 114}, 6, 12}, {{110, 117}, 6, 12}, {{110, 0}, 6, 6},
+    {{110, 0}, 6, 6}, {{110, 0}, 6, 6}, {{110, 0}, 6, 6}, {{110, 0}, 6, 6},
+    {{110, 0}, 6, 6}, {{110, 0}, 6, 6}, {{110, 0}, 6, 6}, {{110, 0}, 6, 6},
+    {{110, 0}, 6, 6}, {{110, 0}, 6, 6}, {{110, 0}, 6, 6}, {{110, 0}, 6, 6},
+    {{110, 0}, 6, 6}, {{110, 0}, 6, 6}, {{110, 0}, 6, 6}, {{110, 0}, 6, 6},
+    {{110, 0}, 6, 6}, {{112, 48}, 6, 11}, {{112, 48}, 6, 11},
+    {{112, 49}, 6, 11}, {{112, 49}, 6, 11}, {{112, 50}, 6, 11},
+    {{112, 50}, 6, 11}, {{112, 97}, 6, 11}, {{112, 97}, 6, 11},
+    {{112, 99}, 6, 11}, {{112, 99}, 6, 11}, {{112, 101}, 6, 11},
+    {{112, 101}, 6, 11}, {{112, 105}, 6, 11}, {{112, 105}, 6, 11},
+    {{112, 111}, 6, 11}, {{112, 111}, 6, 11}, {{112, 115}, 6, 11},
+    {{112, 115}, 6, 11}, {{112, 116}, 6, 11}, {{112, 116}, 6, 11},
+    {{112, 32}, 6, 12}, {{112, 37}, 6, 12}, {{112, 45}, 6, 12},
+    {{112, 46}, 6, 12}, {{112, 47}, 6, 12}, {{112, 51}, 6, 12},
+    {{112, 52}, 6, 12}, {{112, 53}, 6, 12}, {{112, 54}, 6, 12},
+    {{112, 55}, 6, 12}, {{112, 56}, 6, 12}, {{112, 57}, 6, 12},
+    {{112, 61}, 6, 12}, {{112, 65}, 6, 12}, {{112, 95}, 6, 12},
+    {{112, 98}, 6, 12}, {{112, 100}, 6, 12}, {{112, 102}, 6, 12},
+    {{112, 103}, 6, 12}, {{112, 104}, 6, 12}, {{112, 108}, 6, 12},
+    {{112, 109}, 6, 12}, {{112, 110}, 6, 12}, {{112, 112}, 6, 12},
+    {{112, 114}, 6, 12}, {{112, 117}, 6, 12}, {{112, 0}, 6, 6},
+    {{112, 0}, 6, 6}, {{112, 0}, 6, 6}, {{112, 0}, 6, 6}, {{112, 0}, 6, 6},
+    {{112, 0}, 6, 6}, {{112, 0}, 6, 6}, {{112, 0}, 6, 6}, {{112, 0}, 6, 6},
+    {{112, 0}, 6, 6}, {{112, 0}, 6, 6}, {{112, 0}, 6, 6}, {{112, 0}, 6, 6},
+    {{112, 0}, 6, 6}, {{112, 0}, 6, 6}, {{112, 0}, 6, 6}, {{112, 0}, 6, 6},
+    {{112, 0}, 6, 6}, {{114, 48}, 6, 11}, {{114, 48}, 6, 11},
+    {{114, 49}, 6, 11}, {{114, 49}, 6, 11}, {{114, 50}, 6, 11},
+    {{114, 50}, 6, 11}, {{114, 97}, 6, 11}, {{114, 97}, 6, 11},
+    {{114, 99}, 6, 11}, {{114, 99}, 6, 11}, {{114, 101}, 6, 11},
+    {{114, 101}, 6, 11}, {{114, 105}, 6, 11}, {{114, 105}, 6, 11},
+    {{114, 111}, 6, 11}, {{114, 111}, 6, 11}, {{114, 115}, 6, 11},
+    {{114, 115}, 6, 11}, {{114, 116}, 6, 11}, {{114, 116}, 6, 11},
+    {{114, 32}, 6, 12}, {{114, 37}, 6, 12}, {{114, 45}, 6, 12},
+    {{114, 46}, 6, 12}, {{114, 47}, 6, 12}, {{114, 51}, 6, 12},
+    {{114, 52}, 6, 12}, {{114, 53}, 6, 12}, {{114, 54}, 6, 12},
+    {{114, 55}, 6, 12}, {{114, 56}, 6, 12}, {{114, 57}, 6, 12},
+    {{114, 61}, 6, 12}, {{114, 65}, 6, 12}, {{114, 95}, 6, 12},
+    {{114, 98}, 6, 12}, {{114, 100}, 6, 12}, {{114, 102}, 6, 12},
+    {{114, 103}, 6, 12}, {{114, 104}, 6, 12}, {{114, 108}, 6, 12},
+    {{114, 109}, 6, 12}, {{114, 110}, 6, 12}, {{114, 112}, 6, 12},
+    {{114, 114}, 6, 12}, {{114, 117}, 6, 12}, {{114, 0}, 6, 6},
+    {{114, 0}, 6, 6}, {{114, 0}, 6, 6}, {{114, 0}, 6, 6}, {{114, 0}, 6, 6},
+    {{114, 0}, 6, 6}, {{114, 0}, 6, 6}, {{114, 0}, 6, 6}, {{114, 0}, 6, 6},
+    {{114, 0}, 6, 6}, {{114, 0}, 6, 6}, {{114, 0}, 6, 6}, {{114, 0}, 6, 6},
+    {{114, 0}, 6, 6}, {{114, 0}, 6, 6}, {{114, 0}, 6, 6}, {{114, 0}, 6, 6},
+    {{114, 0}, 6, 6}, {{117, 48}, 6, 11}, {{117, 48}, 6, 11},
+    {{117, 49}, 6, 11}, {{117, 49}, 6, 11}, {{117, 50}, 6, 11},
+    {{117, 50}, 6, 11}, {{117, 97}, 6, 11}, {{117, 97}, 6, 11},
+    {{117, 99}, 6, 11}, {{117, 99}, 6, 11}, {{117, 101}, 6, 11},
+    {{117, 101}, 6, 11}, {{117, 105}, 6, 11}, {{117, 105}, 6, 11},
+    {{117, 111}, 6, 11}, {{117, 111}, 6, 11}, {{117, 115}, 6, 11},
+    {{117, 115}, 6, 11}, {{117, 116}, 6, 11}, {{117, 116}, 6, 11},
+    {{117, 32}, 6, 12}, {{117, 37}, 6, 12}, {{117, 45}, 6, 12},
+    {{117, 46}, 6, 12}, {{117, 47}, 6, 12}, {{117, 51}, 6, 12},
+    {{117, 52}, 6, 12}, {{117, 53}, 6, 12}, {{117, 54}, 6, 12},
+    {{117, 55}, 6, 12}, {{117, 56}, 6, 12}, {{117, 57}, 6, 12},
+    {{117, 61}, 6, 12}, {{117, 65}, 6, 12}, {{117, 95}, 6, 12},
+    {{117, 98}, 6, 12}, {{117, 100}, 6, 12}, {{117, 102}, 6, 12},
+    {{117, 103}, 6, 12}, {{117, 104}, 6, 12}, {{117, 108}, 6, 12},
+    {{117, 109}, 6, 12}, {{117, 110}, 6, 12}, {{117, 112}, 6, 12},
+    {{117, 114}, 6, 12}, {{117, 117}, 6, 12}, {{117, 0}, 6, 6},
+    {{117, 0}, 6, 6}, {{117, 0}, 6, 6}, {{117, 0}, 6, 6}, {{117, 0}, 6, 6},
+    {{117, 0}, 6, 6}, {{117, 0}, 6, 6}, {{117, 0}, 6, 6}, {{117, 0}, 6, 6},
+    {{117, 0}, 6, 6}, {{117, 0}, 6, 6}, {{117, 0}, 6, 6}, {{117, 0}, 6, 6},
+    {{117, 0}, 6, 6}, {{117, 0}, 6, 6}, {{117, 0}, 6, 6}, {{117, 0}, 6, 6},
+    {{117, 0}, 6, 6}, {{58, 48}, 7, 12}, {{58, 49}, 7, 12}, {{58, 50}, 7, 12},
+    {{58, 97}, 7, 12}, {{58, 99}, 7, 12}, {{58, 101}, 7, 12},
+    {{58, 105}, 7, 12}, {{58, 111}, 7, 12}, {{58, 115}, 7, 12},
+    {{58, 116}, 7, 12}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7},
+    {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7},
+    {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7},
+    {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7},
+    {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7},
+    {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{58, 0}, 7, 7}, {{66, 48}, 7, 12},
+    {{66, 49}, 7, 12}, {{66, 50}, 7, 12}, {{66, 97}, 7, 12}, {{66, 99}, 7, 12},
+    {{66, 101}, 7, 12}, {{66, 105}, 7, 12}, {{66, 111}, 7, 12},
+    {{66, 115}, 7, 12}, {{66, 116}, 7, 12}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7},
+    {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7},
+    {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7},
+    {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7},
+    {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7},
+    {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7}, {{66, 0}, 7, 7},
+    {{67, 48}, 7, 12}, {{67, 49}, 7, 12}, {{67, 50}, 7, 12}, {{67, 97}, 7, 12},
+    {{67, 99}, 7, 12}, {{67, 101}, 7, 12}, {{67, 105}, 7, 12},
+    {{67, 111}, 7, 12}, {{67, 115}, 7, 12}, {{67, 116}, 7, 12}, {{67, 0}, 7, 7},
+    {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7},
+    {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7},
+    {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7},
+    {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7},
+    {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7}, {{67, 0}, 7, 7},
+    {{67, 0}, 7, 7}, {{68, 48}, 7, 12}, {{68, 49}, 7, 12}, {{68, 50}, 7, 12},
+    {{68, 97}, 7, 12}, {{68, 99}, 7, 12}, {{68, 101}, 7, 12},
+    {{68, 105}, 7, 12}, {{68, 111}, 7, 12}, {{68, 115}, 7, 12},
+    {{68, 116}, 7, 12}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7},
+    {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7},
+    {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7},
+    {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7},
+    {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7},
+    {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{68, 0}, 7, 7}, {{69, 48}, 7, 12},
+    {{69, 49}, 7, 12}, {{69, 50}, 7, 12}, {{69, 97}, 7, 12}, {{69, 99}, 7, 12},
+    {{69, 101}, 7, 12}, {{69, 105}, 7, 12}, {{69, 111}, 7, 12},
+    {{69, 115}, 7, 12}, {{69, 116}, 7, 12}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7},
+    {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7},
+    {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7},
+    {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7},
+    {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7},
+    {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7}, {{69, 0}, 7, 7},
+    {{70, 48}, 7, 12}, {{70, 49}, 7, 12}, {{70, 50}, 7, 12}, {{70, 97}, 7, 12},
+    {{70, 99}, 7, 12}, {{70, 101}, 7, 12}, {{70, 105}, 7, 12},
+    {{70, 111}, 7, 12}, {{70, 115}, 7, 12}, {{70, 116}, 7, 12}, {{70, 0}, 7, 7},
+    {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7},
+    {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7},
+    {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7},
+    {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7},
+    {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7}, {{70, 0}, 7, 7},
+    {{70, 0}, 7, 7}, {{71, 48}, 7, 12}, {{71, 49}, 7, 12}, {{71, 50}, 7, 12},
+    {{71, 97}, 7, 12}, {{71, 99}, 7, 12}, {{71, 101}, 7, 12},
+    {{71, 105}, 7, 12}, {{71, 111}, 7, 12}, {{71, 115}, 7, 12},
+    {{71, 116}, 7, 12}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7},
+    {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7},
+    {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7},
+    {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7},
+    {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7},
+    {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{71, 0}, 7, 7}, {{72, 48}, 7, 12},
+    {{72, 49}, 7, 12}, {{72, 50}, 7, 12}, {{72, 97}, 7, 12}, {{72, 99}, 7, 12},
+    {{72, 101}, 7, 12}, {{72, 105}, 7, 12}, {{72, 111}, 7, 12},
+    {{72, 115}, 7, 12}, {{72, 116}, 7, 12}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7},
+    {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7},
+    {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7},
+    {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7},
+    {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7},
+    {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7}, {{72, 0}, 7, 7},
+    {{73, 48}, 7, 12}, {{73, 49}, 7, 12}, {{73, 50}, 7, 12}, {{73, 97}, 7, 12},
+    {{73, 99}, 7, 12}, {{73, 101}, 7, 12}, {{73, 105}, 7, 12},
+    {{73, 111}, 7, 12}, {{73, 115}, 7, 12}, {{73, 116}, 7, 12}, {{73, 0}, 7, 7},
+    {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7},
+    {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7},
+    {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7},
+    {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7},
+    {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7}, {{73, 0}, 7, 7},
+    {{73, 0}, 7, 7}, {{74, 48}, 7, 12}, {{74, 49}, 7, 12}, {{74, 50}, 7, 12},
+    {{74, 97}, 7, 12}, {{74, 99}, 7, 12}, {{74, 101}, 7, 12},
+    {{74, 105}, 7, 12}, {{74, 111}, 7, 12}, {{74, 115}, 7, 12},
+    {{74, 116}, 7, 12}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7},
+    {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7},
+    {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7},
+    {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7},
+    {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7},
+    {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{74, 0}, 7, 7}, {{75, 48}, 7, 12},
+    {{75, 49}, 7, 12}, {{75, 50}, 7, 12}, {{75, 97}, 7, 12}, {{75, 99}, 7, 12},
+    {{75, 101}, 7, 12}, {{75, 105}, 7, 12}, {{75, 111}, 7, 12},
+    {{75, 115}, 7, 12}, {{75, 116}, 7, 12}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7},
+    {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7},
+    {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7},
+    {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7},
+    {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7},
+    {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7}, {{75, 0}, 7, 7},
+    {{76, 48}, 7, 12}, {{76, 49}, 7, 12}, {{76, 50}, 7, 12}, {{76, 97}, 7, 12},
+    {{76, 99}, 7, 12}, {{76, 101}, 7, 12}, {{76, 105}, 7, 12},
+    {{76, 111}, 7, 12}, {{76, 115}, 7, 12}, {{76, 116}, 7, 12}, {{76, 0}, 7, 7},
+    {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7},
+    {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7},
+    {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7},
+    {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7},
+    {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7}, {{76, 0}, 7, 7},
+    {{76, 0}, 7, 7}, {{77, 48}, 7, 12}, {{77, 49}, 7, 12}, {{77, 50}, 7, 12},
+    {{77, 97}, 7, 12}, {{77, 99}, 7, 12}, {{77, 101}, 7, 12},
+    {{77, 105}, 7, 12}, {{77, 111}, 7, 12}, {{77, 115}, 7, 12},
+    {{77, 116}, 7, 12}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7},
+    {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7},
+    {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7},
+    {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7},
+    {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7},
+    {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{77, 0}, 7, 7}, {{78, 48}, 7, 12},
+    {{78, 49}, 7, 12}, {{78, 50}, 7, 12}, {{78, 97}, 7, 12}, {{78, 99}, 7, 12},
+    {{78, 101}, 7, 12}, {{78, 105}, 7, 12}, {{78, 111}, 7, 12},
+    {{78, 115}, 7, 12}, {{78, 116}, 7, 12}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7},
+    {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7},
+    {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7},
+    {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7},
+    {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7},
+    {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7}, {{78, 0}, 7, 7},
+    {{79, 48}, 7, 12}, {{79, 49}, 7, 12}, {{79, 50}, 7, 12}, {{79, 97}, 7, 12},
+    {{79, 99}, 7, 12}, {{79, 101}, 7, 12}, {{79, 105}, 7, 12},
+    {{79, 111}, 7, 12}, {{79, 115}, 7, 12}, {{79, 116}, 7, 12}, {{79, 0}, 7, 7},
+    {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7},
+    {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7},
+    {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7},
+    {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7},
+    {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7}, {{79, 0}, 7, 7},
+    {{79, 0}, 7, 7}, {{80, 48}, 7, 12}, {{80, 49}, 7, 12}, {{80, 50}, 7, 12},
+    {{80, 97}, 7, 12}, {{80, 99}, 7, 12}, {{80, 101}, 7, 12},
+    {{80, 105}, 7, 12}, {{80, 111}, 7, 12}, {{80, 115}, 7, 12},
+    {{80, 116}, 7, 12}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7},
+    {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7},
+    {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7},
+    {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7},
+    {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7},
+    {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{80, 0}, 7, 7}, {{81, 48}, 7, 12},
+    {{81, 49}, 7, 12}, {{81, 50}, 7, 12}, {{81, 97}, 7, 12}, {{81, 99}, 7, 12},
+    {{81, 101}, 7, 12}, {{81, 105}, 7, 12}, {{81, 111}, 7, 12},
+    {{81, 115}, 7, 12}, {{81, 116}, 7, 12}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7},
+    {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7},
+    {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7},
+    {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7},
+    {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7},
+    {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7}, {{81, 0}, 7, 7},
+    {{82, 48}, 7, 12}, {{82, 49}, 7, 12}, {{82, 50}, 7, 12}, {{82, 97}, 7, 12},
+    {{82, 99}, 7, 12}, {{82, 101}, 7, 12}, {{82, 105}, 7, 12},
+    {{82, 111}, 7, 12}, {{82, 115}, 7, 12}, {{82, 116}, 7, 12}, {{82, 0}, 7, 7},
+    {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7},
+    {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7},
+    {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7},
+    {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7},
+    {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7}, {{82, 0}, 7, 7},
+    {{82, 0}, 7, 7}, {{83, 48}, 7, 12}, {{83, 49}, 7, 12}, {{83, 50}, 7, 12},
+    {{83, 97}, 7, 12}, {{83, 99}, 7, 12}, {{83, 101}, 7, 12},
+    {{83, 105}, 7, 12}, {{83, 111}, 7, 12}, {{83, 115}, 7, 12},
+    {{83, 116}, 7, 12}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7},
+    {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7},
+    {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7},
+    {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7},
+    {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7},
+    {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{83, 0}, 7, 7}, {{84, 48}, 7, 12},
+    {{84, 49}, 7, 12}, {{84, 50}, 7, 12}, {{84, 97}, 7, 12}, {{84, 99}, 7, 12},
+    {{84, 101}, 7, 12}, {{84, 105}, 7, 12}, {{84, 111}, 7, 12},
+    {{84, 115}, 7, 12}, {{84, 116}, 7, 12}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7},
+    {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7},
+    {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7},
+    {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7},
+    {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7},
+    {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7}, {{84, 0}, 7, 7},
+    {{85, 48}, 7, 12}, {{85, 49}, 7, 12}, {{85, 50}, 7, 12}, {{85, 97}, 7, 12},
+    {{85, 99}, 7, 12}, {{85, 101}, 7, 12}, {{85, 105}, 7, 12},
+    {{85, 111}, 7, 12}, {{85, 115}, 7, 12}, {{85, 116}, 7, 12}, {{85, 0}, 7, 7},
+    {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7},
+    {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7},
+    {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7},
+    {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7},
+    {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7}, {{85, 0}, 7, 7},
+    {{85, 0}, 7, 7}, {{86, 48}, 7, 12}, {{86, 49}, 7, 12}, {{86, 50}, 7, 12},
+    {{86, 97}, 7, 12}, {{86, 99}, 7, 12}, {{86, 101}, 7, 12},
+    {{86, 105}, 7, 12}, {{86, 111}, 7, 12}, {{86, 115}, 7, 12},
+    {{86, 116}, 7, 12}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7},
+    {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7},
+    {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7},
+    {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7},
+    {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7},
+    {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{86, 0}, 7, 7}, {{87, 48}, 7, 12},
+    {{87, 49}, 7, 12}, {{87, 50}, 7, 12}, {{87, 97}, 7, 12}, {{87, 99}, 7, 12},
+    {{87, 101}, 7, 12}, {{87, 105}, 7, 12}, {{87, 111}, 7, 12},
+    {{87, 115}, 7, 12}, {{87, 116}, 7, 12}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7},
+    {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7},
+    {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7},
+    {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7},
+    {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7},
+    {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7}, {{87, 0}, 7, 7},
+    {{89, 48}, 7, 12}, {{89, 49}, 7, 12}, {{89, 50}, 7, 12}, {{89, 97}, 7, 12},
+    {{89, 99}, 7, 12}, {{89, 101}, 7, 12}, {{89, 105}, 7, 12},
+    {{89, 111}, 7, 12}, {{89, 115}, 7, 12}, {{89, 116}, 7, 12}, {{89, 0}, 7, 7},
+    {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7},
+    {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7},
+    {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7},
+    {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7},
+    {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7}, {{89, 0}, 7, 7},
+    {{89, 0}, 7, 7}, {{106, 48}, 7, 12}, {{106, 49}, 7, 12}, {{106, 50}, 7, 12},
+    {{106, 97}, 7, 12}, {{106, 99}, 7, 12}, {{106, 101}, 7, 12},
+    {{106, 105}, 7, 12}, {{106, 111}, 7, 12}, {{106, 115}, 7, 12},
+    {{106, 116}, 7, 12}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7},
+    {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7},
+    {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7},
+    {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7},
+    {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7},
+    {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{106, 0}, 7, 7}, {{107, 48}, 7, 12},
+    {{107, 49}, 7, 12}, {{107, 50}, 7, 12}, {{107, 97}, 7, 12},
+    {{107, 99}, 7, 12}, {{107, 101}, 7, 12}, {{107, 105}, 7, 12},
+    {{107, 111}, 7, 12}, {{107, 115}, 7, 12}, {{107, 116}, 7, 12},
+    {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7},
+    {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7},
+    {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7},
+    {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7},
+    {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{107, 0}, 7, 7},
+    {{107, 0}, 7, 7}, {{107, 0}, 7, 7}, {{113, 48}, 7, 12}, {{113, 49}, 7, 12},
+    {{113, 50}, 7, 12}, {{113, 97}, 7, 12}, {{113, 99}, 7, 12},
+    {{113, 101}, 7, 12}, {{113, 105}, 7, 12}, {{113, 111}, 7, 12},
+    {{113, 115}, 7, 12}, {{113, 116}, 7, 12}, {{113, 0}, 7, 7},
+    {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7},
+    {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7},
+    {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7},
+    {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7},
+    {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7}, {{113, 0}, 7, 7},
+    {{113, 0}, 7, 7}, {{118, 48}, 7, 12}, {{118, 49}, 7, 12},
+    {{118, 50}, 7, 12}, {{118, 97}, 7, 12}, {{118, 99}, 7, 12},
+    {{118, 101}, 7, 12}, {{118, 105}, 7, 12}, {{118, 111}, 7, 12},
+    {{118, 115}, 7, 12}, {{118, 116}, 7, 12}, {{118, 0}, 7, 7},
+    {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7},
+    {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7},
+    {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7},
+    {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7},
+    {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7}, {{118, 0}, 7, 7},
+    {{118, 0}, 7, 7}, {{119, 48}, 7, 12}, {{119, 49}, 7, 12},
+    {{119, 50}, 7, 12}, {{119, 97}, 7, 12}, {{119, 99}, 7, 12},
+    {{119, 101}, 7, 12}, {{119, 105}, 7, 12}, {{119, 111}, 7, 12},
+    {{119, 115}, 7, 12}, {{119, 116}, 7, 12}, {{119, 0}, 7, 7},
+    {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7},
+    {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7},
+    {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7},
+    {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7},
+    {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7}, {{119, 0}, 7, 7},
+    {{119, 0}, 7, 7}, {{120, 48}, 7, 12}, {{120, 49}, 7, 12},
+    {{120, 50}, 7, 12}, {{120, 97}, 7, 12}, {{120, 99}, 7, 12},
+    {{120, 101}, 7, 12}, {{120, 105}, 7, 12}, {{120, 111}, 7, 12},
+    {{120, 115}, 7, 12}, {{120, 116}, 7, 12}, {{120, 0}, 7, 7},
+    {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7},
+    {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7},
+    {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7},
+    {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7},
+    {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7}, {{120, 0}, 7, 7},
+    {{120, 0}, 7, 7}, {{121, 48}, 7, 12}, {{121, 49}, 7, 12},
+    {{121, 50}, 7, 12}, {{121, 97}, 7, 12}, {{121, 99}, 7, 12},
+    {{121, 101}, 7, 12}, {{121, 105}, 7, 12}, {{121, 111}, 7, 12},
+    {{121, 115}, 7, 12}, {{121, 116}, 7, 12}, {{121, 0}, 7, 7},
+    {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7},
+    {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7},
+    {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7},
+    {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7},
+    {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7}, {{121, 0}, 7, 7},
+    {{121, 0}, 7, 7}, {{122, 48}, 7, 12}, {{122, 49}, 7, 12},
+    {{122, 50}, 7, 12}, {{122, 97}, 7, 12}, {{122, 99}, 7, 12},
+    {{122, 101}, 7, 12}, {{122, 105}, 7, 12}, {{122, 111}, 7, 12},
+    {{122, 115}, 7, 12}, {{122, 116}, 7, 12}, {{122, 0}, 7, 7},
+    {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7},
+    {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7},
+    {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7},
+    {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7},
+    {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7}, {{122, 0}, 7, 7},
+    {{122, 0}, 7, 7}, {{38, 0}, 8, 8}, {{38, 0}, 8, 8}, {{38, 0}, 8, 8},
+    {{38, 0}, 8, 8}, {{38, 0}, 8, 8}, {{38, 0}, 8, 8}, {{38, 0}, 8, 8},
+    {{38, 0}, 8, 8}, {{38, 0}, 8, 8}, {{38, 0}, 8, 8}, {{38, 0}, 8, 8},
+    {{38, 0}, 8, 8}, {{38, 0}, 8, 8}, {{38, 0}, 8, 8}, {{38, 0}, 8, 8},
+    {{38, 0}, 8, 8}, {{42, 0}, 8, 8}, {{42, 0}, 8, 8}, {{42, 0}, 8, 8},
+    {{42, 0}, 8, 8}, {{42, 0}, 8, 8}, {{42, 0}, 8, 8}, {{42, 0}, 8, 8},
+    {{42, 0}, 8, 8}, {{42, 0}, 8, 8}, {{42, 0}, 8, 8}, {{42, 0}, 8, 8},
+    {{42, 0}, 8, 8}, {{42, 0}, 8, 8}, {{42, 0}, 8, 8}, {{42, 0}, 8, 8},
+    {{42, 0}, 8, 8}, {{44, 0}, 8, 8}, {{44, 0}, 8, 8}, {{44, 0}, 8, 8},
+    {{44, 0}, 8, 8}, {{44, 0}, 8, 8}, {{44, 0}, 8, 8}, {{44, 0}, 8, 8},
+    {{44, 0}, 8, 8}, {{44, 0}, 8, 8}, {{44, 0}, 8, 8}, {{44, 0}, 8, 8},
+    {{44, 0}, 8, 8}, {{44, 0}, 8, 8}, {{44, 0}, 8, 8}, {{44, 0}, 8, 8},
+    {{44, 0}, 8, 8}, {{59, 0}, 8, 8}, {{59, 0}, 8, 8}, {{59, 0}, 8, 8},
+    {{59, 0}, 8, 8}, {{59, 0}, 8, 8}, {{59, 0}, 8, 8}, {{59, 0}, 8, 8},
+    {{59, 0}, 8, 8}, {{59, 0}, 8, 8}, {{59, 0}, 8, 8}, {{59, 0}, 8, 8},
+    {{59, 0}, 8, 8}, {{59, 0}, 8, 8}, {{59, 0}, 8, 8}, {{59, 0}, 8, 8},
+    {{59, 0}, 8, 8}, {{88, 0}, 8, 8}, {{88, 0}, 8, 8}, {{88, 0}, 8, 8},
+    {{88, 0}, 8, 8}, {{88, 0}, 8, 8}, {{88, 0}, 8, 8}, {{88, 0}, 8, 8},
+    {{88, 0}, 8, 8}, {{88, 0}, 8, 8}, {{88, 0}, 8, 8}, {{88, 0}, 8, 8},
+    {{88, 0}, 8, 8}, {{88, 0}, 8, 8}, {{88, 0}, 8, 8}, {{88, 0}, 8, 8},
+    {{88, 0}, 8, 8}, {{90, 0}, 8, 8}, {{90, 0}, 8, 8}, {{90, 0}, 8, 8},
+    {{90, 0}, 8, 8}, {{90, 0}, 8, 8}, {{90, 0}, 8, 8}, {{90, 0}, 8, 8},
+    {{90, 0}, 8, 8}, {{90, 0}, 8, 8}, {{90, 0}, 8, 8}, {{90, 0}, 8, 8},
+    {{90, 0}, 8, 8}, {{90, 0}, 8, 8}, {{90, 0}, 8, 8}, {{90, 0}, 8, 8},
+    {{90, 0}, 8, 8}, {{33, 0}, 10, 10}, {{33, 0}, 10, 10}, {{33, 0}, 10, 10},
+    {{33, 0}, 10, 10}, {{34, 0}, 10, 10}, {{34, 0}, 10, 10}, {{34, 0}, 10, 10},
+    {{34, 0}, 10, 10}, {{40, 0}, 10, 10}, {{40, 0}, 10, 10}, {{40, 0}, 10, 10},
+    {{40, 0}, 10, 10}, {{41, 0}, 10, 10}, {{41, 0}, 10, 10}, {{41, 0}, 10, 10},
+    {{41, 0}, 10, 10}, {{63, 0}, 10, 10}, {{63, 0}, 10, 10}, {{63, 0}, 10, 10},
+    {{63, 0}, 10, 10}, {{39, 0}, 11, 11}, {{39, 0}, 11, 11}, {{43, 0}, 11, 11},
+    {{43, 0}, 11, 11}, {{124, 0}, 11, 11}, {{124, 0}, 11, 11},
+    {{35, 0}, 12, 12}, {{62, 0}, 12, 12}, {{0, 0}, 0, 0}, {{0, 0}, 0, 0},
+    {{0, 0}, 0, 0}, {{0, 0}, 0, 0}
+};
+
+const nghttp3_qpack_huffman_decode_length qpack_huffman_decode_lengths[] = {
+    {0x0u, 0x0u, 0}, {0x0u, 0x0u, 0}, {0x0u, 0x0u, 0}, {0x0u, 0x0u, 0},
+    {0x0u, 0x0u, 0}, {0x0u, 0xau, 0}, {0x14u, 0x2eu, 10}, {0x5cu, 0x7cu, 36},
+    {0xf8u, 0xfeu, 68}, {0x1fcu, 0x1fcu, 0}, {0x3f8u, 0x3fdu, 74},
+    {0x7fau, 0x7fdu, 79}, {0xffau, 0xffcu, 82}, {0x1ff8u, 0x1ffeu, 84},
+    {0x3ffcu, 0x3ffeu, 90}, {0x7ffcu, 0x7fffu, 92}, {0xfffeu, 0xfffeu, 0},
+    {0x1fffcu, 0x1fffcu, 0}, {0x3fff8u, 0x3fff8u, 0}, {0x7fff0u, 0x7fff3u, 95},
+    {0xfffe6u, 0xfffeeu, 98}, {0x1fffdcu, 0x1fffe9u, 106},
+    {0x3fffd2u, 0x3fffecu, 119}, {0x7fffd8u, 0x7ffff5u, 145},
+    {0xffffeau, 0xfffff6u, 174}, {0x1ffffecu, 0x1fffff0u, 186},
+    {0x3ffffe0u, 0x3ffffefu, 190}, {0x7ffffdeu, 0x7fffff1u, 205},
+    {0xfffffe2u, 0xfffffffu, 224}, {0x1ffffffeu, 0x1ffffffeu, 0},
+    {0x3ffffffcu, 0x40000000u, 253}
+};
 
-const nghttp3_qpack_huffman_decode_node qpack_huffman_decode_table[][16] = {
-    /* 0 */
-    {
-        {0x04, 0},
-        {0x05, 0},
-        {0x07, 0},
-        {0x08, 0},
-        {0x0b, 0},
-        {0x0c, 0},
-        {0x10, 0},
-        {0x13, 0},
-        {0x19, 0},
-        {0x1c, 0},
-        {0x20, 0},
-        {0x23, 0},
-        {0x2a, 0},
-        {0x31, 0},
-        {0x39, 0},
-        {0x4040, 0},
-    },
-    /* 1 */
-    {
-        {0xc000, 48},
-        {0xc000, 49},
-        {0xc000, 50},
-        {0xc000, 97},
-        {0xc000, 99},
-        {0xc000, 101},
-        {0xc000, 105},
-        {0xc000, 111},
-        {0xc000, 115},
-        {0xc000, 116},
-        {0x0d, 0},
-        {0x0e, 0},
-        {0x11, 0},
-        {0x12, 0},
-        {0x14, 0},
-        {0x15, 0},
-    },
-    /* 2 */
-    {
-        {0x8001, 48},
-        {0xc016, 48},
-        {0x8001, 49},
-        {0xc016, 49},
-        {0x8001, 50},
-        {0xc016, 50},
-        {0x8001, 97},
-        {0xc016, 97},
-        {0x8001, 99},
-        {0xc016, 99},
-        {0x8001, 101},
-        {0xc016, 101},
-        {0x8001, 105},
-        {0xc016, 105},
-        {0x8001, 111},
-        {0xc016, 111},
-    },
-    /* 3 */
-    {
-        {0x8002, 48},
-        {0x8009, 48},
-        {0x8017, 48},
-        {0xc028, 48},
-        {0x8002, 49},
-        {0x8009, 49},
-        {0x8017, 49},
-        {0xc028, 49},
-        {0x8002, 50},
-        {0x8009, 50},
-        {0x8017, 50},
-        {0xc028, 50},
-        {0x8002, 97},
-        {0x8009, 97},
-        {0x8017, 97},
-        {0xc028, 97},
-    },
-    /* 4 */
-    {
-        {0x8003, 48},
-        {0x8006, 48},
-        {0x800a, 48},
-        {0x800f, 48},
-        {0x8018, 48},
-        {0x801f, 48},
-        {0x8029, 48},
-        {0xc038, 48},
-        {0x8003, 49},
-        {0x8006, 49},
-        {0x800a, 49},
-        {0x800f, 49},
-        {0x8018, 49},
-        {0x801f, 49},
-        {0x8029, 49},
-        {0xc038, 49},
-    },
-    /* 5 */
-    {
-        {0x8003, 50},
-        {0x8006, 50},
-        {0x800a, 50},
-        {0x800f, 50},
-        {0x8018, 50},
-        {0x801f, 50},
-        {0x8029, 50},
-        {0xc038, 50},
-        {0x8003, 97},
-        {0x8006, 97},
-        {0x800a, 97},
-        {0x800f, 97},
-        {0x8018, 97},
-        {0x801f, 97},
-        {0x8029, 97},
-        {0xc038, 97},
-    },
-    /* 6 */
-    {
-        {0x8002, 99},
-        {0x8009, 99},
-        {0x8017, 99},
-        {0xc028, 99},
-        {0x8002, 101},
-        {0x8009, 101},
-        {0x8017, 101},
-        {0xc028, 101},
-        {0x8002, 105},
-        {0x8009, 105},
-        {0x8017, 105},
-        {0xc028, 105},
-        {0x8002, 111},
-        {0x8009, 111},
-        {0x8017, 111},
-        {0xc028, 111},
-    },
-    /* 7 */
-    {
-        {0x8003, 99},
-        {0x8006, 99},
-        {0x800a, 99},
-        {0x800f, 99},
-        {0x8018, 99},
-        {0x801f, 99},
-        {0x8029, 99},
-        {0xc038, 99},
-        {0x8003, 101},
-        {0x8006, 101},
-        {0x800a, 101},
-        {0x800f, 101},
-        {0x8018, 101},
-        {0x801f, 101},
-        {0x8029, 101},
-        {0xc038, 101},
-    },
-    /* 8 */
-    {
-        {0x8003, 105},
-        {0x8006, 105},
-        {0x800a, 105},
-        {0x800f, 105},
-        {0x8018, 105},
-        {0x801f, 105},
-        {0x8029, 105},
-        {0xc038, 105},
-        {0x8003, 111},
-        {0x8006, 111},
-        {0x800a, 111},
-        {0x800f, 111},
-        {0x8018, 111},
-        {0x801f, 111},
-        {0x8029, 111},
-        {0xc038, 111},
-    },
-    /* 9 */
-    {
-        {0x8001, 115},
-        {0xc016, 115},
-        {0x8001, 116},
-        {0xc016, 116},
-        {0xc000, 32},
-        {0xc000, 37},
-        {0xc000, 45},
-        {0xc000, 46},
-        {0xc000, 47},
-        {0xc000, 51},
-        {0xc000, 52},
-        {0xc000, 53},
-        {0xc000, 54},
-        {0xc000, 55},
-        {0xc000, 56},
-        {0xc000, 57},
-    },
-    /* 10 */
-    {
-        {0x8002, 115},
-        {0x8009, 115},
-        {0x8017, 115},
-        {0xc028, 115},
-        {0x8002, 116},
-        {0x8009, 116},
-        {0x8017, 116},
-        {0xc028, 116},
-        {0x8001, 32},
-        {0xc016, 32},
-        {0x8001, 37},
-        {0xc016, 37},
-        {0x8001, 45},
-        {0xc016, 45},
-        {0x8001, 46},
-        {0xc016, 46},
-    },
-    /* 11 */
-    {
-        {0x8003, 115},
-        {0x8006, 115},
-        {0x800a, 115},
-        {0x800f, 115},
-        {0x8018, 115},
-        {0x801f, 115},
-        {0x8029, 115},
-        {0xc038, 115},
-        {0x8003, 116},
-        {0x8006, 116},
-        {0x800a, 116},
-        {0x800f, 116},
-        {0x8018, 116},
-        {0x801f, 116},
-        {0x8029, 116},
-        {0xc038, 116},
-    },
-    /* 12 */
-    {
-        {0x8002, 32},
-        {0x8009, 32},
-        {0x8017, 32},
-        {0xc028, 32},
-        {0x8002, 37},
-        {0x8009, 37},
-        {0x8017, 37},
-        {0xc028, 37},
-        {0x8002, 45},
-        {0x8009, 45},
-        {0x8017, 45},
-        {0xc028, 45},
-        {0x8002, 46},
-        {0x8009, 46},
-        {0x8017, 46},
-        {0xc028, 46},
-    },
-    /* 13 */
-    {
-        {0x8003, 32},
-        {0x8006, 32},
-        {0x800a, 32},
-        {0x800f, 32},
-        {0x8018, 32},
-        {0x801f, 32},
-        {0x8029, 32},
-        {0xc038, 32},
-        {0x8003, 37},
-        {0x8006, 37},
-        {0x800a, 37},
-        {0x800f, 37},
-        {0x8018, 37},
-        {0x801f, 37},
-        {0x8029, 37},
-        {0xc038, 37},
-    },
-    /* 14 */
-    {
-        {0x8003, 45},
-        {0x8006, 45},
-        {0x800a, 45},
-        {0x800f, 45},
-        {0x8018, 45},
-        {0x801f, 45},
-        {0x8029, 45},
-        {0xc038, 45},
-        {0x8003, 46},
-        {0x8006, 46},
-        {0x800a, 46},
-        {0x800f, 46},
-        {0x8018, 46},
-        {0x801f, 46},
-        {0x8029, 46},
-        {0xc038, 46},
-    },
-    /* 15 */
-    {
-        {0x8001, 47},
-        {0xc016, 47},
-        {0x8001, 51},
-        {0xc016, 51},
-        {0x8001, 52},
-        {0xc016, 52},
-        {0x8001, 53},
-        {0xc016, 53},
-        {0x8001, 54},
-        {0xc016, 54},
-        {0x8001, 55},
-        {0xc016, 55},
-        {0x8001, 56},
-        {0xc016, 56},
-        {0x8001, 57},
-        {0xc016, 57},
-    },
-    /* 16 */
-    {
-        {0x8002, 47},
-        {0x8009, 47},
-        {0x8017, 47},
-        {0xc028, 47},
-        {0x8002, 51},
-        {0x8009, 51},
-        {0x8017, 51},
-        {0xc028, 51},
-        {0x8002, 52},
-        {0x8009, 52},
-        {0x8017, 52},
-        {0xc028, 52},
-        {0x8002, 53},
-        {0x8009, 53},
-        {0x8017, 53},
-        {0xc028, 53},
-    },
-    /* 17 */
-    {
-        {0x8003, 47},
-        {0x8006, 47},
-        {0x800a, 47},
-        {0x800f, 47},
-        {0x8018, 47},
-        {0x801f, 47},
-        {0x8029, 47},
-        {0xc038, 47},
-        {0x8003, 51},
-        {0x8006, 51},
-        {0x800a, 51},
-        {0x800f, 51},
-        {0x8018, 51},
-        {0x801f, 51},
-        {0x8029, 51},
-        {0xc038, 51},
-    },
-    /* 18 */
-    {
-        {0x8003, 52},
-        {0x8006, 52},
-        {0x800a, 52},
-        {0x800f, 52},
-        {0x8018, 52},
-        {0x801f, 52},
-        {0x8029, 52},
-        {0xc038, 52},
-        {0x8003, 53},
-        {0x8006, 53},
-        {0x800a, 53},
-        {0x800f, 53},
-        {0x8018, 53},
-        {0x801f, 53},
-        {0x8029, 53},
-        {0xc038, 53},
-    },
-    /* 19 */
-    {
-        {0x8002, 54},
-        {0x8009, 54},
-        {0x8017, 54},
-        {0xc028, 54},
-        {0x8002, 55},
-        {0x8009, 55},
-        {0x8017, 55},
-        {0xc028, 55},
-        {0x8002, 56},
-        {0x8009, 56},
-        {0x8017, 56},
-        {0xc028, 56},
-        {0x8002, 57},
-        {0x8009, 57},
-        {0x8017, 57},
-        {0xc028, 57},
-    },
-    /* 20 */
-    {
-        {0x8003, 54},
-        {0x8006, 54},
-        {0x800a, 54},
-        {0x800f, 54},
-        {0x8018, 54},
-        {0x801f, 54},
-        {0x8029, 54},
-        {0xc038, 54},
-        {0x8003, 55},
-        {0x8006, 55},
-        {0x800a, 55},
-        {0x800f, 55},
-        {0x8018, 55},
-        {0x801f, 55},
-        {0x8029, 55},
-        {0xc038, 55},
-    },
-    /* 21 */
-    {
-        {0x8003, 56},
-        {0x8006, 56},
-        {0x800a, 56},
-        {0x800f, 56},
-        {0x8018, 56},
-        {0x801f, 56},
-        {0x8029, 56},
-        {0xc038, 56},
-        {0x8003, 57},
-        {0x8006, 57},
-        {0x800a, 57},
-        {0x800f, 57},
-        {0x8018, 57},
-        {0x801f, 57},
-        {0x8029, 57},
-        {0xc038, 57},
-    },
-    /* 22 */
-    {
-        {0x1a, 0},
-        {0x1b, 0},
-        {0x1d, 0},
-        {0x1e, 0},
-        {0x21, 0},
-        {0x22, 0},
-        {0x24, 0},
-        {0x25, 0},
-        {0x2b, 0},
-        {0x2e, 0},
-        {0x32, 0},
-        {0x35, 0},
-        {0x3a, 0},
-        {0x3d, 0},
-        {0x41, 0},
-        {0x4044, 0},
-    },
-    /* 23 */
-    {
-        {0xc000, 61},
-        {0xc000, 65},
-        {0xc000, 95},
-        {0xc000, 98},
-        {0xc000, 100},
-        {0xc000, 102},
-        {0xc000, 103},
-        {0xc000, 104},
-        {0xc000, 108},
-        {0xc000, 109},
-        {0xc000, 110},
-        {0xc000, 112},
-        {0xc000, 114},
-        {0xc000, 117},
-        {0x26, 0},
-        {0x27, 0},
-    },
-    /* 24 */
-    {
-        {0x8001, 61},
-        {0xc016, 61},
-        {0x8001, 65},
-        {0xc016, 65},
-        {0x8001, 95},
-        {0xc016, 95},
-        {0x8001, 98},
-        {0xc016, 98},
-        {0x8001, 100},
-        {0xc016, 100},
-        {0x8001, 102},
-        {0xc016, 102},
-        {0x8001, 103},
-        {0xc016, 103},
-        {0x8001, 104},
-        {0xc016, 104},
-    },
-    /* 25 */
-    {
-        {0x8002, 61},
-        {0x8009, 61},
-        {0x8017, 61},
-        {0xc028, 61},
-        {0x8002, 65},
-        {0x8009, 65},
-        {0x8017, 65},
-        {0xc028, 65},
-        {0x8002, 95},
-        {0x8009, 95},
-        {0x8017, 95},
-        {0xc028, 95},
-        {0x8002, 98},
-        {0x8009, 98},
-        {0x8017, 98},
-        {0xc028, 98},
-    },
-    /* 26 */
-    {
-        {0x8003, 61},
-        {0x8006, 61},
-        {0x800a, 61},
-        {0x800f, 61},
-        {0x8018, 61},
-        {0x801f, 61},
-        {0x8029, 61},
-        {0xc038, 61},
-        {0x8003, 65},
-        {0x8006, 65},
-        {0x800a, 65},
-        {0x800f, 65},
-        {0x8018, 65},
-        {0x801f, 65},
-        {0x8029, 65},
-        {0xc038, 65},
-    },
-    /* 27 */
-    {
-        {0x8003, 95},
-        {0x8006, 95},
-        {0x800a, 95},
-        {0x800f, 95},
-        {0x8018, 95},
-        {0x801f, 95},
-        {0x8029, 95},
-        {0xc038, 95},
-        {0x8003, 98},
-        {0x8006, 98},
-        {0x800a, 98},
-        {0x800f, 98},
-        {0x8018, 98},
-        {0x801f, 98},
-        {0x8029, 98},
-        {0xc038, 98},
-    },
-    /* 28 */
-    {
-        {0x8002, 100},
-        {0x8009, 100},
-        {0x8017, 100},
-        {0xc028, 100},
-        {0x8002, 102},
-        {0x8009, 102},
-        {0x8017, 102},
-        {0xc028, 102},
-        {0x8002, 103},
-        {0x8009, 103},
-        {0x8017, 103},
-        {0xc028, 103},
-        {0x8002, 104},
-        {0x8009, 104},
-        {0x8017, 104},
-        {0xc028, 104},
-    },
-    /* 29 */
-    {
-        {0x8003, 100},
-        {0x8006, 100},
-        {0x800a, 100},
-        {0x800f, 100},
-        {0x8018, 100},
-        {0x801f, 100},
-        {0x8029, 100},
-        {0xc038, 100},
-        {0x8003, 102},
-        {0x8006, 102},
-        {0x800a, 102},
-        {0x800f, 102},
-        {0x8018, 102},
-        {0x801f, 102},
-        {0x8029, 102},
-        {0xc038, 102},
-    },
-    /* 30 */
-    {
-        {0x8003, 103},
-        {0x8006, 103},
-        {0x800a, 103},
-        {0x800f, 103},
-        {0x8018, 103},
-        {0x801f, 103},
-        {0x8029, 103},
-        {0xc038, 103},
-        {0x8003, 104},
-        {0x8006, 104},
-        {0x800a, 104},
-        {0x800f, 104},
-        {0x8018, 104},
-        {0x801f, 104},
-        {0x8029, 104},
-        {0xc038, 104},
-    },
-    /* 31 */
-    {
-        {0x8001, 108},
-        {0xc016, 108},
-        {0x8001, 109},
-        {0xc016, 109},
-        {0x8001, 110},
-        {0xc016, 110},
-        {0x8001, 112},
-        {0xc016, 112},
-        {0x8001, 114},
-        {0xc016, 114},
-        {0x8001, 117},
-        {0xc016, 117},
-        {0xc000, 58},
-        {0xc000, 66},
-        {0xc000, 67},
-        {0xc000, 68},
-    },
-    /* 32 */
-    {
-        {0x8002, 108},
-        {0x8009, 108},
-        {0x8017, 108},
-        {0xc028, 108},
-        {0x8002, 109},
-        {0x8009, 109},
-        {0x8017, 109},
-        {0xc028, 109},
-        {0x8002, 110},
-        {0x8009, 110},
-        {0x8017, 110},
-        {0xc028, 110},
-        {0x8002, 112},
-        {0x8009, 112},
-        {0x8017, 112},
-        {0xc028, 112},
-    },
-    /* 33 */
-    {
-        {0x8003, 108},
-        {0x8006, 108},
-        {0x800a, 108},
-        {0x800f, 108},
-        {0x8018, 108},
-        {0x801f, 108},
-        {0x8029, 108},
-        {0xc038, 108},
-        {0x8003, 109},
-        {0x8006, 109},
-        {0x800a, 109},
-        {0x800f, 109},
-        {0x8018, 109},
-        {0x801f, 109},
-        {0x8029, 109},
-        {0xc038, 109},
-    },
-    /* 34 */
-    {
-        {0x8003, 110},
-        {0x8006, 110},
-        {0x800a, 110},
-        {0x800f, 110},
-        {0x8018, 110},
-        {0x801f, 110},
-        {0x8029, 110},
-        {0xc038, 110},
-        {0x8003, 112},
-        {0x8006, 112},
-        {0x800a, 112},
-        {0x800f, 112},
-        {0x8018, 112},
-        {0x801f, 112},
-        {0x8029, 112},
-        {0xc038, 112},
-    },
-    /* 35 */
-    {
-        {0x8002, 114},
-        {0x8009, 114},
-        {0x8017, 114},
-        {0xc028, 114},
-        {0x8002, 117},
-        {0x8009, 117},
-        {0x8017, 117},
-        {0xc028, 117},
-        {0x8001, 58},
-        {0xc016, 58},
-        {0x8001, 66},
-        {0xc016, 66},
-        {0x8001, 67},
-        {0xc016, 67},
-        {0x8001, 68},
-        {0xc016, 68},
-    },
-    /* 36 */
-    {
-        {0x8003, 114},
-        {0x8006, 114},
-        {0x800a, 114},
-        {0x800f, 114},
-        {0x8018, 114},
-        {0x801f, 114},
-        {0x8029, 114},
-        {0xc038, 114},
-        {0x8003, 117},
-        {0x8006, 117},
-        {0x800a, 117},
-        {0x800f, 117},
-        {0x8018, 117},
-        {0x801f, 117},
-        {0x8029, 117},
-        {0xc038, 117},
-    },
-    /* 37 */
-    {
-        {0x8002, 58},
-        {0x8009, 58},
-        {0x8017, 58},
-        {0xc028, 58},
-        {0x8002, 66},
-        {0x8009, 66},
-        {0x8017, 66},
-        {0xc028, 66},
-        {0x8002, 67},
-        {0x8009, 67},
-        {0x8017, 67},
-        {0xc028, 67},
-        {0x8002, 68},
-        {0x8009, 68},
-        {0x8017, 68},
-        {0xc028, 68},
-    },
-    /* 38 */
-    {
-        {0x8003, 58},
-        {0x8006, 58},
-        {0x800a, 58},
-        {0x800f, 58},
-        {0x8018, 58},
-        {0x801f, 58},
-        {0x8029, 58},
-        {0xc038, 58},
-        {0x8003, 66},
-        {0x8006, 66},
-        {0x800a, 66},
-        {0x800f, 66},
-        {0x8018, 66},
-        {0x801f, 66},
-        {0x8029, 66},
-        {0xc038, 66},
-    },
-    /* 39 */
-    {
-        {0x8003, 67},
-        {0x8006, 67},
-        {0x800a, 67},
-        {0x800f, 67},
-        {0x8018, 67},
-        {0x801f, 67},
-        {0x8029, 67},
-        {0xc038, 67},
-        {0x8003, 68},
-        {0x8006, 68},
-        {0x800a, 68},
-        {0x800f, 68},
-        {0x8018, 68},
-        {0x801f, 68},
-        {0x8029, 68},
-        {0xc038, 68},
-    },
-    /* 40 */
-    {
-        {0x2c, 0},
-        {0x2d, 0},
-        {0x2f, 0},
-        {0x30, 0},
-        {0x33, 0},
-        {0x34, 0},
-        {0x36, 0},
-        {0x37, 0},
-        {0x3b, 0},
-        {0x3c, 0},
-        {0x3e, 0},
-        {0x3f, 0},
-        {0x42, 0},
-        {0x43, 0},
-        {0x45, 0},
-        {0x4048, 0},
-    },
-    /* 41 */
-    {
-        {0xc000, 69},
-        {0xc000, 70},
-        {0xc000, 71},
-        {0xc000, 72},
-        {0xc000, 73},
-        {0xc000, 74},
-        {0xc000, 75},
-        {0xc000, 76},
-        {0xc000, 77},
-        {0xc000, 78},
-        {0xc000, 79},
-        {0xc000, 80},
-        {0xc000, 81},
-        {0xc000, 82},
-        {0xc000, 83},
-        {0xc000, 84},
-    },
-    /* 42 */
-    {
-        {0x8001, 69},
-        {0xc016, 69},
-        {0x8001, 70},
-        {0xc016, 70},
-        {0x8001, 71},
-        {0xc016, 71},
-        {0x8001, 72},
-        {0xc016, 72},
-        {0x8001, 73},
-        {0xc016, 73},
-        {0x8001, 74},
-        {0xc016, 74},
-        {0x8001, 75},
-        {0xc016, 75},
-        {0x8001, 76},
-        {0xc016, 76},
-    },
-    /* 43 */
-    {
-        {0x8002, 69},
-        {0x8009, 69},
-        {0x8017, 69},
-        {0xc028, 69},
-        {0x8002, 70},
-        {0x8009, 70},
-        {0x8017, 70},
-        {0xc028, 70},
-        {0x8002, 71},
-        {0x8009, 71},
-        {0x8017, 71},
-        {0xc028, 71},
-        {0x8002, 72},
-        {0x8009, 72},
-        {0x8017, 72},
-        {0xc028, 72},
-    },
-    /* 44 */
-    {
-        {0x8003, 69},
-        {0x8006, 69},
-        {0x800a, 69},
-        {0x800f, 69},
-        {0x8018, 69},
-        {0x801f, 69},
-        {0x8029, 69},
-        {0xc038, 69},
-        {0x8003, 70},
-        {0x8006, 70},
-        {0x800a, 70},
-        {0x800f, 70},
-        {0x8018, 70},
-        {0x801f, 70},
-        {0x8029, 70},
-        {0xc038, 70},
-    },
-    /* 45 */
-    {
-        {0x8003, 71},
-        {0x8006, 71},
-        {0x800a, 71},
-        {0x800f, 71},
-        {0x8018, 71},
-        {0x801f, 71},
-        {0x8029, 71},
-        {0xc038, 71},
-        {0x8003, 72},
-        {0x8006, 72},
-        {0x800a, 72},
-        {0x800f, 72},
-        {0x8018, 72},
-        {0x801f, 72},
-        {0x8029, 72},
-        {0xc038, 72},
-    },
-    /* 46 */
-    {
-        {0x8002, 73},
-        {0x8009, 73},
-        {0x8017, 73},
-        {0xc028, 73},
-        {0x8002, 74},
-        {0x8009, 74},
-        {0x8017, 74},
-        {0xc028, 74},
-        {0x8002, 75},
-        {0x8009, 75},
-        {0x8017, 75},
-        {0xc028, 75},
-        {0x8002, 76},
-        {0x8009, 76},
-        {0x8017, 76},
-        {0xc028, 76},
-    },
-    /* 47 */
-    {
-        {0x8003, 73},
-        {0x8006, 73},
-        {0x800a, 73},
-        {0x800f, 73},
-        {0x8018, 73},
-        {0x801f, 73},
-        {0x8029, 73},
-        {0xc038, 73},
-        {0x8003, 74},
-        {0x8006, 74},
-        {0x800a, 74},
-        {0x800f, 74},
-        {0x8018, 74},
-        {0x801f, 74},
-        {0x8029, 74},
-        {0xc038, 74},
-    },
-    /* 48 */
-    {
-        {0x8003, 75},
-        {0x8006, 75},
-        {0x800a, 75},
-        {0x800f, 75},
-        {0x8018, 75},
-        {0x801f, 75},
-        {0x8029, 75},
-        {0xc038, 75},
-        {0x8003, 76},
-        {0x8006, 76},
-        {0x800a, 76},
-        {0x800f, 76},
-        {0x8018, 76},
-        {0x801f, 76},
-        {0x8029, 76},
-        {0xc038, 76},
-    },
-    /* 49 */
-    {
-        {0x8001, 77},
-        {0xc016, 77},
-        {0x8001, 78},
-        {0xc016, 78},
-        {0x8001, 79},
-        {0xc016, 79},
-        {0x8001, 80},
-        {0xc016, 80},
-        {0x8001, 81},
-        {0xc016, 81},
-        {0x8001, 82},
-        {0xc016, 82},
-        {0x8001, 83},
-        {0xc016, 83},
-        {0x8001, 84},
-        {0xc016, 84},
-    },
-    /* 50 */
-    {
-        {0x8002, 77},
-        {0x8009, 77},
-        {0x8017, 77},
-        {0xc028, 77},
-        {0x8002, 78},
-        {0x8009, 78},
-        {0x8017, 78},
-        {0xc028, 78},
-        {0x8002, 79},
-        {0x8009, 79},
-        {0x8017, 79},
-        {0xc028, 79},
-        {0x8002, 80},
-        {0x8009, 80},
-        {0x8017, 80},
-        {0xc028, 80},
-    },
-    /* 51 */
-    {
-        {0x8003, 77},
-        {0x8006, 77},
-        {0x800a, 77},
-        {0x800f, 77},
-        {0x8018, 77},
-        {0x801f, 77},
-        {0x8029, 77},
-        {0xc038, 77},
-        {0x8003, 78},
-        {0x8006, 78},
-        {0x800a, 78},
-        {0x800f, 78},
-        {0x8018, 78},
-        {0x801f, 78},
-        {0x8029, 78},
-        {0xc038, 78},
-    },
-    /* 52 */
-    {
-        {0x8003, 79},
-        {0x8006, 79},
-        {0x800a, 79},
-        {0x800f, 79},
-        {0x8018, 79},
-        {0x801f, 79},
-        {0x8029, 79},
-        {0xc038, 79},
-        {0x8003, 80},
-        {0x8006, 80},
-        {0x800a, 80},
-        {0x800f, 80},
-        {0x8018, 80},
-        {0x801f, 80},
-        {0x8029, 80},
-        {0xc038, 80},
-    },
-    /* 53 */
-    {
-        {0x8002, 81},
-        {0x8009, 81},
-        {0x8017, 81},
-        {0xc028, 81},
-        {0x8002, 82},
-        {0x8009, 82},
-        {0x8017, 82},
-        {0xc028, 82},
-        {0x8002, 83},
-        {0x8009, 83},
-        {0x8017, 83},
-        {0xc028, 83},
-        {0x8002, 84},
-        {0x8009, 84},
-        {0x8017, 84},
-        {0xc028, 84},
-    },
-    /* 54 */
-    {
-        {0x8003, 81},
-        {0x8006, 81},
-        {0x800a, 81},
-        {0x800f, 81},
-        {0x8018, 81},
-        {0x801f, 81},
-        {0x8029, 81},
-        {0xc038, 81},
-        {0x8003, 82},
-        {0x8006, 82},
-        {0x800a, 82},
-        {0x800f, 82},
-        {0x8018, 82},
-        {0x801f, 82},
-        {0x8029, 82},
-        {0xc038, 82},
-    },
-    /* 55 */
-    {
-        {0x8003, 83},
-        {0x8006, 83},
-        {0x800a, 83},
-        {0x800f, 83},
-        {0x8018, 83},
-        {0x801f, 83},
-        {0x8029, 83},
-        {0xc038, 83},
-        {0x8003, 84},
-        {0x8006, 84},
-        {0x800a, 84},
-        {0x800f, 84},
-        {0x8018, 84},
-        {0x801f, 84},
-        {0x8029, 84},
-        {0xc038, 84},
-    },
-    /* 56 */
-    {
-        {0xc000, 85},
-        {0xc000, 86},
-        {0xc000, 87},
-        {0xc000, 89},
-        {0xc000, 106},
-        {0xc000, 107},
-        {0xc000, 113},
-        {0xc000, 118},
-        {0xc000, 119},
-        {0xc000, 120},
-        {0xc000, 121},
-        {0xc000, 122},
-        {0x46, 0},
-        {0x47, 0},
-        {0x49, 0},
-        {0x404a, 0},
-    },
-    /* 57 */
-    {
-        {0x8001, 85},
-        {0xc016, 85},
-        {0x8001, 86},
-        {0xc016, 86},
-        {0x8001, 87},
-        {0xc016, 87},
-        {0x8001, 89},
-        {0xc016, 89},
-        {0x8001, 106},
-        {0xc016, 106},
-        {0x8001, 107},
-        {0xc016, 107},
-        {0x8001, 113},
-        {0xc016, 113},
-        {0x8001, 118},
-        {0xc016, 118},
-    },
-    /* 58 */
-    {
-        {0x8002, 85},
-        {0x8009, 85},
-        {0x8017, 85},
-        {0xc028, 85},
-        {0x8002, 86},
-        {0x8009, 86},
-        {0x8017, 86},
-        {0xc028, 86},
-        {0x8002, 87},
-        {0x8009, 87},
-        {0x8017, 87},
-        {0xc028, 87},
-        {0x8002, 89},
-        {0x8009, 89},
-        {0x8017, 89},
-        {0xc028, 89},
-    },
-    /* 59 */
-    {
-        {0x8003, 85},
-        {0x8006, 85},
-        {0x800a, 85},
-        {0x800f, 85},
-        {0x8018, 85},
-        {0x801f, 85},
-        {0x8029, 85},
-        {0xc038, 85},
-        {0x8003, 86},
-        {0x8006, 86},
-        {0x800a, 86},
-        {0x800f, 86},
-        {0x8018, 86},
-        {0x801f, 86},
-        {0x8029, 86},
-        {0xc038, 86},
-    },
-    /* 60 */
-    {
-        {0x8003, 87},
-        {0x8006, 87},
-        {0x800a, 87},
-        {0x800f, 87},
-        {0x8018, 87},
-        {0x801f, 87},
-        {0x8029, 87},
-        {0xc038, 87},
-        {0x8003, 89},
-        {0x8006, 89},
-        {0x800a, 89},
-        {0x800f, 89},
-        {0x8018, 89},
-        {0x801f, 89},
-        {0x8029, 89},
-        {0xc038, 89},
-    },
-    /* 61 */
-    {
-        {0x8002, 106},
-        {0x8009, 106},
-        {0x8017, 106},
-        {0xc028, 106},
-        {0x8002, 107},
-        {0x8009, 107},
-        {0x8017, 107},
-        {0xc028, 107},
-        {0x8002, 113},
-        {0x8009, 113},
-        {0x8017, 113},
-        {0xc028, 113},
-        {0x8002, 118},
-        {0x8009, 118},
-        {0x8017, 118},
-        {0xc028, 118},
-    },
-    /* 62 */
-    {
-        {0x8003, 106},
-        {0x8006, 106},
-        {0x800a, 106},
-        {0x800f, 106},
-        {0x8018, 106},
-        {0x801f, 106},
-        {0x8029, 106},
-        {0xc038, 106},
-        {0x8003, 107},
-        {0x8006, 107},
-        {0x800a, 107},
-        {0x800f, 107},
-        {0x8018, 107},
-        {0x801f, 107},
-        {0x8029, 107},
-        {0xc038, 107},
-    },
-    /* 63 */
-    {
-        {0x8003, 113},
-        {0x8006, 113},
-        {0x800a, 113},
-        {0x800f, 113},
-        {0x8018, 113},
-        {0x801f, 113},
-        {0x8029, 113},
-        {0xc038, 113},
-        {0x8003, 118},
-        {0x8006, 118},
-        {0x800a, 118},
-        {0x800f, 118},
-        {0x8018, 118},
-        {0x801f, 118},
-        {0x8029, 118},
-        {0xc038, 118},
-    },
-    /* 64 */
-    {
-        {0x8001, 119},
-        {0xc016, 119},
-        {0x8001, 120},
-        {0xc016, 120},
-        {0x8001, 121},
-        {0xc016, 121},
-        {0x8001, 122},
-        {0xc016, 122},
-        {0xc000, 38},
-        {0xc000, 42},
-        {0xc000, 44},
-        {0xc000, 59},
-        {0xc000, 88},
-        {0xc000, 90},
-        {0x4b, 0},
-        {0x4e, 0},
-    },
-    /* 65 */
-    {
-        {0x8002, 119},
-        {0x8009, 119},
-        {0x8017, 119},
-        {0xc028, 119},
-        {0x8002, 120},
-        {0x8009, 120},
-        {0x8017, 120},
-        {0xc028, 120},
-        {0x8002, 121},
-        {0x8009, 121},
-        {0x8017, 121},
-        {0xc028, 121},
-        {0x8002, 122},
-        {0x8009, 122},
-        {0x8017, 122},
-        {0xc028, 122},
-    },
-    /* 66 */
-    {
-        {0x8003, 119},
-        {0x8006, 119},
-        {0x800a, 119},
-        {0x800f, 119},
-        {0x8018, 119},
-        {0x801f, 119},
-        {0x8029, 119},
-        {0xc038, 119},
-        {0x8003, 120},
-        {0x8006, 120},
-        {0x800a, 120},
-        {0x800f, 120},
-        {0x8018, 120},
-        {0x801f, 120},
-        {0x8029, 120},
-        {0xc038, 120},
-    },
-    /* 67 */
-    {
-        {0x8003, 121},
-        {0x8006, 121},
-        {0x800a, 121},
-        {0x800f, 121},
-        {0x8018, 121},
-        {0x801f, 121},
-        {0x8029, 121},
-        {0xc038, 121},
-        {0x8003, 122},
-        {0x8006, 122},
-        {0x800a, 122},
-        {0x800f, 122},
-        {0x8018, 122},
-        {0x801f, 122},
-        {0x8029, 122},
-        {0xc038, 122},
-    },
-    /* 68 */
-    {
-        {0x8001, 38},
-        {0xc016, 38},
-        {0x8001, 42},
-        {0xc016, 42},
-        {0x8001, 44},
-        {0xc016, 44},
-        {0x8001, 59},
-        {0xc016, 59},
-        {0x8001, 88},
-        {0xc016, 88},
-        {0x8001, 90},
-        {0xc016, 90},
-        {0x4c, 0},
-        {0x4d, 0},
-        {0x4f, 0},
-        {0x51, 0},
-    },
-    /* 69 */
-    {
-        {0x8002, 38},
-        {0x8009, 38},
-        {0x8017, 38},
-        {0xc028, 38},
-        {0x8002, 42},
-        {0x8009, 42},
-        {0x8017, 42},
-        {0xc028, 42},
-        {0x8002, 44},
-        {0x8009, 44},
-        {0x8017, 44},
-        {0xc028, 44},
-        {0x8002, 59},
-        {0x8009, 59},
-        {0x8017, 59},
-        {0xc028, 59},
-    },
-    /* 70 */
-    {
-        {0x8003, 38},
-        {0x8006, 38},
-        {0x800a, 38},
-        {0x800f, 38},
-        {0x8018, 38},
-        {0x801f, 38},
-        {0x8029, 38},
-        {0xc038, 38},
-        {0x8003, 42},
-        {0x8006, 42},
-        {0x800a, 42},
-        {0x800f, 42},
-        {0x8018, 42},
-        {0x801f, 42},
-        {0x8029, 42},
-        {0xc038, 42},
-    },
-    /* 71 */
-    {
-        {0x8003, 44},
-        {0x8006, 44},
-        {0x800a, 44},
-        {0x800f, 44},
-        {0x8018, 44},
-        {0x801f, 44},
-        {0x8029, 44},
-        {0xc038, 44},
-        {0x8003, 59},
-        {0x8006, 59},
-        {0x800a, 59},
-        {0x800f, 59},
-        {0x8018, 59},
-        {0x801f, 59},
-        {0x8029, 59},
-        {0xc038, 59},
-    },
-    /* 72 */
-    {
-        {0x8002, 88},
-        {0x8009, 88},
-        {0x8017, 88},
-        {0xc028, 88},
-        {0x8002, 90},
-        {0x8009, 90},
-        {0x8017, 90},
-        {0xc028, 90},
-        {0xc000, 33},
-        {0xc000, 34},
-        {0xc000, 40},
-        {0xc000, 41},
-        {0xc000, 63},
-        {0x50, 0},
-        {0x52, 0},
-        {0x54, 0},
-    },
-    /* 73 */
-    {
-        {0x8003, 88},
-        {0x8006, 88},
-        {0x800a, 88},
-        {0x800f, 88},
-        {0x8018, 88},
-        {0x801f, 88},
-        {0x8029, 88},
-        {0xc038, 88},
-        {0x8003, 90},
-        {0x8006, 90},
-        {0x800a, 90},
-        {0x800f, 90},
-        {0x8018, 90},
-        {0x801f, 90},
-        {0x8029, 90},
-        {0xc038, 90},
-    },
-    /* 74 */
-    {
-        {0x8001, 33},
-        {0xc016, 33},
-        {0x8001, 34},
-        {0xc016, 34},
-        {0x8001, 40},
-        {0xc016, 40},
-        {0x8001, 41},
-        {0xc016, 41},
-        {0x8001, 63},
-        {0xc016, 63},
-        {0xc000, 39},
-        {0xc000, 43},
-        {0xc000, 124},
-        {0x53, 0},
-        {0x55, 0},
-        {0x58, 0},
-    },
-    /* 75 */
-    {
-        {0x8002, 33},
-        {0x8009, 33},
-        {0x8017, 33},
-        {0xc028, 33},
-        {0x8002, 34},
-        {0x8009, 34},
-        {0x8017, 34},
-        {0xc028, 34},
-        {0x8002, 40},
-        {0x8009, 40},
-        {0x8017, 40},
-        {0xc028, 40},
-        {0x8002, 41},
-        {0x8009, 41},
-        {0x8017, 41},
-        {0xc028, 41},
-    },
-    /* 76 */
-    {
-        {0x8003, 33},
-        {0x8006, 33},
-        {0x800a, 33},
-        {0x800f, 33},
-        {0x8018, 33},
-        {0x801f, 33},
-        {0x8029, 33},
-        {0xc038, 33},
-        {0x8003, 34},
-        {0x8006, 34},
-        {0x800a, 34},
-        {0x800f, 34},
-        {0x8018, 34},
-        {0x801f, 34},
-        {0x8029, 34},
-        {0xc038, 34},
-    },
-    /* 77 */
-    {
-        {0x8003, 40},
-        {0x8006, 40},
-        {0x800a, 40},
-        {0x800f, 40},
-        {0x8018, 40},
-        {0x801f, 40},
-        {0x8029, 40},
-        {0xc038, 40},
-        {0x8003, 41},
-        {0x8006, 41},
-        {0x800a, 41},
-        {0x800f, 41},
-        {0x8018, 41},
-        {0x801f, 41},
-        {0x8029, 41},
-        {0xc038, 41},
-    },
-    /* 78 */
-    {
-        {0x8002, 63},
-        {0x8009, 63},
-        {0x8017, 63},
-        {0xc028, 63},
-        {0x8001, 39},
-        {0xc016, 39},
-        {0x8001, 43},
-        {0xc016, 43},
-        {0x8001, 124},
-        {0xc016, 124},
-        {0xc000, 35},
-        {0xc000, 62},
-        {0x56, 0},
-        {0x57, 0},
-        {0x59, 0},
-        {0x5a, 0},
-    },
-    /* 79 */
-    {
-        {0x8003, 63},
-        {0x8006, 63},
-        {0x800a, 63},
-        {0x800f, 63},
-        {0x8018, 63},
-        {0x801f, 63},
-        {0x8029, 63},
-        {0xc038, 63},
-        {0x8002, 39},
-        {0x8009, 39},
-        {0x8017, 39},
-        {0xc028, 39},
-        {0x8002, 43},
-        {0x8009, 43},
-        {0x8017, 43},
-        {0xc028, 43},
-    },
-    /* 80 */
-    {
-        {0x8003, 39},
-        {0x8006, 39},
-        {0x800a, 39},
-        {0x800f, 39},
-        {0x8018, 39},
-        {0x801f, 39},
-        {0x8029, 39},
-        {0xc038, 39},
-        {0x8003, 43},
-        {0x8006, 43},
-        {0x800a, 43},
-        {0x800f, 43},
-        {0x8018, 43},
-        {0x801f, 43},
-        {0x8029, 43},
-        {0xc038, 43},
-    },
-    /* 81 */
-    {
-        {0x8002, 124},
-        {0x8009, 124},
-        {0x8017, 124},
-        {0xc028, 124},
-        {0x8001, 35},
-        {0xc016, 35},
-        {0x8001, 62},
-        {0xc016, 62},
-        {0xc000, 0},
-        {0xc000, 36},
-        {0xc000, 64},
-        {0xc000, 91},
-        {0xc000, 93},
-        {0xc000, 126},
-        {0x5b, 0},
-        {0x5c, 0},
-    },
-    /* 82 */
-    {
-        {0x8003, 124},
-        {0x8006, 124},
-        {0x800a, 124},
-        {0x800f, 124},
-        {0x8018, 124},
-        {0x801f, 124},
-        {0x8029, 124},
-        {0xc038, 124},
-        {0x8002, 35},
-        {0x8009, 35},
-        {0x8017, 35},
-        {0xc028, 35},
-        {0x8002, 62},
-        {0x8009, 62},
-        {0x8017, 62},
-        {0xc028, 62},
-    },
-    /* 83 */
-    {
-        {0x8003, 35},
-        {0x8006, 35},
-        {0x800a, 35},
-        {0x800f, 35},
-        {0x8018, 35},
-        {0x801f, 35},
-        {0x8029, 35},
-        {0xc038, 35},
-        {0x8003, 62},
-        {0x8006, 62},
-        {0x800a, 62},
-        {0x800f, 62},
-        {0x8018, 62},
-        {0x801f, 62},
-        {0x8029, 62},
-        {0xc038, 62},
-    },
-    /* 84 */
-    {
-        {0x8001, 0},
-        {0xc016, 0},
-        {0x8001, 36},
-        {0xc016, 36},
-        {0x8001, 64},
-        {0xc016, 64},
-        {0x8001, 91},
-        {0xc016, 91},
-        {0x8001, 93},
-        {0xc016, 93},
-        {0x8001, 126},
-        {0xc016, 126},
-        {0xc000, 94},
-        {0xc000, 125},
-        {0x5d, 0},
-        {0x5e, 0},
-    },
-    /* 85 */
-    {
-        {0x8002, 0},
-        {0x8009, 0},
-        {0x8017, 0},
-        {0xc028, 0},
-        {0x8002, 36},
-        {0x8009, 36},
-        {0x8017, 36},
-        {0xc028, 36},
-        {0x8002, 64},
-        {0x8009, 64},
-        {0x8017, 64},
-        {0xc028, 64},
-        {0x8002, 91},
-        {0x8009, 91},
-        {0x8017, 91},
-        {0xc028, 91},
-    },
-    /* 86 */
-    {
-        {0x8003, 0},
-        {0x8006, 0},
-        {0x800a, 0},
-        {0x800f, 0},
-        {0x8018, 0},
-        {0x801f, 0},
-        {0x8029, 0},
-        {0xc038, 0},
-        {0x8003, 36},
-        {0x8006, 36},
-        {0x800a, 36},
-        {0x800f, 36},
-        {0x8018, 36},
-        {0x801f, 36},
-        {0x8029, 36},
-        {0xc038, 36},
-    },
-    /* 87 */
-    {
-        {0x8003, 64},
-        {0x8006, 64},
-        {0x800a, 64},
-        {0x800f, 64},
-        {0x8018, 64},
-        {0x801f, 64},
-        {0x8029, 64},
-        {0xc038, 64},
-        {0x8003, 91},
-        {0x8006, 91},
-        {0x800a, 91},
-        {0x800f, 91},
-        {0x8018, 91},
-        {0x801f, 91},
-        {0x8029, 91},
-        {0xc038, 91},
-    },
-    /* 88 */
-    {
-        {0x8002, 93},
-        {0x8009, 93},
-        {0x8017, 93},
-        {0xc028, 93},
-        {0x8002, 126},
-        {0x8009, 126},
-        {0x8017, 126},
-        {0xc028, 126},
-        {0x8001, 94},
-        {0xc016, 94},
-        {0x8001, 125},
-        {0xc016, 125},
-        {0xc000, 60},
-        {0xc000, 96},
-        {0xc000, 123},
-        {0x5f, 0},
-    },
-    /* 89 */
-    {
-        {0x8003, 93},
-        {0x8006, 93},
-        {0x800a, 93},
-        {0x800f, 93},
-        {0x8018, 93},
-        {0x801f, 93},
-        {0x8029, 93},
-        {0xc038, 93},
-        {0x8003, 126},
-        {0x8006, 126},
-        {0x800a, 126},
-        {0x800f, 126},
-        {0x8018, 126},
-        {0x801f, 126},
-        {0x8029, 126},
-        {0xc038, 126},
-    },
-    /* 90 */
-    {
-        {0x8002, 94},
-        {0x8009, 94},
-        {0x8017, 94},
-        {0xc028, 94},
-        {0x8002, 125},
-        {0x8009, 125},
-        {0x8017, 125},
-        {0xc028, 125},
-        {0x8001, 60},
-        {0xc016, 60},
-        {0x8001, 96},
-        {0xc016, 96},
-        {0x8001, 123},
-        {0xc016, 123},
-        {0x60, 0},
-        {0x6e, 0},
-    },
-    /* 91 */
-    {
-        {0x8003, 94},
-        {0x8006, 94},
-        {0x800a, 94},
-        {0x800f, 94},
-        {0x8018, 94},
-        {0x801f, 94},
-        {0x8029, 94},
-        {0xc038, 94},
-        {0x8003, 125},
-        {0x8006, 125},
-        {0x800a, 125},
-        {0x800f, 125},
-        {0x8018, 125},
-        {0x801f, 125},
-        {0x8029, 125},
-        {0xc038, 125},
-    },
-    /* 92 */
-    {
-        {0x8002, 60},
-        {0x8009, 60},
-        {0x8017, 60},
-        {0xc028, 60},
-        {0x8002, 96},
-        {0x8009, 96},
-        {0x8017, 96},
-        {0xc028, 96},
-        {0x8002, 123},
-        {0x8009, 123},
-        {0x8017, 123},
-        {0xc028, 123},
-        {0x61, 0},
-        {0x65, 0},
-        {0x6f, 0},
-        {0x85, 0},
-    },
-    /* 93 */
-    {
-        {0x8003, 60},
-        {0x8006, 60},
-        {0x800a, 60},
-        {0x800f, 60},
-        {0x8018, 60},
-        {0x801f, 60},
-        {0x8029, 60},
-        {0xc038, 60},
-        {0x8003, 96},
-        {0x8006, 96},
-        {0x800a, 96},
-        {0x800f, 96},
-        {0x8018, 96},
-        {0x801f, 96},
-        {0x8029, 96},
-        {0xc038, 96},
-    },
-    /* 94 */
-    {
-        {0x8003, 123},
-        {0x8006, 123},
-        {0x800a, 123},
-        {0x800f, 123},
-        {0x8018, 123},
-        {0x801f, 123},
-        {0x8029, 123},
-        {0xc038, 123},
-        {0x62, 0},
-        {0x63, 0},
-        {0x66, 0},
-        {0x69, 0},
-        {0x70, 0},
-        {0x77, 0},
-        {0x86, 0},
-        {0x99, 0},
-    },
-    /* 95 */
-    {
-        {0xc000, 92},
-        {0xc000, 195},
-        {0xc000, 208},
-        {0x64, 0},
-        {0x67, 0},
-        {0x68, 0},
-        {0x6a, 0},
-        {0x6b, 0},
-        {0x71, 0},
-        {0x74, 0},
-        {0x78, 0},
-        {0x7e, 0},
-        {0x87, 0},
-        {0x8e, 0},
-        {0x9a, 0},
-        {0xa9, 0},
-    },
-    /* 96 */
-    {
-        {0x8001, 92},
-        {0xc016, 92},
-        {0x8001, 195},
-        {0xc016, 195},
-        {0x8001, 208},
-        {0xc016, 208},
-        {0xc000, 128},
-        {0xc000, 130},
-        {0xc000, 131},
-        {0xc000, 162},
-        {0xc000, 184},
-        {0xc000, 194},
-        {0xc000, 224},
-        {0xc000, 226},
-        {0x6c, 0},
-        {0x6d, 0},
-    },
-    /* 97 */
-    {
-        {0x8002, 92},
-        {0x8009, 92},
-        {0x8017, 92},
-        {0xc028, 92},
-        {0x8002, 195},
-        {0x8009, 195},
-        {0x8017, 195},
-        {0xc028, 195},
-        {0x8002, 208},
-        {0x8009, 208},
-        {0x8017, 208},
-        {0xc028, 208},
-        {0x8001, 128},
-        {0xc016, 128},
-        {0x8001, 130},
-        {0xc016, 130},
-    },
-    /* 98 */
-    {
-        {0x8003, 92},
-        {0x8006, 92},
-        {0x800a, 92},
-        {0x800f, 92},
-        {0x8018, 92},
-        {0x801f, 92},
-        {0x8029, 92},
-        {0xc038, 92},
-        {0x8003, 195},
-        {0x8006, 195},
-        {0x800a, 195},
-        {0x800f, 195},
-        {0x8018, 195},
-        {0x801f, 195},
-        {0x8029, 195},
-        {0xc038, 195},
-    },
-    /* 99 */
-    {
-        {0x8003, 208},
-        {0x8006, 208},
-        {0x800a, 208},
-        {0x800f, 208},
-        {0x8018, 208},
-        {0x801f, 208},
-        {0x8029, 208},
-        {0xc038, 208},
-        {0x8002, 128},
-        {0x8009, 128},
-        {0x8017, 128},
-        {0xc028, 128},
-        {0x8002, 130},
-        {0x8009, 130},
-        {0x8017, 130},
-        {0xc028, 130},
-    },
-    /* 100 */
-    {
-        {0x8003, 128},
-        {0x8006, 128},
-        {0x800a, 128},
-        {0x800f, 128},
-        {0x8018, 128},
-        {0x801f, 128},
-        {0x8029, 128},
-        {0xc038, 128},
-        {0x8003, 130},
-        {0x8006, 130},
-        {0x800a, 130},
-        {0x800f, 130},
-        {0x8018, 130},
-        {0x801f, 130},
-        {0x8029, 130},
-        {0xc038, 130},
-    },
-    /* 101 */
-    {
-        {0x8001, 131},
-        {0xc016, 131},
-        {0x8001, 162},
-        {0xc016, 162},
-        {0x8001, 184},
-        {0xc016, 184},
-        {0x8001, 194},
-        {0xc016, 194},
-        {0x8001, 224},
-        {0xc016, 224},
-        {0x8001, 226},
-        {0xc016, 226},
-        {0xc000, 153},
-        {0xc000, 161},
-        {0xc000, 167},
-        {0xc000, 172},
-    },
-    /* 102 */
-    {
-        {0x8002, 131},
-        {0x8009, 131},
-        {0x8017, 131},
-        {0xc028, 131},
-        {0x8002, 162},
-        {0x8009, 162},
-        {0x8017, 162},
-        {0xc028, 162},
-        {0x8002, 184},
-        {0x8009, 184},
-        {0x8017, 184},
-        {0xc028, 184},
-        {0x8002, 194},
-        {0x8009, 194},
-        {0x8017, 194},
-        {0xc028, 194},
-    },
-    /* 103 */
-    {
-        {0x8003, 131},
-        {0x8006, 131},
-        {0x800a, 131},
-        {0x800f, 131},
-        {0x8018, 131},
-        {0x801f, 131},
-        {0x8029, 131},
-        {0xc038, 131},
-        {0x8003, 162},
-        {0x8006, 162},
-        {0x800a, 162},
-        {0x800f, 162},
-        {0x8018, 162},
-        {0x801f, 162},
-        {0x8029, 162},
-        {0xc038, 162},
-    },
-    /* 104 */
-    {
-        {0x8003, 184},
-        {0x8006, 184},
-        {0x800a, 184},
-        {0x800f, 184},
-        {0x8018, 184},
-        {0x801f, 184},
-        {0x8029, 184},
-        {0xc038, 184},
-        {0x8003, 194},
-        {0x8006, 194},
-        {0x800a, 194},
-        {0x800f, 194},
-        {0x8018, 194},
-        {0x801f, 194},
-        {0x8029, 194},
-        {0xc038, 194},
-    },
-    /* 105 */
-    {
-        {0x8002, 224},
-        {0x8009, 224},
-        {0x8017, 224},
-        {0xc028, 224},
-        {0x8002, 226},
-        {0x8009, 226},
-        {0x8017, 226},
-        {0xc028, 226},
-        {0x8001, 153},
-        {0xc016, 153},
-        {0x8001, 161},
-        {0xc016, 161},
-        {0x8001, 167},
-        {0xc016, 167},
-        {0x8001, 172},
-        {0xc016, 172},
-    },
-    /* 106 */
-    {
-        {0x8003, 224},
-        {0x8006, 224},
-        {0x800a, 224},
-        {0x800f, 224},
-        {0x8018, 224},
-        {0x801f, 224},
-        {0x8029, 224},
-        {0xc038, 224},
-        {0x8003, 226},
-        {0x8006, 226},
-        {0x800a, 226},
-        {0x800f, 226},
-        {0x8018, 226},
-        {0x801f, 226},
-        {0x8029, 226},
-        {0xc038, 226},
-    },
-    /* 107 */
-    {
-        {0x8002, 153},
-        {0x8009, 153},
-        {0x8017, 153},
-        {0xc028, 153},
-        {0x8002, 161},
-        {0x8009, 161},
-        {0x8017, 161},
-        {0xc028, 161},
-        {0x8002, 167},
-        {0x8009, 167},
-        {0x8017, 167},
-        {0xc028, 167},
-        {0x8002, 172},
-        {0x8009, 172},
-        {0x8017, 172},
-        {0xc028, 172},
-    },
-    /* 108 */
-    {
-        {0x8003, 153},
-        {0x8006, 153},
-        {0x800a, 153},
-        {0x800f, 153},
-        {0x8018, 153},
-        {0x801f, 153},
-        {0x8029, 153},
-        {0xc038, 153},
-        {0x8003, 161},
-        {0x8006, 161},
-        {0x800a, 161},
-        {0x800f, 161},
-        {0x8018, 161},
-        {0x801f, 161},
-        {0x8029, 161},
-        {0xc038, 161},
-    },
-    /* 109 */
-    {
-        {0x8003, 167},
-        {0x8006, 167},
-        {0x800a, 167},
-        {0x800f, 167},
-        {0x8018, 167},
-        {0x801f, 167},
-        {0x8029, 167},
-        {0xc038, 167},
-        {0x8003, 172},
-        {0x8006, 172},
-        {0x800a, 172},
-        {0x800f, 172},
-        {0x8018, 172},
-        {0x801f, 172},
-        {0x8029, 172},
-        {0xc038, 172},
-    },
-    /* 110 */
-    {
-        {0x72, 0},
-        {0x73, 0},
-        {0x75, 0},
-        {0x76, 0},
-        {0x79, 0},
-        {0x7b, 0},
-        {0x7f, 0},
-        {0x82, 0},
-        {0x88, 0},
-        {0x8b, 0},
-        {0x8f, 0},
-        {0x92, 0},
-        {0x9b, 0},
-        {0xa2, 0},
-        {0xaa, 0},
-        {0xb4, 0},
-    },
-    /* 111 */
-    {
-        {0xc000, 176},
-        {0xc000, 177},
-        {0xc000, 179},
-        {0xc000, 209},
-        {0xc000, 216},
-        {0xc000, 217},
-        {0xc000, 227},
-        {0xc000, 229},
-        {0xc000, 230},
-        {0x7a, 0},
-        {0x7c, 0},
-        {0x7d, 0},
-        {0x80, 0},
-        {0x81, 0},
-        {0x83, 0},
-        {0x84, 0},
-    },
-    /* 112 */
-    {
-        {0x8001, 176},
-        {0xc016, 176},
-        {0x8001, 177},
-        {0xc016, 177},
-        {0x8001, 179},
-        {0xc016, 179},
-        {0x8001, 209},
-        {0xc016, 209},
-        {0x8001, 216},
-        {0xc016, 216},
-        {0x8001, 217},
-        {0xc016, 217},
-        {0x8001, 227},
-        {0xc016, 227},
-        {0x8001, 229},
-        {0xc016, 229},
-    },
-    /* 113 */
-    {
-        {0x8002, 176},
-        {0x8009, 176},
-        {0x8017, 176},
-        {0xc028, 176},
-        {0x8002, 177},
-        {0x8009, 177},
-        {0x8017, 177},
-        {0xc028, 177},
-        {0x8002, 179},
-        {0x8009, 179},
-        {0x8017, 179},
-        {0xc028, 179},
-        {0x8002, 209},
-        {0x8009, 209},
-        {0x8017, 209},
-        {0xc028, 209},
-    },
-    /* 114 */
-    {
-        {0x8003, 176},
-        {0x8006, 176},
-        {0x800a, 176},
-        {0x800f, 176},
-        {0x8018, 176},
-        {0x801f, 176},
-        {0x8029, 176},
-        {0xc038, 176},
-        {0x8003, 177},
-        {0x8006, 177},
-        {0x800a, 177},
-        {0x800f, 177},
-        {0x8018, 177},
-        {0x801f, 177},
-        {0x8029, 177},
-        {0xc038, 177},
-    },
-    /* 115 */
-    {
-        {0x8003, 179},
-        {0x8006, 179},
-        {0x800a, 179},
-        {0x800f, 179},
-        {0x8018, 179},
-        {0x801f, 179},
-        {0x8029, 179},
-        {0xc038, 179},
-        {0x8003, 209},
-        {0x8006, 209},
-        {0x800a, 209},
-        {0x800f, 209},
-        {0x8018, 209},
-        {0x801f, 209},
-        {0x8029, 209},
-        {0xc038, 209},
-    },
-    /* 116 */
-    {
-        {0x8002, 216},
-        {0x8009, 216},
-        {0x8017, 216},
-        {0xc028, 216},
-        {0x8002, 217},
-        {0x8009, 217},
-        {0x8017, 217},
-        {0xc028, 217},
-        {0x8002, 227},
-        {0x8009, 227},
-        {0x8017, 227},
-        {0xc028, 227},
-        {0x8002, 229},
-        {0x8009, 229},
-        {0x8017, 229},
-        {0xc028, 229},
-    },
-    /* 117 */
-    {
-        {0x8003, 216},
-        {0x8006, 216},
-        {0x800a, 216},
-        {0x800f, 216},
-        {0x8018, 216},
-        {0x801f, 216},
-        {0x8029, 216},
-        {0xc038, 216},
-        {0x8003, 217},
-        {0x8006, 217},
-        {0x800a, 217},
-        {0x800f, 217},
-        {0x8018, 217},
-        {0x801f, 217},
-        {0x8029, 217},
-        {0xc038, 217},
-    },
-    /* 118 */
-    {
-        {0x8003, 227},
-        {0x8006, 227},
-        {0x800a, 227},
-        {0x800f, 227},
-        {0x8018, 227},
-        {0x801f, 227},
-        {0x8029, 227},
-        {0xc038, 227},
-        {0x8003, 229},
-        {0x8006, 229},
-        {0x800a, 229},
-        {0x800f, 229},
-        {0x8018, 229},
-        {0x801f, 229},
-        {0x8029, 229},
-        {0xc038, 229},
-    },
-    /* 119 */
-    {
-        {0x8001, 230},
-        {0xc016, 230},
-        {0xc000, 129},
-        {0xc000, 132},
-        {0xc000, 133},
-        {0xc000, 134},
-        {0xc000, 136},
-        {0xc000, 146},
-        {0xc000, 154},
-        {0xc000, 156},
-        {0xc000, 160},
-        {0xc000, 163},
-        {0xc000, 164},
-        {0xc000, 169},
-        {0xc000, 170},
-        {0xc000, 173},
-    },
-    /* 120 */
-    {
-        {0x8002, 230},
-        {0x8009, 230},
-        {0x8017, 230},
-        {0xc028, 230},
-        {0x8001, 129},
-        {0xc016, 129},
-        {0x8001, 132},
-        {0xc016, 132},
-        {0x8001, 133},
-        {0xc016, 133},
-        {0x8001, 134},
-        {0xc016, 134},
-        {0x8001, 136},
-        {0xc016, 136},
-        {0x8001, 146},
-        {0xc016, 146},
-    },
-    /* 121 */
-    {
-        {0x8003, 230},
-        {0x8006, 230},
-        {0x800a, 230},
-        {0x800f, 230},
-        {0x8018, 230},
-        {0x801f, 230},
-        {0x8029, 230},
-        {0xc038, 230},
-        {0x8002, 129},
-        {0x8009, 129},
-        {0x8017, 129},
-        {0xc028, 129},
-        {0x8002, 132},
-        {0x8009, 132},
-        {0x8017, 132},
-        {0xc028, 132},
-    },
-    /* 122 */
-    {
-        {0x8003, 129},
-        {0x8006, 129},
-        {0x800a, 129},
-        {0x800f, 129},
-        {0x8018, 129},
-        {0x801f, 129},
-        {0x8029, 129},
-        {0xc038, 129},
-        {0x8003, 132},
-        {0x8006, 132},
-        {0x800a, 132},
-        {0x800f, 132},
-        {0x8018, 132},
-        {0x801f, 132},
-        {0x8029, 132},
-        {0xc038, 132},
-    },
-    /* 123 */
-    {
-        {0x8002, 133},
-        {0x8009, 133},
-        {0x8017, 133},
-        {0xc028, 133},
-        {0x8002, 134},
-        {0x8009, 134},
-        {0x8017, 134},
-        {0xc028, 134},
-        {0x8002, 136},
-        {0x8009, 136},
-        {0x8017, 136},
-        {0xc028, 136},
-        {0x8002, 146},
-        {0x8009, 146},
-        {0x8017, 146},
-        {0xc028, 146},
-    },
-    /* 124 */
-    {
-        {0x8003, 133},
-        {0x8006, 133},
-        {0x800a, 133},
-        {0x800f, 133},
-        {0x8018, 133},
-        {0x801f, 133},
-        {0x8029, 133},
-        {0xc038, 133},
-        {0x8003, 134},
-        {0x8006, 134},
-        {0x800a, 134},
-        {0x800f, 134},
-        {0x8018, 134},
-        {0x801f, 134},
-        {0x8029, 134},
-        {0xc038, 134},
-    },
-    /* 125 */
-    {
-        {0x8003, 136},
-        {0x8006, 136},
-        {0x800a, 136},
-        {0x800f, 136},
-        {0x8018, 136},
-        {0x801f, 136},
-        {0x8029, 136},
-        {0xc038, 136},
-        {0x8003, 146},
-        {0x8006, 146},
-        {0x800a, 146},
-        {0x800f, 146},
-        {0x8018, 146},
-        {0x801f, 146},
-        {0x8029, 146},
-        {0xc038, 146},
-    },
-    /* 126 */
-    {
-        {0x8001, 154},
-        {0xc016, 154},
-        {0x8001, 156},
-        {0xc016, 156},
-        {0x8001, 160},
-        {0xc016, 160},
-        {0x8001, 163},
-        {0xc016, 163},
-        {0x8001, 164},
-        {0xc016, 164},
-        {0x8001, 169},
-        {0xc016, 169},
-        {0x8001, 170},
-        {0xc016, 170},
-        {0x8001, 173},
-        {0xc016, 173},
-    },
-    /* 127 */
-    {
-        {0x8002, 154},
-        {0x8009, 154},
-        {0x8017, 154},
-        {0xc028, 154},
-        {0x8002, 156},
-        {0x8009, 156},
-        {0x8017, 156},
-        {0xc028, 156},
-        {0x8002, 160},
-        {0x8009, 160},
-        {0x8017, 160},
-        {0xc028, 160},
-        {0x8002, 163},
-        {0x8009, 163},
-        {0x8017, 163},
-        {0xc028, 163},
-    },
-    /* 128 */
-    {
-        {0x8003, 154},
-        {0x8006, 154},
-        {0x800a, 154},
-        {0x800f, 154},
-        {0x8018, 154},
-        {0x801f, 154},
-        {0x8029, 154},
-        {0xc038, 154},
-        {0x8003, 156},
-        {0x8006, 156},
-        {0x800a, 156},
-        {0x800f, 156},
-        {0x8018, 156},
-        {0x801f, 156},
-        {0x8029, 156},
-        {0xc038, 156},
-    },
-    /* 129 */
-    {
-        {0x8003, 160},
-        {0x8006, 160},
-        {0x800a, 160},
-        {0x800f, 160},
-        {0x8018, 160},
-        {0x801f, 160},
-        {0x8029, 160},
-        {0xc038, 160},
-        {0x8003, 163},
-        {0x8006, 163},
-        {0x800a, 163},
-        {0x800f, 163},
-        {0x8018, 163},
-        {0x801f, 163},
-        {0x8029, 163},
-        {0xc038, 163},
-    },
-    /* 130 */
-    {
-        {0x8002, 164},
-        {0x8009, 164},
-        {0x8017, 164},
-        {0xc028, 164},
-        {0x8002, 169},
-        {0x8009, 169},
-        {0x8017, 169},
-        {0xc028, 169},
-        {0x8002, 170},
-        {0x8009, 170},
-        {0x8017, 170},
-        {0xc028, 170},
-        {0x8002, 173},
-        {0x8009, 173},
-        {0x8017, 173},
-        {0xc028, 173},
-    },
-    /* 131 */
-    {
-        {0x8003, 164},
-        {0x8006, 164},
-        {0x800a, 164},
-        {0x800f, 164},
-        {0x8018, 164},
-        {0x801f, 164},
-        {0x8029, 164},
-        {0xc038, 164},
-        {0x8003, 169},
-        {0x8006, 169},
-        {0x800a, 169},
-        {0x800f, 169},
-        {0x8018, 169},
-        {0x801f, 169},
-        {0x8029, 169},
-        {0xc038, 169},
-    },
-    /* 132 */
-    {
-        {0x8003, 170},
-        {0x8006, 170},
-        {0x800a, 170},
-        {0x800f, 170},
-        {0x8018, 170},
-        {0x801f, 170},
-        {0x8029, 170},
-        {0xc038, 170},
-        {0x8003, 173},
-        {0x8006, 173},
-        {0x800a, 173},
-        {0x800f, 173},
-        {0x8018, 173},
-        {0x801f, 173},
-        {0x8029, 173},
-        {0xc038, 173},
-    },
-    /* 133 */
-    {
-        {0x89, 0},
-        {0x8a, 0},
-        {0x8c, 0},
-        {0x8d, 0},
-        {0x90, 0},
-        {0x91, 0},
-        {0x93, 0},
-        {0x96, 0},
-        {0x9c, 0},
-        {0x9f, 0},
-        {0xa3, 0},
-        {0xa6, 0},
-        {0xab, 0},
-        {0xae, 0},
-        {0xb5, 0},
-        {0xbe, 0},
-    },
-    /* 134 */
-    {
-        {0xc000, 178},
-        {0xc000, 181},
-        {0xc000, 185},
-        {0xc000, 186},
-        {0xc000, 187},
-        {0xc000, 189},
-        {0xc000, 190},
-        {0xc000, 196},
-        {0xc000, 198},
-        {0xc000, 228},
-        {0xc000, 232},
-        {0xc000, 233},
-        {0x94, 0},
-        {0x95, 0},
-        {0x97, 0},
-        {0x98, 0},
-    },
-    /* 135 */
-    {
-        {0x8001, 178},
-        {0xc016, 178},
-        {0x8001, 181},
-        {0xc016, 181},
-        {0x8001, 185},
-        {0xc016, 185},
-        {0x8001, 186},
-        {0xc016, 186},
-        {0x8001, 187},
-        {0xc016, 187},
-        {0x8001, 189},
-        {0xc016, 189},
-        {0x8001, 190},
-        {0xc016, 190},
-        {0x8001, 196},
-        {0xc016, 196},
-    },
-    /* 136 */
-    {
-        {0x8002, 178},
-        {0x8009, 178},
-        {0x8017, 178},
-        {0xc028, 178},
-        {0x8002, 181},
-        {0x8009, 181},
-        {0x8017, 181},
-        {0xc028, 181},
-        {0x8002, 185},
-        {0x8009, 185},
-        {0x8017, 185},
-        {0xc028, 185},
-        {0x8002, 186},
-        {0x8009, 186},
-        {0x8017, 186},
-        {0xc028, 186},
-    },
-    /* 137 */
-    {
-        {0x8003, 178},
-        {0x8006, 178},
-        {0x800a, 178},
-        {0x800f, 178},
-        {0x8018, 178},
-        {0x801f, 178},
-        {0x8029, 178},
-        {0xc038, 178},
-        {0x8003, 181},
-        {0x8006, 181},
-        {0x800a, 181},
-        {0x800f, 181},
-        {0x8018, 181},
-        {0x801f, 181},
-        {0x8029, 181},
-        {0xc038, 181},
-    },
-    /* 138 */
-    {
-        {0x8003, 185},
-        {0x8006, 185},
-        {0x800a, 185},
-        {0x800f, 185},
-        {0x8018, 185},
-        {0x801f, 185},
-        {0x8029, 185},
-        {0xc038, 185},
-        {0x8003, 186},
-        {0x8006, 186},
-        {0x800a, 186},
-        {0x800f, 186},
-        {0x8018, 186},
-        {0x801f, 186},
-        {0x8029, 186},
-        {0xc038, 186},
-    },
-    /* 139 */
-    {
-        {0x8002, 187},
-        {0x8009, 187},
-        {0x8017, 187},
-        {0xc028, 187},
-        {0x8002, 189},
-        {0x8009, 189},
-        {0x8017, 189},
-        {0xc028, 189},
-        {0x8002, 190},
-        {0x8009, 190},
-        {0x8017, 190},
-        {0xc028, 190},
-        {0x8002, 196},
-        {0x8009, 196},
-        {0x8017, 196},
-        {0xc028, 196},
-    },
-    /* 140 */
-    {
-        {0x8003, 187},
-        {0x8006, 187},
-        {0x800a, 187},
-        {0x800f, 187},
-        {0x8018, 187},
-        {0x801f, 187},
-        {0x8029, 187},
-        {0xc038, 187},
-        {0x8003, 189},
-        {0x8006, 189},
-        {0x800a, 189},
-        {0x800f, 189},
-        {0x8018, 189},
-        {0x801f, 189},
-        {0x8029, 189},
-        {0xc038, 189},
-    },
-    /* 141 */
-    {
-        {0x8003, 190},
-        {0x8006, 190},
-        {0x800a, 190},
-        {0x800f, 190},
-        {0x8018, 190},
-        {0x801f, 190},
-        {0x8029, 190},
-        {0xc038, 190},
-        {0x8003, 196},
-        {0x8006, 196},
-        {0x800a, 196},
-        {0x800f, 196},
-        {0x8018, 196},
-        {0x801f, 196},
-        {0x8029, 196},
-        {0xc038, 196},
-    },
-    /* 142 */
-    {
-        {0x8001, 198},
-        {0xc016, 198},
-        {0x8001, 228},
-        {0xc016, 228},
-        {0x8001, 232},
-        {0xc016, 232},
-        {0x8001, 233},
-        {0xc016, 233},
-        {0xc000, 1},
-        {0xc000, 135},
-        {0xc000, 137},
-        {0xc000, 138},
-        {0xc000, 139},
-        {0xc000, 140},
-        {0xc000, 141},
-        {0xc000, 143},
-    },
-    /* 143 */
-    {
-        {0x8002, 198},
-        {0x8009, 198},
-        {0x8017, 198},
-        {0xc028, 198},
-        {0x8002, 228},
-        {0x8009, 228},
-        {0x8017, 228},
-        {0xc028, 228},
-        {0x8002, 232},
-        {0x8009, 232},
-        {0x8017, 232},
-        {0xc028, 232},
-        {0x8002, 233},
-        {0x8009, 233},
-        {0x8017, 233},
-        {0xc028, 233},
-    },
-    /* 144 */
-    {
-        {0x8003, 198},
-        {0x8006, 198},
-        {0x800a, 198},
-        {0x800f, 198},
-        {0x8018, 198},
-        {0x801f, 198},
-        {0x8029, 198},
-        {0xc038, 198},
-        {0x8003, 228},
-        {0x8006, 228},
-        {0x800a, 228},
-        {0x800f, 228},
-        {0x8018, 228},
-        {0x801f, 228},
-        {0x8029, 228},
-        {0xc038, 228},
-    },
-    /* 145 */
-    {
-        {0x8003, 232},
-        {0x8006, 232},
-        {0x800a, 232},
-        {0x800f, 232},
-        {0x8018, 232},
-        {0x801f, 232},
-        {0x8029, 232},
-        {0xc038, 232},
-        {0x8003, 233},
-        {0x8006, 233},
-        {0x800a, 233},
-        {0x800f, 233},
-        {0x8018, 233},
-        {0x801f, 233},
-        {0x8029, 233},
-        {0xc038, 233},
-    },
-    /* 146 */
-    {
-        {0x8001, 1},
-        {0xc016, 1},
-        {0x8001, 135},
-        {0xc016, 135},
-        {0x8001, 137},
-        {0xc016, 137},
-        {0x8001, 138},
-        {0xc016, 138},
-        {0x8001, 139},
-        {0xc016, 139},
-        {0x8001, 140},
-        {0xc016, 140},
-        {0x8001, 141},
-        {0xc016, 141},
-        {0x8001, 143},
-        {0xc016, 143},
-    },
-    /* 147 */
-    {
-        {0x8002, 1},
-        {0x8009, 1},
-        {0x8017, 1},
-        {0xc028, 1},
-        {0x8002, 135},
-        {0x8009, 135},
-        {0x8017, 135},
-        {0xc028, 135},
-        {0x8002, 137},
-        {0x8009, 137},
-        {0x8017, 137},
-        {0xc028, 137},
-        {0x8002, 138},
-        {0x8009, 138},
-        {0x8017, 138},
-        {0xc028, 138},
-    },
-    /* 148 */
-    {
-        {0x8003, 1},
-        {0x8006, 1},
-        {0x800a, 1},
-        {0x800f, 1},
-        {0x8018, 1},
-        {0x801f, 1},
-        {0x8029, 1},
-        {0xc038, 1},
-        {0x8003, 135},
-        {0x8006, 135},
-        {0x800a, 135},
-        {0x800f, 135},
-        {0x8018, 135},
-        {0x801f, 135},
-        {0x8029, 135},
-        {0xc038, 135},
-    },
-    /* 149 */
-    {
-        {0x8003, 137},
-        {0x8006, 137},
-        {0x800a, 137},
-        {0x800f, 137},
-        {0x8018, 137},
-        {0x801f, 137},
-        {0x8029, 137},
-        {0xc038, 137},
-        {0x8003, 138},
-        {0x8006, 138},
-        {0x800a, 138},
-        {0x800f, 138},
-        {0x8018, 138},
-        {0x801f, 138},
-        {0x8029, 138},
-        {0xc038, 138},
-    },
-    /* 150 */
-    {
-        {0x8002, 139},
-        {0x8009, 139},
-        {0x8017, 139},
-        {0xc028, 139},
-        {0x8002, 140},
-        {0x8009, 140},
-        {0x8017, 140},
-        {0xc028, 140},
-        {0x8002, 141},
-        {0x8009, 141},
-        {0x8017, 141},
-        {0xc028, 141},
-        {0x8002, 143},
-        {0x8009, 143},
-        {0x8017, 143},
-        {0xc028, 143},
-    },
-    /* 151 */
-    {
-        {0x8003, 139},
-        {0x8006, 139},
-        {0x800a, 139},
-        {0x800f, 139},
-        {0x8018, 139},
-        {0x801f, 139},
-        {0x8029, 139},
-        {0xc038, 139},
-        {0x8003, 140},
-        {0x8006, 140},
-        {0x800a, 140},
-        {0x800f, 140},
-        {0x8018, 140},
-        {0x801f, 140},
-        {0x8029, 140},
-        {0xc038, 140},
-    },
-    /* 152 */
-    {
-        {0x8003, 141},
-        {0x8006, 141},
-        {0x800a, 141},
-        {0x800f, 141},
-        {0x8018, 141},
-        {0x801f, 141},
-        {0x8029, 141},
-        {0xc038, 141},
-        {0x8003, 143},
-        {0x8006, 143},
-        {0x800a, 143},
-        {0x800f, 143},
-        {0x8018, 143},
-        {0x801f, 143},
-        {0x8029, 143},
-        {0xc038, 143},
-    },
-    /* 153 */
-    {
-        {0x9d, 0},
-        {0x9e, 0},
-        {0xa0, 0},
-        {0xa1, 0},
-        {0xa4, 0},
-        {0xa5, 0},
-        {0xa7, 0},
-        {0xa8, 0},
-        {0xac, 0},
-        {0xad, 0},
-        {0xaf, 0},
-        {0xb1, 0},
-        {0xb6, 0},
-        {0xb9, 0},
-        {0xbf, 0},
-        {0xcf, 0},
-    },
-    /* 154 */
-    {
-        {0xc000, 147},
-        {0xc000, 149},
-        {0xc000, 150},
-        {0xc000, 151},
-        {0xc000, 152},
-        {0xc000, 155},
-        {0xc000, 157},
-        {0xc000, 158},
-        {0xc000, 165},
-        {0xc000, 166},
-        {0xc000, 168},
-        {0xc000, 174},
-        {0xc000, 175},
-        {0xc000, 180},
-        {0xc000, 182},
-        {0xc000, 183},
-    },
-    /* 155 */
-    {
-        {0x8001, 147},
-        {0xc016, 147},
-        {0x8001, 149},
-        {0xc016, 149},
-        {0x8001, 150},
-        {0xc016, 150},
-        {0x8001, 151},
-        {0xc016, 151},
-        {0x8001, 152},
-        {0xc016, 152},
-        {0x8001, 155},
-        {0xc016, 155},
-        {0x8001, 157},
-        {0xc016, 157},
-        {0x8001, 158},
-        {0xc016, 158},
-    },
-    /* 156 */
-    {
-        {0x8002, 147},
-        {0x8009, 147},
-        {0x8017, 147},
-        {0xc028, 147},
-        {0x8002, 149},
-        {0x8009, 149},
-        {0x8017, 149},
-        {0xc028, 149},
-        {0x8002, 150},
-        {0x8009, 150},
-        {0x8017, 150},
-        {0xc028, 150},
-        {0x8002, 151},
-        {0x8009, 151},
-        {0x8017, 151},
-        {0xc028, 151},
-    },
-    /* 157 */
-    {
-        {0x8003, 147},
-        {0x8006, 147},
-        {0x800a, 147},
-        {0x800f, 147},
-        {0x8018, 147},
-        {0x801f, 147},
-        {0x8029, 147},
-        {0xc038, 147},
-        {0x8003, 149},
-        {0x8006, 149},
-        {0x800a, 149},
-        {0x800f, 149},
-        {0x8018, 149},
-        {0x801f, 149},
-        {0x8029, 149},
-        {0xc038, 149},
-    },
-    /* 158 */
-    {
-        {0x8003, 150},
-        {0x8006, 150},
-        {0x800a, 150},
-        {0x800f, 150},
-        {0x8018, 150},
-        {0x801f, 150},
-        {0x8029, 150},
-        {0xc038, 150},
-        {0x8003, 151},
-        {0x8006, 151},
-        {0x800a, 151},
-        {0x800f, 151},
-        {0x8018, 151},
-        {0x801f, 151},
-        {0x8029, 151},
-        {0xc038, 151},
-    },
-    /* 159 */
-    {
-        {0x8002, 152},
-        {0x8009, 152},
-        {0x8017, 152},
-        {0xc028, 152},
-        {0x8002, 155},
-        {0x8009, 155},
-        {0x8017, 155},
-        {0xc028, 155},
-        {0x8002, 157},
-        {0x8009, 157},
-        {0x8017, 157},
-        {0xc028, 157},
-        {0x8002, 158},
-        {0x8009, 158},
-        {0x8017, 158},
-        {0xc028, 158},
-    },
-    /* 160 */
-    {
-        {0x8003, 152},
-        {0x8006, 152},
-        {0x800a, 152},
-        {0x800f, 152},
-        {0x8018, 152},
-        {0x801f, 152},
-        {0x8029, 152},
-        {0xc038, 152},
-        {0x8003, 155},
-        {0x8006, 155},
-        {0x800a, 155},
-        {0x800f, 155},
-        {0x8018, 155},
-        {0x801f, 155},
-        {0x8029, 155},
-        {0xc038, 155},
-    },
-    /* 161 */
-    {
-        {0x8003, 157},
-        {0x8006, 157},
-        {0x800a, 157},
-        {0x800f, 157},
-        {0x8018, 157},
-        {0x801f, 157},
-        {0x8029, 157},
-        {0xc038, 157},
-        {0x8003, 158},
-        {0x8006, 158},
-        {0x800a, 158},
-        {0x800f, 158},
-        {0x8018, 158},
-        {0x801f, 158},
-        {0x8029, 158},
-        {0xc038, 158},
-    },
-    /* 162 */
-    {
-        {0x8001, 165},
-        {0xc016, 165},
-        {0x8001, 166},
-        {0xc016, 166},
-        {0x8001, 168},
-        {0xc016, 168},
-        {0x8001, 174},
-        {0xc016, 174},
-        {0x8001, 175},
-        {0xc016, 175},
-        {0x8001, 180},
-        {0xc016, 180},
-        {0x8001, 182},
-        {0xc016, 182},
-        {0x8001, 183},
-        {0xc016, 183},
-    },
-    /* 163 */
-    {
-        {0x8002, 165},
-        {0x8009, 165},
-        {0x8017, 165},
-        {0xc028, 165},
-        {0x8002, 166},
-        {0x8009, 166},
-        {0x8017, 166},
-        {0xc028, 166},
-        {0x8002, 168},
-        {0x8009, 168},
-        {0x8017, 168},
-        {0xc028, 168},
-        {0x8002, 174},
-        {0x8009, 174},
-        {0x8017, 174},
-        {0xc028, 174},
-    },
-    /* 164 */
-    {
-        {0x8003, 165},
-        {0x8006, 165},
-        {0x800a, 165},
-        {0x800f, 165},
-        {0x8018, 165},
-        {0x801f, 165},
-        {0x8029, 165},
-        {0xc038, 165},
-        {0x8003, 166},
-        {0x8006, 166},
-        {0x800a, 166},
-        {0x800f, 166},
-        {0x8018, 166},
-        {0x801f, 166},
-        {0x8029, 166},
-        {0xc038, 166},
-    },
-    /* 165 */
-    {
-        {0x8003, 168},
-        {0x8006, 168},
-        {0x800a, 168},
-        {0x800f, 168},
-        {0x8018, 168},
-        {0x801f, 168},
-        {0x8029, 168},
-        {0xc038, 168},
-        {0x8003, 174},
-        {0x8006, 174},
-        {0x800a, 174},
-        {0x800f, 174},
-        {0x8018, 174},
-        {0x801f, 174},
-        {0x8029, 174},
-        {0xc038, 174},
-    },
-    /* 166 */
-    {
-        {0x8002, 175},
-        {0x8009, 175},
-        {0x8017, 175},
-        {0xc028, 175},
-        {0x8002, 180},
-        {0x8009, 180},
-        {0x8017, 180},
-        {0xc028, 180},
-        {0x8002, 182},
-        {0x8009, 182},
-        {0x8017, 182},
-        {0xc028, 182},
-        {0x8002, 183},
-        {0x8009, 183},
-        {0x8017, 183},
-        {0xc028, 183},
-    },
-    /* 167 */
-    {
-        {0x8003, 175},
-        {0x8006, 175},
-        {0x800a, 175},
-        {0x800f, 175},
-        {0x8018, 175},
-        {0x801f, 175},
-        {0x8029, 175},
-        {0xc038, 175},
-        {0x8003, 180},
-        {0x8006, 180},
-        {0x800a, 180},
-        {0x800f, 180},
-        {0x8018, 180},
-        {0x801f, 180},
-        {0x8029, 180},
-        {0xc038, 180},
-    },
-    /* 168 */
-    {
-        {0x8003, 182},
-        {0x8006, 182},
-        {0x800a, 182},
-        {0x800f, 182},
-        {0x8018, 182},
-        {0x801f, 182},
-        {0x8029, 182},
-        {0xc038, 182},
-        {0x8003, 183},
-        {0x8006, 183},
-        {0x800a, 183},
-        {0x800f, 183},
-        {0x8018, 183},
-        {0x801f, 183},
-        {0x8029, 183},
-        {0xc038, 183},
-    },
-    /* 169 */
-    {
-        {0xc000, 188},
-        {0xc000, 191},
-        {0xc000, 197},
-        {0xc000, 231},
-        {0xc000, 239},
-        {0xb0, 0},
-        {0xb2, 0},
-        {0xb3, 0},
-        {0xb7, 0},
-        {0xb8, 0},
-        {0xba, 0},
-        {0xbb, 0},
-        {0xc0, 0},
-        {0xc7, 0},
-        {0xd0, 0},
-        {0xdf, 0},
-    },
-    /* 170 */
-    {
-        {0x8001, 188},
-        {0xc016, 188},
-        {0x8001, 191},
-        {0xc016, 191},
-        {0x8001, 197},
-        {0xc016, 197},
-        {0x8001, 231},
-        {0xc016, 231},
-        {0x8001, 239},
-        {0xc016, 239},
-        {0xc000, 9},
-        {0xc000, 142},
-        {0xc000, 144},
-        {0xc000, 145},
-        {0xc000, 148},
-        {0xc000, 159},
-    },
-    /* 171 */
-    {
-        {0x8002, 188},
-        {0x8009, 188},
-        {0x8017, 188},
-        {0xc028, 188},
-        {0x8002, 191},
-        {0x8009, 191},
-        {0x8017, 191},
-        {0xc028, 191},
-        {0x8002, 197},
-        {0x8009, 197},
-        {0x8017, 197},
-        {0xc028, 197},
-        {0x8002, 231},
-        {0x8009, 231},
-        {0x8017, 231},
-        {0xc028, 231},
-    },
-    /* 172 */
-    {
-        {0x8003, 188},
-        {0x8006, 188},
-        {0x800a, 188},
-        {0x800f, 188},
-        {0x8018, 188},
-        {0x801f, 188},
-        {0x8029, 188},
-        {0xc038, 188},
-        {0x8003, 191},
-        {0x8006, 191},
-        {0x800a, 191},
-        {0x800f, 191},
-        {0x8018, 191},
-        {0x801f, 191},
-        {0x8029, 191},
-        {0xc038, 191},
-    },
-    /* 173 */
-    {
-        {0x8003, 197},
-        {0x8006, 197},
-        {0x800a, 197},
-        {0x800f, 197},
-        {0x8018, 197},
-        {0x801f, 197},
-        {0x8029, 197},
-        {0xc038, 197},
-        {0x8003, 231},
-        {0x8006, 231},
-        {0x800a, 231},
-        {0x800f, 231},
-        {0x8018, 231},
-        {0x801f, 231},
-        {0x8029, 231},
-        {0xc038, 231},
-    },
-    /* 174 */
-    {
-        {0x8002, 239},
-        {0x8009, 239},
-        {0x8017, 239},
-        {0xc028, 239},
-        {0x8001, 9},
-        {0xc016, 9},
-        {0x8001, 142},
-        {0xc016, 142},
-        {0x8001, 144},
-        {0xc016, 144},
-        {0x8001, 145},
-        {0xc016, 145},
-        {0x8001, 148},
-        {0xc016, 148},
-        {0x8001, 159},
-        {0xc016, 159},
-    },
-    /* 175 */
-    {
-        {0x8003, 239},
-        {0x8006, 239},
-        {0x800a, 239},
-        {0x800f, 239},
-        {0x8018, 239},
-        {0x801f, 239},
-        {0x8029, 239},
-        {0xc038, 239},
-        {0x8002, 9},
-        {0x8009, 9},
-        {0x8017, 9},
-        {0xc028, 9},
-        {0x8002, 142},
-        {0x8009, 142},
-        {0x8017, 142},
-        {0xc028, 142},
-    },
-    /* 176 */
-    {
-        {0x8003, 9},
-        {0x8006, 9},
-        {0x800a, 9},
-        {0x800f, 9},
-        {0x8018, 9},
-        {0x801f, 9},
-        {0x8029, 9},
-        {0xc038, 9},
-        {0x8003, 142},
-        {0x8006, 142},
-        {0x800a, 142},
-        {0x800f, 142},
-        {0x8018, 142},
-        {0x801f, 142},
-        {0x8029, 142},
-        {0xc038, 142},
-    },
-    /* 177 */
-    {
-        {0x8002, 144},
-        {0x8009, 144},
-        {0x8017, 144},
-        {0xc028, 144},
-        {0x8002, 145},
-        {0x8009, 145},
-        {0x8017, 145},
-        {0xc028, 145},
-        {0x8002, 148},
-        {0x8009, 148},
-        {0x8017, 148},
-        {0xc028, 148},
-        {0x8002, 159},
-        {0x8009, 159},
-        {0x8017, 159},
-        {0xc028, 159},
-    },
-    /* 178 */
-    {
-        {0x8003, 144},
-        {0x8006, 144},
-        {0x800a, 144},
-        {0x800f, 144},
-        {0x8018, 144},
-        {0x801f, 144},
-        {0x8029, 144},
-        {0xc038, 144},
-        {0x8003, 145},
-        {0x8006, 145},
-        {0x800a, 145},
-        {0x800f, 145},
-        {0x8018, 145},
-        {0x801f, 145},
-        {0x8029, 145},
-        {0xc038, 145},
-    },
-    /* 179 */
-    {
-        {0x8003, 148},
-        {0x8006, 148},
-        {0x800a, 148},
-        {0x800f, 148},
-        {0x8018, 148},
-        {0x801f, 148},
-        {0x8029, 148},
-        {0xc038, 148},
-        {0x8003, 159},
-        {0x8006, 159},
-        {0x800a, 159},
-        {0x800f, 159},
-        {0x8018, 159},
-        {0x801f, 159},
-        {0x8029, 159},
-        {0xc038, 159},
-    },
-    /* 180 */
-    {
-        {0xc000, 171},
-        {0xc000, 206},
-        {0xc000, 215},
-        {0xc000, 225},
-        {0xc000, 236},
-        {0xc000, 237},
-        {0xbc, 0},
-        {0xbd, 0},
-        {0xc1, 0},
-        {0xc4, 0},
-        {0xc8, 0},
-        {0xcb, 0},
-        {0xd1, 0},
-        {0xd8, 0},
-        {0xe0, 0},
-        {0xee, 0},
-    },
-    /* 181 */
-    {
-        {0x8001, 171},
-        {0xc016, 171},
-        {0x8001, 206},
-        {0xc016, 206},
-        {0x8001, 215},
-        {0xc016, 215},
-        {0x8001, 225},
-        {0xc016, 225},
-        {0x8001, 236},
-        {0xc016, 236},
-        {0x8001, 237},
-        {0xc016, 237},
-        {0xc000, 199},
-        {0xc000, 207},
-        {0xc000, 234},
-        {0xc000, 235},
-    },
-    /* 182 */
-    {
-        {0x8002, 171},
-        {0x8009, 171},
-        {0x8017, 171},
-        {0xc028, 171},
-        {0x8002, 206},
-        {0x8009, 206},
-        {0x8017, 206},
-        {0xc028, 206},
-        {0x8002, 215},
-        {0x8009, 215},
-        {0x8017, 215},
-        {0xc028, 215},
-        {0x8002, 225},
-        {0x8009, 225},
-        {0x8017, 225},
-        {0xc028, 225},
-    },
-    /* 183 */
-    {
-        {0x8003, 171},
-        {0x8006, 171},
-        {0x800a, 171},
-        {0x800f, 171},
-        {0x8018, 171},
-        {0x801f, 171},
-        {0x8029, 171},
-        {0xc038, 171},
-        {0x8003, 206},
-        {0x8006, 206},
-        {0x800a, 206},
-        {0x800f, 206},
-        {0x8018, 206},
-        {0x801f, 206},
-        {0x8029, 206},
-        {0xc038, 206},
-    },
-    /* 184 */
-    {
-        {0x8003, 215},
-        {0x8006, 215},
-        {0x800a, 215},
-        {0x800f, 215},
-        {0x8018, 215},
-        {0x801f, 215},
-        {0x8029, 215},
-        {0xc038, 215},
-        {0x8003, 225},
-        {0x8006, 225},
-        {0x800a, 225},
-        {0x800f, 225},
-        {0x8018, 225},
-        {0x801f, 225},
-        {0x8029, 225},
-        {0xc038, 225},
-    },
-    /* 185 */
-    {
-        {0x8002, 236},
-        {0x8009, 236},
-        {0x8017, 236},
-        {0xc028, 236},
-        {0x8002, 237},
-        {0x8009, 237},
-        {0x8017, 237},
-        {0xc028, 237},
-        {0x8001, 199},
-        {0xc016, 199},
-        {0x8001, 207},
-        {0xc016, 207},
-        {0x8001, 234},
-        {0xc016, 234},
-        {0x8001, 235},
-        {0xc016, 235},
-    },
-    /* 186 */
-    {
-        {0x8003, 236},
-        {0x8006, 236},
-        {0x800a, 236},
-        {0x800f, 236},
-        {0x8018, 236},
-        {0x801f, 236},
-        {0x8029, 236},
-        {0xc038, 236},
-        {0x8003, 237},
-        {0x8006, 237},
-        {0x800a, 237},
-        {0x800f, 237},
-        {0x8018, 237},
-        {0x801f, 237},
-        {0x8029, 237},
-        {0xc038, 237},
-    },
-    /* 187 */
-    {
-        {0x8002, 199},
-        {0x8009, 199},
-        {0x8017, 199},
-        {0xc028, 199},
-        {0x8002, 207},
-        {0x8009, 207},
-        {0x8017, 207},
-        {0xc028, 207},
-        {0x8002, 234},
-        {0x8009, 234},
-        {0x8017, 234},
-        {0xc028, 234},
-        {0x8002, 235},
-        {0x8009, 235},
-        {0x8017, 235},
-        {0xc028, 235},
-    },
-    /* 188 */
-    {
-        {0x8003, 199},
-        {0x8006, 199},
-        {0x800a, 199},
-        {0x800f, 199},
-        {0x8018, 199},
-        {0x801f, 199},
-        {0x8029, 199},
-        {0xc038, 199},
-        {0x8003, 207},
-        {0x8006, 207},
-        {0x800a, 207},
-        {0x800f, 207},
-        {0x8018, 207},
-        {0x801f, 207},
-        {0x8029, 207},
-        {0xc038, 207},
-    },
-    /* 189 */
-    {
-        {0x8003, 234},
-        {0x8006, 234},
-        {0x800a, 234},
-        {0x800f, 234},
-        {0x8018, 234},
-        {0x801f, 234},
-        {0x8029, 234},
-        {0xc038, 234},
-        {0x8003, 235},
-        {0x8006, 235},
-        {0x800a, 235},
-        {0x800f, 235},
-        {0x8018, 235},
-        {0x801f, 235},
-        {0x8029, 235},
-        {0xc038, 235},
-    },
-    /* 190 */
-    {
-        {0xc2, 0},
-        {0xc3, 0},
-        {0xc5, 0},
-        {0xc6, 0},
-        {0xc9, 0},
-        {0xca, 0},
-        {0xcc, 0},
-        {0xcd, 0},
-        {0xd2, 0},
-        {0xd5, 0},
-        {0xd9, 0},
-        {0xdc, 0},
-        {0xe1, 0},
-        {0xe7, 0},
-        {0xef, 0},
-        {0xf6, 0},
-    },
-    /* 191 */
-    {
-        {0xc000, 192},
-        {0xc000, 193},
-        {0xc000, 200},
-        {0xc000, 201},
-        {0xc000, 202},
-        {0xc000, 205},
-        {0xc000, 210},
-        {0xc000, 213},
-        {0xc000, 218},
-        {0xc000, 219},
-        {0xc000, 238},
-        {0xc000, 240},
-        {0xc000, 242},
-        {0xc000, 243},
-        {0xc000, 255},
-        {0xce, 0},
-    },
-    /* 192 */
-    {
-        {0x8001, 192},
-        {0xc016, 192},
-        {0x8001, 193},
-        {0xc016, 193},
-        {0x8001, 200},
-        {0xc016, 200},
-        {0x8001, 201},
-        {0xc016, 201},
-        {0x8001, 202},
-        {0xc016, 202},
-        {0x8001, 205},
-        {0xc016, 205},
-        {0x8001, 210},
-        {0xc016, 210},
-        {0x8001, 213},
-        {0xc016, 213},
-    },
-    /* 193 */
-    {
-        {0x8002, 192},
-        {0x8009, 192},
-        {0x8017, 192},
-        {0xc028, 192},
-        {0x8002, 193},
-        {0x8009, 193},
-        {0x8017, 193},
-        {0xc028, 193},
-        {0x8002, 200},
-        {0x8009, 200},
-        {0x8017, 200},
-        {0xc028, 200},
-        {0x8002, 201},
-        {0x8009, 201},
-        {0x8017, 201},
-        {0xc028, 201},
-    },
-    /* 194 */
-    {
-        {0x8003, 192},
-        {0x8006, 192},
-        {0x800a, 192},
-        {0x800f, 192},
-        {0x8018, 192},
-        {0x801f, 192},
-        {0x8029, 192},
-        {0xc038, 192},
-        {0x8003, 193},
-        {0x8006, 193},
-        {0x800a, 193},
-        {0x800f, 193},
-        {0x8018, 193},
-        {0x801f, 193},
-        {0x8029, 193},
-        {0xc038, 193},
-    },
-    /* 195 */
-    {
-        {0x8003, 200},
-        {0x8006, 200},
-        {0x800a, 200},
-        {0x800f, 200},
-        {0x8018, 200},
-        {0x801f, 200},
-        {0x8029, 200},
-        {0xc038, 200},
-        {0x8003, 201},
-        {0x8006, 201},
-        {0x800a, 201},
-        {0x800f, 201},
-        {0x8018, 201},
-        {0x801f, 201},
-        {0x8029, 201},
-        {0xc038, 201},
-    },
-    /* 196 */
-    {
-        {0x8002, 202},
-        {0x8009, 202},
-        {0x8017, 202},
-        {0xc028, 202},
-        {0x8002, 205},
-        {0x8009, 205},
-        {0x8017, 205},
-        {0xc028, 205},
-        {0x8002, 210},
-        {0x8009, 210},
-        {0x8017, 210},
-        {0xc028, 210},
-        {0x8002, 213},
-        {0x8009, 213},
-        {0x8017, 213},
-        {0xc028, 213},
-    },
-    /* 197 */
-    {
-        {0x8003, 202},
-        {0x8006, 202},
-        {0x800a, 202},
-        {0x800f, 202},
-        {0x8018, 202},
-        {0x801f, 202},
-        {0x8029, 202},
-        {0xc038, 202},
-        {0x8003, 205},
-        {0x8006, 205},
-        {0x800a, 205},
-        {0x800f, 205},
-        {0x8018, 205},
-        {0x801f, 205},
-        {0x8029, 205},
-        {0xc038, 205},
-    },
-    /* 198 */
-    {
-        {0x8003, 210},
-        {0x8006, 210},
-        {0x800a, 210},
-        {0x800f, 210},
-        {0x8018, 210},
-        {0x801f, 210},
-        {0x8029, 210},
-        {0xc038, 210},
-        {0x8003, 213},
-        {0x8006, 213},
-        {0x800a, 213},
-        {0x800f, 213},
-        {0x8018, 213},
-        {0x801f, 213},
-        {0x8029, 213},
-        {0xc038, 213},
-    },
-    /* 199 */
-    {
-        {0x8001, 218},
-        {0xc016, 218},
-        {0x8001, 219},
-        {0xc016, 219},
-        {0x8001, 238},
-        {0xc016, 238},
-        {0x8001, 240},
-        {0xc016, 240},
-        {0x8001, 242},
-        {0xc016, 242},
-        {0x8001, 243},
-        {0xc016, 243},
-        {0x8001, 255},
-        {0xc016, 255},
-        {0xc000, 203},
-        {0xc000, 204},
-    },
-    /* 200 */
-    {
-        {0x8002, 218},
-        {0x8009, 218},
-        {0x8017, 218},
-        {0xc028, 218},
-        {0x8002, 219},
-        {0x8009, 219},
-        {0x8017, 219},
-        {0xc028, 219},
-        {0x8002, 238},
-        {0x8009, 238},
-        {0x8017, 238},
-        {0xc028, 238},
-        {0x8002, 240},
-        {0x8009, 240},
-        {0x8017, 240},
-        {0xc028, 240},
-    },
-    /* 201 */
-    {
-        {0x8003, 218},
-        {0x8006, 218},
-        {0x800a, 218},
-        {0x800f, 218},
-        {0x8018, 218},
-        {0x801f, 218},
-        {0x8029, 218},
-        {0xc038, 218},
-        {0x8003, 219},
-        {0x8006, 219},
-        {0x800a, 219},
-        {0x800f, 219},
-        {0x8018, 219},
-        {0x801f, 219},
-        {0x8029, 219},
-        {0xc038, 219},
-    },
-    /* 202 */
-    {
-        {0x8003, 238},
-        {0x8006, 238},
-        {0x800a, 238},
-        {0x800f, 238},
-        {0x8018, 238},
-        {0x801f, 238},
-        {0x8029, 238},
-        {0xc038, 238},
-        {0x8003, 240},
-        {0x8006, 240},
-        {0x800a, 240},
-        {0x800f, 240},
-        {0x8018, 240},
-        {0x801f, 240},
-        {0x8029, 240},
-        {0xc038, 240},
-    },
-    /* 203 */
-    {
-        {0x8002, 242},
-        {0x8009, 242},
-        {0x8017, 242},
-        {0xc028, 242},
-        {0x8002, 243},
-        {0x8009, 243},
-        {0x8017, 243},
-        {0xc028, 243},
-        {0x8002, 255},
-        {0x8009, 255},
-        {0x8017, 255},
-        {0xc028, 255},
-        {0x8001, 203},
-        {0xc016, 203},
-        {0x8001, 204},
-        {0xc016, 204},
-    },
-    /* 204 */
-    {
-        {0x8003, 242},
-        {0x8006, 242},
-        {0x800a, 242},
-        {0x800f, 242},
-        {0x8018, 242},
-        {0x801f, 242},
-        {0x8029, 242},
-        {0xc038, 242},
-        {0x8003, 243},
-        {0x8006, 243},
-        {0x800a, 243},
-        {0x800f, 243},
-        {0x8018, 243},
-        {0x801f, 243},
-        {0x8029, 243},
-        {0xc038, 243},
-    },
-    /* 205 */
-    {
-        {0x8003, 255},
-        {0x8006, 255},
-        {0x800a, 255},
-        {0x800f, 255},
-        {0x8018, 255},
-        {0x801f, 255},
-        {0x8029, 255},
-        {0xc038, 255},
-        {0x8002, 203},
-        {0x8009, 203},
-        {0x8017, 203},
-        {0xc028, 203},
-        {0x8002, 204},
-        {0x8009, 204},
-        {0x8017, 204},
-        {0xc028, 204},
-    },
-    /* 206 */
-    {
-        {0x8003, 203},
-        {0x8006, 203},
-        {0x800a, 203},
-        {0x800f, 203},
-        {0x8018, 203},
-        {0x801f, 203},
-        {0x8029, 203},
-        {0xc038, 203},
-        {0x8003, 204},
-        {0x8006, 204},
-        {0x800a, 204},
-        {0x800f, 204},
-        {0x8018, 204},
-        {0x801f, 204},
-        {0x8029, 204},
-        {0xc038, 204},
-    },
-    /* 207 */
-    {
-        {0xd3, 0},
-        {0xd4, 0},
-        {0xd6, 0},
-        {0xd7, 0},
-        {0xda, 0},
-        {0xdb, 0},
-        {0xdd, 0},
-        {0xde, 0},
-        {0xe2, 0},
-        {0xe4, 0},
-        {0xe8, 0},
-        {0xeb, 0},
-        {0xf0, 0},
-        {0xf3, 0},
-        {0xf7, 0},
-        {0xfa, 0},
-    },
-    /* 208 */
-    {
-        {0xc000, 211},
-        {0xc000, 212},
-        {0xc000, 214},
-        {0xc000, 221},
-        {0xc000, 222},
-        {0xc000, 223},
-        {0xc000, 241},
-        {0xc000, 244},
-        {0xc000, 245},
-        {0xc000, 246},
-        {0xc000, 247},
-        {0xc000, 248},
-        {0xc000, 250},
-        {0xc000, 251},
-        {0xc000, 252},
-        {0xc000, 253},
-    },
-    /* 209 */
-    {
-        {0x8001, 211},
-        {0xc016, 211},
-        {0x8001, 212},
-        {0xc016, 212},
-        {0x8001, 214},
-        {0xc016, 214},
-        {0x8001, 221},
-        {0xc016, 221},
-        {0x8001, 222},
-        {0xc016, 222},
-        {0x8001, 223},
-        {0xc016, 223},
-        {0x8001, 241},
-        {0xc016, 241},
-        {0x8001, 244},
-        {0xc016, 244},
-    },
-    /* 210 */
-    {
-        {0x8002, 211},
-        {0x8009, 211},
-        {0x8017, 211},
-        {0xc028, 211},
-        {0x8002, 212},
-        {0x8009, 212},
-        {0x8017, 212},
-        {0xc028, 212},
-        {0x8002, 214},
-        {0x8009, 214},
-        {0x8017, 214},
-        {0xc028, 214},
-        {0x8002, 221},
-        {0x8009, 221},
-        {0x8017, 221},
-        {0xc028, 221},
-    },
-    /* 211 */
-    {
-        {0x8003, 211},
-        {0x8006, 211},
-        {0x800a, 211},
-        {0x800f, 211},
-        {0x8018, 211},
-        {0x801f, 211},
-        {0x8029, 211},
-        {0xc038, 211},
-        {0x8003, 212},
-        {0x8006, 212},
-        {0x800a, 212},
-        {0x800f, 212},
-        {0x8018, 212},
-        {0x801f, 212},
-        {0x8029, 212},
-        {0xc038, 212},
-    },
-    /* 212 */
-    {
-        {0x8003, 214},
-        {0x8006, 214},
-        {0x800a, 214},
-        {0x800f, 214},
-        {0x8018, 214},
-        {0x801f, 214},
-        {0x8029, 214},
-        {0xc038, 214},
-        {0x8003, 221},
-        {0x8006, 221},
-        {0x800a, 221},
-        {0x800f, 221},
-        {0x8018, 221},
-        {0x801f, 221},
-        {0x8029, 221},
-        {0xc038, 221},
-    },
-    /* 213 */
-    {
-        {0x8002, 222},
-        {0x8009, 222},
-        {0x8017, 222},
-        {0xc028, 222},
-        {0x8002, 223},
-        {0x8009, 223},
-        {0x8017, 223},
-        {0xc028, 223},
-        {0x8002, 241},
-        {0x8009, 241},
-        {0x8017, 241},
-        {0xc028, 241},
-        {0x8002, 244},
-        {0x8009, 244},
-        {0x8017, 244},
-        {0xc028, 244},
-    },
-    /* 214 */
-    {
-        {0x8003, 222},
-        {0x8006, 222},
-        {0x800a, 222},
-        {0x800f, 222},
-        {0x8018, 222},
-        {0x801f, 222},
-        {0x8029, 222},
-        {0xc038, 222},
-        {0x8003, 223},
-        {0x8006, 223},
-        {0x800a, 223},
-        {0x800f, 223},
-        {0x8018, 223},
-        {0x801f, 223},
-        {0x8029, 223},
-        {0xc038, 223},
-    },
-    /* 215 */
-    {
-        {0x8003, 241},
-        {0x8006, 241},
-        {0x800a, 241},
-        {0x800f, 241},
-        {0x8018, 241},
-        {0x801f, 241},
-        {0x8029, 241},
-        {0xc038, 241},
-        {0x8003, 244},
-        {0x8006, 244},
-        {0x800a, 244},
-        {0x800f, 244},
-        {0x8018, 244},
-        {0x801f, 244},
-        {0x8029, 244},
-        {0xc038, 244},
-    },
-    /* 216 */
-    {
-        {0x8001, 245},
-        {0xc016, 245},
-        {0x8001, 246},
-        {0xc016, 246},
-        {0x8001, 247},
-        {0xc016, 247},
-        {0x8001, 248},
-        {0xc016, 248},
-        {0x8001, 250},
-        {0xc016, 250},
-        {0x8001, 251},
-        {0xc016, 251},
-        {0x8001, 252},
-        {0xc016, 252},
-        {0x8001, 253},
-        {0xc016, 253},
-    },
-    /* 217 */
-    {
-        {0x8002, 245},
-        {0x8009, 245},
-        {0x8017, 245},
-        {0xc028, 245},
-        {0x8002, 246},
-        {0x8009, 246},
-        {0x8017, 246},
-        {0xc028, 246},
-        {0x8002, 247},
-        {0x8009, 247},
-        {0x8017, 247},
-        {0xc028, 247},
-        {0x8002, 248},
-        {0x8009, 248},
-        {0x8017, 248},
-        {0xc028, 248},
-    },
-    /* 218 */
-    {
-        {0x8003, 245},
-        {0x8006, 245},
-        {0x800a, 245},
-        {0x800f, 245},
-        {0x8018, 245},
-        {0x801f, 245},
-        {0x8029, 245},
-        {0xc038, 245},
-        {0x8003, 246},
-        {0x8006, 246},
-        {0x800a, 246},
-        {0x800f, 246},
-        {0x8018, 246},
-        {0x801f, 246},
-        {0x8029, 246},
-        {0xc038, 246},
-    },
-    /* 219 */
-    {
-        {0x8003, 247},
-        {0x8006, 247},
-        {0x800a, 247},
-        {0x800f, 247},
-        {0x8018, 247},
-        {0x801f, 247},
-        {0x8029, 247},
-        {0xc038, 247},
-        {0x8003, 248},
-        {0x8006, 248},
-        {0x800a, 248},
-        {0x800f, 248},
-        {0x8018, 248},
-        {0x801f, 248},
-        {0x8029, 248},
-        {0xc038, 248},
-    },
-    /* 220 */
-    {
-        {0x8002, 250},
-        {0x8009, 250},
-        {0x8017, 250},
-        {0xc028, 250},
-        {0x8002, 251},
-        {0x8009, 251},
-        {0x8017, 251},
-        {0xc028, 251},
-        {0x8002, 252},
-        {0x8009, 252},
-        {0x8017, 252},
-        {0xc028, 252},
-        {0x8002, 253},
-        {0x8009, 253},
-        {0x8017, 253},
-        {0xc028, 253},
-    },
-    /* 221 */
-    {
-        {0x8003, 250},
-        {0x8006, 250},
-        {0x800a, 250},
-        {0x800f, 250},
-        {0x8018, 250},
-        {0x801f, 250},
-        {0x8029, 250},
-        {0xc038, 250},
-        {0x8003, 251},
-        {0x8006, 251},
-        {0x800a, 251},
-        {0x800f, 251},
-        {0x8018, 251},
-        {0x801f, 251},
-        {0x8029, 251},
-        {0xc038, 251},
-    },
-    /* 222 */
-    {
-        {0x8003, 252},
-        {0x8006, 252},
-        {0x800a, 252},
-        {0x800f, 252},
-        {0x8018, 252},
-        {0x801f, 252},
-        {0x8029, 252},
-        {0xc038, 252},
-        {0x8003, 253},
-        {0x8006, 253},
-        {0x800a, 253},
-        {0x800f, 253},
-        {0x8018, 253},
-        {0x801f, 253},
-        {0x8029, 253},
-        {0xc038, 253},
-    },
-    /* 223 */
-    {
-        {0xc000, 254},
-        {0xe3, 0},
-        {0xe5, 0},
-        {0xe6, 0},
-        {0xe9, 0},
-        {0xea, 0},
-        {0xec, 0},
-        {0xed, 0},
-        {0xf1, 0},
-        {0xf2, 0},
-        {0xf4, 0},
-        {0xf5, 0},
-        {0xf8, 0},
-        {0xf9, 0},
-        {0xfb, 0},
-        {0xfc, 0},
-    },
-    /* 224 */
-    {
-        {0x8001, 254},
-        {0xc016, 254},
-        {0xc000, 2},
-        {0xc000, 3},
-        {0xc000, 4},
-        {0xc000, 5},
-        {0xc000, 6},
-        {0xc000, 7},
-        {0xc000, 8},
-        {0xc000, 11},
-        {0xc000, 12},
-        {0xc000, 14},
-        {0xc000, 15},
-        {0xc000, 16},
-        {0xc000, 17},
-        {0xc000, 18},
-    },
-    /* 225 */
-    {
-        {0x8002, 254},
-        {0x8009, 254},
-        {0x8017, 254},
-        {0xc028, 254},
-        {0x8001, 2},
-        {0xc016, 2},
-        {0x8001, 3},
-        {0xc016, 3},
-        {0x8001, 4},
-        {0xc016, 4},
-        {0x8001, 5},
-        {0xc016, 5},
-        {0x8001, 6},
-        {0xc016, 6},
-        {0x8001, 7},
-        {0xc016, 7},
-    },
-    /* 226 */
-    {
-        {0x8003, 254},
-        {0x8006, 254},
-        {0x800a, 254},
-        {0x800f, 254},
-        {0x8018, 254},
-        {0x801f, 254},
-        {0x8029, 254},
-        {0xc038, 254},
-        {0x8002, 2},
-        {0x8009, 2},
-        {0x8017, 2},
-        {0xc028, 2},
-        {0x8002, 3},
-        {0x8009, 3},
-        {0x8017, 3},
-        {0xc028, 3},
-    },
-    /* 227 */
-    {
-        {0x8003, 2},
-        {0x8006, 2},
-        {0x800a, 2},
-        {0x800f, 2},
-        {0x8018, 2},
-        {0x801f, 2},
-        {0x8029, 2},
-        {0xc038, 2},
-        {0x8003, 3},
-        {0x8006, 3},
-        {0x800a, 3},
-        {0x800f, 3},
-        {0x8018, 3},
-        {0x801f, 3},
-        {0x8029, 3},
-        {0xc038, 3},
-    },
-    /* 228 */
-    {
-        {0x8002, 4},
-        {0x8009, 4},
-        {0x8017, 4},
-        {0xc028, 4},
-        {0x8002, 5},
-        {0x8009, 5},
-        {0x8017, 5},
-        {0xc028, 5},
-        {0x8002, 6},
-        {0x8009, 6},
-        {0x8017, 6},
-        {0xc028, 6},
-        {0x8002, 7},
-        {0x8009, 7},
-        {0x8017, 7},
-        {0xc028, 7},
-    },
-    /* 229 */
-    {
-        {0x8003, 4},
-        {0x8006, 4},
-        {0x800a, 4},
-        {0x800f, 4},
-        {0x8018, 4},
-        {0x801f, 4},
-        {0x8029, 4},
-        {0xc038, 4},
-        {0x8003, 5},
-        {0x8006, 5},
-        {0x800a, 5},
-        {0x800f, 5},
-        {0x8018, 5},
-        {0x801f, 5},
-        {0x8029, 5},
-        {0xc038, 5},
-    },
-    /* 230 */
-    {
-        {0x8003, 6},
-        {0x8006, 6},
-        {0x800a, 6},
-        {0x800f, 6},
-        {0x8018, 6},
-        {0x801f, 6},
-        {0x8029, 6},
-        {0xc038, 6},
-        {0x8003, 7},
-        {0x8006, 7},
-        {0x800a, 7},
-        {0x800f, 7},
-        {0x8018, 7},
-        {0x801f, 7},
-        {0x8029, 7},
-        {0xc038, 7},
-    },
-    /* 231 */
-    {
-        {0x8001, 8},
-        {0xc016, 8},
-        {0x8001, 11},
-        {0xc016, 11},
-        {0x8001, 12},
-        {0xc016, 12},
-        {0x8001, 14},
-        {0xc016, 14},
-        {0x8001, 15},
-        {0xc016, 15},
-        {0x8001, 16},
-        {0xc016, 16},
-        {0x8001, 17},
-        {0xc016, 17},
-        {0x8001, 18},
-        {0xc016, 18},
-    },
-    /* 232 */
-    {
-        {0x8002, 8},
-        {0x8009, 8},
-        {0x8017, 8},
-        {0xc028, 8},
-        {0x8002, 11},
-        {0x8009, 11},
-        {0x8017, 11},
-        {0xc028, 11},
-        {0x8002, 12},
-        {0x8009, 12},
-        {0x8017, 12},
-        {0xc028, 12},
-        {0x8002, 14},
-        {0x8009, 14},
-        {0x8017, 14},
-        {0xc028, 14},
-    },
-    /* 233 */
-    {
-        {0x8003, 8},
-        {0x8006, 8},
-        {0x800a, 8},
-        {0x800f, 8},
-        {0x8018, 8},
-        {0x801f, 8},
-        {0x8029, 8},
-        {0xc038, 8},
-        {0x8003, 11},
-        {0x8006, 11},
-        {0x800a, 11},
-        {0x800f, 11},
-        {0x8018, 11},
-        {0x801f, 11},
-        {0x8029, 11},
-        {0xc038, 11},
-    },
-    /* 234 */
-    {
-        {0x8003, 12},
-        {0x8006, 12},
-        {0x800a, 12},
-        {0x800f, 12},
-        {0x8018, 12},
-        {0x801f, 12},
-        {0x8029, 12},
-        {0xc038, 12},
-        {0x8003, 14},
-        {0x8006, 14},
-        {0x800a, 14},
-        {0x800f, 14},
-        {0x8018, 14},
-        {0x801f, 14},
-        {0x8029, 14},
-        {0xc038, 14},
-    },
-    /* 235 */
-    {
-        {0x8002, 15},
-        {0x8009, 15},
-        {0x8017, 15},
-        {0xc028, 15},
-        {0x8002, 16},
-        {0x8009, 16},
-        {0x8017, 16},
-        {0xc028, 16},
-        {0x8002, 17},
-        {0x8009, 17},
-        {0x8017, 17},
-        {0xc028, 17},
-        {0x8002, 18},
-        {0x8009, 18},
-        {0x8017, 18},
-        {0xc028, 18},
-    },
-    /* 236 */
-    {
-        {0x8003, 15},
-        {0x8006, 15},
-        {0x800a, 15},
-        {0x800f, 15},
-        {0x8018, 15},
-        {0x801f, 15},
-        {0x8029, 15},
-        {0xc038, 15},
-        {0x8003, 16},
-        {0x8006, 16},
-        {0x800a, 16},
-        {0x800f, 16},
-        {0x8018, 16},
-        {0x801f, 16},
-        {0x8029, 16},
-        {0xc038, 16},
-    },
-    /* 237 */
-    {
-        {0x8003, 17},
-        {0x8006, 17},
-        {0x800a, 17},
-        {0x800f, 17},
-        {0x8018, 17},
-        {0x801f, 17},
-        {0x8029, 17},
-        {0xc038, 17},
-        {0x8003, 18},
-        {0x8006, 18},
-        {0x800a, 18},
-        {0x800f, 18},
-        {0x8018, 18},
-        {0x801f, 18},
-        {0x8029, 18},
-        {0xc038, 18},
-    },
-    /* 238 */
-    {
-        {0xc000, 19},
-        {0xc000, 20},
-        {0xc000, 21},
-        {0xc000, 23},
-        {0xc000, 24},
-        {0xc000, 25},
-        {0xc000, 26},
-        {0xc000, 27},
-        {0xc000, 28},
-        {0xc000, 29},
-        {0xc000, 30},
-        {0xc000, 31},
-        {0xc000, 127},
-        {0xc000, 220},
-        {0xc000, 249},
-        {0xfd, 0},
-    },
-    /* 239 */
-    {
-        {0x8001, 19},
-        {0xc016, 19},
-        {0x8001, 20},
-        {0xc016, 20},
-        {0x8001, 21},
-        {0xc016, 21},
-        {0x8001, 23},
-        {0xc016, 23},
-        {0x8001, 24},
-        {0xc016, 24},
-        {0x8001, 25},
-        {0xc016, 25},
-        {0x8001, 26},
-        {0xc016, 26},
-        {0x8001, 27},
-        {0xc016, 27},
-    },
-    /* 240 */
-    {
-        {0x8002, 19},
-        {0x8009, 19},
-        {0x8017, 19},
-        {0xc028, 19},
-        {0x8002, 20},
-        {0x8009, 20},
-        {0x8017, 20},
-        {0xc028, 20},
-        {0x8002, 21},
-        {0x8009, 21},
-        {0x8017, 21},
-        {0xc028, 21},
-        {0x8002, 23},
-        {0x8009, 23},
-        {0x8017, 23},
-        {0xc028, 23},
-    },
-    /* 241 */
-    {
-        {0x8003, 19},
-        {0x8006, 19},
-        {0x800a, 19},
-        {0x800f, 19},
-        {0x8018, 19},
-        {0x801f, 19},
-        {0x8029, 19},
-        {0xc038, 19},
-        {0x8003, 20},
-        {0x8006, 20},
-        {0x800a, 20},
-        {0x800f, 20},
-        {0x8018, 20},
-        {0x801f, 20},
-        {0x8029, 20},
-        {0xc038, 20},
-    },
-    /* 242 */
-    {
-        {0x8003, 21},
-        {0x8006, 21},
-        {0x800a, 21},
-        {0x800f, 21},
-        {0x8018, 21},
-        {0x801f, 21},
-        {0x8029, 21},
-        {0xc038, 21},
-        {0x8003, 23},
-        {0x8006, 23},
-        {0x800a, 23},
-        {0x800f, 23},
-        {0x8018, 23},
-        {0x801f, 23},
-        {0x8029, 23},
-        {0xc038, 23},
-    },
-    /* 243 */
-    {
-        {0x8002, 24},
-        {0x8009, 24},
-        {0x8017, 24},
-        {0xc028, 24},
-        {0x8002, 25},
-        {0x8009, 25},
-        {0x8017, 25},
-        {0xc028, 25},
-        {0x8002, 26},
-        {0x8009, 26},
-        {0x8017, 26},
-        {0xc028, 26},
-        {0x8002, 27},
-        {0x8009, 27},
-        {0x8017, 27},
-        {0xc028, 27},
-    },
-    /* 244 */
-    {
-        {0x8003, 24},
-        {0x8006, 24},
-        {0x800a, 24},
-        {0x800f, 24},
-        {0x8018, 24},
-        {0x801f, 24},
-        {0x8029, 24},
-        {0xc038, 24},
-        {0x8003, 25},
-        {0x8006, 25},
-        {0x800a, 25},
-        {0x800f, 25},
-        {0x8018, 25},
-        {0x801f, 25},
-        {0x8029, 25},
-        {0xc038, 25},
-    },
-    /* 245 */
-    {
-        {0x8003, 26},
-        {0x8006, 26},
-        {0x800a, 26},
-        {0x800f, 26},
-        {0x8018, 26},
-        {0x801f, 26},
-        {0x8029, 26},
-        {0xc038, 26},
-        {0x8003, 27},
-        {0x8006, 27},
-        {0x800a, 27},
-        {0x800f, 27},
-        {0x8018, 27},
-        {0x801f, 27},
-        {0x8029, 27},
-        {0xc038, 27},
-    },
-    /* 246 */
-    {
-        {0x8001, 28},
-        {0xc016, 28},
-        {0x8001, 29},
-        {0xc016, 29},
-        {0x8001, 30},
-        {0xc016, 30},
-        {0x8001, 31},
-        {0xc016, 31},
-        {0x8001, 127},
-        {0xc016, 127},
-        {0x8001, 220},
-        {0xc016, 220},
-        {0x8001, 249},
-        {0xc016, 249},
-        {0xfe, 0},
-        {0xff, 0},
-    },
-    /* 247 */
-    {
-        {0x8002, 28},
-        {0x8009, 28},
-        {0x8017, 28},
-        {0xc028, 28},
-        {0x8002, 29},
-        {0x8009, 29},
-        {0x8017, 29},
-        {0xc028, 29},
-        {0x8002, 30},
-        {0x8009, 30},
-        {0x8017, 30},
-        {0xc028, 30},
-        {0x8002, 31},
-        {0x8009, 31},
-        {0x8017, 31},
-        {0xc028, 31},
-    },
-    /* 248 */
-    {
-        {0x8003, 28},
-        {0x8006, 28},
-        {0x800a, 28},
-        {0x800f, 28},
-        {0x8018, 28},
-        {0x801f, 28},
-        {0x8029, 28},
-        {0xc038, 28},
-        {0x8003, 29},
-        {0x8006, 29},
-        {0x800a, 29},
-        {0x800f, 29},
-        {0x8018, 29},
-        {0x801f, 29},
-        {0x8029, 29},
-        {0xc038, 29},
-    },
-    /* 249 */
-    {
-        {0x8003, 30},
-        {0x8006, 30},
-        {0x800a, 30},
-        {0x800f, 30},
-        {0x8018, 30},
-        {0x801f, 30},
-        {0x8029, 30},
-        {0xc038, 30},
-        {0x8003, 31},
-        {0x8006, 31},
-        {0x800a, 31},
-        {0x800f, 31},
-        {0x8018, 31},
-        {0x801f, 31},
-        {0x8029, 31},
-        {0xc038, 31},
-    },
-    /* 250 */
-    {
-        {0x8002, 127},
-        {0x8009, 127},
-        {0x8017, 127},
-        {0xc028, 127},
-        {0x8002, 220},
-        {0x8009, 220},
-        {0x8017, 220},
-        {0xc028, 220},
-        {0x8002, 249},
-        {0x8009, 249},
-        {0x8017, 249},
-        {0xc028, 249},
-        {0xc000, 10},
-        {0xc000, 13},
-        {0xc000, 22},
-        {0x100, 0},
-    },
-    /* 251 */
-    {
-        {0x8003, 127},
-        {0x8006, 127},
-        {0x800a, 127},
-        {0x800f, 127},
-        {0x8018, 127},
-        {0x801f, 127},
-        {0x8029, 127},
-        {0xc038, 127},
-        {0x8003, 220},
-        {0x8006, 220},
-        {0x800a, 220},
-        {0x800f, 220},
-        {0x8018, 220},
-        {0x801f, 220},
-        {0x8029, 220},
-        {0xc038, 220},
-    },
-    /* 252 */
-    {
-        {0x8003, 249},
-        {0x8006, 249},
-        {0x800a, 249},
-        {0x800f, 249},
-        {0x8018, 249},
-        {0x801f, 249},
-        {0x8029, 249},
-        {0xc038, 249},
-        {0x8001, 10},
-        {0xc016, 10},
-        {0x8001, 13},
-        {0xc016, 13},
-        {0x8001, 22},
-        {0xc016, 22},
-        {0x100, 0},
-        {0x100, 0},
-    },
-    /* 253 */
-    {
-        {0x8002, 10},
-        {0x8009, 10},
-        {0x8017, 10},
-        {0xc028, 10},
-        {0x8002, 13},
-        {0x8009, 13},
-        {0x8017, 13},
-        {0xc028, 13},
-        {0x8002, 22},
-        {0x8009, 22},
-        {0x8017, 22},
-        {0xc028, 22},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-    },
-    /* 254 */
-    {
-        {0x8003, 10},
-        {0x8006, 10},
-        {0x800a, 10},
-        {0x800f, 10},
-        {0x8018, 10},
-        {0x801f, 10},
-        {0x8029, 10},
-        {0xc038, 10},
-        {0x8003, 13},
-        {0x8006, 13},
-        {0x800a, 13},
-        {0x800f, 13},
-        {0x8018, 13},
-        {0x801f, 13},
-        {0x8029, 13},
-        {0xc038, 13},
-    },
-    /* 255 */
-    {
-        {0x8003, 22},
-        {0x8006, 22},
-        {0x800a, 22},
-        {0x800f, 22},
-        {0x8018, 22},
-        {0x801f, 22},
-        {0x8029, 22},
-        {0xc038, 22},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-    },
-    /* 256 */
-    {
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-        {0x100, 0},
-    },
+const uint16_t qpack_huffman_decode_syms[] = {
+    48, 49, 50, 97, 99, 101, 105, 111, 115, 116, 32, 37, 45, 46, 47, 51, 52, 53,
+    54, 55, 56, 57, 61, 65, 95, 98, 100, 102, 103, 104, 108, 109, 110, 112, 114,
+    117, 58, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 89, 106, 107, 113, 118, 119, 120, 121, 122, 38, 42, 44,
+    59, 88, 90, 33, 34, 40, 41, 63, 39, 43, 124, 35, 62, 0, 36, 64, 91, 93, 126,
+    94, 125, 60, 96, 123, 92, 195, 208, 128, 130, 131, 162, 184, 194, 224, 226,
+    153, 161, 167, 172, 176, 177, 179, 209, 216, 217, 227, 229, 230, 129, 132,
+    133, 134, 136, 146, 154, 156, 160, 163, 164, 169, 170, 173, 178, 181, 185,
+    186, 187, 189, 190, 196, 198, 228, 232, 233, 1, 135, 137, 138, 139, 140,
+    141, 143, 147, 149, 150, 151, 152, 155, 157, 158, 165, 166, 168, 174, 175,
+    180, 182, 183, 188, 191, 197, 231, 239, 9, 142, 144, 145, 148, 159, 171,
+    206, 215, 225, 236, 237, 199, 207, 234, 235, 192, 193, 200, 201, 202, 205,
+    210, 213, 218, 219, 238, 240, 242, 243, 255, 203, 204, 211, 212, 214, 221,
+    222, 223, 241, 244, 245, 246, 247, 248, 250, 251, 252, 253, 254, 2, 3, 4, 5,
+    6, 7, 8, 11, 12, 14, 15, 16, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 127, 220, 249, 10, 13, 22, 256
 };
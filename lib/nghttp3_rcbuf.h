@@ -44,6 +44,19 @@ struct nghttp3_rcbuf {
   int32_t ref;
 };
 
+/*
+ * NGHTTP3_RCBUF_REF_STATIC is the reference count of nghttp3_rcbuf
+ * whose buffer outlives any user of it, such as the static table.
+ */
+#define NGHTTP3_RCBUF_REF_STATIC -1
+/*
+ * NGHTTP3_RCBUF_REF_BORROWED is the reference count of nghttp3_rcbuf
+ * which refers to a buffer owned by somebody else for a limited
+ * period of time.  Like static nghttp3_rcbuf, reference counting is
+ * not performed for it.
+ */
+#define NGHTTP3_RCBUF_REF_BORROWED -2
+
 /*
  * Allocates nghttp3_rcbuf object with |size| as initial buffer size.
  * When the function succeeds, the reference count becomes 1.
@@ -78,4 +91,11 @@ int nghttp3_rcbuf_new2(nghttp3_rcbuf **rcbuf_ptr, const uint8_t *src,
  */
 void nghttp3_rcbuf_del(nghttp3_rcbuf *rcbuf);
 
+/*
+ * nghttp3_rcbuf_is_borrowed returns nonzero if |rcbuf| refers to a
+ * buffer which it does not own, and the buffer must be copied if it
+ * is kept beyond the lifetime of that buffer.
+ */
+int nghttp3_rcbuf_is_borrowed(const nghttp3_rcbuf *rcbuf);
+
 #endif /* NGHTTP3_RCBUF_H */
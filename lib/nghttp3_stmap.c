@@ -0,0 +1,260 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2024 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "nghttp3_stmap.h"
+
+#include <string.h>
+
+#include "nghttp3_macro.h"
+
+void nghttp3_stmap_init(nghttp3_stmap *stmap, const nghttp3_mem *mem) {
+  memset(stmap->win, 0, sizeof(stmap->win));
+  nghttp3_map_init(&stmap->outliers, mem);
+  stmap->mem = mem;
+}
+
+void nghttp3_stmap_free(nghttp3_stmap *stmap) {
+  size_t i;
+
+  if (!stmap) {
+    return;
+  }
+
+  for (i = 0; i < nghttp3_arraylen(stmap->win); ++i) {
+    nghttp3_mem_free(stmap->mem, stmap->win[i].slots);
+  }
+
+  nghttp3_map_free(&stmap->outliers);
+}
+
+void nghttp3_stmap_each_free(nghttp3_stmap *stmap,
+                             int (*func)(void *data, void *ptr), void *ptr) {
+  nghttp3_stmap_window *win;
+  size_t i, j;
+
+  for (i = 0; i < nghttp3_arraylen(stmap->win); ++i) {
+    win = &stmap->win[i];
+
+    for (j = 0; j < win->slotslen; ++j) {
+      if (win->slots[j]) {
+        func(win->slots[j], ptr);
+      }
+    }
+  }
+
+  nghttp3_map_each_free(&stmap->outliers, func, ptr);
+}
+
+void nghttp3_stmap_clear(nghttp3_stmap *stmap) {
+  nghttp3_stmap_window *win;
+  size_t i;
+
+  for (i = 0; i < nghttp3_arraylen(stmap->win); ++i) {
+    win = &stmap->win[i];
+
+    if (win->slotslen) {
+      memset(win->slots, 0, sizeof(void *) * win->slotslen);
+    }
+
+    win->base = 0;
+    win->len = 0;
+  }
+
+  nghttp3_map_clear(&stmap->outliers);
+}
+
+static nghttp3_stmap_window *stmap_get_window(nghttp3_stmap *stmap,
+                                              int64_t stream_id) {
+  return &stmap->win[stream_id & 0x3];
+}
+
+static int stmap_window_contains(const nghttp3_stmap_window *win,
+                                 uint64_t idx) {
+  /* If idx < win->base, the subtraction wraps around, and the result
+     is not less than win->slotslen. */
+  return idx - win->base < win->slotslen;
+}
+
+static void **stmap_window_get_slot(nghttp3_stmap_window *win, uint64_t idx) {
+  return &win->slots[idx & (win->slotslen - 1)];
+}
+
+/*
+ * stmap_window_fit makes |win| contain |idx|.  It first slides |win|
+ * over the empty slots at its beginning, and then grows |win| if
+ * necessary.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_INVALID_ARGUMENT
+ *     |idx| precedes |win|, or |win| would grow too large.
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory
+ */
+static int stmap_window_fit(nghttp3_stmap_window *win, uint64_t idx,
+                            const nghttp3_mem *mem) {
+  void **slots;
+  size_t slotslen;
+  uint64_t i;
+
+  if (win->slotslen == 0) {
+    slots = nghttp3_mem_calloc(mem, NGHTTP3_STMAP_INITIAL_SLOTSLEN,
+                               sizeof(void *));
+    if (slots == NULL) {
+      return NGHTTP3_ERR_NOMEM;
+    }
+
+    win->slots = slots;
+    win->slotslen = NGHTTP3_STMAP_INITIAL_SLOTSLEN;
+    win->base = idx < NGHTTP3_STMAP_INITIAL_SLOTSLEN ? 0 : idx;
+
+    return 0;
+  }
+
+  if (stmap_window_contains(win, idx)) {
+    return 0;
+  }
+
+  if (idx < win->base) {
+    return NGHTTP3_ERR_INVALID_ARGUMENT;
+  }
+
+  if (win->len == 0) {
+    win->base = idx;
+
+    return 0;
+  }
+
+  while (!stmap_window_contains(win, idx) &&
+         *stmap_window_get_slot(win, win->base) == NULL) {
+    ++win->base;
+  }
+
+  if (stmap_window_contains(win, idx)) {
+    return 0;
+  }
+
+  slotslen = win->slotslen;
+
+  do {
+    slotslen *= 2;
+  } while (slotslen <= NGHTTP3_STMAP_MAX_SLOTSLEN &&
+           idx - win->base >= slotslen);
+
+  if (slotslen > NGHTTP3_STMAP_MAX_SLOTSLEN) {
+    return NGHTTP3_ERR_INVALID_ARGUMENT;
+  }
+
+  slots = nghttp3_mem_calloc(mem, slotslen, sizeof(void *));
+  if (slots == NULL) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  for (i = win->base; i < win->base + win->slotslen; ++i) {
+    slots[i & (slotslen - 1)] = *stmap_window_get_slot(win, i);
+  }
+
+  nghttp3_mem_free(mem, win->slots);
+
+  win->slots = slots;
+  win->slotslen = slotslen;
+
+  return 0;
+}
+
+int nghttp3_stmap_insert(nghttp3_stmap *stmap, int64_t stream_id,
+                         void *data) {
+  nghttp3_stmap_window *win = stmap_get_window(stmap, stream_id);
+  uint64_t idx = (uint64_t)stream_id >> 2;
+  void **slot;
+  int rv;
+
+  rv = stmap_window_fit(win, idx, stmap->mem);
+  if (rv != 0) {
+    if (rv != NGHTTP3_ERR_INVALID_ARGUMENT) {
+      return rv;
+    }
+
+    return nghttp3_map_insert(&stmap->outliers,
+                              (nghttp3_map_key_type)stream_id, data);
+  }
+
+  slot = stmap_window_get_slot(win, idx);
+
+  /* A stream which was stored in outliers might have entered the
+     window. */
+  if (*slot || nghttp3_map_find(&stmap->outliers,
+                                (nghttp3_map_key_type)stream_id)) {
+    return NGHTTP3_ERR_INVALID_ARGUMENT;
+  }
+
+  *slot = data;
+  ++win->len;
+
+  return 0;
+}
+
+void *nghttp3_stmap_find(nghttp3_stmap *stmap, int64_t stream_id) {
+  nghttp3_stmap_window *win = stmap_get_window(stmap, stream_id);
+  uint64_t idx = (uint64_t)stream_id >> 2;
+  void *data;
+
+  if (stmap_window_contains(win, idx)) {
+    data = *stmap_window_get_slot(win, idx);
+    if (data || nghttp3_map_size(&stmap->outliers) == 0) {
+      return data;
+    }
+  }
+
+  return nghttp3_map_find(&stmap->outliers, (nghttp3_map_key_type)stream_id);
+}
+
+int nghttp3_stmap_remove(nghttp3_stmap *stmap, int64_t stream_id) {
+  nghttp3_stmap_window *win = stmap_get_window(stmap, stream_id);
+  uint64_t idx = (uint64_t)stream_id >> 2;
+  void **slot;
+
+  if (stmap_window_contains(win, idx)) {
+    slot = stmap_window_get_slot(win, idx);
+    if (*slot) {
+      *slot = NULL;
+      --win->len;
+
+      return 0;
+    }
+  }
+
+  return nghttp3_map_remove(&stmap->outliers, (nghttp3_map_key_type)stream_id);
+}
+
+size_t nghttp3_stmap_size(nghttp3_stmap *stmap) {
+  size_t i, n = nghttp3_map_size(&stmap->outliers);
+
+  for (i = 0; i < nghttp3_arraylen(stmap->win); ++i) {
+    n += stmap->win[i].len;
+  }
+
+  return n;
+}
@@ -0,0 +1,142 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2024 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NGHTTP3_STMAP_H
+#define NGHTTP3_STMAP_H
+
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* HAVE_CONFIG_H */
+
+#include <nghttp3/nghttp3.h>
+
+#include "nghttp3_mem.h"
+#include "nghttp3_map.h"
+
+/* NGHTTP3_STMAP_INITIAL_SLOTSLEN is the initial number of slots of a
+   window. */
+#define NGHTTP3_STMAP_INITIAL_SLOTSLEN 16
+
+/* NGHTTP3_STMAP_MAX_SLOTSLEN is the maximum number of slots of a
+   window.  A stream which does not fit into the window is stored in
+   the fallback map. */
+#define NGHTTP3_STMAP_MAX_SLOTSLEN (1 << 16)
+
+/*
+ * nghttp3_stmap_window is a sliding window of the streams of a single
+ * stream type.  The stream whose stream ID is id is stored at
+ * slots[(id >> 2) & (slotslen - 1)] if base <= (id >> 2) < base +
+ * slotslen.
+ */
+typedef struct nghttp3_stmap_window {
+  void **slots;
+  /* slotslen is the number of slots.  It is 0 or a power of 2. */
+  size_t slotslen;
+  /* base is the smallest index (stream ID >> 2) in the window. */
+  uint64_t base;
+  /* len is the number of streams stored in slots. */
+  size_t len;
+} nghttp3_stmap_window;
+
+/*
+ * nghttp3_stmap is a map keyed by stream ID.  Because QUIC stream IDs
+ * of each stream type are opened in increasing order, the most of
+ * streams are stored in the window of their stream type, and found
+ * with a single load.  The other streams are stored in the fallback
+ * map.
+ */
+typedef struct nghttp3_stmap {
+  /* win is indexed by the lowest 2 bits of stream ID, which denote
+     the stream type. */
+  nghttp3_stmap_window win[4];
+  /* outliers contains the streams which do not fit into the
+     windows. */
+  nghttp3_map outliers;
+  const nghttp3_mem *mem;
+} nghttp3_stmap;
+
+/*
+ * nghttp3_stmap_init initializes |stmap|.
+ */
+void nghttp3_stmap_init(nghttp3_stmap *stmap, const nghttp3_mem *mem);
+
+/*
+ * nghttp3_stmap_free frees resources allocated for |stmap|.  The
+ * stored data are not freed by this function.
+ */
+void nghttp3_stmap_free(nghttp3_stmap *stmap);
+
+/*
+ * nghttp3_stmap_each_free calls |func| with each data stored in
+ * |stmap| and |ptr| so that |func| can free the data.  The return
+ * value of |func| is ignored.  nghttp3_stmap_free must be called
+ * after this function to free |stmap| itself.
+ */
+void nghttp3_stmap_each_free(nghttp3_stmap *stmap,
+                             int (*func)(void *data, void *ptr), void *ptr);
+
+/*
+ * nghttp3_stmap_clear removes all data from |stmap| without freeing
+ * the memory which |stmap| has allocated.  The stored data are not
+ * freed by this function.
+ */
+void nghttp3_stmap_clear(nghttp3_stmap *stmap);
+
+/*
+ * nghttp3_stmap_insert stores |data| associated by |stream_id|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_INVALID_ARGUMENT
+ *     The data associated by |stream_id| already exists.
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory
+ */
+int nghttp3_stmap_insert(nghttp3_stmap *stmap, int64_t stream_id, void *data);
+
+/*
+ * nghttp3_stmap_find returns the data associated by |stream_id|.  If
+ * there is no such data, this function returns NULL.
+ */
+void *nghttp3_stmap_find(nghttp3_stmap *stmap, int64_t stream_id);
+
+/*
+ * nghttp3_stmap_remove removes the data associated by |stream_id|.
+ * The removed data is not freed by this function.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_INVALID_ARGUMENT
+ *     The data associated by |stream_id| does not exist.
+ */
+int nghttp3_stmap_remove(nghttp3_stmap *stmap, int64_t stream_id);
+
+/*
+ * nghttp3_stmap_size returns the number of data stored in |stmap|.
+ */
+size_t nghttp3_stmap_size(nghttp3_stmap *stmap);
+
+#endif /* NGHTTP3_STMAP_H */
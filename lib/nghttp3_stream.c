@@ -27,6 +27,10 @@
 #include <string.h>
 #include <assert.h>
 #include <stdio.h>
+#include <errno.h>
+#ifdef HAVE_UNISTD_H
+#  include <unistd.h>
+#endif /* HAVE_UNISTD_H */
 
 #include "nghttp3_conv.h"
 #include "nghttp3_macro.h"
@@ -35,6 +39,7 @@
 #include "nghttp3_str.h"
 #include "nghttp3_http.h"
 #include "nghttp3_vec.h"
+#include "nghttp3_encoded_field_section.h"
 #include "nghttp3_unreachable.h"
 
 /* NGHTTP3_STREAM_MAX_COPY_THRES is the maximum size of buffer which
@@ -44,11 +49,22 @@
 /* NGHTTP3_MIN_RBLEN is the minimum length of nghttp3_ringbuf */
 #define NGHTTP3_MIN_RBLEN 4
 
+/* NGHTTP3_STREAM_FIELDS_BLKLEN is the size of memory block which
+   stores the copies of string literals in nghttp3_field_section. */
+#define NGHTTP3_STREAM_FIELDS_BLKLEN 4096
+
+#ifdef HAVE_PREAD
+/* NGHTTP3_STREAM_FILE_SEGMENT_SIZE is the maximum number of bytes
+   which are read from a file at once. */
+#  define NGHTTP3_STREAM_FILE_SEGMENT_SIZE 65536
+#endif /* HAVE_PREAD */
+
 nghttp3_objalloc_def(stream, nghttp3_stream, oplent);
 
 int nghttp3_stream_new(nghttp3_stream **pstream, int64_t stream_id,
                        const nghttp3_stream_callbacks *callbacks,
                        nghttp3_objalloc *out_chunk_objalloc,
+                       nghttp3_objalloc *in_chunk_objalloc,
                        nghttp3_objalloc *stream_objalloc,
                        const nghttp3_mem *mem) {
   nghttp3_stream *stream = nghttp3_objalloc_stream_get(stream_objalloc);
@@ -60,6 +76,7 @@ int nghttp3_stream_new(nghttp3_stream **pstream, int64_t stream_id,
   memset(stream, 0, sizeof(*stream));
 
   stream->out_chunk_objalloc = out_chunk_objalloc;
+  stream->in_chunk_objalloc = in_chunk_objalloc;
   stream->stream_objalloc = stream_objalloc;
 
   nghttp3_tnode_init(&stream->node, stream_id);
@@ -67,9 +84,13 @@ int nghttp3_stream_new(nghttp3_stream **pstream, int64_t stream_id,
   nghttp3_ringbuf_init(&stream->frq, 0, sizeof(nghttp3_frame_entry), mem);
   nghttp3_ringbuf_init(&stream->chunks, 0, sizeof(nghttp3_buf), mem);
   nghttp3_ringbuf_init(&stream->outq, 0, sizeof(nghttp3_typed_buf), mem);
-  nghttp3_ringbuf_init(&stream->inq, 0, sizeof(nghttp3_buf), mem);
+  nghttp3_ringbuf_init(&stream->outq_refs, 0, sizeof(nghttp3_stream_outq_ref),
+                       mem);
+  nghttp3_ringbuf_init(&stream->inq, 0, sizeof(nghttp3_stream_inq_buf), mem);
 
   nghttp3_qpack_stream_context_init(&stream->qpack_sctx, stream_id, mem);
+  nghttp3_balloc_init(&stream->rx.fields.balloc, NGHTTP3_STREAM_FIELDS_BLKLEN,
+                      mem);
 
   stream->qpack_blocked_pe.index = NGHTTP3_PQ_BAD_INDEX;
   stream->mem = mem;
@@ -102,16 +123,57 @@ static void delete_outq(nghttp3_ringbuf *outq, const nghttp3_mem *mem) {
   nghttp3_ringbuf_free(outq);
 }
 
-static void delete_chunks(nghttp3_ringbuf *chunks, const nghttp3_mem *mem) {
-  nghttp3_buf *buf;
-  size_t i, len = nghttp3_ringbuf_len(chunks);
+static void stream_release_vec(nghttp3_stream *stream,
+                               nghttp3_release_vec release, void *user_data) {
+  nghttp3_conn *conn = stream->conn;
+
+  if (release) {
+    release(conn, stream->node.id, user_data, conn->user_data,
+            stream->user_data);
+  }
+}
+
+static void delete_outq_refs(nghttp3_stream *stream) {
+  nghttp3_ringbuf *outq_refs = &stream->outq_refs;
+  nghttp3_stream_outq_ref *ref;
+  size_t i, len = nghttp3_ringbuf_len(outq_refs);
 
   for (i = 0; i < len; ++i) {
-    buf = nghttp3_ringbuf_get(chunks, i);
-    nghttp3_buf_free(buf, mem);
+    ref = nghttp3_ringbuf_get(outq_refs, i);
+    stream_release_vec(stream, ref->release, ref->user_data);
   }
 
-  nghttp3_ringbuf_free(chunks);
+  nghttp3_ringbuf_free(outq_refs);
+}
+
+static void release_in_chunk(nghttp3_stream *stream,
+                             nghttp3_stream_inq_buf *ibuf) {
+  nghttp3_buf *buf = &ibuf->buf;
+
+  if (ibuf->type == NGHTTP3_BUF_TYPE_ALIEN) {
+    stream->callbacks.release_buf(stream, ibuf->buf_user_data);
+    return;
+  }
+
+  if (nghttp3_buf_cap(buf) == NGHTTP3_STREAM_MIN_CHUNK_SIZE) {
+    nghttp3_objalloc_chunk_release(stream->out_chunk_objalloc,
+                                   (nghttp3_chunk *)(void *)buf->begin);
+    return;
+  }
+
+  nghttp3_objalloc_chunk_release(stream->in_chunk_objalloc,
+                                 (nghttp3_chunk *)(void *)buf->begin);
+}
+
+static void delete_in_chunks(nghttp3_stream *stream) {
+  nghttp3_ringbuf *inq = &stream->inq;
+  size_t i, len = nghttp3_ringbuf_len(inq);
+
+  for (i = 0; i < len; ++i) {
+    release_in_chunk(stream, nghttp3_ringbuf_get(inq, i));
+  }
+
+  nghttp3_ringbuf_free(inq);
 }
 
 static void delete_out_chunks(nghttp3_ringbuf *chunks,
@@ -144,6 +206,9 @@ static void delete_frq(nghttp3_ringbuf *frq, const nghttp3_mem *mem) {
     switch (frent->fr.hd.type) {
     case NGHTTP3_FRAME_HEADERS:
       nghttp3_frame_headers_free(&frent->fr.headers, mem);
+      if (frent->aux.headers.efs) {
+        nghttp3_encoded_field_section_decref(frent->aux.headers.efs);
+      }
       break;
     case NGHTTP3_FRAME_PRIORITY_UPDATE:
       nghttp3_frame_priority_update_free(&frent->fr.priority_update, mem);
@@ -161,9 +226,17 @@ void nghttp3_stream_del(nghttp3_stream *stream) {
     return;
   }
 
+  nghttp3_stream_clear_fields(stream);
+  nghttp3_mem_free(stream->mem, stream->rx.fields.nva);
+  nghttp3_balloc_free(&stream->rx.fields.balloc);
+  nghttp3_rcbuf_decref(stream->rx.req.method);
+  nghttp3_rcbuf_decref(stream->rx.req.path);
+  nghttp3_rcbuf_decref(stream->rx.req.authority);
+  nghttp3_rcbuf_decref(stream->rx.req.scheme);
   nghttp3_qpack_stream_context_free(&stream->qpack_sctx);
-  delete_chunks(&stream->inq, stream->mem);
+  delete_in_chunks(stream);
   delete_outq(&stream->outq, stream->mem);
+  delete_outq_refs(stream);
   delete_out_chunks(&stream->chunks, stream->out_chunk_objalloc, stream->mem);
   delete_frq(&stream->frq, stream->mem);
   nghttp3_tnode_free(&stream->node);
@@ -436,6 +509,9 @@ int nghttp3_stream_write_priority_update(nghttp3_stream *stream,
   return nghttp3_stream_outq_add(stream, &tbuf);
 }
 
+static int stream_write_encoded_headers(nghttp3_stream *stream,
+                                        nghttp3_frame_entry *frent);
+
 int nghttp3_stream_write_headers(nghttp3_stream *stream,
                                  nghttp3_frame_entry *frent) {
   nghttp3_frame_headers *fr = &frent->fr.headers;
@@ -443,6 +519,10 @@ int nghttp3_stream_write_headers(nghttp3_stream *stream,
 
   assert(conn);
 
+  if (frent->aux.headers.efs) {
+    return stream_write_encoded_headers(stream, frent);
+  }
+
   return nghttp3_stream_write_header_block(
       stream, &conn->qenc, conn->tx.qenc, &conn->tx.qpack.rbuf,
       &conn->tx.qpack.ebuf, NGHTTP3_FRAME_HEADERS, fr->nva, fr->nvlen);
@@ -563,6 +643,299 @@ fail:
   return rv;
 }
 
+#ifdef HAVE_PREAD
+static void stream_release_file_segment(nghttp3_conn *conn, int64_t stream_id,
+                                        void *vec_user_data,
+                                        void *conn_user_data,
+                                        void *stream_user_data) {
+  (void)stream_id;
+  (void)conn_user_data;
+  (void)stream_user_data;
+
+  nghttp3_mem_free(conn->mem, vec_user_data);
+}
+
+/*
+ * stream_read_file reads the next segment of the file range in
+ * |frent|, and stores it in |rvec|.  The segment is freed by its
+ * release callback.
+ *
+ * This function returns the number of objects filled, or one of the
+ * following negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ * NGHTTP3_ERR_CALLBACK_FAILURE
+ *     pread(2) failed, or the file ended prematurely.
+ */
+static nghttp3_ssize stream_read_file(nghttp3_stream *stream,
+                                      nghttp3_frame_entry *frent,
+                                      nghttp3_ref_vec *rvec,
+                                      uint32_t *pflags) {
+  const nghttp3_mem *mem = stream->mem;
+  size_t len = (size_t)nghttp3_min(frent->aux.data.file.left,
+                                   NGHTTP3_STREAM_FILE_SEGMENT_SIZE);
+  uint8_t *seg;
+  size_t nread = 0;
+  ssize_t n;
+
+  if (len == 0) {
+    *pflags |= NGHTTP3_DATA_FLAG_EOF;
+    return 0;
+  }
+
+  seg = nghttp3_mem_malloc(mem, len);
+  if (seg == NULL) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  for (; nread < len;) {
+    n = pread(frent->aux.data.file.fd, seg + nread, len - nread,
+              (off_t)frent->aux.data.file.offset + (off_t)nread);
+    if (n <= 0) {
+      if (n == -1 && errno == EINTR) {
+        continue;
+      }
+
+      nghttp3_mem_free(mem, seg);
+
+      return NGHTTP3_ERR_CALLBACK_FAILURE;
+    }
+
+    nread += (size_t)n;
+  }
+
+  frent->aux.data.file.offset += (int64_t)len;
+  frent->aux.data.file.left -= len;
+
+  if (frent->aux.data.file.left == 0) {
+    *pflags |= NGHTTP3_DATA_FLAG_EOF;
+  }
+
+  rvec->base = seg;
+  rvec->len = len;
+  rvec->release = stream_release_file_segment;
+  rvec->user_data = seg;
+
+  return 1;
+}
+#endif /* HAVE_PREAD */
+
+/*
+ * stream_read_data obtains the data of DATA frame |frent|, and stores
+ * it in |rvec| of length |rveccnt|.  The data obtained by read_data
+ * callback has NULL release callback.
+ */
+static nghttp3_ssize stream_read_data(nghttp3_stream *stream,
+                                      nghttp3_frame_entry *frent,
+                                      nghttp3_ref_vec *rvec, size_t rveccnt,
+                                      uint32_t *pflags) {
+  nghttp3_conn *conn = stream->conn;
+  const nghttp3_data_reader *dr = &frent->aux.data.dr;
+  const nghttp3_data_ref_reader *rdr = &frent->aux.data.rdr;
+  nghttp3_vec vec[8];
+  nghttp3_ssize sveccnt;
+  size_t i;
+
+  switch (frent->aux.data.source) {
+  case NGHTTP3_DATA_SOURCE_READ_DATA:
+    break;
+  case NGHTTP3_DATA_SOURCE_READ_DATA_REF:
+    assert(rdr->read_data_ref);
+
+    return rdr->read_data_ref(conn, stream->node.id, rvec, rveccnt, pflags,
+                              conn->user_data, stream->user_data);
+#ifdef HAVE_PREAD
+  case NGHTTP3_DATA_SOURCE_FILE:
+    return stream_read_file(stream, frent, rvec, pflags);
+#endif /* HAVE_PREAD */
+  default:
+    nghttp3_unreachable();
+  }
+
+  assert(dr->read_data);
+
+  sveccnt = dr->read_data(conn, stream->node.id, vec,
+                          nghttp3_min(nghttp3_arraylen(vec), rveccnt), pflags,
+                          conn->user_data, stream->user_data);
+  if (sveccnt < 0) {
+    return sveccnt;
+  }
+
+  for (i = 0; i < (size_t)sveccnt; ++i) {
+    rvec[i].base = vec[i].base;
+    rvec[i].len = vec[i].len;
+    rvec[i].release = NULL;
+    rvec[i].user_data = NULL;
+  }
+
+  return sveccnt;
+}
+
+static int64_t ref_vec_len_varint(const nghttp3_ref_vec *rvec, size_t n) {
+  uint64_t res = 0;
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    if (rvec[i].len > NGHTTP3_MAX_VARINT - res) {
+      return -1;
+    }
+
+    res += rvec[i].len;
+  }
+
+  return (int64_t)res;
+}
+
+/*
+ * stream_outq_add_ref_vec adds the data of |rvec| to outq.  If
+ * |rvec| has a release callback, the callback is recorded in
+ * outq_refs, or it is called immediately if |rvec| is empty.
+ */
+static int stream_outq_add_ref_vec(nghttp3_stream *stream,
+                                   const nghttp3_ref_vec *rvec) {
+  nghttp3_typed_buf tbuf;
+  nghttp3_buf buf;
+  nghttp3_ringbuf *outq_refs = &stream->outq_refs;
+  nghttp3_stream_outq_ref *ref;
+  int rv;
+
+  if (rvec->len == 0) {
+    stream_release_vec(stream, rvec->release, rvec->user_data);
+    return 0;
+  }
+
+  nghttp3_buf_wrap_init(&buf, rvec->base, rvec->len);
+  buf.last = buf.end;
+
+  if (!rvec->release) {
+    nghttp3_typed_buf_init(&tbuf, &buf, NGHTTP3_BUF_TYPE_ALIEN);
+    return nghttp3_stream_outq_add(stream, &tbuf);
+  }
+
+  if (nghttp3_ringbuf_full(outq_refs)) {
+    rv = nghttp3_ringbuf_reserve(
+        outq_refs,
+        nghttp3_max(NGHTTP3_MIN_RBLEN, nghttp3_ringbuf_len(outq_refs) * 2));
+    if (rv != 0) {
+      return rv;
+    }
+  }
+
+  nghttp3_typed_buf_init(&tbuf, &buf, NGHTTP3_BUF_TYPE_ALIEN_REF);
+  rv = nghttp3_stream_outq_add(stream, &tbuf);
+  if (rv != 0) {
+    return rv;
+  }
+
+  ref = nghttp3_ringbuf_push_back(outq_refs);
+  ref->release = rvec->release;
+  ref->user_data = rvec->user_data;
+
+  return 0;
+}
+
+static void stream_release_ref_vecs(nghttp3_stream *stream,
+                                    const nghttp3_ref_vec *rvec, size_t n) {
+  size_t i;
+
+  for (i = 0; i < n; ++i) {
+    stream_release_vec(stream, rvec[i].release, rvec[i].user_data);
+  }
+}
+
+static void stream_release_encoded_field_section(nghttp3_conn *conn,
+                                                 int64_t stream_id,
+                                                 void *vec_user_data,
+                                                 void *conn_user_data,
+                                                 void *stream_user_data) {
+  (void)conn;
+  (void)stream_id;
+  (void)conn_user_data;
+  (void)stream_user_data;
+
+  nghttp3_encoded_field_section_decref(vec_user_data);
+}
+
+/*
+ * stream_write_encoded_headers writes HEADERS frame which carries the
+ * field section that is encoded in advance.  Small field section is
+ * copied into a chunk, and a larger one is referenced until it is
+ * acknowledged.  The reference to the field section held by |frent|
+ * is moved to outq if this function succeeds.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int stream_write_encoded_headers(nghttp3_stream *stream,
+                                        nghttp3_frame_entry *frent) {
+  nghttp3_encoded_field_section *efs = frent->aux.headers.efs;
+  nghttp3_frame_hd hd;
+  nghttp3_buf *chunk;
+  nghttp3_typed_buf tbuf;
+  nghttp3_ref_vec rvec;
+  size_t len;
+  int rv;
+
+  hd.type = NGHTTP3_FRAME_HEADERS;
+  hd.length = (int64_t)efs->len;
+
+  len = nghttp3_frame_write_hd_len(&hd);
+
+  if (efs->len <= NGHTTP3_STREAM_MAX_COPY_THRES) {
+    len += efs->len;
+  }
+
+  rv = nghttp3_stream_ensure_chunk(stream, len);
+  if (rv != 0) {
+    return rv;
+  }
+
+  chunk = nghttp3_stream_get_chunk(stream);
+  typed_buf_shared_init(&tbuf, chunk);
+
+  chunk->last = nghttp3_frame_write_hd(chunk->last, &hd);
+
+  if (efs->len <= NGHTTP3_STREAM_MAX_COPY_THRES) {
+    chunk->last = nghttp3_cpymem(chunk->last, efs->base, efs->len);
+    tbuf.buf.last = chunk->last;
+
+    rv = nghttp3_stream_outq_add(stream, &tbuf);
+    if (rv != 0) {
+      return rv;
+    }
+
+    frent->aux.headers.efs = NULL;
+    nghttp3_encoded_field_section_decref(efs);
+
+    return 0;
+  }
+
+  tbuf.buf.last = chunk->last;
+
+  rv = nghttp3_stream_outq_add(stream, &tbuf);
+  if (rv != 0) {
+    return rv;
+  }
+
+  rvec.base = efs->base;
+  rvec.len = efs->len;
+  rvec.release = stream_release_encoded_field_section;
+  rvec.user_data = efs;
+
+  rv = stream_outq_add_ref_vec(stream, &rvec);
+  if (rv != 0) {
+    return rv;
+  }
+
+  frent->aux.headers.efs = NULL;
+
+  return 0;
+}
+
 int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
                               nghttp3_frame_entry *frent) {
   int rv;
@@ -570,39 +943,49 @@ int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
   nghttp3_typed_buf tbuf;
   nghttp3_buf buf;
   nghttp3_buf *chunk;
-  nghttp3_read_data_callback read_data = frent->aux.data.dr.read_data;
   nghttp3_conn *conn = stream->conn;
   int64_t datalen;
   uint32_t flags = 0;
   nghttp3_frame_hd hd;
-  nghttp3_vec vec[8];
-  nghttp3_vec *v;
+  nghttp3_ref_vec rvec[8];
+  size_t rveccnt;
   nghttp3_ssize sveccnt;
   size_t i;
 
   assert(!(stream->flags & NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED));
-  assert(read_data);
   assert(conn);
 
   *peof = 0;
 
-  sveccnt = read_data(conn, stream->node.id, vec, nghttp3_arraylen(vec), &flags,
-                      conn->user_data, stream->user_data);
+  sveccnt = stream_read_data(stream, frent, rvec, nghttp3_arraylen(rvec),
+                             &flags);
   if (sveccnt < 0) {
-    if (sveccnt == NGHTTP3_ERR_WOULDBLOCK) {
+    switch (sveccnt) {
+    case NGHTTP3_ERR_WOULDBLOCK:
       stream->flags |= NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED;
       return 0;
+    case NGHTTP3_ERR_NOMEM:
+      return NGHTTP3_ERR_NOMEM;
+    default:
+      return NGHTTP3_ERR_CALLBACK_FAILURE;
     }
-    return NGHTTP3_ERR_CALLBACK_FAILURE;
   }
 
-  datalen = nghttp3_vec_len_varint(vec, (size_t)sveccnt);
+  rveccnt = (size_t)sveccnt;
+
+  datalen = ref_vec_len_varint(rvec, rveccnt);
   if (datalen == -1) {
+    stream_release_ref_vecs(stream, rvec, rveccnt);
     return NGHTTP3_ERR_STREAM_DATA_OVERFLOW;
   }
 
   assert(datalen || flags & NGHTTP3_DATA_FLAG_EOF);
 
+  if (datalen == 0) {
+    /* Nothing refers to empty vectors. */
+    stream_release_ref_vecs(stream, rvec, rveccnt);
+  }
+
   if (flags & NGHTTP3_DATA_FLAG_EOF) {
     *peof = 1;
     if (!(flags & NGHTTP3_DATA_FLAG_NO_END_STREAM)) {
@@ -635,6 +1018,7 @@ int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
 
   rv = nghttp3_stream_ensure_chunk(stream, len);
   if (rv != 0) {
+    stream_release_ref_vecs(stream, rvec, rveccnt);
     return rv;
   }
 
@@ -647,22 +1031,15 @@ int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
 
   rv = nghttp3_stream_outq_add(stream, &tbuf);
   if (rv != 0) {
+    stream_release_ref_vecs(stream, rvec, rveccnt);
     return rv;
   }
 
-  if (datalen) {
-    for (i = 0; i < (size_t)sveccnt; ++i) {
-      v = &vec[i];
-      if (v->len == 0) {
-        continue;
-      }
-      nghttp3_buf_wrap_init(&buf, v->base, v->len);
-      buf.last = buf.end;
-      nghttp3_typed_buf_init(&tbuf, &buf, NGHTTP3_BUF_TYPE_ALIEN);
-      rv = nghttp3_stream_outq_add(stream, &tbuf);
-      if (rv != 0) {
-        return rv;
-      }
+  for (i = 0; i < rveccnt; ++i) {
+    rv = stream_outq_add_ref_vec(stream, &rvec[i]);
+    if (rv != 0) {
+      stream_release_ref_vecs(stream, rvec + i, rveccnt - i);
+      return rv;
     }
   }
 
@@ -896,6 +1273,7 @@ static void stream_pop_outq_entry(nghttp3_stream *stream,
                                   nghttp3_typed_buf *tbuf) {
   nghttp3_ringbuf *chunks = &stream->chunks;
   nghttp3_buf *chunk;
+  nghttp3_stream_outq_ref *ref;
 
   switch (tbuf->type) {
   case NGHTTP3_BUF_TYPE_PRIVATE:
@@ -903,6 +1281,13 @@ static void stream_pop_outq_entry(nghttp3_stream *stream,
     break;
   case NGHTTP3_BUF_TYPE_ALIEN:
     break;
+  case NGHTTP3_BUF_TYPE_ALIEN_REF:
+    assert(nghttp3_ringbuf_len(&stream->outq_refs));
+
+    ref = nghttp3_ringbuf_get(&stream->outq_refs, 0);
+    stream_release_vec(stream, ref->release, ref->user_data);
+    nghttp3_ringbuf_pop_front(&stream->outq_refs);
+    break;
   case NGHTTP3_BUF_TYPE_SHARED:
     assert(nghttp3_ringbuf_len(chunks));
 
@@ -983,18 +1368,31 @@ int nghttp3_stream_add_ack_offset(nghttp3_stream *stream, uint64_t n) {
   return 0;
 }
 
+static int stream_inq_reserve(nghttp3_ringbuf *inq) {
+  if (!nghttp3_ringbuf_full(inq)) {
+    return 0;
+  }
+
+  return nghttp3_ringbuf_reserve(
+      inq, nghttp3_max(NGHTTP3_MIN_RBLEN, nghttp3_ringbuf_len(inq) * 2));
+}
+
 int nghttp3_stream_buffer_data(nghttp3_stream *stream, const uint8_t *data,
                                size_t datalen) {
   nghttp3_ringbuf *inq = &stream->inq;
   size_t len = nghttp3_ringbuf_len(inq);
+  nghttp3_stream_inq_buf *ibuf;
   nghttp3_buf *buf;
   size_t nwrite;
   uint8_t *rawbuf;
+  size_t buflen;
   size_t bufleft;
   int rv;
 
   if (len) {
-    buf = nghttp3_ringbuf_get(inq, len - 1);
+    ibuf = nghttp3_ringbuf_get(inq, len - 1);
+    buf = &ibuf->buf;
+    /* A referenced application buffer has no room left. */
     bufleft = nghttp3_buf_left(buf);
     nwrite = nghttp3_min(datalen, bufleft);
     buf->last = nghttp3_cpymem(buf->last, data, nwrite);
@@ -1003,22 +1401,31 @@ int nghttp3_stream_buffer_data(nghttp3_stream *stream, const uint8_t *data,
   }
 
   for (; datalen;) {
-    if (nghttp3_ringbuf_full(inq)) {
-      size_t nlen =
-          nghttp3_max(NGHTTP3_MIN_RBLEN, nghttp3_ringbuf_len(inq) * 2);
-      rv = nghttp3_ringbuf_reserve(inq, nlen);
-      if (rv != 0) {
-        return rv;
-      }
+    rv = stream_inq_reserve(inq);
+    if (rv != 0) {
+      return rv;
     }
 
-    rawbuf = nghttp3_mem_malloc(stream->mem, 16384);
+    /* Pack a short tail into a small chunk so that many streams
+       which are blocked with a few bytes do not pin large chunks. */
+    if (datalen <= NGHTTP3_STREAM_MIN_CHUNK_SIZE) {
+      buflen = NGHTTP3_STREAM_MIN_CHUNK_SIZE;
+      rawbuf = (uint8_t *)nghttp3_objalloc_chunk_len_get(
+          stream->out_chunk_objalloc, buflen);
+    } else {
+      buflen = NGHTTP3_STREAM_INQ_CHUNK_SIZE;
+      rawbuf = (uint8_t *)nghttp3_objalloc_chunk_len_get(
+          stream->in_chunk_objalloc, buflen);
+    }
     if (rawbuf == NULL) {
       return NGHTTP3_ERR_NOMEM;
     }
 
-    buf = nghttp3_ringbuf_push_back(inq);
-    nghttp3_buf_wrap_init(buf, rawbuf, 16384);
+    ibuf = nghttp3_ringbuf_push_back(inq);
+    ibuf->type = NGHTTP3_BUF_TYPE_PRIVATE;
+    ibuf->buf_user_data = NULL;
+    buf = &ibuf->buf;
+    nghttp3_buf_wrap_init(buf, rawbuf, buflen);
     bufleft = nghttp3_buf_left(buf);
     nwrite = nghttp3_min(datalen, bufleft);
     buf->last = nghttp3_cpymem(buf->last, data, nwrite);
@@ -1029,15 +1436,198 @@ int nghttp3_stream_buffer_data(nghttp3_stream *stream, const uint8_t *data,
   return 0;
 }
 
+int nghttp3_stream_buffer_data_ref(nghttp3_stream *stream, const uint8_t *src,
+                                   size_t srclen, void *buf_user_data) {
+  nghttp3_ringbuf *inq = &stream->inq;
+  nghttp3_stream_inq_buf *ibuf;
+  int rv;
+
+  assert(srclen);
+
+  rv = stream_inq_reserve(inq);
+  if (rv != 0) {
+    return rv;
+  }
+
+  ibuf = nghttp3_ringbuf_push_back(inq);
+  ibuf->type = NGHTTP3_BUF_TYPE_ALIEN;
+  ibuf->buf_user_data = buf_user_data;
+  nghttp3_buf_wrap_init(&ibuf->buf, (uint8_t *)src, srclen);
+  ibuf->buf.last = ibuf->buf.end;
+
+  return 0;
+}
+
+/*
+ * stream_fields_copy_literal makes a copy of |*prcbuf| which refers
+ * to the input buffer of QPACK decoder, and assigns it to |*prcbuf|.
+ * Small literals are copied into |fields|->balloc.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int stream_fields_copy_literal(nghttp3_field_section *fields,
+                                      nghttp3_rcbuf **prcbuf,
+                                      const nghttp3_mem *mem) {
+  const nghttp3_rcbuf *src = *prcbuf;
+  nghttp3_rcbuf *rcbuf;
+  size_t n = sizeof(nghttp3_rcbuf) + src->len + 1;
+  uint8_t *p;
+  int rv;
+
+  if (n > NGHTTP3_STREAM_FIELDS_BLKLEN) {
+    return nghttp3_rcbuf_new2(prcbuf, src->base, src->len, mem);
+  }
+
+  rv = nghttp3_balloc_get(&fields->balloc, (void **)&rcbuf, n);
+  if (rv != 0) {
+    return rv;
+  }
+
+  p = (uint8_t *)rcbuf + sizeof(nghttp3_rcbuf);
+
+  rcbuf->mem = NULL;
+  rcbuf->base = p;
+  rcbuf->len = src->len;
+  rcbuf->ref = NGHTTP3_RCBUF_REF_STATIC;
+
+  if (src->len) {
+    p = nghttp3_cpymem(p, src->base, src->len);
+  }
+
+  *p = '\0';
+
+  *prcbuf = rcbuf;
+
+  return 0;
+}
+
+int nghttp3_stream_add_field(nghttp3_stream *stream,
+                             const nghttp3_qpack_nv *nv) {
+  nghttp3_field_section *fields = &stream->rx.fields;
+  nghttp3_qpack_nv *dest, *nva;
+  size_t nvcap;
+  int rv;
+
+  if (fields->nvlen == fields->nvcap) {
+    nvcap = nghttp3_max(16, fields->nvcap * 2);
+    nva = nghttp3_mem_realloc(stream->mem, fields->nva,
+                              sizeof(nghttp3_qpack_nv) * nvcap);
+    if (nva == NULL) {
+      rv = NGHTTP3_ERR_NOMEM;
+      goto fail;
+    }
+
+    fields->nva = nva;
+    fields->nvcap = nvcap;
+  }
+
+  dest = &fields->nva[fields->nvlen];
+  *dest = *nv;
+
+  if (nghttp3_rcbuf_is_borrowed(dest->name)) {
+    rv = stream_fields_copy_literal(fields, &dest->name, stream->mem);
+    if (rv != 0) {
+      goto fail;
+    }
+  }
+
+  if (nghttp3_rcbuf_is_borrowed(dest->value)) {
+    rv = stream_fields_copy_literal(fields, &dest->value, stream->mem);
+    if (rv != 0) {
+      if (dest->name != nv->name) {
+        nghttp3_rcbuf_decref(dest->name);
+      }
+      goto fail;
+    }
+  }
+
+  ++fields->nvlen;
+
+  return 0;
+
+fail:
+  nghttp3_rcbuf_decref(nv->name);
+  nghttp3_rcbuf_decref(nv->value);
+
+  return rv;
+}
+
+int nghttp3_stream_keep_request_field(nghttp3_stream *stream,
+                                      const nghttp3_qpack_nv *nv) {
+  nghttp3_request_fields *req = &stream->rx.req;
+  nghttp3_rcbuf **dest;
+
+  switch (nv->token) {
+  case NGHTTP3_QPACK_TOKEN__METHOD:
+    dest = &req->method;
+    break;
+  case NGHTTP3_QPACK_TOKEN__PATH:
+    dest = &req->path;
+    break;
+  case NGHTTP3_QPACK_TOKEN__AUTHORITY:
+    dest = &req->authority;
+    break;
+  case NGHTTP3_QPACK_TOKEN_HOST:
+    /* :authority takes precedence over host.  Pseudo header fields
+       always come before regular header fields. */
+    if (req->authority) {
+      return 0;
+    }
+
+    dest = &req->authority;
+    break;
+  case NGHTTP3_QPACK_TOKEN__SCHEME:
+    dest = &req->scheme;
+    break;
+  default:
+    return 0;
+  }
+
+  assert(*dest == NULL);
+
+  if (nghttp3_rcbuf_is_borrowed(nv->value)) {
+    return nghttp3_rcbuf_new2(dest, nv->value->base, nv->value->len,
+                              stream->mem);
+  }
+
+  nghttp3_rcbuf_incref(nv->value);
+  *dest = nv->value;
+
+  return 0;
+}
+
+void nghttp3_stream_clear_fields(nghttp3_stream *stream) {
+  nghttp3_field_section *fields = &stream->rx.fields;
+  size_t i;
+
+  for (i = 0; i < fields->nvlen; ++i) {
+    nghttp3_rcbuf_decref(fields->nva[i].name);
+    nghttp3_rcbuf_decref(fields->nva[i].value);
+  }
+
+  nghttp3_balloc_reset(&fields->balloc);
+
+  fields->nvlen = 0;
+}
+
+void nghttp3_stream_inq_pop_front(nghttp3_stream *stream) {
+  release_in_chunk(stream, nghttp3_ringbuf_get(&stream->inq, 0));
+  nghttp3_ringbuf_pop_front(&stream->inq);
+}
+
 size_t nghttp3_stream_get_buffered_datalen(nghttp3_stream *stream) {
   nghttp3_ringbuf *inq = &stream->inq;
   size_t len = nghttp3_ringbuf_len(inq);
   size_t i, n = 0;
-  nghttp3_buf *buf;
+  nghttp3_stream_inq_buf *ibuf;
 
   for (i = 0; i < len; ++i) {
-    buf = nghttp3_ringbuf_get(inq, i);
-    n += nghttp3_buf_len(buf);
+    ibuf = nghttp3_ringbuf_get(inq, i);
+    n += nghttp3_buf_len(&ibuf->buf);
   }
 
   return n;
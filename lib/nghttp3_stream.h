@@ -38,9 +38,14 @@
 #include "nghttp3_frame.h"
 #include "nghttp3_qpack.h"
 #include "nghttp3_objalloc.h"
+#include "nghttp3_balloc.h"
 
 #define NGHTTP3_STREAM_MIN_CHUNK_SIZE 256
 
+/* NGHTTP3_STREAM_INQ_CHUNK_SIZE is the size of a chunk which buffers
+   the data received while a stream is blocked by QPACK decoder. */
+#define NGHTTP3_STREAM_INQ_CHUNK_SIZE 16384
+
 /* NGHTTP3_MIN_UNSENT_BYTES is the minimum unsent bytes which is large
    enough to fill outgoing single QUIC packet. */
 #define NGHTTP3_MIN_UNSENT_BYTES 4096
@@ -181,10 +186,40 @@ typedef int (*nghttp3_stream_acked_data)(nghttp3_stream *stream,
                                          int64_t stream_id, uint64_t datalen,
                                          void *user_data);
 
+/*
+ * nghttp3_stream_release_buf is a callback function which is invoked
+ * when |stream| no longer refers to the application buffer identified
+ * by |buf_user_data|.
+ */
+typedef void (*nghttp3_stream_release_buf)(nghttp3_stream *stream,
+                                           void *buf_user_data);
+
 typedef struct nghttp3_stream_callbacks {
   nghttp3_stream_acked_data acked_data;
+  nghttp3_stream_release_buf release_buf;
 } nghttp3_stream_callbacks;
 
+/*
+ * nghttp3_stream_inq_buf is an element of inq.  If type is
+ * NGHTTP3_BUF_TYPE_ALIEN, buf refers to the application buffer
+ * identified by buf_user_data.  Otherwise, buf is a chunk owned by
+ * stream.
+ */
+typedef struct nghttp3_stream_inq_buf {
+  nghttp3_buf buf;
+  nghttp3_buf_type type;
+  void *buf_user_data;
+} nghttp3_stream_inq_buf;
+
+/*
+ * nghttp3_stream_outq_ref is the release callback of the buffer of
+ * type NGHTTP3_BUF_TYPE_ALIEN_REF in outq.
+ */
+typedef struct nghttp3_stream_outq_ref {
+  nghttp3_release_vec release;
+  void *user_data;
+} nghttp3_stream_outq_ref;
+
 typedef struct nghttp3_http_state {
   /* status_code is HTTP status code received.  This field is used
      if connection is initialized as client. */
@@ -197,13 +232,49 @@ typedef struct nghttp3_http_state {
   int64_t recv_content_length;
   nghttp3_pri pri;
   uint32_t flags;
+  /* method is the request method, which is one of
+     NGHTTP3_METHOD_*.  This field is used if connection is
+     initialized as server. */
+  uint8_t method;
 } nghttp3_http_state;
 
+/*
+ * nghttp3_field_section stores the HTTP fields of a field section
+ * being received in order to deliver them to an application at once.
+ */
+typedef struct nghttp3_field_section {
+  /* balloc allocates the copies of the borrowed nghttp3_rcbuf which
+     QPACK decoder emitted. */
+  nghttp3_balloc balloc;
+  /* nva is the array of HTTP fields received so far. */
+  nghttp3_qpack_nv *nva;
+  /* nvlen is the number of HTTP fields in nva. */
+  size_t nvlen;
+  /* nvcap is the capacity of nva. */
+  size_t nvcap;
+} nghttp3_field_section;
+
+/*
+ * nghttp3_request_fields holds the values of well-known request
+ * header fields for nghttp3_conn_get_request_view.
+ */
+typedef struct nghttp3_request_fields {
+  nghttp3_rcbuf *method;
+  nghttp3_rcbuf *path;
+  nghttp3_rcbuf *authority;
+  nghttp3_rcbuf *scheme;
+} nghttp3_request_fields;
+
 struct nghttp3_stream {
   union {
     struct {
       const nghttp3_mem *mem;
       nghttp3_objalloc *out_chunk_objalloc;
+      /* in_chunk_objalloc is the pool of the chunks of
+         NGHTTP3_STREAM_INQ_CHUNK_SIZE bytes which inq uses.  A short
+         tail is buffered in a chunk of NGHTTP3_STREAM_MIN_CHUNK_SIZE
+         bytes taken from out_chunk_objalloc instead. */
+      nghttp3_objalloc *in_chunk_objalloc;
       nghttp3_objalloc *stream_objalloc;
       nghttp3_tnode node;
       nghttp3_pq_entry qpack_blocked_pe;
@@ -211,6 +282,9 @@ struct nghttp3_stream {
       nghttp3_ringbuf frq;
       nghttp3_ringbuf chunks;
       nghttp3_ringbuf outq;
+      /* outq_refs contains nghttp3_stream_outq_ref for each buffer of
+         type NGHTTP3_BUF_TYPE_ALIEN_REF in outq in the same order. */
+      nghttp3_ringbuf outq_refs;
       /* inq stores the stream raw data which cannot be read because
          stream is blocked by QPACK decoder. */
       nghttp3_ringbuf inq;
@@ -231,7 +305,8 @@ struct nghttp3_stream {
       uint64_t ack_offset;
       /* ack_done is the number of bytes notified to an application that
          they are acknowledged inside the first outq element if it is of
-         type NGHTTP3_BUF_TYPE_ALIEN. */
+         type NGHTTP3_BUF_TYPE_ALIEN.  It is not used for
+         NGHTTP3_BUF_TYPE_ALIEN_REF. */
       uint64_t ack_done;
       uint64_t unscheduled_nwrite;
       nghttp3_stream_type type;
@@ -247,6 +322,13 @@ struct nghttp3_stream {
       struct {
         nghttp3_stream_http_state hstate;
         nghttp3_http_state http;
+        /* fields is the HTTP fields received so far in the current
+           field section.  It is only used if an application
+           receives a whole field section at once. */
+        nghttp3_field_section fields;
+        /* req is the values of well-known request header fields.  It
+           is only used if server enables request view. */
+        nghttp3_request_fields req;
       } rx;
 
       uint16_t flags;
@@ -258,6 +340,16 @@ struct nghttp3_stream {
 
 nghttp3_objalloc_decl(stream, nghttp3_stream, oplent);
 
+/* NGHTTP3_DATA_SOURCE_READ_DATA indicates that the data of DATA
+   frame is generated by nghttp3_data_reader. */
+#define NGHTTP3_DATA_SOURCE_READ_DATA 0x00u
+/* NGHTTP3_DATA_SOURCE_READ_DATA_REF indicates that the data of DATA
+   frame is generated by nghttp3_data_ref_reader. */
+#define NGHTTP3_DATA_SOURCE_READ_DATA_REF 0x01u
+/* NGHTTP3_DATA_SOURCE_FILE indicates that the data of DATA frame is
+   read from a file range. */
+#define NGHTTP3_DATA_SOURCE_FILE 0x02u
+
 typedef struct nghttp3_frame_entry {
   nghttp3_frame fr;
   union {
@@ -265,7 +357,23 @@ typedef struct nghttp3_frame_entry {
       nghttp3_settings *local_settings;
     } settings;
     struct {
+      /* efs, if not NULL, is the field section which is encoded in
+         advance, and it is sent instead of fr.headers.nva. */
+      nghttp3_encoded_field_section *efs;
+    } headers;
+    struct {
+      /* source is the source of the data.  It is one of
+         NGHTTP3_DATA_SOURCE_*. */
+      uint8_t source;
       nghttp3_data_reader dr;
+      nghttp3_data_ref_reader rdr;
+      /* file is the file range which provides the data if source is
+         NGHTTP3_DATA_SOURCE_FILE. */
+      struct {
+        int fd;
+        int64_t offset;
+        uint64_t left;
+      } file;
     } data;
   } aux;
 } nghttp3_frame_entry;
@@ -273,6 +381,7 @@ typedef struct nghttp3_frame_entry {
 int nghttp3_stream_new(nghttp3_stream **pstream, int64_t stream_id,
                        const nghttp3_stream_callbacks *callbacks,
                        nghttp3_objalloc *out_chunk_objalloc,
+                       nghttp3_objalloc *in_chunk_objalloc,
                        nghttp3_objalloc *stream_objalloc,
                        const nghttp3_mem *mem);
 
@@ -355,8 +464,67 @@ int nghttp3_stream_require_schedule(nghttp3_stream *stream);
 int nghttp3_stream_buffer_data(nghttp3_stream *stream, const uint8_t *src,
                                size_t srclen);
 
+/*
+ * nghttp3_stream_buffer_data_ref is similar to
+ * nghttp3_stream_buffer_data, but it keeps a reference to |src|
+ * instead of copying it.  |src| must stay valid until
+ * callbacks.release_buf is invoked with |buf_user_data|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+int nghttp3_stream_buffer_data_ref(nghttp3_stream *stream, const uint8_t *src,
+                                   size_t srclen, void *buf_user_data);
+
+/*
+ * nghttp3_stream_inq_pop_front removes the first chunk in inq of
+ * |stream|, and returns it to the pool, or releases the reference to
+ * the application buffer.  inq must not be empty.
+ */
+void nghttp3_stream_inq_pop_front(nghttp3_stream *stream);
+
 size_t nghttp3_stream_get_buffered_datalen(nghttp3_stream *stream);
 
+/*
+ * nghttp3_stream_add_field appends |nv| to stream->rx.fields.  This
+ * function takes the ownership of nv->name and nv->value regardless
+ * of its outcome.  If they refer to the input buffer of QPACK
+ * decoder, they are copied.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+int nghttp3_stream_add_field(nghttp3_stream *stream,
+                             const nghttp3_qpack_nv *nv);
+
+/*
+ * nghttp3_stream_keep_request_field keeps the value of |nv| in
+ * stream->rx.req if it is one of the well-known request header
+ * fields.  The value is copied if it refers to the input buffer of
+ * QPACK decoder.  Otherwise, its reference count is incremented.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+int nghttp3_stream_keep_request_field(nghttp3_stream *stream,
+                                      const nghttp3_qpack_nv *nv);
+
+/*
+ * nghttp3_stream_clear_fields releases all HTTP fields in
+ * stream->rx.fields.  The memory allocated for them is kept for the
+ * next field section, and freed by nghttp3_stream_del.
+ */
+void nghttp3_stream_clear_fields(nghttp3_stream *stream);
+
 int nghttp3_stream_ensure_qpack_stream_context(nghttp3_stream *stream);
 
 void nghttp3_stream_delete_qpack_stream_context(nghttp3_stream *stream);
@@ -31,10 +31,21 @@
 #include "nghttp3_conn.h"
 #include "nghttp3_conv.h"
 
+/* NGHTTP3_TNODE_DRR_QUANTUM is the number of bytes which an
+   incremental node can write in each round of deficit round-robin
+   scheduler.  It matches the write length which costs one cycle in
+   the cycle based scheduler. */
+#define NGHTTP3_TNODE_DRR_QUANTUM NGHTTP3_STREAM_MIN_WRITELEN
+
 void nghttp3_tnode_init(nghttp3_tnode *tnode, int64_t id) {
   tnode->pe.index = NGHTTP3_PQ_BAD_INDEX;
+  tnode->queue = NULL;
+  tnode->queue_prev = NULL;
+  tnode->queue_next = NULL;
+  tnode->held_next = NULL;
   tnode->id = id;
   tnode->cycle = 0;
+  tnode->deficit = 0;
   tnode->pri.urgency = NGHTTP3_DEFAULT_URGENCY;
   tnode->pri.inc = 0;
 }
@@ -91,5 +102,98 @@ int nghttp3_tnode_schedule(nghttp3_tnode *tnode, nghttp3_pq *pq,
 }
 
 int nghttp3_tnode_is_scheduled(nghttp3_tnode *tnode) {
-  return tnode->pe.index != NGHTTP3_PQ_BAD_INDEX;
+  return tnode->pe.index != NGHTTP3_PQ_BAD_INDEX || tnode->queue != NULL;
+}
+
+void nghttp3_tnode_queue_init(nghttp3_tnode_queue *queue) {
+  queue->head = NULL;
+  queue->tail = NULL;
+}
+
+static void tnode_queue_push_back(nghttp3_tnode_queue *queue,
+                                  nghttp3_tnode *tnode) {
+  tnode->queue = queue;
+  tnode->queue_prev = queue->tail;
+  tnode->queue_next = NULL;
+
+  if (queue->tail) {
+    queue->tail->queue_next = tnode;
+  } else {
+    queue->head = tnode;
+  }
+
+  queue->tail = tnode;
+}
+
+static void tnode_queue_remove(nghttp3_tnode *tnode) {
+  nghttp3_tnode_queue *queue = tnode->queue;
+
+  if (tnode->queue_prev) {
+    tnode->queue_prev->queue_next = tnode->queue_next;
+  } else {
+    queue->head = tnode->queue_next;
+  }
+
+  if (tnode->queue_next) {
+    tnode->queue_next->queue_prev = tnode->queue_prev;
+  } else {
+    queue->tail = tnode->queue_prev;
+  }
+
+  tnode->queue = NULL;
+  tnode->queue_prev = NULL;
+  tnode->queue_next = NULL;
+}
+
+void nghttp3_tnode_drr_schedule(nghttp3_tnode *tnode,
+                                nghttp3_tnode_queue *queue, uint64_t nwrite) {
+  if (tnode->queue == NULL) {
+    tnode->deficit = NGHTTP3_TNODE_DRR_QUANTUM;
+    tnode_queue_push_back(queue, tnode);
+    return;
+  }
+
+  assert(tnode->queue == queue);
+
+  if (!tnode->pri.inc || nwrite == 0) {
+    return;
+  }
+
+  tnode->deficit -= (int64_t)nghttp3_min(nwrite, NGHTTP3_MAX_VARINT);
+  if (tnode->deficit > 0) {
+    return;
+  }
+
+  /* The overdraft is carried over to the next round. */
+  tnode->deficit += NGHTTP3_TNODE_DRR_QUANTUM;
+
+  if (queue->tail != tnode) {
+    tnode_queue_remove(tnode);
+    tnode_queue_push_back(queue, tnode);
+  }
+}
+
+void nghttp3_tnode_drr_unschedule(nghttp3_tnode *tnode) {
+  if (tnode->queue == NULL) {
+    return;
+  }
+
+  tnode_queue_remove(tnode);
+}
+
+void nghttp3_tnode_drr_push_front(nghttp3_tnode *tnode,
+                                  nghttp3_tnode_queue *queue) {
+  assert(tnode->queue == NULL);
+
+  tnode->queue = queue;
+  tnode->queue_prev = NULL;
+  tnode->queue_next = queue->head;
+
+  if (queue->head) {
+    queue->head->queue_prev = tnode;
+  } else {
+    queue->tail = tnode;
+  }
+
+  queue->head = tnode;
 }
@@ -35,14 +35,37 @@
 
 #define NGHTTP3_TNODE_MAX_CYCLE_GAP (1llu << 24)
 
-typedef struct nghttp3_tnode {
+typedef struct nghttp3_tnode nghttp3_tnode;
+
+/*
+ * nghttp3_tnode_queue is a FIFO queue of nghttp3_tnode which deficit
+ * round-robin scheduler uses.
+ */
+typedef struct nghttp3_tnode_queue {
+  nghttp3_tnode *head;
+  nghttp3_tnode *tail;
+} nghttp3_tnode_queue;
+
+struct nghttp3_tnode {
   nghttp3_pq_entry pe;
+  /* queue is the nghttp3_tnode_queue which this node is in.  It is
+     NULL if this node is not scheduled by deficit round-robin
+     scheduler. */
+  nghttp3_tnode_queue *queue;
+  nghttp3_tnode *queue_prev;
+  nghttp3_tnode *queue_next;
+  /* held_next links the nodes which nghttp3_conn_writev_streams has
+     taken off the scheduler while it fills a batch. */
+  nghttp3_tnode *held_next;
   size_t num_children;
   int64_t id;
   uint64_t cycle;
+  /* deficit is the number of bytes which this node can write before
+     it yields to the next node in queue. */
+  int64_t deficit;
   /* pri is a stream priority produced by nghttp3_pri_to_uint8. */
   nghttp3_pri pri;
-} nghttp3_tnode;
+};
 
 void nghttp3_tnode_init(nghttp3_tnode *tnode, int64_t id);
 
@@ -63,4 +86,32 @@ int nghttp3_tnode_schedule(nghttp3_tnode *tnode, nghttp3_pq *pq,
  */
 int nghttp3_tnode_is_scheduled(nghttp3_tnode *tnode);
 
+void nghttp3_tnode_queue_init(nghttp3_tnode_queue *queue);
+
+/*
+ * nghttp3_tnode_drr_schedule schedules |tnode| in |queue| using
+ * |nwrite| as the number of bytes written.  If |tnode| has not been
+ * scheduled, it is appended to |queue|.  Otherwise, if |tnode| is
+ * incremental, |nwrite| is charged to it, and it is moved to the back
+ * of |queue| once it has used up its quantum.  A non-incremental node
+ * keeps its position.
+ */
+void nghttp3_tnode_drr_schedule(nghttp3_tnode *tnode,
+                                nghttp3_tnode_queue *queue, uint64_t nwrite);
+
+/*
+ * nghttp3_tnode_drr_unschedule removes |tnode| from the queue it is
+ * in.  It does nothing if |tnode| is not scheduled.
+ */
+void nghttp3_tnode_drr_unschedule(nghttp3_tnode *tnode);
+
+/*
+ * nghttp3_tnode_drr_push_front inserts |tnode|, which is not
+ * scheduled, at the front of |queue|.  Unlike
+ * nghttp3_tnode_drr_schedule, it keeps the deficit of |tnode|.  It is
+ * used to put back a node which was temporarily unscheduled.
+ */
+void nghttp3_tnode_drr_push_front(nghttp3_tnode *tnode,
+                                  nghttp3_tnode_queue *queue);
+
 #endif /* NGHTTP3_TNODE_H */
@@ -5,6 +5,11 @@
 # and decoding tables in C language.  The resulting code is used in
 # lib/nghttp3_qpack_huffman.h and lib/nghttp3_qpack_huffman_data.c
 #
+# The decoding tables consist of a lookup table indexed by the next
+# NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS bits of input, which yields up to
+# 2 symbols at once, and the tables of canonical Huffman code to
+# decode the codes longer than that.
+#
 # [1] http://http2.github.io/http2-spec/compression.html
 
 import re
@@ -272,144 +277,82 @@ HUFFMAN_CODE_TABLE = """\
 EOS (256)  |11111111|11111111|11111111|111111      3fffffff  [30]
 """
 
-class Node:
-
-    def __init__(self, term = None):
-        self.term = term
-        self.left = None
-        self.right = None
-        self.trans = []
-        self.id = None
-        self.accept = False
-
-class Context:
-
-    def __init__(self):
-        self.next_id_ = 0
-        self.root = Node()
-
-    def next_id(self):
-        id = self.next_id_
-        self.next_id_ += 1
-        return id
+# NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS is the number of input bits
+# which the decoder looks up at once.  The shortest code is 5 bits
+# long, so a single lookup emits up to 2 symbols.
+NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS = 12
 
-def _add(node, sym, bits):
-    if len(bits) == 0:
-        node.term = sym
-        return
-    else:
-        if bits[0] == '0':
-            if node.left is None:
-                node.left = Node()
-            child = node.left
-        else:
-            if node.right is None:
-                node.right = Node()
-            child = node.right
-        _add(child, sym, bits[1:])
-
-def huffman_tree_add(ctx, sym, bits):
-    _add(ctx.root, sym, bits)
-
-def _set_node_id(ctx, node, prefix):
-    if node.term is not None:
-        return
-    if len(prefix) <= 7 and [1] * len(prefix) == prefix:
-        node.accept = True
-    node.id = ctx.next_id()
-    _set_node_id(ctx, node.left, prefix + [0])
-    _set_node_id(ctx, node.right, prefix + [1])
+# NGHTTP3_QPACK_HUFFMAN_MAX_NBITS is the length of the longest code.
+NGHTTP3_QPACK_HUFFMAN_MAX_NBITS = 30
 
-def huffman_tree_set_node_id(ctx):
-    _set_node_id(ctx, ctx.root, [])
+def build_lookup_table(symbol_tbl, lookup_bits):
+    # codes maps a code (as a string of '0' and '1') to a symbol.
+    # EOS is excluded because it must not appear in a string.
+    codes = {}
+    for sym in range(256):
+        nbits, code = symbol_tbl[sym]
+        codes[format(int(code, 16), '0{}b'.format(nbits))] = sym
 
-def _traverse(node, sym, start_node, root, left):
-    if left == 0:
-        if sym == 256:
-            sym = None
-            node = None
-        start_node.trans.append((node, sym))
-        return
+    def decode_one(bits):
+        for i in range(1, len(bits) + 1):
+            sym = codes.get(bits[:i])
+            if sym is not None:
+                return sym, i
+        return None, 0
 
-    if node.term is not None:
-        node = root
-
-    def go(node):
-        if node.term is not None:
-            assert sym is None
-            nsym = node.term
+    tbl = []
+    for i in range(1 << lookup_bits):
+        bits = format(i, '0{}b'.format(lookup_bits))
+        sym0, nbits0 = decode_one(bits)
+        if sym0 is None:
+            tbl.append(((0, 0), 0, 0))
+            continue
+        sym1, nbits1 = decode_one(bits[nbits0:])
+        if sym1 is None:
+            tbl.append(((sym0, 0), nbits0, nbits0))
         else:
-            nsym = sym
+            tbl.append(((sym0, sym1), nbits0, nbits0 + nbits1))
 
-        _traverse(node, nsym, start_node, root, left - 1)
+    return tbl
 
-    go(node.left)
-    go(node.right)
+def build_canonical_table(symbol_tbl):
+    # The Huffman code is canonical: the codes of the same length are
+    # consecutive, and they are assigned in ascending order of symbol.
+    syms = sorted(range(257), key=lambda sym: (symbol_tbl[sym][0], sym))
+    lens = [None] * (NGHTTP3_QPACK_HUFFMAN_MAX_NBITS + 1)
+    code = 0
+    nbits = 0
+    for i, sym in enumerate(syms):
+        code <<= symbol_tbl[sym][0] - nbits
+        nbits = symbol_tbl[sym][0]
+        assert code == int(symbol_tbl[sym][1], 16)
+        if lens[nbits] is None:
+            lens[nbits] = [code, code, i]
+        lens[nbits][1] = code + 1
+        code += 1
 
-def _build_transition_table(ctx, node):
-    if node is None:
-        return
-    _traverse(node, None, node, ctx.root, 4)
-    _build_transition_table(ctx, node.left)
-    _build_transition_table(ctx, node.right)
+    lens[0] = [0, 0, 0]
+    code = 0
+    for nbits in range(1, NGHTTP3_QPACK_HUFFMAN_MAX_NBITS + 1):
+        if lens[nbits] is None:
+            # No code of this length.  Make limit equal to the first
+            # code of the next length so that nothing matches.
+            lens[nbits] = [code, code, 0]
+        code = lens[nbits][1] << 1
 
-def huffman_tree_build_transition_table(ctx):
-    _build_transition_table(ctx, ctx.root)
+    return syms, lens
 
-NGHTTP3_QPACK_HUFFMAN_ACCEPTED = 1 << 14
-NGHTTP3_QPACK_HUFFMAN_SYM = 1 << 15
-
-def _print_transition_table(node):
-    if node.term is not None:
-        return
-    print('/* {} */'.format(node.id))
-    print('{')
-    for nd, sym in node.trans:
-        flags = 0
-        if sym is None:
-            out = 0
-        else:
-            out = sym
-            flags |= NGHTTP3_QPACK_HUFFMAN_SYM
-        if nd is None:
-            id = 256
-        else:
-            id = nd.id
-            if id is None:
-                # if nd.id is None, it is a leaf node
-                id = 0
-                flags |= NGHTTP3_QPACK_HUFFMAN_ACCEPTED
-            elif nd.accept:
-                flags |= NGHTTP3_QPACK_HUFFMAN_ACCEPTED
-        print('  {{0x{:02x}, {}}},'.format(id | flags, out))
-    print('},')
-    _print_transition_table(node.left)
-    _print_transition_table(node.right)
-
-def huffman_tree_print_transition_table(ctx):
-    _print_transition_table(ctx.root)
-    print('/* 256 */')
-    print('{')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('  {0x100, 0},')
-    print('},')
+def print_entries(entries):
+    line = '   '
+    for i, ent in enumerate(entries):
+        s = ' ' + ent + (',' if i + 1 < len(entries) else '')
+        if len(line) + len(s) > 80:
+            print(line)
+            line = '   '
+        line += s
+    print(line)
 
 if __name__ == '__main__':
-    ctx = Context()
     symbol_tbl = [(None, 0) for i in range(257)]
 
     for line in io.StringIO(HUFFMAN_CODE_TABLE):
@@ -424,45 +367,43 @@ if __name__ == '__main__':
                 raise Error('Code is more than 4 bytes long')
             assert(len(bits) == nbits)
             symbol_tbl[sym] = (nbits, code)
-            huffman_tree_add(ctx, sym, bits)
 
-    huffman_tree_set_node_id(ctx)
-    huffman_tree_build_transition_table(ctx)
-
-    print('''\
-typedef struct {
-  uint32_t nbits;
-  uint32_t code;
-} nghttp3_qpack_huffman_sym;
-''')
+    lookup_tbl = build_lookup_table(symbol_tbl,
+                                    NGHTTP3_QPACK_HUFFMAN_LOOKUP_BITS)
+    canon_syms, canon_lens = build_canonical_table(symbol_tbl)
 
     print('''\
 const nghttp3_qpack_huffman_sym huffman_sym_table[] = {''')
+    entries = []
     for i in range(257):
         nbits = symbol_tbl[i][0]
         k = int(symbol_tbl[i][1], 16)
         k = k << (32 - nbits)
-        print('''\
-  {{ {}, 0x{}u }}{}\
-'''.format(symbol_tbl[i][0], hex(k)[2:], ',' if i < 256 else ''))
+        entries.append('{{{}, 0x{}u}}'.format(nbits, hex(k)[2:]))
+    print_entries(entries)
     print('};')
     print('')
 
     print('''\
-enum {{
-  NGHTTP3_QPACK_HUFFMAN_ACCEPTED = {},
-  NGHTTP3_QPACK_HUFFMAN_SYM = {},
-}} nghttp3_qpack_huffman_decode_flag;
-'''.format(NGHTTP3_QPACK_HUFFMAN_ACCEPTED, NGHTTP3_QPACK_HUFFMAN_SYM))
+const nghttp3_qpack_huffman_decode_entry qpack_huffman_decode_table[] = {''')
+    entries = []
+    for (sym0, sym1), nbits0, nbits in lookup_tbl:
+        entries.append('{{{{{}, {}}}, {}, {}}}'.format(sym0, sym1, nbits0,
+                                                      nbits))
+    print_entries(entries)
+    print('};')
+    print('')
 
     print('''\
-typedef struct {
-  uint16_t fstate;
-  uint8_t sym;
-} nghttp3_qpack_huffman_decode_node;
-''')
+const nghttp3_qpack_huffman_decode_length qpack_huffman_decode_lengths[] = {''')
+    entries = []
+    for first, limit, offset in canon_lens:
+        entries.append('{{0x{:x}u, 0x{:x}u, {}}}'.format(first, limit, offset))
+    print_entries(entries)
+    print('};')
+    print('')
 
     print('''\
-const nghttp3_qpack_huffman_decode_node qpack_huffman_decode_table[][16] = {''')
-    huffman_tree_print_transition_table(ctx)
+const uint16_t qpack_huffman_decode_syms[] = {''')
+    print_entries([str(sym) for sym in canon_syms])
     print('};')
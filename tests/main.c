@@ -35,6 +35,7 @@
 #include "nghttp3_qpack_test.h"
 #include "nghttp3_conn_test.h"
 #include "nghttp3_tnode_test.h"
+#include "nghttp3_stmap_test.h"
 #include "nghttp3_http_test.h"
 #include "nghttp3_conv_test.h"
 
@@ -66,11 +67,28 @@ int main(void) {
                    test_nghttp3_qpack_encoder_still_blocked) ||
       !CU_add_test(pSuite, "qpack_encoder_set_dtable_cap",
                    test_nghttp3_qpack_encoder_set_dtable_cap) ||
+      !CU_add_test(pSuite, "qpack_encoder_dtable_map",
+                   test_nghttp3_qpack_encoder_dtable_map) ||
+      !CU_add_test(pSuite, "qpack_encoder_indexing_policy_frequency",
+                   test_nghttp3_qpack_encoder_indexing_policy_frequency) ||
+      !CU_add_test(pSuite, "qpack_stream_refs",
+                   test_nghttp3_qpack_stream_refs) ||
       !CU_add_test(pSuite, "qpack_decoder_feedback",
                    test_nghttp3_qpack_decoder_feedback) ||
       !CU_add_test(pSuite, "qpack_decoder_stream_overflow",
                    test_nghttp3_qpack_decoder_stream_overflow) ||
+      !CU_add_test(pSuite, "qpack_decoder_borrow_literals",
+                   test_nghttp3_qpack_decoder_borrow_literals) ||
+      !CU_add_test(pSuite, "qpack_decoder_value_chunk",
+                   test_nghttp3_qpack_decoder_value_chunk) ||
+      !CU_add_test(pSuite, "qpack_ring_dtable",
+                   test_nghttp3_qpack_ring_dtable) ||
+      !CU_add_test(pSuite, "qpack_stats", test_nghttp3_qpack_stats) ||
       !CU_add_test(pSuite, "qpack_huffman", test_nghttp3_qpack_huffman) ||
+      !CU_add_test(pSuite, "qpack_huffman_encode_bounded",
+                   test_nghttp3_qpack_huffman_encode_bounded) ||
+      !CU_add_test(pSuite, "qpack_huffman_decode_chunk",
+                   test_nghttp3_qpack_huffman_decode_chunk) ||
       !CU_add_test(pSuite, "qpack_huffman_decode_failure_state",
                    test_nghttp3_qpack_huffman_decode_failure_state) ||
       !CU_add_test(pSuite, "qpack_decoder_reconstruct_ricnt",
@@ -79,6 +97,10 @@ int main(void) {
                    test_nghttp3_conn_read_control) ||
       !CU_add_test(pSuite, "conn_write_control",
                    test_nghttp3_conn_write_control) ||
+      !CU_add_test(pSuite, "conn_settings_version",
+                   test_nghttp3_conn_settings_version) ||
+      !CU_add_test(pSuite, "conn_callbacks_version",
+                   test_nghttp3_conn_callbacks_version) ||
       !CU_add_test(pSuite, "conn_submit_request",
                    test_nghttp3_conn_submit_request) ||
       !CU_add_test(pSuite, "conn_http_request",
@@ -102,8 +124,24 @@ int main(void) {
       !CU_add_test(pSuite, "conn_http_error", test_nghttp3_conn_http_error) ||
       !CU_add_test(pSuite, "conn_qpack_blocked_stream",
                    test_nghttp3_conn_qpack_blocked_stream) ||
+      !CU_add_test(pSuite, "conn_qpack_blocked_datalen",
+                   test_nghttp3_conn_qpack_blocked_datalen) ||
+      !CU_add_test(pSuite, "conn_read_stream_ref",
+                   test_nghttp3_conn_read_stream_ref) ||
+      !CU_add_test(pSuite, "conn_read_data_ref",
+                   test_nghttp3_conn_read_data_ref) ||
+      !CU_add_test(pSuite, "conn_submit_response_file",
+                   test_nghttp3_conn_submit_response_file) ||
+      !CU_add_test(pSuite, "conn_submit_response_encoded",
+                   test_nghttp3_conn_submit_response_encoded) ||
+      !CU_add_test(pSuite, "conn_eager_header_encoding",
+                   test_nghttp3_conn_eager_header_encoding) ||
       !CU_add_test(pSuite, "conn_submit_response_read_blocked",
                    test_nghttp3_conn_submit_response_read_blocked) ||
+      !CU_add_test(pSuite, "conn_drr_scheduler",
+                   test_nghttp3_conn_drr_scheduler) ||
+      !CU_add_test(pSuite, "conn_writev_streams",
+                   test_nghttp3_conn_writev_streams) ||
       !CU_add_test(pSuite, "conn_just_fin", test_nghttp3_conn_just_fin) ||
       !CU_add_test(pSuite, "conn_recv_uni", test_nghttp3_conn_recv_uni) ||
       !CU_add_test(pSuite, "conn_recv_goaway", test_nghttp3_conn_recv_goaway) ||
@@ -121,9 +159,21 @@ int main(void) {
                    test_nghttp3_conn_shutdown_stream_read) ||
       !CU_add_test(pSuite, "conn_stream_data_overflow",
                    test_nghttp3_conn_stream_data_overflow) ||
+      !CU_add_test(pSuite, "conn_recv_header_section",
+                   test_nghttp3_conn_recv_header_section) ||
+      !CU_add_test(pSuite, "conn_get_request_view",
+                   test_nghttp3_conn_get_request_view) ||
       !CU_add_test(pSuite, "conn_get_frame_payload_left",
                    test_nghttp3_conn_get_frame_payload_left) ||
+      !CU_add_test(pSuite, "conn_read_bidi_frame_split",
+                   test_nghttp3_conn_read_bidi_frame_split) ||
+      !CU_add_test(pSuite, "conn_read_streams",
+                   test_nghttp3_conn_read_streams) ||
+      !CU_add_test(pSuite, "conn_reset", test_nghttp3_conn_reset) ||
       !CU_add_test(pSuite, "tnode_schedule", test_nghttp3_tnode_schedule) ||
+      !CU_add_test(pSuite, "tnode_drr_schedule",
+                   test_nghttp3_tnode_drr_schedule) ||
+      !CU_add_test(pSuite, "stmap", test_nghttp3_stmap) ||
       !CU_add_test(pSuite, "http_parse_priority",
                    test_nghttp3_http_parse_priority) ||
       !CU_add_test(pSuite, "check_header_value",
@@ -26,6 +26,7 @@
 
 #include <stdio.h>
 #include <assert.h>
+#include <stddef.h>
 
 #include <CUnit/CUnit.h>
 
@@ -36,6 +37,7 @@
 #include "nghttp3_vec.h"
 #include "nghttp3_test_helper.h"
 #include "nghttp3_http.h"
+#include "nghttp3_encoded_field_section.h"
 
 static uint8_t nulldata[4096];
 
@@ -69,6 +71,26 @@ typedef struct {
     size_t ncalled;
     nghttp3_settings settings;
   } recv_settings_cb;
+  struct {
+    size_t ncalled;
+  } recv_header_cb;
+  struct {
+    size_t ncalled;
+    size_t nvlen;
+    uint8_t buf[256];
+    size_t buflen;
+  } recv_header_section_cb;
+  struct {
+    size_t ncalled;
+    void *vec_user_data;
+    int tags[3];
+  } release_vec_cb;
+  struct {
+    uint64_t datalen;
+  } recv_data_cb;
+  struct {
+    size_t ncalled;
+  } end_stream_cb;
 } userdata;
 
 static int acked_stream_data(nghttp3_conn *conn, int64_t stream_id,
@@ -108,6 +130,58 @@ static int recv_header(nghttp3_conn *conn, int64_t stream_id, int32_t token,
   return 0;
 }
 
+static int count_recv_header(nghttp3_conn *conn, int64_t stream_id,
+                             int32_t token, nghttp3_rcbuf *name,
+                             nghttp3_rcbuf *value, uint8_t flags,
+                             void *user_data, void *stream_user_data) {
+  userdata *ud = user_data;
+
+  (void)conn;
+  (void)stream_id;
+  (void)token;
+  (void)name;
+  (void)value;
+  (void)flags;
+  (void)stream_user_data;
+
+  ++ud->recv_header_cb.ncalled;
+
+  return 0;
+}
+
+static int recv_header_section(nghttp3_conn *conn, int64_t stream_id,
+                               const nghttp3_qpack_nv *nva, size_t nvlen,
+                               void *user_data, void *stream_user_data) {
+  userdata *ud = user_data;
+  uint8_t *p =
+      ud->recv_header_section_cb.buf + ud->recv_header_section_cb.buflen;
+  size_t i;
+
+  (void)conn;
+  (void)stream_id;
+  (void)stream_user_data;
+
+  ++ud->recv_header_section_cb.ncalled;
+  ud->recv_header_section_cb.nvlen += nvlen;
+
+  /* Serialize fields as "name: value\n" so that the test can compare
+     them after the borrowed buffers are gone. */
+  for (i = 0; i < nvlen; ++i) {
+    memcpy(p, nva[i].name->base, nva[i].name->len);
+    p += nva[i].name->len;
+    *p++ = ':';
+    *p++ = ' ';
+    memcpy(p, nva[i].value->base, nva[i].value->len);
+    p += nva[i].value->len;
+    *p++ = '\n';
+  }
+
+  ud->recv_header_section_cb.buflen =
+      (size_t)(p - ud->recv_header_section_cb.buf);
+
+  return 0;
+}
+
 static int end_headers(nghttp3_conn *conn, int64_t stream_id, int fin,
                        void *user_data, void *stream_user_data) {
   (void)conn;
@@ -272,6 +346,34 @@ static int deferred_consume(nghttp3_conn *conn, int64_t stream_id,
   return 0;
 }
 
+static int recv_data(nghttp3_conn *conn, int64_t stream_id,
+                     const uint8_t *data, size_t datalen, void *user_data,
+                     void *stream_user_data) {
+  userdata *ud = user_data;
+
+  (void)conn;
+  (void)stream_id;
+  (void)data;
+  (void)stream_user_data;
+
+  ud->recv_data_cb.datalen += datalen;
+
+  return 0;
+}
+
+static int end_stream(nghttp3_conn *conn, int64_t stream_id, void *user_data,
+                      void *stream_user_data) {
+  userdata *ud = user_data;
+
+  (void)conn;
+  (void)stream_id;
+  (void)stream_user_data;
+
+  ++ud->end_stream_cb.ncalled;
+
+  return 0;
+}
+
 static int recv_settings(nghttp3_conn *conn, const nghttp3_settings *settings,
                          void *user_data) {
   userdata *ud = user_data;
@@ -644,6 +746,91 @@ void test_nghttp3_conn_write_control(void) {
   nghttp3_conn_del(conn);
 }
 
+void test_nghttp3_conn_settings_version(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  int rv;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+
+  /* nghttp3_settings_default does not write the fields which are not
+     available in NGHTTP3_SETTINGS_V1. */
+  memset(&settings, 0xff, sizeof(settings));
+  nghttp3_settings_default_versioned(NGHTTP3_SETTINGS_V1, &settings);
+
+  CU_ASSERT(NGHTTP3_VARINT_MAX == settings.max_field_section_size);
+  CU_ASSERT(0 == settings.h3_datagram);
+  CU_ASSERT(0xff == settings.qpack_indexing_policy);
+  CU_ASSERT(0xff == settings.eager_header_encoding);
+
+  /* They are ignored, and take the default values. */
+  rv = nghttp3_conn_server_new_versioned(&conn, NGHTTP3_CALLBACKS_VERSION,
+                                         &callbacks, NGHTTP3_SETTINGS_V1,
+                                         &settings, mem, NULL);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(NGHTTP3_VARINT_MAX == conn->local.settings.max_field_section_size);
+  CU_ASSERT(NGHTTP3_QPACK_INDEXING_POLICY_DEFAULT ==
+            conn->local.settings.qpack_indexing_policy);
+  CU_ASSERT(0 == conn->local.settings.qpack_ring_dtable);
+  CU_ASSERT(1024 * 1024 == conn->local.settings.qpack_max_blocked_datalen);
+  CU_ASSERT(0 == conn->local.settings.eager_header_encoding);
+
+  settings.qpack_blocked_streams = 7;
+
+  rv = nghttp3_conn_reset_server_versioned(conn, NGHTTP3_CALLBACKS_VERSION,
+                                           &callbacks, NGHTTP3_SETTINGS_V1,
+                                           &settings, NULL);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(7 == conn->local.settings.qpack_blocked_streams);
+  CU_ASSERT(0 == conn->local.settings.qpack_ring_dtable);
+  CU_ASSERT(1024 * 1024 == conn->local.settings.qpack_max_blocked_datalen);
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_callbacks_version(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  int rv;
+
+  nghttp3_settings_default(&settings);
+
+  /* The fields which are not available in NGHTTP3_CALLBACKS_V1 are
+     ignored. */
+  memset(&callbacks, 0xff, sizeof(callbacks));
+  memset(&callbacks, 0, offsetof(nghttp3_callbacks, recv_settings));
+  callbacks.recv_settings = recv_settings;
+
+  rv = nghttp3_conn_client_new_versioned(&conn, NGHTTP3_CALLBACKS_V1,
+                                         &callbacks, NGHTTP3_SETTINGS_VERSION,
+                                         &settings, mem, NULL);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(recv_settings == conn->callbacks.recv_settings);
+  CU_ASSERT(NULL == conn->callbacks.recv_header_section);
+  CU_ASSERT(NULL == conn->callbacks.recv_trailer_section);
+  CU_ASSERT(NULL == conn->callbacks.retain_buf);
+  CU_ASSERT(NULL == conn->callbacks.release_buf);
+
+  rv = nghttp3_conn_reset_client_versioned(conn, NGHTTP3_CALLBACKS_V1,
+                                           &callbacks,
+                                           NGHTTP3_SETTINGS_VERSION,
+                                           &settings, NULL);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(recv_settings == conn->callbacks.recv_settings);
+  CU_ASSERT(NULL == conn->callbacks.recv_header_section);
+  CU_ASSERT(NULL == conn->callbacks.release_buf);
+
+  nghttp3_conn_del(conn);
+}
+
 void test_nghttp3_conn_submit_request(void) {
   const nghttp3_mem *mem = nghttp3_mem_default();
   nghttp3_conn *conn;
@@ -2601,146 +2788,1341 @@ void test_nghttp3_conn_just_fin(void) {
   nghttp3_conn_del(conn);
 }
 
-void test_nghttp3_conn_submit_response_read_blocked(void) {
+void test_nghttp3_conn_qpack_blocked_datalen(void) {
   const nghttp3_mem *mem = nghttp3_mem_default();
   nghttp3_conn *conn;
   nghttp3_callbacks callbacks;
   nghttp3_settings settings;
-  const nghttp3_nv nva[] = {
+  nghttp3_qpack_encoder qenc;
+  int rv;
+  nghttp3_buf ebuf;
+  uint8_t rawbuf[4096];
+  nghttp3_buf buf;
+  const nghttp3_nv reqnv[] = {
+      MAKE_NV(":authority", "localhost"),
+      MAKE_NV(":method", "GET"),
+      MAKE_NV(":path", "/"),
+      MAKE_NV(":scheme", "https"),
+  };
+  const nghttp3_nv resnv[] = {
       MAKE_NV(":status", "200"),
+      MAKE_NV("server", "nghttp3"),
   };
+  nghttp3_frame fr;
+  nghttp3_ssize sconsumed;
   nghttp3_stream *stream;
-  int rv;
-  nghttp3_vec vec[256];
-  int fin;
   int64_t stream_id;
-  nghttp3_ssize sveccnt;
-  nghttp3_data_reader dr = {step_then_block_read_data};
-  userdata ud;
+  size_t headerslen;
 
   memset(&callbacks, 0, sizeof(callbacks));
   nghttp3_settings_default(&settings);
+  settings.qpack_max_dtable_capacity = 4096;
+  settings.qpack_blocked_streams = 100;
+  settings.qpack_max_blocked_datalen = 100;
 
-  /* Make sure that flushing serialized data while
-     NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED is set does not cause any
-     error */
-  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
-  conn->remote.bidi.max_client_streams = 1;
-  nghttp3_conn_bind_qpack_streams(conn, 7, 11);
-
-  nghttp3_conn_create_stream(conn, &stream, 0);
-
-  ud.data.left = 1000;
-  ud.data.step = 1000;
-  rv = nghttp3_conn_submit_response(conn, 0, nva, nghttp3_arraylen(nva), &dr);
-
-  CU_ASSERT(0 == rv);
+  nghttp3_buf_init(&ebuf);
 
-  for (;;) {
-    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
-                                         nghttp3_arraylen(vec));
+  nghttp3_qpack_encoder_init(&qenc, settings.qpack_max_dtable_capacity, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&qenc,
+                                                settings.qpack_blocked_streams);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(
+      &qenc, settings.qpack_max_dtable_capacity);
 
-    CU_ASSERT(sveccnt >= 0);
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
+  nghttp3_conn_bind_qpack_streams(conn, 2, 6);
 
-    if (sveccnt <= 0) {
-      break;
-    }
+  fr.hd.type = NGHTTP3_FRAME_HEADERS;
+  fr.headers.nva = (nghttp3_nv *)resnv;
+  fr.headers.nvlen = nghttp3_arraylen(resnv);
 
-    rv = nghttp3_conn_add_write_offset(conn, stream_id, 1);
+  for (stream_id = 0; stream_id < 8; stream_id += 4) {
+    rv = nghttp3_conn_submit_request(conn, stream_id, reqnv,
+                                     nghttp3_arraylen(reqnv), NULL, NULL);
 
     CU_ASSERT(0 == rv);
-  }
-
-  nghttp3_conn_del(conn);
-}
-
-void test_nghttp3_conn_recv_uni(void) {
-  const nghttp3_mem *mem = nghttp3_mem_default();
-  nghttp3_conn *conn;
-  nghttp3_callbacks callbacks;
-  nghttp3_settings settings;
-  nghttp3_ssize nread;
-  uint8_t buf[256];
 
-  memset(&callbacks, 0, sizeof(callbacks));
-  nghttp3_settings_default(&settings);
+    /* HEADERS refers to the dynamic table, and the following DATA is
+       buffered until the stream is unblocked. */
+    nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+    nghttp3_write_frame_qpack_dyn(&buf, &ebuf, &qenc, stream_id, &fr);
+    headerslen = nghttp3_buf_len(&buf);
+    nghttp3_write_frame_data(&buf, 60);
 
-  /* 0 length unidirectional stream must be ignored */
-  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
+    sconsumed = nghttp3_conn_read_stream(
+        conn, stream_id, buf.pos, nghttp3_buf_len(&buf), /* fin = */ 0);
 
-  nread = nghttp3_conn_read_stream(conn, 3, NULL, 0, /* fin = */ 1);
+    if (stream_id == 0) {
+      CU_ASSERT(sconsumed > 0);
+      CU_ASSERT(sconsumed < (nghttp3_ssize)headerslen);
 
-  CU_ASSERT(0 == nread);
-  CU_ASSERT(NULL == nghttp3_conn_find_stream(conn, 3));
+      stream = nghttp3_conn_find_stream(conn, 0);
 
-  nghttp3_conn_del(conn);
+      CU_ASSERT(stream->flags & NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED);
+      CU_ASSERT(nghttp3_buf_len(&buf) - (size_t)sconsumed ==
+                conn->rx.blocked_datalen);
+      CU_ASSERT(conn->rx.blocked_datalen ==
+                nghttp3_stream_get_buffered_datalen(stream));
+      /* A short tail is packed into a small chunk. */
+      CU_ASSERT(NGHTTP3_STREAM_MIN_CHUNK_SIZE ==
+                nghttp3_buf_cap(nghttp3_ringbuf_get(&stream->inq, 0)));
+    } else {
+      /* The total amount of buffered data exceeds the limit. */
+      CU_ASSERT(NGHTTP3_ERR_H3_EXCESSIVE_LOAD == sconsumed);
+    }
+  }
 
-  /* 0 length unidirectional stream; first get 0 length without fin,
-     and then get 0 length with fin. */
-  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
+  /* Unblocking stream releases its buffered data. */
+  nghttp3_buf_reset(&buf);
+  buf.last = nghttp3_put_varint(buf.last, NGHTTP3_STREAM_TYPE_QPACK_ENCODER);
 
-  nread = nghttp3_conn_read_stream(conn, 3, NULL, 0, /* fin = */ 0);
+  sconsumed = nghttp3_conn_read_stream(conn, 7, buf.pos, nghttp3_buf_len(&buf),
+                                       /* fin = */ 0);
 
-  CU_ASSERT(0 == nread);
-  CU_ASSERT(NULL != nghttp3_conn_find_stream(conn, 3));
+  CU_ASSERT(sconsumed == (nghttp3_ssize)nghttp3_buf_len(&buf));
 
-  nread = nghttp3_conn_read_stream(conn, 3, NULL, 0, /* fin = */ 1);
+  sconsumed = nghttp3_conn_read_stream(conn, 7, ebuf.pos,
+                                       nghttp3_buf_len(&ebuf), /* fin = */ 0);
 
-  CU_ASSERT(0 == nread);
-  CU_ASSERT(NULL == nghttp3_conn_find_stream(conn, 3));
+  CU_ASSERT(sconsumed == (nghttp3_ssize)nghttp3_buf_len(&ebuf));
+  CU_ASSERT(0 == conn->rx.blocked_datalen);
+  CU_ASSERT(0 == nghttp3_ringbuf_len(&stream->inq));
 
   nghttp3_conn_del(conn);
+  nghttp3_qpack_encoder_free(&qenc);
+  nghttp3_buf_free(&ebuf, mem);
+}
 
-  /* Fin while reading stream header is treated as error. */
-  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
-
-  /* 4 bytes integer */
-  buf[0] = 0xc0;
-  nread = nghttp3_conn_read_stream(conn, 3, buf, 1, /* fin = */ 0);
+typedef struct {
+  size_t nretain;
+  size_t nrelease;
+} buf_ref_counter;
 
-  CU_ASSERT(1 == nread);
-  CU_ASSERT(NULL != nghttp3_conn_find_stream(conn, 3));
+static void count_retain_buf(nghttp3_conn *conn, void *buf_user_data,
+                             void *conn_user_data) {
+  (void)conn;
+  (void)buf_user_data;
 
-  nread = nghttp3_conn_read_stream(conn, 3, NULL, 0, /* fin = */ 1);
+  ++((buf_ref_counter *)conn_user_data)->nretain;
+}
 
-  CU_ASSERT(NGHTTP3_ERR_H3_GENERAL_PROTOCOL_ERROR == nread);
+static void count_release_buf(nghttp3_conn *conn, void *buf_user_data,
+                              void *conn_user_data) {
+  (void)conn;
+  (void)buf_user_data;
 
-  nghttp3_conn_del(conn);
+  ++((buf_ref_counter *)conn_user_data)->nrelease;
 }
 
-void test_nghttp3_conn_recv_goaway(void) {
+void test_nghttp3_conn_read_stream_ref(void) {
   const nghttp3_mem *mem = nghttp3_mem_default();
   nghttp3_conn *conn;
   nghttp3_callbacks callbacks;
   nghttp3_settings settings;
-  nghttp3_frame fr;
-  uint8_t rawbuf[1024];
-  nghttp3_buf buf;
-  nghttp3_ssize nconsumed;
-  const nghttp3_nv nva[] = {
+  nghttp3_qpack_encoder qenc;
+  int rv;
+  nghttp3_buf ebuf;
+  /* Each stream refers to its own buffer. */
+  uint8_t rawbuf[2][4096];
+  uint8_t databuf[256];
+  uint8_t typebuf[8];
+  nghttp3_buf buf, dbuf;
+  const nghttp3_nv reqnv[] = {
+      MAKE_NV(":authority", "localhost"),
+      MAKE_NV(":method", "GET"),
       MAKE_NV(":path", "/"),
-      MAKE_NV(":authority", "example.com"),
       MAKE_NV(":scheme", "https"),
-      MAKE_NV(":method", "GET"),
   };
-  int rv;
-  userdata ud;
+  const nghttp3_nv resnv[] = {
+      MAKE_NV(":status", "200"),
+      MAKE_NV("server", "nghttp3"),
+  };
+  nghttp3_frame fr;
+  nghttp3_ssize sconsumed;
+  nghttp3_stream *stream;
+  nghttp3_stream_inq_buf *ibuf;
+  buf_ref_counter counter;
+  int64_t stream_id;
 
   memset(&callbacks, 0, sizeof(callbacks));
-  callbacks.shutdown = conn_shutdown;
-  memset(&ud, 0, sizeof(ud));
+  callbacks.retain_buf = count_retain_buf;
+  callbacks.release_buf = count_release_buf;
   nghttp3_settings_default(&settings);
-  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+  settings.qpack_max_dtable_capacity = 4096;
+  settings.qpack_blocked_streams = 100;
 
-  /* Client receives GOAWAY */
-  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, &ud);
-  nghttp3_conn_bind_control_stream(conn, 2);
-  nghttp3_conn_bind_qpack_streams(conn, 6, 10);
+  nghttp3_buf_init(&ebuf);
 
-  buf.last = nghttp3_put_varint(buf.last, NGHTTP3_STREAM_TYPE_CONTROL);
+  nghttp3_qpack_encoder_init(&qenc, settings.qpack_max_dtable_capacity, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&qenc,
+                                                settings.qpack_blocked_streams);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(
+      &qenc, settings.qpack_max_dtable_capacity);
 
-  fr.hd.type = NGHTTP3_FRAME_SETTINGS;
-  fr.settings.niv = 0;
+  memset(&counter, 0, sizeof(counter));
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, &counter);
+  nghttp3_conn_bind_qpack_streams(conn, 2, 6);
+
+  fr.hd.type = NGHTTP3_FRAME_HEADERS;
+  fr.headers.nva = (nghttp3_nv *)resnv;
+  fr.headers.nvlen = nghttp3_arraylen(resnv);
+
+  for (stream_id = 0; stream_id < 8; stream_id += 4) {
+    rv = nghttp3_conn_submit_request(conn, stream_id, reqnv,
+                                     nghttp3_arraylen(reqnv), NULL, NULL);
+
+    CU_ASSERT(0 == rv);
+
+    nghttp3_buf_wrap_init(&buf, rawbuf[stream_id / 4], sizeof(rawbuf[0]));
+    nghttp3_write_frame_qpack_dyn(&buf, &ebuf, &qenc, stream_id, &fr);
+    nghttp3_write_frame_data(&buf, 60);
+
+    sconsumed = nghttp3_conn_read_stream_ref(
+        conn, stream_id, buf.pos, nghttp3_buf_len(&buf), /* fin = */ 0, &buf);
+
+    CU_ASSERT(sconsumed > 0);
+
+    /* The data following the blocked HEADERS is not copied. */
+    stream = nghttp3_conn_find_stream(conn, stream_id);
+    ibuf = nghttp3_ringbuf_get(&stream->inq, 0);
+
+    CU_ASSERT(1 == nghttp3_ringbuf_len(&stream->inq));
+    CU_ASSERT(NGHTTP3_BUF_TYPE_ALIEN == ibuf->type);
+    CU_ASSERT(&buf == ibuf->buf_user_data);
+    CU_ASSERT(buf.pos + sconsumed == ibuf->buf.pos);
+    CU_ASSERT(buf.last == ibuf->buf.last);
+  }
+
+  CU_ASSERT(2 == counter.nretain);
+  CU_ASSERT(0 == counter.nrelease);
+
+  /* Data which arrives while stream is blocked is also referenced. */
+  nghttp3_buf_wrap_init(&dbuf, databuf, sizeof(databuf));
+  nghttp3_write_frame_data(&dbuf, 10);
+
+  sconsumed = nghttp3_conn_read_stream_ref(
+      conn, 0, dbuf.pos, nghttp3_buf_len(&dbuf), /* fin = */ 0, &dbuf);
+
+  CU_ASSERT(0 == sconsumed);
+  CU_ASSERT(3 == counter.nretain);
+
+  stream = nghttp3_conn_find_stream(conn, 0);
+
+  CU_ASSERT(2 == nghttp3_ringbuf_len(&stream->inq));
+  CU_ASSERT(conn->rx.blocked_datalen ==
+            nghttp3_stream_get_buffered_datalen(stream) +
+                nghttp3_stream_get_buffered_datalen(
+                    nghttp3_conn_find_stream(conn, 4)));
+
+  /* Unblocking streams releases all references. */
+  nghttp3_buf_wrap_init(&buf, typebuf, sizeof(typebuf));
+  buf.last = nghttp3_put_varint(buf.last, NGHTTP3_STREAM_TYPE_QPACK_ENCODER);
+
+  sconsumed = nghttp3_conn_read_stream(conn, 7, buf.pos, nghttp3_buf_len(&buf),
+                                       /* fin = */ 0);
+
+  CU_ASSERT(sconsumed == (nghttp3_ssize)nghttp3_buf_len(&buf));
+
+  sconsumed = nghttp3_conn_read_stream(conn, 7, ebuf.pos,
+                                       nghttp3_buf_len(&ebuf), /* fin = */ 0);
+
+  CU_ASSERT(sconsumed == (nghttp3_ssize)nghttp3_buf_len(&ebuf));
+  CU_ASSERT(3 == counter.nrelease);
+  CU_ASSERT(0 == conn->rx.blocked_datalen);
+  CU_ASSERT(0 == nghttp3_ringbuf_len(&stream->inq));
+
+  nghttp3_conn_del(conn);
+  nghttp3_qpack_encoder_free(&qenc);
+  nghttp3_buf_free(&ebuf, mem);
+
+  /* Deleting connection releases the references of blocked
+     stream. */
+  nghttp3_buf_init(&ebuf);
+
+  nghttp3_qpack_encoder_init(&qenc, settings.qpack_max_dtable_capacity, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&qenc,
+                                                settings.qpack_blocked_streams);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(
+      &qenc, settings.qpack_max_dtable_capacity);
+
+  memset(&counter, 0, sizeof(counter));
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, &counter);
+  nghttp3_conn_bind_qpack_streams(conn, 2, 6);
+
+  rv = nghttp3_conn_submit_request(conn, 0, reqnv, nghttp3_arraylen(reqnv),
+                                   NULL, NULL);
+
+  CU_ASSERT(0 == rv);
+
+  nghttp3_buf_wrap_init(&buf, rawbuf[0], sizeof(rawbuf[0]));
+  nghttp3_write_frame_qpack_dyn(&buf, &ebuf, &qenc, 0, &fr);
+  nghttp3_write_frame_data(&buf, 60);
+
+  sconsumed = nghttp3_conn_read_stream_ref(conn, 0, buf.pos,
+                                           nghttp3_buf_len(&buf),
+                                           /* fin = */ 0, &buf);
+
+  CU_ASSERT(sconsumed > 0);
+  CU_ASSERT(1 == counter.nretain);
+  CU_ASSERT(0 == counter.nrelease);
+
+  nghttp3_conn_del(conn);
+
+  CU_ASSERT(1 == counter.nrelease);
+
+  nghttp3_qpack_encoder_free(&qenc);
+  nghttp3_buf_free(&ebuf, mem);
+
+  /* Without the callbacks, the data is copied. */
+  nghttp3_buf_init(&ebuf);
+
+  nghttp3_qpack_encoder_init(&qenc, settings.qpack_max_dtable_capacity, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&qenc,
+                                                settings.qpack_blocked_streams);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(
+      &qenc, settings.qpack_max_dtable_capacity);
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  memset(&counter, 0, sizeof(counter));
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, &counter);
+  nghttp3_conn_bind_qpack_streams(conn, 2, 6);
+
+  rv = nghttp3_conn_submit_request(conn, 0, reqnv, nghttp3_arraylen(reqnv),
+                                   NULL, NULL);
+
+  CU_ASSERT(0 == rv);
+
+  nghttp3_buf_wrap_init(&buf, rawbuf[0], sizeof(rawbuf[0]));
+  nghttp3_write_frame_qpack_dyn(&buf, &ebuf, &qenc, 0, &fr);
+  nghttp3_write_frame_data(&buf, 60);
+
+  sconsumed = nghttp3_conn_read_stream_ref(conn, 0, buf.pos,
+                                           nghttp3_buf_len(&buf),
+                                           /* fin = */ 0, &buf);
+
+  CU_ASSERT(sconsumed > 0);
+
+  stream = nghttp3_conn_find_stream(conn, 0);
+  ibuf = nghttp3_ringbuf_get(&stream->inq, 0);
+
+  CU_ASSERT(NGHTTP3_BUF_TYPE_PRIVATE == ibuf->type);
+  CU_ASSERT(0 == counter.nretain);
+
+  nghttp3_conn_del(conn);
+  nghttp3_qpack_encoder_free(&qenc);
+  nghttp3_buf_free(&ebuf, mem);
+}
+
+static void release_vec(nghttp3_conn *conn, int64_t stream_id,
+                        void *vec_user_data, void *user_data,
+                        void *stream_user_data) {
+  userdata *ud = user_data;
+
+  (void)conn;
+  (void)stream_id;
+  (void)stream_user_data;
+
+  ++ud->release_vec_cb.ncalled;
+  ud->release_vec_cb.vec_user_data = vec_user_data;
+}
+
+static nghttp3_ssize ref_read_data(nghttp3_conn *conn, int64_t stream_id,
+                                   nghttp3_ref_vec *rvec, size_t rveccnt,
+                                   uint32_t *pflags, void *user_data,
+                                   void *stream_user_data) {
+  userdata *ud = user_data;
+  size_t i;
+
+  (void)conn;
+  (void)stream_id;
+  (void)rveccnt;
+  (void)stream_user_data;
+
+  /* The second vector is empty. */
+  for (i = 0; i < 3; ++i) {
+    rvec[i].base = nulldata;
+    rvec[i].len = i == 1 ? 0 : 600;
+    rvec[i].release = release_vec;
+    rvec[i].user_data = &ud->release_vec_cb.tags[i];
+  }
+
+  *pflags = NGHTTP3_DATA_FLAG_EOF;
+
+  return 3;
+}
+
+void test_nghttp3_conn_read_data_ref(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":status", "200"),
+  };
+  const nghttp3_nv reqnva[] = {
+      MAKE_NV(":path", "/"),
+      MAKE_NV(":authority", "localhost"),
+      MAKE_NV(":method", "POST"),
+      MAKE_NV(":scheme", "https"),
+  };
+  nghttp3_stream *stream;
+  int rv;
+  nghttp3_vec vec[256];
+  int fin;
+  int64_t stream_id;
+  nghttp3_ssize sveccnt;
+  nghttp3_data_ref_reader rdr;
+  userdata ud;
+  size_t len, hdlen, i;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.acked_stream_data = acked_stream_data;
+  nghttp3_settings_default(&settings);
+  rdr.read_data_ref = ref_read_data;
+
+  memset(&ud, 0, sizeof(ud));
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+  conn->remote.bidi.max_client_streams = 1;
+  nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+  nghttp3_conn_create_stream(conn, &stream, 0);
+
+  rv = nghttp3_conn_submit_response_ref(conn, 0, nva, nghttp3_arraylen(nva),
+                                        &rdr);
+
+  CU_ASSERT(0 == rv);
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    CU_ASSERT(sveccnt >= 0);
+
+    if (sveccnt <= 0) {
+      break;
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+        conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    CU_ASSERT(0 == rv);
+
+    if (stream_id == 0) {
+      CU_ASSERT(fin);
+      break;
+    }
+  }
+
+  /* The empty vector is released immediately. */
+  CU_ASSERT(1 == ud.release_vec_cb.ncalled);
+  CU_ASSERT(&ud.release_vec_cb.tags[1] == ud.release_vec_cb.vec_user_data);
+
+  len = (size_t)nghttp3_vec_len(vec, (size_t)sveccnt);
+  hdlen = len - 1200;
+
+  /* Each vector is released when all of its bytes are acknowledged.
+     acked_stream_data is not called for them. */
+  for (i = 0; i < len; ++i) {
+    rv = nghttp3_conn_add_ack_offset(conn, 0, 1);
+
+    CU_ASSERT(0 == rv);
+
+    if (i + 1 < hdlen + 600) {
+      CU_ASSERT(1 == ud.release_vec_cb.ncalled);
+    } else if (i + 1 < len) {
+      CU_ASSERT(2 == ud.release_vec_cb.ncalled);
+      CU_ASSERT(&ud.release_vec_cb.tags[0] ==
+                ud.release_vec_cb.vec_user_data);
+    }
+  }
+
+  CU_ASSERT(3 == ud.release_vec_cb.ncalled);
+  CU_ASSERT(&ud.release_vec_cb.tags[2] == ud.release_vec_cb.vec_user_data);
+  CU_ASSERT(0 == ud.ack.acc);
+
+  nghttp3_conn_del(conn);
+
+  /* Closing stream releases the vectors which are not acknowledged
+     yet. */
+  memset(&ud, 0, sizeof(ud));
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+  conn->remote.bidi.max_client_streams = 1;
+  nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+  nghttp3_conn_create_stream(conn, &stream, 0);
+
+  rv = nghttp3_conn_submit_response_ref(conn, 0, nva, nghttp3_arraylen(nva),
+                                        &rdr);
+
+  CU_ASSERT(0 == rv);
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    CU_ASSERT(sveccnt >= 0);
+
+    if (sveccnt <= 0) {
+      break;
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+        conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    CU_ASSERT(0 == rv);
+
+    if (stream_id == 0) {
+      break;
+    }
+  }
+
+  CU_ASSERT(1 == ud.release_vec_cb.ncalled);
+
+  rv = nghttp3_conn_close_stream(conn, 0, NGHTTP3_H3_NO_ERROR);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(3 == ud.release_vec_cb.ncalled);
+
+  nghttp3_conn_del(conn);
+
+  /* Client sends request body. */
+  memset(&ud, 0, sizeof(ud));
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, &ud);
+  nghttp3_conn_bind_qpack_streams(conn, 6, 10);
+
+  rv = nghttp3_conn_submit_request_ref(conn, 0, reqnva,
+                                       nghttp3_arraylen(reqnva), &rdr, NULL);
+
+  CU_ASSERT(0 == rv);
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    CU_ASSERT(sveccnt >= 0);
+
+    if (sveccnt <= 0) {
+      break;
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+        conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    CU_ASSERT(0 == rv);
+
+    if (stream_id == 0) {
+      CU_ASSERT(fin);
+      break;
+    }
+  }
+
+  CU_ASSERT(1 == ud.release_vec_cb.ncalled);
+
+  rv = nghttp3_conn_add_ack_offset(
+      conn, 0, (uint64_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(3 == ud.release_vec_cb.ncalled);
+  CU_ASSERT(0 == ud.ack.acc);
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_submit_response_file(void) {
+#ifdef HAVE_PREAD
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":status", "200"),
+  };
+  nghttp3_stream *stream;
+  int rv;
+  nghttp3_vec vec[256];
+  int fin;
+  int64_t stream_id;
+  nghttp3_ssize sveccnt;
+  FILE *fp;
+  int fd;
+  uint8_t *data, *out;
+  size_t datalen = 150000, outlen = 0, len, i;
+  int64_t type, flen;
+  size_t n;
+
+  data = malloc(datalen);
+  out = malloc(datalen + 4096);
+
+  for (i = 0; i < datalen; ++i) {
+    data[i] = (uint8_t)(i * 7);
+  }
+
+  fp = tmpfile();
+
+  CU_ASSERT(NULL != fp);
+  CU_ASSERT(datalen == fwrite(data, 1, datalen, fp));
+
+  fflush(fp);
+  fd = fileno(fp);
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  nghttp3_settings_default(&settings);
+
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, NULL);
+  conn->remote.bidi.max_client_streams = 1;
+  nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+  nghttp3_conn_create_stream(conn, &stream, 0);
+
+  CU_ASSERT(NGHTTP3_ERR_INVALID_ARGUMENT ==
+            nghttp3_conn_submit_response_file(
+                conn, 0, nva, nghttp3_arraylen(nva), fd, -1, datalen - 10));
+  CU_ASSERT(NGHTTP3_ERR_INVALID_ARGUMENT ==
+            nghttp3_conn_submit_response_file(conn, 0, nva,
+                                              nghttp3_arraylen(nva), fd,
+                                              INT64_MAX - 9, 10));
+
+  /* Serve the file except for the first and the last 5 bytes. */
+  rv = nghttp3_conn_submit_response_file(conn, 0, nva, nghttp3_arraylen(nva),
+                                         fd, 5, datalen - 10);
+
+  CU_ASSERT(0 == rv);
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    CU_ASSERT(sveccnt >= 0);
+
+    if (sveccnt <= 0) {
+      break;
+    }
+
+    len = (size_t)nghttp3_vec_len(vec, (size_t)sveccnt);
+
+    if (stream_id == 0) {
+      for (i = 0; i < (size_t)sveccnt; ++i) {
+        memcpy(out + outlen, vec[i].base, vec[i].len);
+        outlen += vec[i].len;
+      }
+    }
+
+    rv = nghttp3_conn_add_write_offset(conn, stream_id, len);
+
+    CU_ASSERT(0 == rv);
+
+    if (stream_id == 0 && fin) {
+      break;
+    }
+  }
+
+  CU_ASSERT(fin);
+
+  /* Skip HEADERS frame, and strip DATA frame headers. */
+  len = 0;
+
+  for (i = 0; i < outlen;) {
+    type = nghttp3_get_varint(&n, out + i);
+
+    CU_ASSERT((i == 0 ? NGHTTP3_FRAME_HEADERS : NGHTTP3_FRAME_DATA) == type);
+
+    i += n;
+    flen = nghttp3_get_varint(&n, out + i);
+    i += n;
+
+    if (type == NGHTTP3_FRAME_DATA) {
+      CU_ASSERT(0 == memcmp(data + 5 + len, out + i, (size_t)flen));
+
+      len += (size_t)flen;
+    }
+
+    i += (size_t)flen;
+  }
+
+  CU_ASSERT(datalen - 10 == len);
+
+  /* Acknowledging everything frees all segments. */
+  rv = nghttp3_conn_add_ack_offset(conn, 0, outlen);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(0 == nghttp3_ringbuf_len(&stream->outq));
+  CU_ASSERT(0 == nghttp3_ringbuf_len(&stream->outq_refs));
+
+  nghttp3_conn_del(conn);
+
+  /* The file ends prematurely. */
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, NULL);
+  conn->remote.bidi.max_client_streams = 1;
+  nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+  nghttp3_conn_create_stream(conn, &stream, 0);
+
+  rv = nghttp3_conn_submit_response_file(conn, 0, nva, nghttp3_arraylen(nva),
+                                         fd, 100000, datalen);
+
+  CU_ASSERT(0 == rv);
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+    if (sveccnt <= 0) {
+      break;
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+        conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    CU_ASSERT(0 == rv);
+  }
+
+  CU_ASSERT(NGHTTP3_ERR_CALLBACK_FAILURE == sveccnt);
+
+  nghttp3_conn_del(conn);
+
+  fclose(fp);
+  free(out);
+  free(data);
+#endif /* HAVE_PREAD */
+}
+
+static void check_encoded_headers(const uint8_t *out, size_t outlen,
+                                  const nghttp3_nv *nva, size_t nvlen) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_decoder *dec;
+  nghttp3_qpack_stream_context sctx;
+  nghttp3_qpack_nv qnv;
+  const nghttp3_nv *nv;
+  uint8_t flags;
+  int64_t type, flen;
+  size_t n, i = 0;
+  nghttp3_ssize nread;
+
+  type = nghttp3_get_varint(&n, out);
+  out += n;
+  flen = nghttp3_get_varint(&n, out);
+  out += n;
+
+  CU_ASSERT(NGHTTP3_FRAME_HEADERS == type);
+  CU_ASSERT(outlen == (size_t)flen + nghttp3_put_varintlen(type) +
+                          nghttp3_put_varintlen(flen));
+
+  /* The field section is decodable without dynamic table. */
+  nghttp3_qpack_decoder_new(&dec, 0, 0, mem);
+  nghttp3_qpack_stream_context_init(&sctx, 0, mem);
+
+  for (; flen;) {
+    nread = nghttp3_qpack_decoder_read_request(dec, &sctx, &qnv, &flags, out,
+                                               (size_t)flen, 1);
+
+    CU_ASSERT(nread >= 0);
+
+    if (nread < 0) {
+      break;
+    }
+
+    out += nread;
+    flen -= nread;
+
+    if (flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT) {
+      nv = &nva[i++];
+
+      CU_ASSERT(nv->namelen == qnv.name->len);
+      CU_ASSERT(0 == memcmp(nv->name, qnv.name->base, nv->namelen));
+      CU_ASSERT(nv->valuelen == qnv.value->len);
+      CU_ASSERT(0 == memcmp(nv->value, qnv.value->base, nv->valuelen));
+      CU_ASSERT((nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) ==
+                (qnv.flags & NGHTTP3_NV_FLAG_NEVER_INDEX));
+
+      nghttp3_rcbuf_decref(qnv.name);
+      nghttp3_rcbuf_decref(qnv.value);
+    }
+
+    if (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) {
+      break;
+    }
+  }
+
+  CU_ASSERT(0 == flen);
+  CU_ASSERT(i == nvlen);
+
+  nghttp3_qpack_stream_context_free(&sctx);
+  nghttp3_qpack_decoder_del(dec);
+}
+
+void test_nghttp3_conn_submit_response_encoded(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn[2];
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  uint8_t large[200];
+  nghttp3_nv nva[] = {
+      MAKE_NV(":status", "200"),
+      MAKE_NV("content-type", "text/html; charset=utf-8"),
+      MAKE_NV("cache-control", "max-age=86400"),
+      MAKE_NV("x-secret", "nghttp3"),
+      MAKE_NV("x-large", ""),
+  };
+  nghttp3_encoded_field_section *small_efs, *large_efs;
+  nghttp3_stream *stream;
+  int rv;
+  nghttp3_vec vec[256];
+  int fin;
+  int64_t stream_id;
+  nghttp3_ssize sveccnt;
+  uint8_t out[3][1024];
+  size_t outlen[3] = {0};
+  size_t len, i, j, k;
+
+  memset(large, 'a', sizeof(large));
+  nva[3].flags = NGHTTP3_NV_FLAG_NEVER_INDEX;
+  nva[4].value = large;
+  nva[4].valuelen = sizeof(large);
+
+  /* NULL memory allocator falls back to nghttp3_mem_default(). */
+  rv = nghttp3_encoded_field_section_new(&small_efs, nva, 4, NULL);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(nghttp3_mem_default() == small_efs->mem);
+  CU_ASSERT(small_efs->len <= 128);
+
+  rv = nghttp3_encoded_field_section_new(&large_efs, nva,
+                                         nghttp3_arraylen(nva), mem);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(large_efs->len > 128);
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  nghttp3_settings_default(&settings);
+  settings.qpack_max_dtable_capacity = 4096;
+
+  /* The same field sections are sent on the streams of 2 connections
+     whose encoders have dynamic table enabled. */
+  for (i = 0; i < 2; ++i) {
+    nghttp3_conn_server_new(&conn[i], &callbacks, &settings, mem, NULL);
+    conn[i]->remote.bidi.max_client_streams = 2;
+    nghttp3_conn_bind_qpack_streams(conn[i], 7, 11);
+    nghttp3_qpack_encoder_set_max_dtable_capacity(&conn[i]->qenc, 4096);
+
+    nghttp3_conn_create_stream(conn[i], &stream, 0);
+
+    rv = nghttp3_conn_submit_response_encoded(conn[i], 0, large_efs, NULL);
+
+    CU_ASSERT(0 == rv);
+  }
+
+  nghttp3_conn_create_stream(conn[0], &stream, 4);
+
+  rv = nghttp3_conn_submit_response_encoded(conn[0], 4, small_efs, NULL);
+
+  CU_ASSERT(0 == rv);
+
+  CU_ASSERT(NGHTTP3_ERR_STREAM_NOT_FOUND ==
+            nghttp3_conn_submit_response_encoded(conn[0], 8, small_efs, NULL));
+
+  CU_ASSERT(3 == large_efs->ref);
+  CU_ASSERT(2 == small_efs->ref);
+
+  nghttp3_encoded_field_section_decref(small_efs);
+  nghttp3_encoded_field_section_decref(large_efs);
+  nghttp3_encoded_field_section_decref(NULL);
+
+  for (i = 0; i < 2; ++i) {
+    for (;;) {
+      sveccnt = nghttp3_conn_writev_stream(conn[i], &stream_id, &fin, vec,
+                                           nghttp3_arraylen(vec));
+
+      CU_ASSERT(sveccnt >= 0);
+
+      if (sveccnt <= 0) {
+        break;
+      }
+
+      len = (size_t)nghttp3_vec_len(vec, (size_t)sveccnt);
+
+      if (nghttp3_client_stream_bidi(stream_id)) {
+        k = i == 0 ? (size_t)(stream_id / 4) : 2;
+
+        for (j = 0; j < (size_t)sveccnt; ++j) {
+          memcpy(out[k] + outlen[k], vec[j].base, vec[j].len);
+          outlen[k] += vec[j].len;
+        }
+      } else if (stream_id == 11) {
+        /* Nothing is inserted into dynamic table. */
+        CU_ASSERT(1 == len);
+      }
+
+      rv = nghttp3_conn_add_write_offset(conn[i], stream_id, len);
+
+      CU_ASSERT(0 == rv);
+    }
+  }
+
+  check_encoded_headers(out[0], outlen[0], nva, nghttp3_arraylen(nva));
+  check_encoded_headers(out[1], outlen[1], nva, 4);
+  check_encoded_headers(out[2], outlen[2], nva, nghttp3_arraylen(nva));
+
+  /* Small field section is copied, and it is freed right away. */
+  CU_ASSERT(0 == nghttp3_ringbuf_len(&nghttp3_conn_find_stream(conn[0], 4)
+                                          ->outq_refs));
+
+  /* Large field section is referenced until it is acknowledged. */
+  stream = nghttp3_conn_find_stream(conn[0], 0);
+
+  CU_ASSERT(1 == nghttp3_ringbuf_len(&stream->outq_refs));
+  CU_ASSERT(2 == large_efs->ref);
+
+  rv = nghttp3_conn_add_ack_offset(conn[0], 0, outlen[0]);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(0 == nghttp3_ringbuf_len(&stream->outq_refs));
+  CU_ASSERT(1 == large_efs->ref);
+
+  /* Unacknowledged field section is released when connection is
+     deleted. */
+  nghttp3_conn_del(conn[1]);
+  nghttp3_conn_del(conn[0]);
+}
+
+void test_nghttp3_conn_eager_header_encoding(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  uint8_t value[] = "text/plain";
+  const nghttp3_nv expected[] = {
+      MAKE_NV(":status", "200"),
+      MAKE_NV("content-type", "text/plain"),
+  };
+  nghttp3_nv nva[] = {
+      MAKE_NV(":status", "200"),
+      MAKE_NV("content-type", ""),
+  };
+  nghttp3_stream *stream;
+  int rv;
+  nghttp3_vec vec[256];
+  int fin;
+  int64_t stream_id;
+  nghttp3_ssize sveccnt;
+  nghttp3_data_reader dr = {step_read_data};
+  uint8_t out[1024];
+  size_t outlen = 0, i;
+  userdata ud;
+
+  nva[1].value = value;
+  nva[1].valuelen = sizeof(value) - 1;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  nghttp3_settings_default(&settings);
+  settings.eager_header_encoding = 1;
+
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+  conn->remote.bidi.max_client_streams = 3;
+  nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+  /* HTTP fields are queued until SETTINGS frame is received. */
+  nghttp3_conn_create_stream(conn, &stream, 8);
+
+  rv = nghttp3_conn_submit_response(conn, 8, nva, nghttp3_arraylen(nva),
+                                    NULL);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(1 == nghttp3_ringbuf_len(&stream->frq));
+
+  conn->flags |= NGHTTP3_CONN_FLAG_SETTINGS_RECVED;
+
+  nghttp3_conn_create_stream(conn, &stream, 0);
+
+  rv = nghttp3_conn_submit_response(conn, 0, nva, nghttp3_arraylen(nva),
+                                    NULL);
+
+  CU_ASSERT(0 == rv);
+
+  /* HEADERS frame is encoded without being queued, and the fields
+     are no longer referenced. */
+  CU_ASSERT(0 == nghttp3_ringbuf_len(&stream->frq));
+  CU_ASSERT(nghttp3_ringbuf_len(&stream->outq) > 0);
+  CU_ASSERT(nghttp3_stream_require_schedule(stream));
+
+  memset(value, 0, sizeof(value));
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    CU_ASSERT(sveccnt >= 0);
+
+    if (sveccnt <= 0) {
+      break;
+    }
+
+    if (stream_id == 0) {
+      for (i = 0; i < (size_t)sveccnt; ++i) {
+        memcpy(out + outlen, vec[i].base, vec[i].len);
+        outlen += vec[i].len;
+      }
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+        conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    CU_ASSERT(0 == rv);
+
+    if (stream_id == 0 && fin) {
+      break;
+    }
+  }
+
+  CU_ASSERT(fin);
+
+  check_encoded_headers(out, outlen, expected, nghttp3_arraylen(expected));
+
+  /* Trailers are queued behind the pending DATA frame. */
+  nghttp3_conn_create_stream(conn, &stream, 4);
+
+  ud.data.left = 1000;
+  ud.data.step = 1000;
+
+  rv = nghttp3_conn_submit_response(conn, 4, nva, nghttp3_arraylen(nva), &dr);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(1 == nghttp3_ringbuf_len(&stream->frq));
+
+  rv = nghttp3_conn_submit_trailers(conn, 4, nva, 1);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(2 == nghttp3_ringbuf_len(&stream->frq));
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_submit_response_read_blocked(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":status", "200"),
+  };
+  nghttp3_stream *stream;
+  int rv;
+  nghttp3_vec vec[256];
+  int fin;
+  int64_t stream_id;
+  nghttp3_ssize sveccnt;
+  nghttp3_data_reader dr = {step_then_block_read_data};
+  userdata ud;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  nghttp3_settings_default(&settings);
+
+  /* Make sure that flushing serialized data while
+     NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED is set does not cause any
+     error */
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+  conn->remote.bidi.max_client_streams = 1;
+  nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+  nghttp3_conn_create_stream(conn, &stream, 0);
+
+  ud.data.left = 1000;
+  ud.data.step = 1000;
+  rv = nghttp3_conn_submit_response(conn, 0, nva, nghttp3_arraylen(nva), &dr);
+
+  CU_ASSERT(0 == rv);
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    CU_ASSERT(sveccnt >= 0);
+
+    if (sveccnt <= 0) {
+      break;
+    }
+
+    rv = nghttp3_conn_add_write_offset(conn, stream_id, 1);
+
+    CU_ASSERT(0 == rv);
+  }
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_drr_scheduler(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":status", "200"),
+  };
+  const int64_t expected[] = {8, 0, 4, 0, 4, 0, 4};
+  nghttp3_stream *stream;
+  nghttp3_pri pri;
+  int rv;
+  nghttp3_vec vec[256];
+  int fin;
+  int64_t stream_id;
+  nghttp3_ssize sveccnt;
+  nghttp3_data_reader dr = {step_read_data};
+  userdata ud;
+  size_t i = 0;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  nghttp3_settings_default(&settings);
+  settings.enable_drr_scheduler = 1;
+
+  /* Non-incremental stream goes first, and then incremental streams
+     take turns. */
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+  conn->remote.bidi.max_client_streams = 3;
+  nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+  pri.urgency = NGHTTP3_DEFAULT_URGENCY;
+  pri.inc = 1;
+
+  for (stream_id = 0; stream_id < 8; stream_id += 4) {
+    nghttp3_conn_create_stream(conn, &stream, stream_id);
+
+    rv = nghttp3_conn_set_server_stream_priority(conn, stream_id, &pri);
+
+    CU_ASSERT(0 == rv);
+  }
+
+  nghttp3_conn_create_stream(conn, &stream, 8);
+
+  ud.data.left = 100000;
+  ud.data.step = 1000;
+
+  for (stream_id = 0; stream_id < 8; stream_id += 4) {
+    rv = nghttp3_conn_submit_response(conn, stream_id, nva,
+                                      nghttp3_arraylen(nva), &dr);
+
+    CU_ASSERT(0 == rv);
+  }
+
+  rv = nghttp3_conn_submit_response(conn, 8, nva, nghttp3_arraylen(nva), NULL);
+
+  CU_ASSERT(0 == rv);
+
+  while (i < nghttp3_arraylen(expected)) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    CU_ASSERT(sveccnt > 0);
+
+    if (sveccnt <= 0) {
+      break;
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+        conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    CU_ASSERT(0 == rv);
+
+    if (!nghttp3_client_stream_bidi(stream_id)) {
+      continue;
+    }
+
+    CU_ASSERT(expected[i] == stream_id);
+
+    ++i;
+  }
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_writev_streams(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":status", "200"),
+  };
+  const int64_t expected[] = {3, 11, 7, 0, 4, 8};
+  nghttp3_stream *stream;
+  int rv;
+  nghttp3_vec vec[256];
+  nghttp3_vec *v;
+  nghttp3_stream_vec svec[16];
+  nghttp3_ssize nsvec;
+  int64_t stream_id;
+  const uint8_t *base;
+  nghttp3_data_reader dr = {step_read_data};
+  userdata ud;
+  size_t i;
+  uint8_t drr;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+
+  for (drr = 0; drr < 2; ++drr) {
+    nghttp3_settings_default(&settings);
+    settings.enable_drr_scheduler = drr;
+
+    nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+    conn->remote.bidi.max_client_streams = 3;
+    nghttp3_conn_bind_control_stream(conn, 3);
+    nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+    ud.data.left = 1000000;
+    ud.data.step = 1000;
+
+    for (stream_id = 0; stream_id < 12; stream_id += 4) {
+      nghttp3_conn_create_stream(conn, &stream, stream_id);
+
+      rv = nghttp3_conn_submit_response(conn, stream_id, nva,
+                                        nghttp3_arraylen(nva), &dr);
+
+      CU_ASSERT(0 == rv);
+    }
+
+    /* Each stream appears once, and the vectors are laid out
+       back to back. */
+    nsvec = nghttp3_conn_writev_streams(conn, svec, nghttp3_arraylen(svec),
+                                        vec, nghttp3_arraylen(vec), SIZE_MAX);
+
+    CU_ASSERT((nghttp3_ssize)nghttp3_arraylen(expected) == nsvec);
+
+    v = vec;
+
+    for (i = 0; i < (size_t)nsvec && i < nghttp3_arraylen(expected); ++i) {
+      CU_ASSERT(expected[i] == svec[i].stream_id);
+      CU_ASSERT(v == svec[i].vec);
+      CU_ASSERT(svec[i].veccnt > 0);
+      CU_ASSERT(nghttp3_vec_len(svec[i].vec, svec[i].veccnt) ==
+                svec[i].datalen);
+      CU_ASSERT(0 == svec[i].fin);
+
+      v += svec[i].veccnt;
+    }
+
+    /* Request streams are put back to the scheduler. */
+    for (stream_id = 0; stream_id < 12; stream_id += 4) {
+      stream = nghttp3_conn_find_stream(conn, stream_id);
+
+      CU_ASSERT(nghttp3_tnode_is_scheduled(&stream->node));
+      CU_ASSERT(NULL == stream->node.held_next);
+    }
+
+    CU_ASSERT(0 == nghttp3_conn_get_next_tx_stream(conn)->node.id);
+
+    rv = nghttp3_conn_add_write_offsets(conn, svec, (size_t)nsvec);
+
+    CU_ASSERT(0 == rv);
+
+    /* The data is truncated to the budget. */
+    nsvec = nghttp3_conn_writev_streams(conn, svec, nghttp3_arraylen(svec),
+                                        vec, nghttp3_arraylen(vec), 100);
+
+    CU_ASSERT(1 == nsvec);
+    CU_ASSERT(0 == svec[0].stream_id);
+    CU_ASSERT(100 == svec[0].datalen);
+    CU_ASSERT(100 == nghttp3_vec_len(svec[0].vec, svec[0].veccnt));
+    CU_ASSERT(0 == svec[0].fin);
+
+    base = svec[0].vec[0].base;
+
+    /* The number of records is limited by the output array.  The
+       data which have not been committed are returned again. */
+    nsvec = nghttp3_conn_writev_streams(conn, svec, 2, vec,
+                                        nghttp3_arraylen(vec), SIZE_MAX);
+
+    CU_ASSERT(2 == nsvec);
+    CU_ASSERT(0 == svec[0].stream_id);
+    CU_ASSERT(base == svec[0].vec[0].base);
+    CU_ASSERT(4 == svec[1].stream_id);
+
+    nghttp3_conn_del(conn);
+  }
+}
+
+void test_nghttp3_conn_recv_uni(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  nghttp3_ssize nread;
+  uint8_t buf[256];
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  nghttp3_settings_default(&settings);
+
+  /* 0 length unidirectional stream must be ignored */
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
+
+  nread = nghttp3_conn_read_stream(conn, 3, NULL, 0, /* fin = */ 1);
+
+  CU_ASSERT(0 == nread);
+  CU_ASSERT(NULL == nghttp3_conn_find_stream(conn, 3));
+
+  nghttp3_conn_del(conn);
+
+  /* 0 length unidirectional stream; first get 0 length without fin,
+     and then get 0 length with fin. */
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
+
+  nread = nghttp3_conn_read_stream(conn, 3, NULL, 0, /* fin = */ 0);
+
+  CU_ASSERT(0 == nread);
+  CU_ASSERT(NULL != nghttp3_conn_find_stream(conn, 3));
+
+  nread = nghttp3_conn_read_stream(conn, 3, NULL, 0, /* fin = */ 1);
+
+  CU_ASSERT(0 == nread);
+  CU_ASSERT(NULL == nghttp3_conn_find_stream(conn, 3));
+
+  nghttp3_conn_del(conn);
+
+  /* Fin while reading stream header is treated as error. */
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
+
+  /* 4 bytes integer */
+  buf[0] = 0xc0;
+  nread = nghttp3_conn_read_stream(conn, 3, buf, 1, /* fin = */ 0);
+
+  CU_ASSERT(1 == nread);
+  CU_ASSERT(NULL != nghttp3_conn_find_stream(conn, 3));
+
+  nread = nghttp3_conn_read_stream(conn, 3, NULL, 0, /* fin = */ 1);
+
+  CU_ASSERT(NGHTTP3_ERR_H3_GENERAL_PROTOCOL_ERROR == nread);
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_recv_goaway(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  nghttp3_frame fr;
+  uint8_t rawbuf[1024];
+  nghttp3_buf buf;
+  nghttp3_ssize nconsumed;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":path", "/"),
+      MAKE_NV(":authority", "example.com"),
+      MAKE_NV(":scheme", "https"),
+      MAKE_NV(":method", "GET"),
+  };
+  int rv;
+  userdata ud;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.shutdown = conn_shutdown;
+  memset(&ud, 0, sizeof(ud));
+  nghttp3_settings_default(&settings);
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+
+  /* Client receives GOAWAY */
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, &ud);
+  nghttp3_conn_bind_control_stream(conn, 2);
+  nghttp3_conn_bind_qpack_streams(conn, 6, 10);
+
+  buf.last = nghttp3_put_varint(buf.last, NGHTTP3_STREAM_TYPE_CONTROL);
+
+  fr.hd.type = NGHTTP3_FRAME_SETTINGS;
+  fr.settings.niv = 0;
 
   nghttp3_write_frame(&buf, &fr);
 
@@ -3506,81 +4888,315 @@ void test_nghttp3_conn_stream_data_overflow(void) {
   memset(&callbacks, 0, sizeof(callbacks));
   nghttp3_settings_default(&settings);
 
-  /* Specify NGHTTP3_MAX_VARINT + 1 bytes data in
-     nghttp3_read_data_callback. */
-  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
-  nghttp3_conn_bind_qpack_streams(conn, 6, 10);
+  /* Specify NGHTTP3_MAX_VARINT + 1 bytes data in
+     nghttp3_read_data_callback. */
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
+  nghttp3_conn_bind_qpack_streams(conn, 6, 10);
+
+  dr.read_data = stream_data_overflow_read_data;
+
+  /* QPACK decoder stream */
+  rv = nghttp3_conn_submit_request(conn, 0, nva, nghttp3_arraylen(nva), &dr,
+                                   NULL);
+
+  CU_ASSERT(0 == rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  CU_ASSERT(10 == stream_id);
+  CU_ASSERT(1 == sveccnt);
+
+  nghttp3_conn_add_write_offset(conn, 10, vec[0].len);
+
+  /* QPACK encoder stream */
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  CU_ASSERT(6 == stream_id);
+  CU_ASSERT(1 == sveccnt);
+
+  nghttp3_conn_add_write_offset(conn, 6, vec[0].len);
+
+  /* Write request stream */
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  CU_ASSERT(NGHTTP3_ERR_STREAM_DATA_OVERFLOW == sveccnt);
+
+  nghttp3_conn_del(conn);
+
+  /* nghttp3_stream_outq_add detects stream data overflow */
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
+  nghttp3_conn_bind_qpack_streams(conn, 6, 10);
+
+  dr.read_data = stream_data_almost_overflow_read_data;
+
+  /* QPACK decoder stream */
+  rv = nghttp3_conn_submit_request(conn, 0, nva, nghttp3_arraylen(nva), &dr,
+                                   NULL);
+
+  CU_ASSERT(0 == rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  CU_ASSERT(10 == stream_id);
+  CU_ASSERT(1 == sveccnt);
+
+  nghttp3_conn_add_write_offset(conn, 10, vec[0].len);
+
+  /* QPACK encoder stream */
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  CU_ASSERT(6 == stream_id);
+  CU_ASSERT(1 == sveccnt);
+
+  nghttp3_conn_add_write_offset(conn, 6, vec[0].len);
+
+  /* Write request stream */
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  CU_ASSERT(NGHTTP3_ERR_STREAM_DATA_OVERFLOW == sveccnt);
+
+  nghttp3_conn_del(conn);
+#endif /* SIZE_MAX > UINT32_MAX */
+}
+
+void test_nghttp3_conn_recv_header_section(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  nghttp3_frame_headers fr;
+  uint8_t rawbuf[1024];
+  nghttp3_buf buf;
+  nghttp3_ssize nconsumed;
+  nghttp3_qpack_encoder qenc;
+  userdata ud;
+  const nghttp3_nv reqnv[] = {
+      MAKE_NV(":path", "/"),
+      MAKE_NV(":method", "PUT"),
+      MAKE_NV(":authority", "localhost"),
+      MAKE_NV(":scheme", "https"),
+      MAKE_NV("x-token", "Q{Z}J|X"),
+  };
+  const nghttp3_nv trnv[] = {
+      MAKE_NV("x-trailer", "{|}"),
+  };
+  const char expected[] = ":path: /\n"
+                          ":method: PUT\n"
+                          ":authority: localhost\n"
+                          ":scheme: https\n"
+                          "x-token: Q{Z}J|X\n"
+                          "x-trailer: {|}\n";
+  /* 0 means that the whole stream data is given at once. */
+  const size_t chunklens[] = {1, 2, 7, 0};
+  size_t i, j, n, chunklen;
+  nghttp3_stream *stream;
+  int borrow;
+
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+  nghttp3_qpack_encoder_init(&qenc, 0, mem);
+
+  fr.hd.type = NGHTTP3_FRAME_HEADERS;
+  fr.nva = (nghttp3_nv *)reqnv;
+  fr.nvlen = nghttp3_arraylen(reqnv);
+
+  nghttp3_write_frame_qpack(&buf, &qenc, 0, (nghttp3_frame *)&fr);
+
+  fr.nva = (nghttp3_nv *)trnv;
+  fr.nvlen = nghttp3_arraylen(trnv);
+
+  nghttp3_write_frame_qpack(&buf, &qenc, 0, (nghttp3_frame *)&fr);
+
+  nghttp3_qpack_encoder_free(&qenc);
+
+  for (borrow = 0; borrow <= 1; ++borrow) {
+    for (j = 0; j < nghttp3_arraylen(chunklens); ++j) {
+      chunklen = chunklens[j] ? chunklens[j] : nghttp3_buf_len(&buf);
+      memset(&callbacks, 0, sizeof(callbacks));
+      nghttp3_settings_default(&settings);
+      memset(&ud, 0, sizeof(ud));
+
+      callbacks.recv_header = count_recv_header;
+      callbacks.recv_trailer = count_recv_header;
+      callbacks.recv_header_section = recv_header_section;
+      callbacks.recv_trailer_section = recv_header_section;
+      settings.qpack_borrow_literals = (uint8_t)borrow;
+
+      nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+
+      for (i = 0; i < nghttp3_buf_len(&buf); i += n) {
+        n = nghttp3_min(chunklen, nghttp3_buf_len(&buf) - i);
+        nconsumed = nghttp3_conn_read_stream(
+            conn, 0, buf.pos + i, n,
+            /* fin = */ i + n == nghttp3_buf_len(&buf));
+
+        CU_ASSERT((nghttp3_ssize)n == nconsumed);
+      }
+
+      CU_ASSERT(0 == ud.recv_header_cb.ncalled);
+      CU_ASSERT(2 == ud.recv_header_section_cb.ncalled);
+      CU_ASSERT(nghttp3_arraylen(reqnv) + nghttp3_arraylen(trnv) ==
+                ud.recv_header_section_cb.nvlen);
+      CU_ASSERT(sizeof(expected) - 1 == ud.recv_header_section_cb.buflen);
+      CU_ASSERT(0 == memcmp(expected, ud.recv_header_section_cb.buf,
+                            sizeof(expected) - 1));
+
+      /* The memory for the fields is kept for the next field
+         section. */
+      stream = nghttp3_conn_find_stream(conn, 0);
+
+      CU_ASSERT(0 == stream->rx.fields.nvlen);
+      CU_ASSERT(stream->rx.fields.nvcap >= nghttp3_arraylen(reqnv));
+      CU_ASSERT(NULL == stream->rx.fields.balloc.head);
+
+      /* Literals are borrowed only if they are not split across
+         chunks. */
+      if (chunklens[j] == 0) {
+        CU_ASSERT(borrow == (NULL != stream->rx.fields.balloc.unused));
+      }
+
+      nghttp3_conn_del(conn);
+    }
+  }
+}
+
+void test_nghttp3_conn_get_request_view(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  nghttp3_frame_headers fr;
+  uint8_t rawbuf[1024];
+  uint8_t input[1024];
+  nghttp3_buf buf, buf2;
+  nghttp3_ssize nconsumed;
+  nghttp3_qpack_encoder qenc;
+  nghttp3_request_view view;
+  const nghttp3_nv reqnv[] = {
+      MAKE_NV(":method", "POST"),
+      MAKE_NV(":path", "/~~?q=~"),
+      MAKE_NV(":authority", "example.com"),
+      MAKE_NV(":scheme", "https"),
+      MAKE_NV("content-length", "10"),
+      MAKE_NV("priority", "u=1, i"),
+      MAKE_NV("host", "localhost"),
+  };
+  const nghttp3_nv reqnv2[] = {
+      MAKE_NV(":method", "MKCOL"),
+      MAKE_NV(":path", "/~~"),
+      MAKE_NV(":scheme", "https"),
+      MAKE_NV("host", "localhost"),
+  };
+  size_t i;
+  int borrow;
+  int rv;
+
+  nghttp3_qpack_encoder_init(&qenc, 0, mem);
+
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf) / 2);
+
+  fr.hd.type = NGHTTP3_FRAME_HEADERS;
+  fr.nva = (nghttp3_nv *)reqnv;
+  fr.nvlen = nghttp3_arraylen(reqnv);
 
-  dr.read_data = stream_data_overflow_read_data;
+  nghttp3_write_frame_qpack(&buf, &qenc, 0, (nghttp3_frame *)&fr);
 
-  /* QPACK decoder stream */
-  rv = nghttp3_conn_submit_request(conn, 0, nva, nghttp3_arraylen(nva), &dr,
-                                   NULL);
+  nghttp3_buf_wrap_init(&buf2, rawbuf + sizeof(rawbuf) / 2,
+                        sizeof(rawbuf) / 2);
 
-  CU_ASSERT(0 == rv);
+  fr.nva = (nghttp3_nv *)reqnv2;
+  fr.nvlen = nghttp3_arraylen(reqnv2);
 
-  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
-                                       nghttp3_arraylen(vec));
+  nghttp3_write_frame_qpack(&buf2, &qenc, 4, (nghttp3_frame *)&fr);
 
-  CU_ASSERT(10 == stream_id);
-  CU_ASSERT(1 == sveccnt);
+  nghttp3_qpack_encoder_free(&qenc);
 
-  nghttp3_conn_add_write_offset(conn, 10, vec[0].len);
+  for (borrow = 0; borrow <= 1; ++borrow) {
+    memset(&callbacks, 0, sizeof(callbacks));
+    nghttp3_settings_default(&settings);
+    settings.qpack_borrow_literals = (uint8_t)borrow;
+    settings.enable_request_view = 1;
 
-  /* QPACK encoder stream */
-  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
-                                       nghttp3_arraylen(vec));
+    nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, NULL);
 
-  CU_ASSERT(6 == stream_id);
-  CU_ASSERT(1 == sveccnt);
+    memcpy(input, rawbuf, sizeof(rawbuf));
 
-  nghttp3_conn_add_write_offset(conn, 6, vec[0].len);
+    /* Give the first request 1 byte at a time, so that literals are
+       not borrowed from the input. */
+    for (i = 0; i < nghttp3_buf_len(&buf); ++i) {
+      nconsumed = nghttp3_conn_read_stream(conn, 0, input + i, 1,
+                                           /* fin = */ 0);
 
-  /* Write request stream */
-  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
-                                       nghttp3_arraylen(vec));
+      CU_ASSERT(1 == nconsumed);
+    }
 
-  CU_ASSERT(NGHTTP3_ERR_STREAM_DATA_OVERFLOW == sveccnt);
+    nconsumed = nghttp3_conn_read_stream(
+        conn, 4, input + sizeof(input) / 2, nghttp3_buf_len(&buf2),
+        /* fin = */ 0);
 
-  nghttp3_conn_del(conn);
+    CU_ASSERT((nghttp3_ssize)nghttp3_buf_len(&buf2) == nconsumed);
 
-  /* nghttp3_stream_outq_add detects stream data overflow */
-  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, NULL);
-  nghttp3_conn_bind_qpack_streams(conn, 6, 10);
+    /* Overwrite the input to make sure that the view does not refer
+       to it. */
+    memset(input, 0, sizeof(input));
 
-  dr.read_data = stream_data_almost_overflow_read_data;
+    rv = nghttp3_conn_get_request_view(conn, &view, 0);
 
-  /* QPACK decoder stream */
-  rv = nghttp3_conn_submit_request(conn, 0, nva, nghttp3_arraylen(nva), &dr,
-                                   NULL);
+    CU_ASSERT(0 == rv);
+    CU_ASSERT(NGHTTP3_METHOD_POST == view.method);
+    CU_ASSERT(4 == view.method_name.len);
+    CU_ASSERT(0 == memcmp("POST", view.method_name.base, 4));
+    CU_ASSERT(7 == view.path.len);
+    CU_ASSERT(0 == memcmp("/~~?q=~", view.path.base, 7));
+    CU_ASSERT(11 == view.authority.len);
+    CU_ASSERT(0 == memcmp("example.com", view.authority.base, 11));
+    CU_ASSERT(5 == view.scheme.len);
+    CU_ASSERT(0 == memcmp("https", view.scheme.base, 5));
+    CU_ASSERT(10 == view.content_length);
+    CU_ASSERT(1 == view.pri.urgency);
+    CU_ASSERT(1 == view.pri.inc);
+
+    rv = nghttp3_conn_get_request_view(conn, &view, 4);
 
-  CU_ASSERT(0 == rv);
+    CU_ASSERT(0 == rv);
+    CU_ASSERT(NGHTTP3_METHOD_UNKNOWN == view.method);
+    CU_ASSERT(5 == view.method_name.len);
+    CU_ASSERT(0 == memcmp("MKCOL", view.method_name.base, 5));
+    CU_ASSERT(3 == view.path.len);
+    CU_ASSERT(0 == memcmp("/~~", view.path.base, 3));
+    CU_ASSERT(9 == view.authority.len);
+    CU_ASSERT(0 == memcmp("localhost", view.authority.base, 9));
+    CU_ASSERT(-1 == view.content_length);
+    CU_ASSERT(NGHTTP3_DEFAULT_URGENCY == view.pri.urgency);
+    CU_ASSERT(0 == view.pri.inc);
 
-  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
-                                       nghttp3_arraylen(vec));
+    rv = nghttp3_conn_get_request_view(conn, &view, 8);
 
-  CU_ASSERT(10 == stream_id);
-  CU_ASSERT(1 == sveccnt);
+    CU_ASSERT(NGHTTP3_ERR_STREAM_NOT_FOUND == rv);
 
-  nghttp3_conn_add_write_offset(conn, 10, vec[0].len);
+    rv = nghttp3_conn_get_request_view(conn, &view, 2);
 
-  /* QPACK encoder stream */
-  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
-                                       nghttp3_arraylen(vec));
+    CU_ASSERT(NGHTTP3_ERR_INVALID_ARGUMENT == rv);
 
-  CU_ASSERT(6 == stream_id);
-  CU_ASSERT(1 == sveccnt);
+    nghttp3_conn_del(conn);
+  }
 
-  nghttp3_conn_add_write_offset(conn, 6, vec[0].len);
+  /* Request view is not enabled */
+  memset(&callbacks, 0, sizeof(callbacks));
+  nghttp3_settings_default(&settings);
 
-  /* Write request stream */
-  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
-                                       nghttp3_arraylen(vec));
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, NULL);
 
-  CU_ASSERT(NGHTTP3_ERR_STREAM_DATA_OVERFLOW == sveccnt);
+  rv = nghttp3_conn_get_request_view(conn, &view, 0);
+
+  CU_ASSERT(NGHTTP3_ERR_INVALID_STATE == rv);
 
   nghttp3_conn_del(conn);
-#endif /* SIZE_MAX > UINT32_MAX */
 }
 
 void test_nghttp3_conn_get_frame_payload_left(void) {
@@ -3677,3 +5293,378 @@ void test_nghttp3_conn_get_frame_payload_left(void) {
   nghttp3_qpack_encoder_free(&qenc);
   nghttp3_conn_del(conn);
 }
+
+void test_nghttp3_conn_read_bidi_frame_split(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  nghttp3_frame fr;
+  uint8_t rawbuf[4096];
+  nghttp3_buf buf;
+  nghttp3_ssize nconsumed;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":path", "/"),
+      MAKE_NV(":authority", "localhost"),
+      MAKE_NV(":method", "POST"),
+      MAKE_NV(":scheme", "https"),
+      MAKE_NV("content-length", "1103"),
+  };
+  nghttp3_qpack_encoder qenc;
+  userdata ud;
+  size_t i, len;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.recv_data = recv_data;
+  callbacks.end_stream = end_stream;
+  nghttp3_settings_default(&settings);
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+  nghttp3_qpack_encoder_init(&qenc, 0, mem);
+
+  fr.hd.type = NGHTTP3_FRAME_HEADERS;
+  fr.headers.nva = (nghttp3_nv *)nva;
+  fr.headers.nvlen = nghttp3_arraylen(nva);
+
+  nghttp3_write_frame_qpack(&buf, &qenc, 0, (nghttp3_frame *)&fr);
+  nghttp3_write_frame_data(&buf, 1000);
+
+  /* Reserved frame type */
+  *buf.last++ = 0x21;
+  *buf.last++ = 0x03;
+  memcpy(buf.last, "foo", 3);
+  buf.last += 3;
+
+  /* DATA frame whose type is not in the shortest form */
+  *buf.last++ = 0x40;
+  *buf.last++ = NGHTTP3_FRAME_DATA;
+  *buf.last++ = 0x03;
+  memcpy(buf.last, "bar", 3);
+  buf.last += 3;
+
+  nghttp3_write_frame_data(&buf, 100);
+
+  len = nghttp3_buf_len(&buf);
+
+  /* Whether a frame header is split across buffers or not, the same
+     frames are delivered. */
+  for (i = 0; i <= len; ++i) {
+    memset(&ud, 0, sizeof(ud));
+    nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+    nghttp3_conn_set_max_client_streams_bidi(conn, 1);
+
+    nconsumed = nghttp3_conn_read_stream(conn, 0, buf.pos, i, /* fin = */ 0);
+
+    CU_ASSERT(nconsumed >= 0);
+
+    nconsumed =
+        nghttp3_conn_read_stream(conn, 0, buf.pos + i, len - i, /* fin = */ 1);
+
+    CU_ASSERT(nconsumed >= 0);
+    CU_ASSERT(1103 == ud.recv_data_cb.datalen);
+    CU_ASSERT(1 == ud.end_stream_cb.ncalled);
+
+    nghttp3_conn_del(conn);
+  }
+
+  nghttp3_qpack_encoder_free(&qenc);
+}
+
+void test_nghttp3_conn_read_streams(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn, *rconn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  nghttp3_frame fr;
+  struct {
+    nghttp3_frame_settings settings;
+    nghttp3_settings_entry iv[1];
+  } sfr;
+  uint8_t ctrlbuf[256], rawbuf[4096];
+  nghttp3_buf cbuf, buf;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":path", "/"),
+      MAKE_NV(":authority", "localhost"),
+      MAKE_NV(":method", "POST"),
+      MAKE_NV(":scheme", "https"),
+      MAKE_NV("content-length", "1000"),
+  };
+  nghttp3_qpack_encoder qenc;
+  nghttp3_stream_data sdata[8];
+  size_t nconsumed[8];
+  nghttp3_ssize rconsumed;
+  userdata ud, rud;
+  size_t i, len;
+  int rv;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.recv_data = recv_data;
+  callbacks.end_stream = end_stream;
+  nghttp3_settings_default(&settings);
+  nghttp3_buf_wrap_init(&cbuf, ctrlbuf, sizeof(ctrlbuf));
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+  nghttp3_qpack_encoder_init(&qenc, 0, mem);
+
+  cbuf.last = nghttp3_put_varint(cbuf.last, NGHTTP3_STREAM_TYPE_CONTROL);
+
+  sfr.settings.hd.type = NGHTTP3_FRAME_SETTINGS;
+  sfr.settings.iv[0].id = NGHTTP3_SETTINGS_ID_MAX_FIELD_SECTION_SIZE;
+  sfr.settings.iv[0].value = 65536;
+  sfr.settings.niv = 1;
+
+  nghttp3_write_frame(&cbuf, (nghttp3_frame *)&sfr);
+
+  fr.hd.type = NGHTTP3_FRAME_HEADERS;
+  fr.headers.nva = (nghttp3_nv *)nva;
+  fr.headers.nvlen = nghttp3_arraylen(nva);
+
+  nghttp3_write_frame_qpack(&buf, &qenc, 0, (nghttp3_frame *)&fr);
+  nghttp3_write_frame_data(&buf, 1000);
+
+  len = nghttp3_buf_len(&buf);
+
+  /* Records of the same stream are consecutive, interleaved, or
+     ignored. */
+  sdata[0] = (nghttp3_stream_data){2, cbuf.pos, nghttp3_buf_len(&cbuf), 0};
+  sdata[1] = (nghttp3_stream_data){0, buf.pos, 3, 0};
+  sdata[2] = (nghttp3_stream_data){0, buf.pos + 3, 7, 0};
+  sdata[3] = (nghttp3_stream_data){4, buf.pos, len / 2, 0};
+  sdata[4] = (nghttp3_stream_data){0, buf.pos + 10, len - 10, 1};
+  sdata[5] = (nghttp3_stream_data){6, NULL, 0, 1};
+  sdata[6] = (nghttp3_stream_data){4, buf.pos + len / 2, 0, 0};
+  sdata[7] = (nghttp3_stream_data){4, buf.pos + len / 2, len - len / 2, 1};
+
+  memset(&ud, 0, sizeof(ud));
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+  nghttp3_conn_set_max_client_streams_bidi(conn, 2);
+
+  memset(&rud, 0, sizeof(rud));
+  nghttp3_conn_server_new(&rconn, &callbacks, &settings, mem, &rud);
+  nghttp3_conn_set_max_client_streams_bidi(rconn, 2);
+
+  rv = nghttp3_conn_read_streams(conn, sdata, nghttp3_arraylen(sdata),
+                                 nconsumed);
+
+  CU_ASSERT(0 == rv);
+
+  for (i = 0; i < nghttp3_arraylen(sdata); ++i) {
+    rconsumed = nghttp3_conn_read_stream(rconn, sdata[i].stream_id,
+                                         sdata[i].data, sdata[i].datalen,
+                                         sdata[i].fin);
+
+    CU_ASSERT(rconsumed >= 0);
+    CU_ASSERT((size_t)rconsumed == nconsumed[i]);
+  }
+
+  CU_ASSERT(2000 == ud.recv_data_cb.datalen);
+  CU_ASSERT(2 == ud.end_stream_cb.ncalled);
+  CU_ASSERT(rud.recv_data_cb.datalen == ud.recv_data_cb.datalen);
+  CU_ASSERT(rud.end_stream_cb.ncalled == ud.end_stream_cb.ncalled);
+  CU_ASSERT(NULL == nghttp3_conn_find_stream(conn, 6));
+
+  nghttp3_conn_del(rconn);
+  nghttp3_conn_del(conn);
+
+  /* Client receives server initiated bidirectional stream.  The
+     records before it have been processed. */
+  memset(&ud, 0, sizeof(ud));
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, &ud);
+
+  sdata[0] = (nghttp3_stream_data){3, cbuf.pos, nghttp3_buf_len(&cbuf), 0};
+  sdata[1] = (nghttp3_stream_data){1, buf.pos, len, 0};
+
+  nconsumed[0] = 0;
+
+  rv = nghttp3_conn_read_streams(conn, sdata, 2, nconsumed);
+
+  CU_ASSERT(NGHTTP3_ERR_H3_STREAM_CREATION_ERROR == rv);
+  CU_ASSERT(nghttp3_buf_len(&cbuf) == nconsumed[0]);
+
+  nghttp3_conn_del(conn);
+  nghttp3_qpack_encoder_free(&qenc);
+}
+
+static void conn_reset_exchange(nghttp3_conn *conn, const nghttp3_buf *cbuf,
+                                const nghttp3_buf *buf) {
+  nghttp3_nv nva[] = {
+      MAKE_NV(":status", "200"),
+      MAKE_NV("x-reset", "0123456789abcdef"),
+  };
+  nghttp3_vec vec[16];
+  int64_t stream_id;
+  int fin;
+  nghttp3_ssize sveccnt, sconsumed;
+  int rv;
+
+  rv = nghttp3_conn_bind_control_stream(conn, 3);
+
+  CU_ASSERT(0 == rv);
+
+  rv = nghttp3_conn_bind_qpack_streams(conn, 7, 11);
+
+  CU_ASSERT(0 == rv);
+
+  nghttp3_conn_set_max_client_streams_bidi(conn, 1);
+
+  nva[1].flags = NGHTTP3_NV_FLAG_TRY_INDEX;
+
+  sconsumed = nghttp3_conn_read_stream(conn, 2, cbuf->pos,
+                                       nghttp3_buf_len(cbuf), 0);
+
+  CU_ASSERT((nghttp3_ssize)nghttp3_buf_len(cbuf) == sconsumed);
+
+  sconsumed = nghttp3_conn_read_stream(conn, 0, buf->pos,
+                                       nghttp3_buf_len(buf), 1);
+
+  CU_ASSERT(sconsumed >= 0);
+
+  rv = nghttp3_conn_submit_response(conn, 0, nva, nghttp3_arraylen(nva),
+                                    NULL);
+
+  CU_ASSERT(0 == rv);
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    CU_ASSERT(sveccnt >= 0);
+
+    if (sveccnt <= 0 && stream_id == -1) {
+      break;
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+        conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    CU_ASSERT(0 == rv);
+  }
+}
+
+void test_nghttp3_conn_reset(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks;
+  nghttp3_settings settings;
+  nghttp3_frame fr;
+  struct {
+    nghttp3_frame_settings settings;
+    nghttp3_settings_entry iv[1];
+  } sfr;
+  uint8_t ctrlbuf[256], rawbuf[4096];
+  nghttp3_buf cbuf, buf;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":path", "/"),
+      MAKE_NV(":authority", "localhost"),
+      MAKE_NV(":method", "POST"),
+      MAKE_NV(":scheme", "https"),
+      MAKE_NV("content-length", "1000"),
+  };
+  nghttp3_qpack_encoder qenc;
+  userdata ud, ud2;
+  int rv;
+
+  memset(&callbacks, 0, sizeof(callbacks));
+  callbacks.recv_data = recv_data;
+  callbacks.end_stream = end_stream;
+  nghttp3_settings_default(&settings);
+  settings.qpack_max_dtable_capacity = 4096;
+  settings.qpack_encoder_max_dtable_capacity = 4096;
+  settings.qpack_blocked_streams = 100;
+  nghttp3_buf_wrap_init(&cbuf, ctrlbuf, sizeof(ctrlbuf));
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+  nghttp3_qpack_encoder_init(&qenc, 0, mem);
+
+  cbuf.last = nghttp3_put_varint(cbuf.last, NGHTTP3_STREAM_TYPE_CONTROL);
+
+  sfr.settings.hd.type = NGHTTP3_FRAME_SETTINGS;
+  sfr.settings.iv[0].id = NGHTTP3_SETTINGS_ID_QPACK_MAX_TABLE_CAPACITY;
+  sfr.settings.iv[0].value = 4096;
+  sfr.settings.niv = 1;
+
+  nghttp3_write_frame(&cbuf, (nghttp3_frame *)&sfr);
+
+  fr.hd.type = NGHTTP3_FRAME_HEADERS;
+  fr.headers.nva = (nghttp3_nv *)nva;
+  fr.headers.nvlen = nghttp3_arraylen(nva);
+
+  nghttp3_write_frame_qpack(&buf, &qenc, 0, (nghttp3_frame *)&fr);
+  nghttp3_write_frame_data(&buf, 1000);
+
+  memset(&ud, 0, sizeof(ud));
+  nghttp3_conn_server_new(&conn, &callbacks, &settings, mem, &ud);
+
+  conn_reset_exchange(conn, &cbuf, &buf);
+
+  CU_ASSERT(1000 == ud.recv_data_cb.datalen);
+  CU_ASSERT(1 == ud.end_stream_cb.ncalled);
+  CU_ASSERT(conn->qenc.ctx.next_absidx > 0);
+
+  /* Client side reset is not allowed for server. */
+  rv = nghttp3_conn_reset_client(conn, &callbacks, &settings, &ud2);
+
+  CU_ASSERT(NGHTTP3_ERR_INVALID_ARGUMENT == rv);
+  CU_ASSERT(&ud == conn->user_data);
+
+  /* Reset with the same QPACK settings reuses QPACK encoder and
+     decoder, and the same stream IDs can be used again. */
+  settings.qpack_indexing_policy = NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY;
+
+  memset(&ud2, 0, sizeof(ud2));
+  rv = nghttp3_conn_reset_server(conn, &callbacks, &settings, &ud2);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(&ud2 == conn->user_data);
+  CU_ASSERT(NULL == nghttp3_conn_find_stream(conn, 0));
+  CU_ASSERT(NULL == nghttp3_conn_find_stream(conn, 3));
+  CU_ASSERT(NULL == conn->tx.ctrl);
+  CU_ASSERT(NGHTTP3_CONN_FLAG_NONE == conn->flags);
+  CU_ASSERT(0 == conn->remote.bidi.max_client_streams);
+  CU_ASSERT(0 == conn->remote.bidi.num_streams);
+  CU_ASSERT(0 == conn->qenc.ctx.next_absidx);
+  CU_ASSERT(0 == conn->qenc.ctx.max_dtable_capacity);
+  CU_ASSERT(0 == nghttp3_map_size(&conn->qenc.streams));
+  CU_ASSERT(NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY ==
+            conn->qenc.indexing_policy);
+  CU_ASSERT(0 == conn->qdec.ctx.next_absidx);
+  CU_ASSERT(100 == conn->qdec.ctx.max_blocked_streams);
+
+  conn_reset_exchange(conn, &cbuf, &buf);
+
+  CU_ASSERT(1000 == ud.recv_data_cb.datalen);
+  CU_ASSERT(1000 == ud2.recv_data_cb.datalen);
+  CU_ASSERT(1 == ud2.end_stream_cb.ncalled);
+
+  /* Reset with the different QPACK settings recreates QPACK encoder
+     and decoder. */
+  settings.qpack_encoder_max_dtable_capacity = 1024;
+  settings.qpack_ring_dtable = 1;
+
+  rv = nghttp3_conn_reset_server(conn, &callbacks, &settings, &ud2);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(1024 == conn->qenc.ctx.hard_max_dtable_capacity);
+  CU_ASSERT(NULL != conn->qenc.ctx.ring.ents);
+  CU_ASSERT(NULL != conn->qdec.ctx.ring.ents);
+
+  conn_reset_exchange(conn, &cbuf, &buf);
+
+  CU_ASSERT(2000 == ud2.recv_data_cb.datalen);
+  CU_ASSERT(2 == ud2.end_stream_cb.ncalled);
+
+  nghttp3_conn_del(conn);
+
+  /* Server side reset is not allowed for client. */
+  nghttp3_conn_client_new(&conn, &callbacks, &settings, mem, &ud);
+
+  rv = nghttp3_conn_reset_server(conn, &callbacks, &settings, &ud2);
+
+  CU_ASSERT(NGHTTP3_ERR_INVALID_ARGUMENT == rv);
+
+  rv = nghttp3_conn_reset_client(conn, &callbacks, &settings, &ud2);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(&ud2 == conn->user_data);
+  CU_ASSERT(0 == conn->local.settings.enable_connect_protocol);
+
+  nghttp3_conn_del(conn);
+  nghttp3_qpack_encoder_free(&qenc);
+}
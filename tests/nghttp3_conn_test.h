@@ -31,6 +31,8 @@
 
 void test_nghttp3_conn_read_control(void);
 void test_nghttp3_conn_write_control(void);
+void test_nghttp3_conn_settings_version(void);
+void test_nghttp3_conn_callbacks_version(void);
 void test_nghttp3_conn_submit_request(void);
 void test_nghttp3_conn_http_request(void);
 void test_nghttp3_conn_http_resp_header(void);
@@ -43,8 +45,16 @@ void test_nghttp3_conn_http_ignore_content_length(void);
 void test_nghttp3_conn_http_record_request_method(void);
 void test_nghttp3_conn_http_error(void);
 void test_nghttp3_conn_qpack_blocked_stream(void);
+void test_nghttp3_conn_qpack_blocked_datalen(void);
+void test_nghttp3_conn_read_stream_ref(void);
+void test_nghttp3_conn_read_data_ref(void);
+void test_nghttp3_conn_submit_response_file(void);
+void test_nghttp3_conn_submit_response_encoded(void);
+void test_nghttp3_conn_eager_header_encoding(void);
 void test_nghttp3_conn_just_fin(void);
 void test_nghttp3_conn_submit_response_read_blocked(void);
+void test_nghttp3_conn_drr_scheduler(void);
+void test_nghttp3_conn_writev_streams(void);
 void test_nghttp3_conn_recv_uni(void);
 void test_nghttp3_conn_recv_goaway(void);
 void test_nghttp3_conn_shutdown_server(void);
@@ -54,6 +64,11 @@ void test_nghttp3_conn_request_priority(void);
 void test_nghttp3_conn_set_stream_priority(void);
 void test_nghttp3_conn_shutdown_stream_read(void);
 void test_nghttp3_conn_stream_data_overflow(void);
+void test_nghttp3_conn_recv_header_section(void);
+void test_nghttp3_conn_get_request_view(void);
 void test_nghttp3_conn_get_frame_payload_left(void);
+void test_nghttp3_conn_read_bidi_frame_split(void);
+void test_nghttp3_conn_read_streams(void);
+void test_nghttp3_conn_reset(void);
 
 #endif /* NGHTTP3_CONN_TEST_H */
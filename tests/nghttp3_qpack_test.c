@@ -187,8 +187,7 @@ void test_nghttp3_qpack_encoder_encode(void) {
   CU_ASSERT(nghttp3_qpack_encoder_stream_is_blocked(&enc, stream));
   CU_ASSERT(1 == nghttp3_qpack_encoder_get_num_blocked_streams(&enc));
 
-  ref =
-      *(nghttp3_qpack_header_block_ref **)nghttp3_ringbuf_get(&stream->refs, 0);
+  ref = stream->refs_head;
 
   CU_ASSERT(5 == ref->max_cnt);
   CU_ASSERT(1 == ref->min_cnt);
@@ -377,14 +376,12 @@ void test_nghttp3_qpack_encoder_still_blocked(void) {
 
   stream = nghttp3_qpack_encoder_find_stream(&enc, 0);
 
-  ref =
-      *(nghttp3_qpack_header_block_ref **)nghttp3_ringbuf_get(&stream->refs, 0);
+  ref = stream->refs_head;
 
-  CU_ASSERT(nghttp3_ringbuf_len(&stream->refs) > 1);
+  CU_ASSERT(NULL != ref->next);
   CU_ASSERT(ref->max_cnt != nghttp3_qpack_stream_get_max_cnt(stream));
 
-  ref =
-      *(nghttp3_qpack_header_block_ref **)nghttp3_ringbuf_get(&stream->refs, 1);
+  ref = ref->next;
 
   CU_ASSERT(ref->max_cnt == nghttp3_qpack_stream_get_max_cnt(stream));
 
@@ -394,10 +391,9 @@ void test_nghttp3_qpack_encoder_still_blocked(void) {
 
   stream = nghttp3_qpack_encoder_find_stream(&enc, 0);
 
-  ref =
-      *(nghttp3_qpack_header_block_ref **)nghttp3_ringbuf_get(&stream->refs, 0);
+  ref = stream->refs_head;
 
-  CU_ASSERT(1 == nghttp3_ringbuf_len(&stream->refs));
+  CU_ASSERT(NULL == ref->next);
   CU_ASSERT(ref->max_cnt == nghttp3_qpack_stream_get_max_cnt(stream));
 
   nghttp3_qpack_encoder_ack_header(&enc, 0);
@@ -650,6 +646,273 @@ void test_nghttp3_qpack_encoder_set_dtable_cap(void) {
   nghttp3_buf_free(&pbuf, mem);
 }
 
+void test_nghttp3_qpack_encoder_dtable_map(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder enc;
+  nghttp3_qpack_decoder dec;
+  nghttp3_buf pbuf, rbuf, ebuf;
+  nghttp3_nv nva[2];
+  uint8_t namebuf[32], valuebuf[32];
+  size_t i, len;
+  nghttp3_qpack_entry *ent;
+  nghttp3_qpack_lookup_result res;
+  int rv;
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+
+  rv = nghttp3_qpack_encoder_init(&enc, 65536, mem);
+
+  CU_ASSERT(0 == rv);
+
+  nghttp3_qpack_encoder_set_max_dtable_capacity(&enc, 65536);
+
+  rv = nghttp3_qpack_decoder_init(&dec, 65536, 0, mem);
+
+  CU_ASSERT(0 == rv);
+
+  /* Many entries share the same name so that they are clustered in
+     the same probe sequence.  The dynamic table wraps around several
+     times, and evicted entries must be removed from the index. */
+  for (i = 0; i < 8192; ++i) {
+    nva[0].name = namebuf;
+    nva[0].namelen =
+        (size_t)snprintf((char *)namebuf, sizeof(namebuf), "x-name-%zu", i % 7);
+    nva[0].value = valuebuf;
+    nva[0].valuelen =
+        (size_t)snprintf((char *)valuebuf, sizeof(valuebuf), "value-%zu", i);
+    nva[0].flags = NGHTTP3_NV_FLAG_TRY_INDEX;
+
+    nva[1] = nva[0];
+    nva[1].valuelen = (size_t)snprintf((char *)valuebuf + 16,
+                                       sizeof(valuebuf) - 16, "%zu", i % 13);
+    nva[1].value = valuebuf + 16;
+
+    rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, nva, 2);
+
+    CU_ASSERT(0 == rv);
+
+    check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 0, nva, 2, mem);
+
+    nghttp3_qpack_encoder_ack_everything(&enc);
+  }
+
+  len = nghttp3_ringbuf_len(&enc.ctx.dtable);
+
+  CU_ASSERT(len > 0);
+  CU_ASSERT(len == enc.dtable_map.nv_table.size);
+  CU_ASSERT(enc.dtable_map.nv_table.size * 4 <=
+            (size_t)enc.dtable_map.nv_table.tablelen * 3);
+  CU_ASSERT(7 == enc.dtable_map.name_table.size);
+
+  for (i = 0; i < len; ++i) {
+    ent = *(nghttp3_qpack_entry **)nghttp3_ringbuf_get(&enc.ctx.dtable, i);
+
+    nva[0].name = ent->nv.name->base;
+    nva[0].namelen = ent->nv.name->len;
+    nva[0].value = ent->nv.value->base;
+    nva[0].valuelen = ent->nv.value->len;
+    nva[0].flags = NGHTTP3_NV_FLAG_TRY_INDEX;
+
+    res = nghttp3_qpack_encoder_lookup_dtable(
+        &enc, &nva[0], ent->nv.token, ent->hash, ent->nvhash,
+        NGHTTP3_QPACK_INDEXING_MODE_STORE, enc.krcnt, 0);
+
+    CU_ASSERT((nghttp3_ssize)ent->absidx <= res.index);
+    CU_ASSERT(res.name_value_match);
+  }
+
+  nghttp3_qpack_decoder_free(&dec);
+  nghttp3_qpack_encoder_free(&enc);
+  nghttp3_buf_free(&ebuf, mem);
+  nghttp3_buf_free(&rbuf, mem);
+  nghttp3_buf_free(&pbuf, mem);
+}
+
+void test_nghttp3_qpack_encoder_indexing_policy_frequency(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder enc;
+  nghttp3_qpack_decoder dec;
+  nghttp3_buf pbuf, rbuf, ebuf;
+  uint8_t largevalue[1400];
+  nghttp3_nv nv;
+  nghttp3_nv custom_nv = MAKE_NV("x-tenant-id", "tenant-0001");
+  nghttp3_nv ua_nv = MAKE_NV("user-agent", "nghttp3");
+  nghttp3_nv try_nv = MAKE_NV("x-try", "index");
+  nghttp3_nv never_nv = MAKE_NV("x-never", "index");
+  size_t i;
+  int rv;
+
+  never_nv.flags = NGHTTP3_NV_FLAG_NEVER_INDEX;
+  try_nv.flags = NGHTTP3_NV_FLAG_TRY_INDEX;
+
+  memset(largevalue, 'a', sizeof(largevalue));
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+
+  rv = nghttp3_qpack_encoder_init(&enc, 4096, mem);
+
+  CU_ASSERT(0 == rv);
+
+  nghttp3_qpack_encoder_set_max_dtable_capacity(&enc, 4096);
+  nghttp3_qpack_encoder_set_indexing_policy(
+      &enc, NGHTTP3_QPACK_INDEXING_POLICY_FREQUENCY);
+
+  rv = nghttp3_qpack_decoder_init(&dec, 4096, 0, mem);
+
+  CU_ASSERT(0 == rv);
+
+  /* A field which is not indexed by default is inserted when it is
+     seen for the second time. */
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, &custom_nv,
+                                    1);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(0 == nghttp3_ringbuf_len(&enc.ctx.dtable));
+
+  check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 0, &custom_nv, 1, mem);
+
+  for (i = 0; i < 3; ++i) {
+    rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, &custom_nv,
+                                      1);
+
+    CU_ASSERT(0 == rv);
+    CU_ASSERT(1 == nghttp3_ringbuf_len(&enc.ctx.dtable));
+
+    check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 0, &custom_nv, 1, mem);
+
+    nghttp3_qpack_encoder_ack_everything(&enc);
+  }
+
+  /* A field which is indexed by default is not inserted when it is
+     seen for the first time. */
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, &ua_nv, 1);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(0 == nghttp3_buf_len(&ebuf));
+  CU_ASSERT(1 == nghttp3_ringbuf_len(&enc.ctx.dtable));
+
+  check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 0, &ua_nv, 1, mem);
+
+  /* NGHTTP3_NV_FLAG_TRY_INDEX inserts a field immediately. */
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, &try_nv, 1);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(2 == nghttp3_ringbuf_len(&enc.ctx.dtable));
+
+  check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 0, &try_nv, 1, mem);
+
+  nghttp3_qpack_encoder_ack_everything(&enc);
+
+  /* NGHTTP3_NV_FLAG_NEVER_INDEX is honored regardless of frequency. */
+  for (i = 0; i < 8; ++i) {
+    rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, &never_nv,
+                                      1);
+
+    CU_ASSERT(0 == rv);
+    CU_ASSERT(0 == nghttp3_buf_len(&ebuf));
+    CU_ASSERT(2 == nghttp3_ringbuf_len(&enc.ctx.dtable));
+
+    check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 0, &never_nv, 1, mem);
+  }
+
+  /* A large field requires more repetitions.  It occupies more than
+     1/4 of the dynamic table, and it must be seen 4 times. */
+  nv.name = (uint8_t *)"x-large";
+  nv.namelen = strlen("x-large");
+  nv.value = largevalue;
+  nv.valuelen = sizeof(largevalue);
+  nv.flags = NGHTTP3_NV_FLAG_NONE;
+
+  for (i = 0; i < 4; ++i) {
+    rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, &nv, 1);
+
+    CU_ASSERT(0 == rv);
+    CU_ASSERT((i < 3 ? 2u : 3u) == nghttp3_ringbuf_len(&enc.ctx.dtable));
+
+    check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 0, &nv, 1, mem);
+
+    nghttp3_qpack_encoder_ack_everything(&enc);
+  }
+
+  nghttp3_qpack_decoder_free(&dec);
+  nghttp3_qpack_encoder_free(&enc);
+  nghttp3_buf_free(&ebuf, mem);
+  nghttp3_buf_free(&rbuf, mem);
+  nghttp3_buf_free(&pbuf, mem);
+}
+
+void test_nghttp3_qpack_stream_refs(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_objalloc stream_objalloc, ref_objalloc;
+  nghttp3_qpack_stream *stream, *stream2;
+  nghttp3_qpack_header_block_ref *ref;
+  const uint64_t max_cnts[] = {5, 3, 7, 7, 2};
+  const uint64_t expected[] = {7, 7, 7, 2, 0};
+  size_t i;
+  int rv;
+
+  nghttp3_objalloc_qpack_stream_init(&stream_objalloc, 4, mem);
+  nghttp3_objalloc_qpack_header_block_ref_init(&ref_objalloc, 4, mem);
+
+  rv = nghttp3_qpack_stream_new(&stream, 0, &stream_objalloc);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(0 == nghttp3_qpack_stream_get_max_cnt(stream));
+
+  for (i = 0; i < nghttp3_arraylen(max_cnts); ++i) {
+    rv = nghttp3_qpack_header_block_ref_new(&ref, max_cnts[i], 1,
+                                            &ref_objalloc);
+
+    CU_ASSERT(0 == rv);
+
+    nghttp3_qpack_stream_add_ref(stream, ref);
+  }
+
+  CU_ASSERT(7 == nghttp3_qpack_stream_get_max_cnt(stream));
+
+  /* Header blocks are removed in the order they are encoded. */
+  for (i = 0; i < nghttp3_arraylen(max_cnts); ++i) {
+    ref = stream->refs_head;
+
+    CU_ASSERT(max_cnts[i] == ref->max_cnt);
+
+    nghttp3_qpack_stream_pop_ref(stream);
+    nghttp3_qpack_header_block_ref_del(ref, &ref_objalloc);
+
+    CU_ASSERT(expected[i] == nghttp3_qpack_stream_get_max_cnt(stream));
+  }
+
+  CU_ASSERT(NULL == stream->refs_head);
+  CU_ASSERT(NULL == stream->refs_tail);
+
+  nghttp3_qpack_stream_del(stream, &stream_objalloc, &ref_objalloc);
+
+  /* The released stream is reused. */
+  rv = nghttp3_qpack_stream_new(&stream2, 4, &stream_objalloc);
+
+  CU_ASSERT(0 == rv);
+#ifndef NOMEMPOOL
+  CU_ASSERT(stream == stream2);
+#endif /* !NOMEMPOOL */
+  CU_ASSERT(4 == stream2->stream_id);
+  CU_ASSERT(NULL == stream2->refs_head);
+
+  rv = nghttp3_qpack_header_block_ref_new(&ref, 9, 1, &ref_objalloc);
+
+  CU_ASSERT(0 == rv);
+
+  nghttp3_qpack_stream_add_ref(stream2, ref);
+
+  nghttp3_qpack_stream_del(stream2, &stream_objalloc, &ref_objalloc);
+
+  nghttp3_objalloc_free(&ref_objalloc);
+  nghttp3_objalloc_free(&stream_objalloc);
+}
+
 void test_nghttp3_qpack_decoder_feedback(void) {
   const nghttp3_mem *mem = nghttp3_mem_default();
   nghttp3_qpack_encoder enc;
@@ -819,6 +1082,580 @@ void test_nghttp3_qpack_decoder_stream_overflow(void) {
   nghttp3_qpack_decoder_free(&dec);
 }
 
+void test_nghttp3_qpack_decoder_borrow_literals(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_decoder dec;
+  nghttp3_qpack_stream_context sctx;
+  nghttp3_qpack_nv qnv;
+  nghttp3_ssize nread;
+  uint8_t flags;
+  /* Literal field line with literal name "x-foo: bar", literal
+     field line with static name reference ":path: /abcd", and
+     literal field line with literal name "x-e" and empty value. */
+  const uint8_t data[] = "\x00\x00"
+                         "\x25x-foo\x03"
+                         "bar"
+                         "\x51\x05/abcd"
+                         "\x23x-e\x00";
+  const size_t datalen = sizeof(data) - 1;
+  const nghttp3_nv nva[] = {
+      MAKE_NV("x-foo", "bar"),
+      MAKE_NV(":path", "/abcd"),
+      MAKE_NV("x-e", ""),
+  };
+  const uint8_t *p, *end = data + datalen;
+  size_t i, len;
+  int borrow;
+
+  /* Entire field section is given at once. */
+  for (borrow = 0; borrow <= 1; ++borrow) {
+    nghttp3_qpack_decoder_init(&dec, 0, 0, mem);
+    nghttp3_qpack_decoder_set_borrow_literals(&dec, borrow);
+    nghttp3_qpack_stream_context_init(&sctx, 0, mem);
+
+    p = data;
+
+    for (i = 0;;) {
+      nread = nghttp3_qpack_decoder_read_request(
+          &dec, &sctx, &qnv, &flags, p, (size_t)(end - p), 1);
+
+      CU_ASSERT(nread >= 0);
+
+      if (nread < 0 || (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL)) {
+        break;
+      }
+
+      CU_ASSERT(flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT);
+      CU_ASSERT(i < nghttp3_arraylen(nva));
+
+      if (i >= nghttp3_arraylen(nva)) {
+        break;
+      }
+
+      CU_ASSERT(nva[i].namelen == qnv.name->len);
+      CU_ASSERT(0 == memcmp(nva[i].name, qnv.name->base, nva[i].namelen));
+      CU_ASSERT(nva[i].valuelen == qnv.value->len);
+      CU_ASSERT(0 == memcmp(nva[i].value, qnv.value->base, nva[i].valuelen));
+      CU_ASSERT(borrow == nghttp3_rcbuf_is_static(qnv.value));
+
+      if (borrow && qnv.value->len) {
+        CU_ASSERT(qnv.value->base >= p);
+        CU_ASSERT(qnv.value->base + qnv.value->len <= p + nread);
+      }
+
+      switch (i) {
+      case 0:
+      case 2:
+        CU_ASSERT(borrow == nghttp3_rcbuf_is_static(qnv.name));
+
+        if (borrow) {
+          CU_ASSERT(qnv.name->base >= p);
+          CU_ASSERT(qnv.name->base + qnv.name->len <= p + nread);
+        }
+
+        break;
+      case 1:
+        CU_ASSERT(nghttp3_rcbuf_is_static(qnv.name));
+        break;
+      }
+
+      nghttp3_rcbuf_decref(qnv.name);
+      nghttp3_rcbuf_decref(qnv.value);
+
+      p += nread;
+      ++i;
+    }
+
+    CU_ASSERT(nghttp3_arraylen(nva) == i);
+    CU_ASSERT(end == p);
+
+    nghttp3_qpack_stream_context_free(&sctx);
+    nghttp3_qpack_decoder_free(&dec);
+  }
+
+  /* Field section is given in small chunks.  Only the literals which
+     fit in a single chunk are borrowed, and the others are copied. */
+  for (len = 1; len <= 4; ++len) {
+    nghttp3_qpack_decoder_init(&dec, 0, 0, mem);
+    nghttp3_qpack_decoder_set_borrow_literals(&dec, 1);
+    nghttp3_qpack_stream_context_init(&sctx, 0, mem);
+
+    p = data;
+
+    for (i = 0;;) {
+      nread = nghttp3_qpack_decoder_read_request(
+          &dec, &sctx, &qnv, &flags, p, nghttp3_min((size_t)(end - p), len),
+          (size_t)(end - p) <= len);
+
+      CU_ASSERT(nread >= 0);
+
+      if (nread < 0) {
+        break;
+      }
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT) {
+        CU_ASSERT(i < nghttp3_arraylen(nva));
+
+        if (i >= nghttp3_arraylen(nva)) {
+          break;
+        }
+
+        CU_ASSERT(nva[i].namelen == qnv.name->len);
+        CU_ASSERT(0 == memcmp(nva[i].name, qnv.name->base, nva[i].namelen));
+        CU_ASSERT(nva[i].valuelen == qnv.value->len);
+        CU_ASSERT(0 ==
+                  memcmp(nva[i].value, qnv.value->base, nva[i].valuelen));
+
+        if (qnv.value->len > len) {
+          CU_ASSERT(!nghttp3_rcbuf_is_static(qnv.value));
+        }
+
+        nghttp3_rcbuf_decref(qnv.name);
+        nghttp3_rcbuf_decref(qnv.value);
+
+        ++i;
+      }
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) {
+        break;
+      }
+
+      p += nread;
+    }
+
+    CU_ASSERT(nghttp3_arraylen(nva) == i);
+    CU_ASSERT(end == p);
+
+    nghttp3_qpack_stream_context_free(&sctx);
+    nghttp3_qpack_decoder_free(&dec);
+  }
+}
+
+void test_nghttp3_qpack_decoder_value_chunk(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder enc;
+  nghttp3_qpack_decoder dec;
+  nghttp3_qpack_stream_context sctx;
+  nghttp3_qpack_nv qnv;
+  nghttp3_buf pbuf, rbuf, ebuf;
+  nghttp3_ssize nread;
+  uint8_t flags;
+  uint8_t cookie[300], token[300], data[1024], value[512];
+  nghttp3_nv nva[] = {
+      MAKE_NV(":path", "/"),
+      MAKE_NV("cookie", ""),
+      MAKE_NV("x-token", ""),
+      MAKE_NV("user-agent", "nghttp3"),
+  };
+  const size_t lens[] = {1, 7, sizeof(data)};
+  const uint8_t *p, *end;
+  size_t i, j, k, datalen, valuelen, nstreamed;
+  int rv;
+
+  /* cookie is Huffman encoded, and token is not. */
+  for (i = 0; i < sizeof(cookie); ++i) {
+    cookie[i] = (uint8_t)('a' + i % 26);
+    token[i] = (uint8_t)(0x80 + i % 0x80);
+  }
+
+  nva[1].value = cookie;
+  nva[1].valuelen = sizeof(cookie);
+  nva[2].value = token;
+  nva[2].valuelen = sizeof(token);
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+
+  nghttp3_qpack_encoder_init(&enc, 0, mem);
+
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, nva,
+                                    nghttp3_arraylen(nva));
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(0 == nghttp3_buf_len(&ebuf));
+
+  datalen = nghttp3_buf_len(&pbuf) + nghttp3_buf_len(&rbuf);
+
+  CU_ASSERT(datalen <= sizeof(data));
+
+  memcpy(data, pbuf.pos, nghttp3_buf_len(&pbuf));
+  memcpy(data + nghttp3_buf_len(&pbuf), rbuf.pos, nghttp3_buf_len(&rbuf));
+
+  end = data + datalen;
+
+  for (k = 0; k < nghttp3_arraylen(lens); ++k) {
+    nghttp3_qpack_decoder_init(&dec, 0, 0, mem);
+    nghttp3_qpack_decoder_set_value_chunk_size(&dec, 64);
+    nghttp3_qpack_stream_context_init(&sctx, 0, mem);
+
+    p = data;
+    valuelen = 0;
+    nstreamed = 0;
+
+    for (i = 0, j = 0; j < 1000; ++j) {
+      nread = nghttp3_qpack_decoder_read_request(
+          &dec, &sctx, &qnv, &flags, p,
+          nghttp3_min((size_t)(end - p), lens[k]),
+          (size_t)(end - p) <= lens[k]);
+
+      CU_ASSERT(nread >= 0);
+
+      if (nread < 0) {
+        break;
+      }
+
+      p += nread;
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) {
+        break;
+      }
+
+      if (i >= nghttp3_arraylen(nva)) {
+        CU_ASSERT(0 == flags);
+        continue;
+      }
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT) {
+        /* The short values are emitted at once. */
+        CU_ASSERT(nva[i].valuelen <= 64);
+        CU_ASSERT(nva[i].namelen == qnv.name->len);
+        CU_ASSERT(0 == memcmp(nva[i].name, qnv.name->base, nva[i].namelen));
+        CU_ASSERT(nva[i].valuelen == qnv.value->len);
+        CU_ASSERT(0 ==
+                  memcmp(nva[i].value, qnv.value->base, nva[i].valuelen));
+
+        nghttp3_rcbuf_decref(qnv.name);
+        nghttp3_rcbuf_decref(qnv.value);
+
+        ++i;
+
+        continue;
+      }
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_VALUE_BEGIN) {
+        CU_ASSERT(nva[i].namelen == qnv.name->len);
+        CU_ASSERT(0 == memcmp(nva[i].name, qnv.name->base, nva[i].namelen));
+        CU_ASSERT(NULL == qnv.value);
+
+        nghttp3_rcbuf_decref(qnv.name);
+
+        valuelen = 0;
+        ++nstreamed;
+      }
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_VALUE_CHUNK) {
+        CU_ASSERT(NULL == qnv.name);
+        CU_ASSERT(nghttp3_rcbuf_is_static(qnv.value));
+        CU_ASSERT(qnv.value->len <= 128);
+        CU_ASSERT(valuelen + qnv.value->len <= sizeof(value));
+
+        if (valuelen + qnv.value->len > sizeof(value)) {
+          break;
+        }
+
+        memcpy(value + valuelen, qnv.value->base, qnv.value->len);
+        valuelen += qnv.value->len;
+      }
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_VALUE_END) {
+        CU_ASSERT(nva[i].valuelen == valuelen);
+        CU_ASSERT(0 == memcmp(nva[i].value, value, valuelen));
+
+        ++i;
+      }
+    }
+
+    CU_ASSERT(nghttp3_arraylen(nva) == i);
+    CU_ASSERT(2 == nstreamed);
+    CU_ASSERT(end == p);
+    /* Huffman decoded fragments are stored in a buffer of fixed
+       size. */
+    CU_ASSERT(128 == (size_t)(sctx.chunkbuf.end - sctx.chunkbuf.begin));
+
+    nghttp3_qpack_stream_context_free(&sctx);
+    nghttp3_qpack_decoder_free(&dec);
+  }
+
+  nghttp3_qpack_encoder_free(&enc);
+  nghttp3_buf_free(&ebuf, mem);
+  nghttp3_buf_free(&rbuf, mem);
+  nghttp3_buf_free(&pbuf, mem);
+}
+
+typedef struct {
+  size_t nalloc;
+} ring_mem_counter;
+
+static void *ring_malloc(size_t size, void *user_data) {
+  ++((ring_mem_counter *)user_data)->nalloc;
+  return malloc(size);
+}
+
+static void ring_free(void *ptr, void *user_data) {
+  (void)user_data;
+  free(ptr);
+}
+
+static void *ring_calloc(size_t nmemb, size_t size, void *user_data) {
+  ++((ring_mem_counter *)user_data)->nalloc;
+  return calloc(nmemb, size);
+}
+
+static void *ring_realloc(void *ptr, size_t size, void *user_data) {
+  ++((ring_mem_counter *)user_data)->nalloc;
+  return realloc(ptr, size);
+}
+
+void test_nghttp3_qpack_ring_dtable(void) {
+  ring_mem_counter counter = {0};
+  const nghttp3_mem cmem = {&counter, ring_malloc, ring_free, ring_calloc,
+                            ring_realloc};
+  const nghttp3_mem *mem = &cmem;
+  nghttp3_qpack_encoder enc;
+  nghttp3_qpack_decoder dec;
+  nghttp3_buf pbuf, rbuf, ebuf, dbuf;
+  uint8_t path[16], value[101];
+  nghttp3_nv nva[] = {
+      MAKE_NV(":method", "GET"),
+      MAKE_NV(":path", ""),
+      MAKE_NV("x-ring", ""),
+      MAKE_NV("user-agent", "nghttp3"),
+      MAKE_NV("accept-language", ""),
+  };
+  size_t i, j;
+  nghttp3_ssize nread;
+  int rv;
+
+  nva[1].flags = NGHTTP3_NV_FLAG_TRY_INDEX;
+  nva[2].flags = NGHTTP3_NV_FLAG_TRY_INDEX;
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+  nghttp3_buf_init(&dbuf);
+
+  nghttp3_buf_reserve(&dbuf, 4096, mem);
+
+  rv = nghttp3_qpack_encoder_init(&enc, 300, mem);
+
+  CU_ASSERT(0 == rv);
+
+  rv = nghttp3_qpack_encoder_enable_ring_dtable(&enc);
+
+  CU_ASSERT(0 == rv);
+
+  nghttp3_qpack_encoder_set_max_blocked_streams(&enc, 1);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(&enc, 300);
+
+  rv = nghttp3_qpack_decoder_init(&dec, 300, 1, mem);
+
+  CU_ASSERT(0 == rv);
+
+  rv = nghttp3_qpack_decoder_enable_ring_dtable(&dec);
+
+  CU_ASSERT(0 == rv);
+
+  for (i = 0; i < 303; ++i) {
+    nva[1].valuelen = (size_t)snprintf((char *)path, sizeof(path), "/%zu",
+                                       i % 7);
+    nva[1].value = path;
+
+    nva[2].valuelen = (i * 37) % 101;
+    for (j = 0; j < nva[2].valuelen; ++j) {
+      value[j] = (uint8_t)('a' + (i + j) % 26);
+    }
+    nva[2].value = value;
+
+    nva[4].value = value;
+    nva[4].valuelen = i % 11;
+
+    rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf,
+                                      (int64_t)(i * 4), nva,
+                                      nghttp3_arraylen(nva));
+
+    CU_ASSERT(0 == rv);
+
+    counter.nalloc = 0;
+
+    nread = nghttp3_qpack_decoder_read_encoder(&dec, ebuf.pos,
+                                               nghttp3_buf_len(&ebuf));
+
+    CU_ASSERT((nghttp3_ssize)nghttp3_buf_len(&ebuf) == nread);
+
+    /* Once the buffers for the literals on encoder stream have grown
+       enough in the first cycle of value lengths, processing encoder
+       stream does not allocate memory. */
+    if (i > 101) {
+      CU_ASSERT(0 == counter.nalloc);
+    }
+
+    nghttp3_buf_reset(&ebuf);
+
+    check_decode_header(&dec, &pbuf, &rbuf, &ebuf, (int64_t)(i * 4), nva,
+                        nghttp3_arraylen(nva), mem);
+
+    nghttp3_buf_reset(&dbuf);
+    nghttp3_qpack_decoder_write_decoder(&dec, &dbuf);
+
+    nread = nghttp3_qpack_encoder_read_decoder(&enc, dbuf.pos,
+                                               nghttp3_buf_len(&dbuf));
+
+    CU_ASSERT((nghttp3_ssize)nghttp3_buf_len(&dbuf) == nread);
+
+    if (nghttp3_qpack_encoder_find_stream(&enc, (int64_t)(i * 4))) {
+      rv = nghttp3_qpack_encoder_ack_header(&enc, (int64_t)(i * 4));
+
+      CU_ASSERT(0 == rv);
+    }
+  }
+
+  /* Dynamic table has been turned over many times. */
+  CU_ASSERT(enc.ctx.next_absidx > 300);
+  CU_ASSERT(enc.ctx.next_absidx == dec.ctx.next_absidx);
+  CU_ASSERT(enc.ctx.dtable_size == dec.ctx.dtable_size);
+
+  /* Ring mode cannot be enabled once entries have been inserted. */
+  nghttp3_qpack_decoder_free(&dec);
+  nghttp3_qpack_decoder_init(&dec, 300, 1, mem);
+
+  /* Set Dynamic Table Capacity 300, and Insert With Name Reference
+     ":authority: foo" */
+  nread = nghttp3_qpack_decoder_read_encoder(
+      &dec, (const uint8_t *)"\x3f\x8d\x02\xc0\x03"
+                             "foo",
+      8);
+
+  CU_ASSERT(8 == nread);
+  CU_ASSERT(NGHTTP3_ERR_INVALID_STATE ==
+            nghttp3_qpack_decoder_enable_ring_dtable(&dec));
+
+  nghttp3_qpack_decoder_free(&dec);
+  nghttp3_qpack_encoder_free(&enc);
+  nghttp3_buf_free(&dbuf, mem);
+  nghttp3_buf_free(&ebuf, mem);
+  nghttp3_buf_free(&rbuf, mem);
+  nghttp3_buf_free(&pbuf, mem);
+}
+
+void test_nghttp3_qpack_stats(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder enc;
+  nghttp3_qpack_decoder dec;
+  nghttp3_qpack_stats enc_stats, dec_stats;
+  nghttp3_buf pbuf, rbuf, ebuf, dbuf;
+  const nghttp3_nv nva[] = {
+      MAKE_NV(":method", "GET"),
+      MAKE_NV(":path", "/index.html"),
+      {(uint8_t *)"x-foo", (uint8_t *)"bar-baz-qux", sizeof("x-foo") - 1,
+       sizeof("bar-baz-qux") - 1, NGHTTP3_NV_FLAG_TRY_INDEX},
+  };
+  size_t encoded_bytes, ebuflen;
+  nghttp3_ssize nread;
+  int rv;
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+  nghttp3_buf_init(&dbuf);
+
+  nghttp3_buf_reserve(&dbuf, 4096, mem);
+
+  nghttp3_qpack_encoder_init(&enc, 4096, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&enc, 1);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(&enc, 4096);
+  nghttp3_qpack_decoder_init(&dec, 4096, 1, mem);
+
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, nva,
+                                    nghttp3_arraylen(nva));
+
+  CU_ASSERT(0 == rv);
+
+  encoded_bytes = nghttp3_buf_len(&pbuf) + nghttp3_buf_len(&rbuf);
+  ebuflen = nghttp3_buf_len(&ebuf);
+
+  check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 0, nva,
+                      nghttp3_arraylen(nva), mem);
+
+  nghttp3_qpack_decoder_write_decoder(&dec, &dbuf);
+
+  nread = nghttp3_qpack_encoder_read_decoder(&enc, dbuf.pos,
+                                             nghttp3_buf_len(&dbuf));
+
+  CU_ASSERT((nghttp3_ssize)nghttp3_buf_len(&dbuf) == nread);
+
+  nghttp3_qpack_encoder_get_stats(&enc, &enc_stats);
+  nghttp3_qpack_decoder_get_stats(&dec, &dec_stats);
+
+#ifdef ENABLE_QPACK_STATS
+  CU_ASSERT(1 == enc_stats.static_indexed);
+  CU_ASSERT(1 == enc_stats.static_name);
+  CU_ASSERT(1 == enc_stats.dynamic_indexed);
+  CU_ASSERT(0 == enc_stats.dynamic_name);
+  CU_ASSERT(0 == enc_stats.literal);
+  CU_ASSERT(1 == enc_stats.inserts);
+  CU_ASSERT(0 == enc_stats.evictions);
+  CU_ASSERT(1 == enc_stats.blocked_sections);
+  CU_ASSERT(ebuflen == enc_stats.encoder_stream_bytes);
+  CU_ASSERT(nghttp3_buf_len(&dbuf) == enc_stats.decoder_stream_bytes);
+  CU_ASSERT(encoded_bytes == enc_stats.encoded_bytes);
+  CU_ASSERT(7 + 3 + 5 + 11 + 5 + 11 == enc_stats.raw_bytes);
+  CU_ASSERT(enc_stats.huffman_saved > 0);
+
+  /* The decoder has read the encoder stream before the field section,
+     so it was not blocked. */
+  CU_ASSERT(enc_stats.static_indexed == dec_stats.static_indexed);
+  CU_ASSERT(enc_stats.static_name == dec_stats.static_name);
+  CU_ASSERT(enc_stats.dynamic_indexed == dec_stats.dynamic_indexed);
+  CU_ASSERT(enc_stats.inserts == dec_stats.inserts);
+  CU_ASSERT(0 == dec_stats.blocked_sections);
+  CU_ASSERT(enc_stats.encoder_stream_bytes == dec_stats.encoder_stream_bytes);
+  CU_ASSERT(enc_stats.decoder_stream_bytes == dec_stats.decoder_stream_bytes);
+  CU_ASSERT(enc_stats.encoded_bytes == dec_stats.encoded_bytes);
+  CU_ASSERT(enc_stats.raw_bytes == dec_stats.raw_bytes);
+  CU_ASSERT(enc_stats.huffman_saved == dec_stats.huffman_saved);
+#else  /* !ENABLE_QPACK_STATS */
+  (void)encoded_bytes;
+  (void)ebuflen;
+
+  CU_ASSERT(0 == enc_stats.inserts);
+  CU_ASSERT(0 == enc_stats.raw_bytes);
+  CU_ASSERT(0 == dec_stats.inserts);
+  CU_ASSERT(0 == dec_stats.raw_bytes);
+#endif /* !ENABLE_QPACK_STATS */
+
+  /* Shrinking the dynamic table evicts the acknowledged entry on both
+     sides. */
+  nghttp3_qpack_encoder_ack_everything(&enc);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(&enc, 0);
+
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 4, nva, 1);
+
+  CU_ASSERT(0 == rv);
+
+  check_decode_header(&dec, &pbuf, &rbuf, &ebuf, 4, nva, 1, mem);
+
+  nghttp3_qpack_encoder_get_stats(&enc, &enc_stats);
+  nghttp3_qpack_decoder_get_stats(&dec, &dec_stats);
+
+#ifdef ENABLE_QPACK_STATS
+  CU_ASSERT(1 == enc_stats.evictions);
+  CU_ASSERT(1 == dec_stats.evictions);
+  CU_ASSERT(2 == enc_stats.static_indexed);
+  CU_ASSERT(2 == dec_stats.static_indexed);
+#else  /* !ENABLE_QPACK_STATS */
+  CU_ASSERT(0 == enc_stats.evictions);
+  CU_ASSERT(0 == dec_stats.evictions);
+#endif /* !ENABLE_QPACK_STATS */
+
+  nghttp3_qpack_decoder_free(&dec);
+  nghttp3_qpack_encoder_free(&enc);
+  nghttp3_buf_free(&dbuf, mem);
+  nghttp3_buf_free(&ebuf, mem);
+  nghttp3_buf_free(&rbuf, mem);
+  nghttp3_buf_free(&pbuf, mem);
+}
+
 void test_nghttp3_qpack_huffman(void) {
   size_t i, j;
   uint8_t raw[100], ebuf[4096], dbuf[4096];
@@ -846,6 +1683,141 @@ void test_nghttp3_qpack_huffman(void) {
   }
 }
 
+void test_nghttp3_qpack_huffman_encode_bounded(void) {
+  size_t i, j, len;
+  uint8_t raw[100], ebuf[4096], bbuf[4096];
+  uint8_t *end, *bend;
+  const uint8_t text[] = "text/html; charset=utf-8";
+  uint8_t binary[64];
+
+  srand(1000000007);
+
+  for (i = 0; i < 10000; ++i) {
+    len = (size_t)(rand() % (int)sizeof(raw));
+    for (j = 0; j < len; ++j) {
+      raw[j] = (uint8_t)((double)rand() / RAND_MAX * 255);
+    }
+
+    end = nghttp3_qpack_huffman_encode(ebuf, raw, len);
+    bend =
+        nghttp3_qpack_huffman_encode_bounded(bbuf, sizeof(bbuf), raw, len, 0);
+
+    CU_ASSERT(end - ebuf == bend - bbuf);
+    CU_ASSERT(0 == memcmp(ebuf, bbuf, (size_t)(end - ebuf)));
+
+    if (end == ebuf) {
+      continue;
+    }
+
+    /* One byte short */
+    bend = nghttp3_qpack_huffman_encode_bounded(
+        bbuf, (size_t)(end - ebuf) - 1, raw, len, 0);
+
+    CU_ASSERT(NULL == bend);
+  }
+
+  /* Text shrinks, and early abort does not fire. */
+  bend = nghttp3_qpack_huffman_encode_bounded(bbuf, sizeof(text) - 2, text,
+                                              sizeof(text) - 1, 1);
+
+  CU_ASSERT(NULL != bend);
+
+  /* Bytes which are not printable expand, and early abort fires even
+     if the output buffer is large enough. */
+  for (i = 0; i < sizeof(binary); ++i) {
+    binary[i] = (uint8_t)(0x80 + i);
+  }
+
+  bend = nghttp3_qpack_huffman_encode_bounded(bbuf, sizeof(bbuf), binary,
+                                              sizeof(binary), 0);
+
+  CU_ASSERT(NULL != bend);
+  CU_ASSERT((size_t)(bend - bbuf) > sizeof(binary));
+
+  bend = nghttp3_qpack_huffman_encode_bounded(bbuf, sizeof(bbuf), binary,
+                                              sizeof(binary), 1);
+
+  CU_ASSERT(NULL == bend);
+}
+
+void test_nghttp3_qpack_huffman_decode_chunk(void) {
+  size_t i, j, len, chunklen;
+  uint8_t raw[100], ebuf[4096], dbuf[4096];
+  uint8_t *end, *p;
+  const uint8_t *src;
+  nghttp3_qpack_huffman_decode_context ctx;
+  nghttp3_ssize nwrite;
+  /* "a" followed by 3 bits padding */
+  const uint8_t valid[] = {0x1f};
+  /* "a" followed by 3 bits padding and the extra padding byte */
+  const uint8_t long_padding[] = {0x1f, 0xff};
+  /* "a" followed by the padding which is not EOS prefix */
+  const uint8_t bad_padding[] = {0x18};
+
+  srand(1000000007);
+
+  for (i = 0; i < 10000; ++i) {
+    for (j = 0; j < sizeof(raw); ++j) {
+      raw[j] = (uint8_t)((double)rand() / RAND_MAX * 255);
+    }
+    end = nghttp3_qpack_huffman_encode(ebuf, raw, sizeof(raw));
+
+    nghttp3_qpack_huffman_decode_context_init(&ctx);
+
+    src = ebuf;
+    p = dbuf;
+    len = (size_t)(end - ebuf);
+
+    for (; len;) {
+      chunklen = (size_t)(rand() % 11) + 1;
+      chunklen = nghttp3_min(chunklen, len);
+      nwrite = nghttp3_qpack_huffman_decode(&ctx, p, src, chunklen,
+                                            chunklen == len);
+
+      CU_ASSERT(nwrite >= 0);
+
+      if (nwrite < 0) {
+        break;
+      }
+
+      p += nwrite;
+      src += chunklen;
+      len -= chunklen;
+    }
+
+    CU_ASSERT(sizeof(raw) == (size_t)(p - dbuf));
+    CU_ASSERT(0 == memcmp(raw, dbuf, sizeof(raw)));
+  }
+
+  nghttp3_qpack_huffman_decode_context_init(&ctx);
+  nwrite = nghttp3_qpack_huffman_decode(&ctx, dbuf, valid, sizeof(valid), 1);
+
+  CU_ASSERT(1 == nwrite);
+  CU_ASSERT('a' == dbuf[0]);
+
+  nghttp3_qpack_huffman_decode_context_init(&ctx);
+  nwrite = nghttp3_qpack_huffman_decode(&ctx, dbuf, long_padding,
+                                        sizeof(long_padding), 1);
+
+  CU_ASSERT(NGHTTP3_ERR_QPACK_FATAL == nwrite);
+
+  nghttp3_qpack_huffman_decode_context_init(&ctx);
+  nwrite = nghttp3_qpack_huffman_decode(&ctx, dbuf, bad_padding,
+                                        sizeof(bad_padding), 1);
+
+  CU_ASSERT(NGHTTP3_ERR_QPACK_FATAL == nwrite);
+
+  /* Padding can be given in a separate chunk. */
+  nghttp3_qpack_huffman_decode_context_init(&ctx);
+  nwrite = nghttp3_qpack_huffman_decode(&ctx, dbuf, valid, sizeof(valid), 0);
+
+  CU_ASSERT(1 == nwrite);
+
+  nwrite = nghttp3_qpack_huffman_decode(&ctx, dbuf, NULL, 0, 1);
+
+  CU_ASSERT(0 == nwrite);
+}
+
 void test_nghttp3_qpack_huffman_decode_failure_state(void) {
   nghttp3_qpack_huffman_decode_context ctx;
   const uint8_t data[] = {0xff, 0xff, 0xff, 0xff};
@@ -33,9 +33,18 @@ void test_nghttp3_qpack_encoder_encode(void);
 void test_nghttp3_qpack_encoder_encode_try_encode(void);
 void test_nghttp3_qpack_encoder_still_blocked(void);
 void test_nghttp3_qpack_encoder_set_dtable_cap(void);
+void test_nghttp3_qpack_encoder_dtable_map(void);
+void test_nghttp3_qpack_encoder_indexing_policy_frequency(void);
+void test_nghttp3_qpack_stream_refs(void);
 void test_nghttp3_qpack_decoder_feedback(void);
 void test_nghttp3_qpack_decoder_stream_overflow(void);
+void test_nghttp3_qpack_decoder_borrow_literals(void);
+void test_nghttp3_qpack_decoder_value_chunk(void);
+void test_nghttp3_qpack_ring_dtable(void);
+void test_nghttp3_qpack_stats(void);
 void test_nghttp3_qpack_huffman(void);
+void test_nghttp3_qpack_huffman_encode_bounded(void);
+void test_nghttp3_qpack_huffman_decode_chunk(void);
 void test_nghttp3_qpack_huffman_decode_failure_state(void);
 void test_nghttp3_qpack_decoder_reconstruct_ricnt(void);
 
@@ -0,0 +1,146 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2024 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "nghttp3_stmap_test.h"
+
+#include <stdio.h>
+
+#include <CUnit/CUnit.h>
+
+#include "nghttp3_stmap.h"
+#include "nghttp3_macro.h"
+#include "nghttp3_test_helper.h"
+
+static int count_free(void *data, void *ptr) {
+  (void)data;
+
+  ++*(size_t *)ptr;
+
+  return 0;
+}
+
+void test_nghttp3_stmap(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_stmap stmap;
+  int data[4];
+  int64_t i, far;
+  size_t nfree = 0;
+  int rv;
+
+  nghttp3_stmap_init(&stmap, mem);
+
+  /* Open and close streams one after another.  The window slides,
+     and never grows. */
+  for (i = 0; i < 1000; ++i) {
+    rv = nghttp3_stmap_insert(&stmap, i * 4, &data[0]);
+
+    CU_ASSERT(0 == rv);
+    CU_ASSERT(&data[0] == nghttp3_stmap_find(&stmap, i * 4));
+
+    if (i >= 8) {
+      rv = nghttp3_stmap_remove(&stmap, (i - 8) * 4);
+
+      CU_ASSERT(0 == rv);
+      CU_ASSERT(NULL == nghttp3_stmap_find(&stmap, (i - 8) * 4));
+    }
+  }
+
+  CU_ASSERT(8 == nghttp3_stmap_size(&stmap));
+  CU_ASSERT(NGHTTP3_STMAP_INITIAL_SLOTSLEN == stmap.win[0].slotslen);
+  CU_ASSERT(0 == nghttp3_map_size(&stmap.outliers));
+
+  /* Duplicate */
+  CU_ASSERT(NGHTTP3_ERR_INVALID_ARGUMENT ==
+            nghttp3_stmap_insert(&stmap, 999 * 4, &data[0]));
+
+  /* Stream IDs of the other types do not interfere. */
+  rv = nghttp3_stmap_insert(&stmap, 3, &data[1]);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(&data[1] == nghttp3_stmap_find(&stmap, 3));
+  CU_ASSERT(NULL == nghttp3_stmap_find(&stmap, 0));
+  CU_ASSERT(NULL == nghttp3_stmap_find(&stmap, 7));
+
+  /* The window grows while the oldest stream is open. */
+  for (i = 1000; i < 1100; ++i) {
+    rv = nghttp3_stmap_insert(&stmap, i * 4, &data[0]);
+
+    CU_ASSERT(0 == rv);
+  }
+
+  CU_ASSERT(stmap.win[0].slotslen > NGHTTP3_STMAP_INITIAL_SLOTSLEN);
+  CU_ASSERT(0 == nghttp3_map_size(&stmap.outliers));
+
+  for (i = 992; i < 1100; ++i) {
+    CU_ASSERT(&data[0] == nghttp3_stmap_find(&stmap, i * 4));
+  }
+
+  /* A stream too far ahead of the window goes to the fallback
+     map. */
+  far = (992 + NGHTTP3_STMAP_MAX_SLOTSLEN) * 4;
+
+  rv = nghttp3_stmap_insert(&stmap, far, &data[2]);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(1 == nghttp3_map_size(&stmap.outliers));
+  CU_ASSERT(&data[2] == nghttp3_stmap_find(&stmap, far));
+
+  /* Once the old streams are closed, the window slides past the
+     outlier which is still found, and cannot be inserted again. */
+  for (i = 992; i < 1100; ++i) {
+    rv = nghttp3_stmap_remove(&stmap, i * 4);
+
+    CU_ASSERT(0 == rv);
+  }
+
+  rv = nghttp3_stmap_insert(&stmap, far - 4, &data[3]);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(stmap.win[0].base <= (uint64_t)far >> 2);
+  CU_ASSERT(&data[2] == nghttp3_stmap_find(&stmap, far));
+  CU_ASSERT(&data[3] == nghttp3_stmap_find(&stmap, far - 4));
+  CU_ASSERT(NGHTTP3_ERR_INVALID_ARGUMENT ==
+            nghttp3_stmap_insert(&stmap, far, &data[2]));
+
+  /* A stream preceding the window goes to the fallback map. */
+  rv = nghttp3_stmap_insert(&stmap, 0, &data[1]);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(&data[1] == nghttp3_stmap_find(&stmap, 0));
+  CU_ASSERT(2 == nghttp3_map_size(&stmap.outliers));
+  CU_ASSERT(4 == nghttp3_stmap_size(&stmap));
+
+  rv = nghttp3_stmap_remove(&stmap, far);
+
+  CU_ASSERT(0 == rv);
+  CU_ASSERT(NULL == nghttp3_stmap_find(&stmap, far));
+  CU_ASSERT(NGHTTP3_ERR_INVALID_ARGUMENT ==
+            nghttp3_stmap_remove(&stmap, far));
+
+  nghttp3_stmap_each_free(&stmap, count_free, &nfree);
+
+  CU_ASSERT(3 == nfree);
+
+  nghttp3_stmap_free(&stmap);
+}
@@ -166,3 +166,78 @@ void test_nghttp3_tnode_schedule(void) {
 
   nghttp3_pq_free(&pq);
 }
+
+void test_nghttp3_tnode_drr_schedule(void) {
+  nghttp3_tnode node, node2, node3;
+  nghttp3_tnode_queue queue;
+
+  /* Incremental nodes take turns once they use up the quantum */
+  nghttp3_tnode_queue_init(&queue);
+
+  nghttp3_tnode_init(&node, 0);
+  node.pri.inc = 1;
+  nghttp3_tnode_init(&node2, 4);
+  node2.pri.inc = 1;
+  nghttp3_tnode_init(&node3, 8);
+  node3.pri.inc = 1;
+
+  nghttp3_tnode_drr_schedule(&node, &queue, 0);
+  nghttp3_tnode_drr_schedule(&node2, &queue, 0);
+  nghttp3_tnode_drr_schedule(&node3, &queue, 0);
+
+  CU_ASSERT(nghttp3_tnode_is_scheduled(&node));
+  CU_ASSERT(&node == queue.head);
+  CU_ASSERT(&node3 == queue.tail);
+
+  nghttp3_tnode_drr_schedule(&node, &queue, 100);
+
+  CU_ASSERT(&node == queue.head);
+
+  nghttp3_tnode_drr_schedule(&node, &queue, 1000);
+
+  CU_ASSERT(&node2 == queue.head);
+  CU_ASSERT(&node == queue.tail);
+  CU_ASSERT(&node3 == node.queue_prev);
+
+  /* Writing nothing does not move the node */
+  nghttp3_tnode_drr_schedule(&node2, &queue, 0);
+
+  CU_ASSERT(&node2 == queue.head);
+
+  /* Removing a node in the middle */
+  nghttp3_tnode_drr_unschedule(&node3);
+
+  CU_ASSERT(!nghttp3_tnode_is_scheduled(&node3));
+  CU_ASSERT(&node2 == queue.head);
+  CU_ASSERT(&node == queue.tail);
+  CU_ASSERT(&node == node2.queue_next);
+  CU_ASSERT(&node2 == node.queue_prev);
+
+  nghttp3_tnode_drr_unschedule(&node3);
+  nghttp3_tnode_drr_unschedule(&node2);
+  nghttp3_tnode_drr_unschedule(&node);
+
+  CU_ASSERT(NULL == queue.head);
+  CU_ASSERT(NULL == queue.tail);
+
+  /* Non-incremental node keeps its position */
+  nghttp3_tnode_queue_init(&queue);
+
+  nghttp3_tnode_init(&node, 0);
+  nghttp3_tnode_init(&node2, 4);
+
+  nghttp3_tnode_drr_schedule(&node, &queue, 0);
+  nghttp3_tnode_drr_schedule(&node2, &queue, 0);
+  nghttp3_tnode_drr_schedule(&node, &queue, 1000000);
+
+  CU_ASSERT(&node == queue.head);
+  CU_ASSERT(&node2 == queue.tail);
+
+  nghttp3_tnode_drr_unschedule(&node);
+
+  CU_ASSERT(&node2 == queue.head);
+  CU_ASSERT(&node2 == queue.tail);
+  CU_ASSERT(NULL == node2.queue_prev);
+
+  nghttp3_tnode_drr_unschedule(&node2);
+}
@@ -30,5 +30,6 @@
 #endif /* HAVE_CONFIG_H */
 
 void test_nghttp3_tnode_schedule(void);
+void test_nghttp3_tnode_drr_schedule(void);
 
 #endif /* NGHTTP3_TNODE_TEST_H */